@@ -27,29 +27,491 @@
 
 #include "argument_model.hpp"
 #include "clients_common.hpp"
+#include "d_vector.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_datatype2string.hpp"
 #include "hipblas_parse_data.hpp"
 #include "hipblas_test.hpp"
+#include "host_alloc.hpp"
 #include "test_cleanup.hpp"
 #include "type_dispatch.hpp"
 #include "utility.h"
 
 #include <algorithm>
 #include <cctype>
+#include <cmath>
+#include <condition_variable>
 #include <cstdio>
 #include <cstring>
 #include <iostream>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
 #include <stdexcept>
 #include <string>
 #include <thread>
 #include <type_traits>
+#include <vector>
 
 using namespace roc; // For emulated program_options
 
-int hipblas_bench_datafile()
+// hipDataType of a datatype of the arguments, which is one already with HIPBLAS_V2
+hipDataType hipblas_bench_hip_datatype(hipblasDatatype_t type)
 {
+#ifdef HIPBLAS_V2
+    return type;
+#else
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return HIP_R_16F;
+    case HIPBLAS_R_32F:
+        return HIP_R_32F;
+    case HIPBLAS_R_64F:
+        return HIP_R_64F;
+    case HIPBLAS_C_16F:
+        return HIP_C_16F;
+    case HIPBLAS_C_32F:
+        return HIP_C_32F;
+    case HIPBLAS_C_64F:
+        return HIP_C_64F;
+    case HIPBLAS_R_8I:
+        return HIP_R_8I;
+    case HIPBLAS_R_8U:
+        return HIP_R_8U;
+    case HIPBLAS_R_32I:
+        return HIP_R_32I;
+    case HIPBLAS_R_32U:
+        return HIP_R_32U;
+    case HIPBLAS_C_8I:
+        return HIP_C_8I;
+    case HIPBLAS_C_8U:
+        return HIP_C_8U;
+    case HIPBLAS_C_32I:
+        return HIP_C_32I;
+    case HIPBLAS_C_32U:
+        return HIP_C_32U;
+    case HIPBLAS_R_16B:
+        return HIP_R_16BF;
+    case HIPBLAS_C_16B:
+        return HIP_C_16BF;
+    default:
+        // hipblasWarmup reports the problem as not supported
+        return hipDataType(-1);
+    }
+#endif
+}
+
+// Compute type of a gemm computed in the given datatype
+hipblasComputeType_t hipblas_bench_computetype(hipblasDatatype_t type)
+{
+    switch(hipblas_bench_hip_datatype(type))
+    {
+    case HIP_R_16F:
+        return HIPBLAS_COMPUTE_16F;
+    case HIP_R_64F:
+    case HIP_C_64F:
+        return HIPBLAS_COMPUTE_64F;
+    case HIP_R_32I:
+        return HIPBLAS_COMPUTE_32I;
+    default:
+        return HIPBLAS_COMPUTE_32F;
+    }
+}
+
+// Loads and initializes the kernels of the gemm problems of args with hipblasWarmup, so the cold
+// calls of the benchmark don't include the first call of the process. Other functions are skipped.
+void hipblas_bench_warmup(const std::vector<Arguments>& args)
+{
+    std::vector<hipblasWarmupDescriptor_t> descriptors;
+    std::vector<const Arguments*>          problems;
+    for(const Arguments& arg : args)
+    {
+        std::string function = arg.function;
+        bool        ex       = function == "gemm_ex" || function == "gemm_strided_batched_ex";
+
+        hipblasWarmupDescriptor_t desc{};
+        if(function == "gemm" || function == "gemm_ex")
+            desc.routine = HIPBLAS_WARMUP_GEMM;
+        else if(function == "gemm_strided_batched" || function == "gemm_strided_batched_ex")
+            desc.routine = HIPBLAS_WARMUP_GEMM_STRIDED_BATCHED;
+        else
+            continue;
+
+        desc.transA     = char2hipblas_operation(arg.transA);
+        desc.transB     = char2hipblas_operation(arg.transB);
+        desc.m          = arg.M;
+        desc.n          = arg.N;
+        desc.k          = arg.K;
+        desc.batchCount = arg.batch_count;
+        desc.aType      = hipblas_bench_hip_datatype(arg.a_type);
+        desc.bType      = hipblas_bench_hip_datatype(ex ? arg.b_type : arg.a_type);
+        desc.cType      = hipblas_bench_hip_datatype(ex ? arg.c_type : arg.a_type);
+#ifdef HIPBLAS_V2
+        desc.computeType = ex ? arg.compute_type_gemm : hipblas_bench_computetype(arg.a_type);
+#else
+        desc.computeType = hipblas_bench_computetype(ex ? arg.compute_type : arg.a_type);
+#endif
+        descriptors.push_back(desc);
+        problems.push_back(&arg);
+    }
+
+    if(descriptors.empty())
+        return;
+
+    hipblasLocalHandle handle(args.front());
+    hipblasStatus_t    status = hipblasWarmup(handle, descriptors.data(), int(descriptors.size()));
+    if(status == HIPBLAS_STATUS_NOT_SUPPORTED)
+    {
+        std::cout << "hipblasWarmup is not supported, continuing without warm-up" << std::endl;
+        return;
+    }
+
+    std::cout << "warmup,function,transA,transB,M,N,K,batch_count,status,us" << std::endl;
+    for(size_t i = 0; i < descriptors.size(); i++)
+    {
+        const Arguments& arg = *problems[i];
+        std::cout << "warmup," << arg.function << ',' << arg.transA << ',' << arg.transB << ','
+                  << arg.M << ',' << arg.N << ',' << arg.K << ',' << arg.batch_count << ','
+                  << hipblasStatusToString(descriptors[i].status) << ','
+                  << descriptors[i].time_us << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+// Threads which start the hot calls of their timing loops together. A thread which returns
+// without a timing loop leaves instead, so that the others don't wait for it
+class hipblas_bench_barrier
+{
+    std::mutex              m_mutex;
+    std::condition_variable m_cv;
+    int                     m_count;
+
+public:
+    explicit hipblas_bench_barrier(int count)
+        : m_count(count)
+    {
+    }
+
+    void arrive()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if(--m_count == 0)
+            m_cv.notify_all();
+        else
+            m_cv.wait(lock, [this] { return m_count == 0; });
+    }
+
+    void leave()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(--m_count == 0)
+            m_cv.notify_all();
+    }
+};
+
+struct hipblas_bench_thread_result
+{
+    int                  ret      = 0;
+    bool                 timed    = false;
+    double               start_us = 0.0;
+    int                  calls    = 0;
+    ArgumentModel_result result;
+    std::vector<double>  submission_us;
+};
+
+// Runs arg on stream with buffers of its own, and a handle of its own unless handle is not
+// nullptr, capturing its results instead of printing them. With a barrier, the hot calls start
+// together with those of the other threads
+void thread_run_bench_captured(int                          device,
+                               hipblasHandle_t              handle,
+                               hipStream_t                  stream,
+                               const Arguments&             arg,
+                               hipblas_bench_barrier*       barrier,
+                               bool                         time_submission,
+                               hipblas_bench_thread_result& result)
+{
+    CHECK_HIP_ERROR(hipSetDevice(device));
+    hipblas_client_set_handle(handle);
+    hipblas_client_set_stream(stream);
+    hipblas_set_time_submission(time_submission);
+    ArgumentModel_set_capture_results(true);
+
+    bool arrived = false;
+    if(barrier)
+        hipblas_set_timing_start_hook([&] {
+            arrived = true;
+            barrier->arrive();
+        });
+
+    Arguments a(arg);
+    result.ret = run_bench_test(a, 0, 1);
+
+    if(barrier && !arrived)
+    {
+        hipblas_set_timing_start_hook(nullptr);
+        barrier->leave();
+    }
+
+    std::vector<ArgumentModel_result> results = ArgumentModel_take_results();
+    if(!results.empty() && results.back().perf.us != ArgumentLogging::NA_value)
+    {
+        result.timed    = true;
+        result.start_us = hipblas_last_timing_start_us();
+        result.calls    = arg.iters < 1 ? 1 : arg.iters;
+        result.result   = results.back();
+        hipblas_take_submission_times(result.submission_us);
+    }
+
+    ArgumentModel_set_capture_results(false);
+    hipblas_set_time_submission(false);
+    hipblas_client_set_stream(nullptr);
+    hipblas_client_set_handle(nullptr);
+}
+
+// Runs the cases of args on streams of the current device, each stream with a handle and buffers
+// of its own. Stream s of group g runs args[(g * streams + s) % args.size()], so one case is run
+// by every stream, and a list of cases is run as mixed groups. Each group is run on one stream
+// after the other first, then on all streams at once, and the aggregate throughput and the
+// speedup of the concurrent run over the serial one are reported.
+int hipblas_bench_streams(const std::vector<Arguments>& args, int streams)
+{
+    if(streams < 1 || args.empty())
+        throw std::invalid_argument("Invalid value for --streams " + std::to_string(streams));
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    std::vector<hipStream_t> stream(streams);
+    for(hipStream_t& s : stream)
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&s, hipStreamNonBlocking));
+
+    size_t groups = (args.size() + streams - 1) / streams;
+    int    ret    = 0;
+    for(size_t g = 0; g < groups; g++)
+    {
+        std::vector<const Arguments*> cases(streams);
+        for(int s = 0; s < streams; s++)
+            cases[s] = &args[(g * streams + s) % args.size()];
+
+        // serial baseline, one stream after the other
+        std::vector<hipblas_bench_thread_result> serial(streams);
+        for(int s = 0; s < streams; s++)
+        {
+            std::thread thread(::thread_run_bench_captured,
+                               device,
+                               nullptr,
+                               stream[s],
+                               *cases[s],
+                               nullptr,
+                               false,
+                               std::ref(serial[s]));
+            thread.join();
+            ret |= serial[s].ret;
+        }
+
+        // concurrent run
+        std::vector<hipblas_bench_thread_result> concurrent(streams);
+        hipblas_bench_barrier                    barrier(streams);
+        std::vector<std::thread>                 threads;
+        for(int s = 0; s < streams; s++)
+            threads.emplace_back(::thread_run_bench_captured,
+                                 device,
+                                 nullptr,
+                                 stream[s],
+                                 *cases[s],
+                                 &barrier,
+                                 false,
+                                 std::ref(concurrent[s]));
+        for(std::thread& thread : threads)
+            thread.join();
+
+        double serial_us = 0.0, gflop = 0.0, start_us = 0.0, end_us = 0.0;
+        bool   timed = false, has_gflops = false;
+        for(int s = 0; s < streams; s++)
+        {
+            ret |= concurrent[s].ret;
+            if(serial[s].timed)
+                serial_us += serial[s].result.perf.us * serial[s].calls;
+
+            const hipblas_bench_thread_result& r = concurrent[s];
+            if(!r.timed)
+                continue;
+
+            std::cout << "stream," << r.result.names << "\n"
+                      << s << ", " << r.result.values << std::endl;
+
+            double stream_end_us = r.start_us + r.result.perf.us * r.calls;
+            start_us             = timed ? std::min(start_us, r.start_us) : r.start_us;
+            end_us               = timed ? std::max(end_us, stream_end_us) : stream_end_us;
+            timed                = true;
+
+            // the Gflop/s of a stream is its Gflop over its time
+            if(r.result.perf.gflops != ArgumentLogging::NA_value)
+            {
+                gflop += r.result.perf.gflops * r.result.perf.us * r.calls * 1e-6;
+                has_gflops = true;
+            }
+        }
+
+        if(!timed)
+            continue;
+
+        double wall_us = end_us - start_us;
+        std::cout << "streams,serial-us,concurrent-us,aggregate-Gflops,speedup\n"
+                  << streams << ", " << serial_us << ", " << wall_us << ", "
+                  << (has_gflops ? gflop / wall_us * 1e6 : ArgumentLogging::NA_value) << ", "
+                  << serial_us / wall_us << "\n"
+                  << std::endl;
+    }
+
+    for(hipStream_t& s : stream)
+        CHECK_HIP_ERROR(hipStreamDestroy(s));
+
+    test_cleanup::cleanup();
+    return ret;
+}
+
+// The value of sorted at percentile p, by the nearest rank
+double hipblas_bench_percentile(const std::vector<double>& sorted, double p)
+{
+    size_t rank = size_t(std::ceil(p * sorted.size()));
+    return sorted[rank ? rank - 1 : 0];
+}
+
+// Submits the calls of each case of args from threads host threads at once, each with its own
+// buffers. The threads share one handle and its stream with thread_handle "shared", have a handle
+// and stream each with "per_thread", or a handle each on one stream with
+// "per_thread_shared_stream". The aggregate call rate, the host time taken to submit each call
+// and the device throughput are reported, to expose contention between the threads in the
+// handle and backend layers.
+int hipblas_bench_threads(const std::vector<Arguments>& args,
+                          int                           threads,
+                          const std::string&            thread_handle)
+{
+    bool shared_handle = thread_handle == "shared";
+    bool shared_stream = shared_handle || thread_handle == "per_thread_shared_stream";
+    if(!shared_stream && thread_handle != "per_thread")
+        throw std::invalid_argument("Invalid value for --thread_handle " + thread_handle);
+    if(threads < 1)
+        throw std::invalid_argument("Invalid value for --threads " + std::to_string(threads));
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    std::vector<hipStream_t> stream(shared_stream ? 1 : threads);
+    for(hipStream_t& s : stream)
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&s, hipStreamNonBlocking));
+
+    int ret = 0;
+    for(const Arguments& arg : args)
+    {
+        // the shared handle is created and configured here, as by hipblasLocalHandle
+        std::unique_ptr<hipblasLocalHandle> handle;
+        if(shared_handle)
+        {
+            hipblas_client_set_stream(stream[0]);
+            handle = std::make_unique<hipblasLocalHandle>(arg);
+            hipblas_client_set_stream(nullptr);
+        }
+
+        std::vector<hipblas_bench_thread_result> result(threads);
+        hipblas_bench_barrier                    barrier(threads);
+        std::vector<std::thread>                 thread;
+        for(int t = 0; t < threads; t++)
+            thread.emplace_back(::thread_run_bench_captured,
+                                device,
+                                shared_handle ? hipblasHandle_t(*handle) : nullptr,
+                                stream[shared_stream ? 0 : t],
+                                arg,
+                                &barrier,
+                                true,
+                                std::ref(result[t]));
+        for(std::thread& t : thread)
+            t.join();
+
+        std::vector<double> submission_us;
+        double              gflop = 0.0, start_us = 0.0, end_us = 0.0;
+        int64_t             calls = 0;
+        bool                timed = false, has_gflops = false;
+        for(const hipblas_bench_thread_result& r : result)
+        {
+            ret |= r.ret;
+            if(!r.timed)
+                continue;
+
+            if(!timed)
+                std::cout << "thread," << r.result.names << "\n"
+                          << 0 << ", " << r.result.values << std::endl;
+
+            double thread_end_us = r.start_us + r.result.perf.us * r.calls;
+            start_us             = timed ? std::min(start_us, r.start_us) : r.start_us;
+            end_us               = timed ? std::max(end_us, thread_end_us) : thread_end_us;
+            timed                = true;
+
+            calls += r.calls;
+            submission_us.insert(
+                submission_us.end(), r.submission_us.begin(), r.submission_us.end());
+            if(r.result.perf.gflops != ArgumentLogging::NA_value)
+            {
+                gflop += r.result.perf.gflops * r.result.perf.us * r.calls * 1e-6;
+                has_gflops = true;
+            }
+        }
+
+        if(!timed)
+            continue;
+
+        double median_us = ArgumentLogging::NA_value, p99_us = ArgumentLogging::NA_value,
+               max_us    = ArgumentLogging::NA_value;
+        if(!submission_us.empty())
+        {
+            std::sort(submission_us.begin(), submission_us.end());
+            median_us = hipblas_bench_percentile(submission_us, 0.5);
+            p99_us    = hipblas_bench_percentile(submission_us, 0.99);
+            max_us    = submission_us.back();
+        }
+
+        double wall_us = end_us - start_us;
+        std::cout << "threads,thread_handle,calls,wall-us,calls/s,submit-us-median,submit-us-p99,"
+                     "submit-us-max,aggregate-Gflops\n"
+                  << threads << ", " << thread_handle << ", " << calls << ", " << wall_us << ", "
+                  << calls / wall_us * 1e6 << ", " << median_us << ", " << p99_us << ", "
+                  << max_us << ", "
+                  << (has_gflops ? gflop / wall_us * 1e6 : ArgumentLogging::NA_value) << "\n"
+                  << std::endl;
+    }
+
+    for(hipStream_t& s : stream)
+        CHECK_HIP_ERROR(hipStreamDestroy(s));
+
+    test_cleanup::cleanup();
+    return ret;
+}
+
+int hipblas_bench_datafile(bool               warmup,
+                           int                streams,
+                           int                threads,
+                           const std::string& thread_handle)
+{
+    if(warmup)
+    {
+        std::vector<Arguments> args;
+        for(Arguments arg : HipBLAS_TestData())
+            args.push_back(arg);
+        hipblas_bench_warmup(args);
+    }
+
+    if(streams || threads)
+    {
+        std::vector<Arguments> args;
+        for(Arguments arg : HipBLAS_TestData())
+            args.push_back(arg);
+        return streams ? hipblas_bench_streams(args, streams)
+                       : hipblas_bench_threads(args, threads, thread_handle);
+    }
+
     int ret = 0;
     for(Arguments arg : HipBLAS_TestData())
         ret |= run_bench_test(arg, 0, 1);
@@ -112,6 +574,107 @@ int run_bench_multi_gpu_test(int parallel_devices, Arguments& arg)
     return 0;
 }
 
+// Sizes of a sweep from start to end, adding step or multiplying by step if geometric
+std::vector<int64_t> hipblas_bench_sweep_points(const Arguments& arg, bool geometric)
+{
+    if(arg.start < 0 || (geometric ? arg.start < 1 || arg.step < 2 : arg.step < 1))
+        throw std::invalid_argument("Invalid value for --sweep_range");
+
+    std::vector<int64_t> points;
+    for(int64_t size = arg.start; size <= arg.end; size = geometric ? size * arg.step : size + arg.step)
+        points.push_back(size);
+    return points;
+}
+
+// Parse start:end:step or start:end:xfactor into arg.start, arg.end and arg.step
+bool hipblas_bench_sweep_range(const std::string& range, Arguments& arg)
+{
+    size_t first  = range.find(':');
+    size_t second = range.find(':', first + 1);
+    if(first == std::string::npos || second == std::string::npos)
+        throw std::invalid_argument("Invalid value for --sweep_range " + range);
+
+    std::string step      = range.substr(second + 1);
+    bool        geometric = !step.empty() && (step[0] == 'x' || step[0] == 'X');
+    if(geometric || (!step.empty() && step[0] == '+'))
+        step.erase(0, 1);
+
+    try
+    {
+        arg.start = std::stoi(range.substr(0, first));
+        arg.end   = std::stoi(range.substr(first + 1, second - first - 1));
+        arg.step  = std::stoi(step);
+    }
+    catch(const std::logic_error&)
+    {
+        throw std::invalid_argument("Invalid value for --sweep_range " + range);
+    }
+    return geometric;
+}
+
+// Run the sizes of a sweep in this process. Host and device memory is allocated once by a run of
+// the largest size without timing, and reused by the smaller sizes which follow.
+int hipblas_bench_sweep(const Arguments& arg, const std::string& sweep, bool geometric, bool warmup)
+{
+    bool sweep_m = false, sweep_n = false, sweep_k = false;
+
+    std::stringstream dims(sweep);
+    std::string       dim;
+    while(std::getline(dims, dim, ','))
+    {
+        std::transform(dim.begin(), dim.end(), dim.begin(), ::tolower);
+        if(dim == "m")
+            sweep_m = true;
+        else if(dim == "n")
+            sweep_n = true;
+        else if(dim == "k")
+            sweep_k = true;
+        else
+            throw std::invalid_argument("Invalid value for --sweep " + sweep);
+    }
+
+    std::vector<Arguments> args;
+    for(int64_t size : hipblas_bench_sweep_points(arg, geometric))
+    {
+        Arguments a(arg);
+        if(sweep_m)
+            a.M = size;
+        if(sweep_n)
+            a.N = size;
+        if(sweep_k)
+            a.K = size;
+
+        // leading dimensions must hold the swept sizes
+        a.lda = std::max(a.lda, size);
+        a.ldb = std::max(a.ldb, size);
+        a.ldc = std::max(a.ldc, size);
+        a.ldd = std::max(a.ldd, size);
+        args.push_back(a);
+    }
+
+    if(args.empty())
+        return 0;
+
+    if(warmup)
+        hipblas_bench_warmup(args);
+
+    host_set_retain_allocations(true);
+    d_vector_set_retain_allocations(true);
+
+    Arguments largest(args.back());
+    largest.cold_iters = 1;
+    largest.iters      = 0;
+    int ret            = run_bench_test(largest, 0, 1);
+
+    for(Arguments& a : args)
+        ret |= run_bench_test(a, 0, 1);
+
+    d_vector_set_retain_allocations(false);
+    host_set_retain_allocations(false);
+
+    return ret;
+}
+
 // Replace --batch with --batch_count for backward compatibility
 void fix_batch(int argc, char* argv[])
 {
@@ -144,6 +707,10 @@ try
     std::string initialization;
     int         device_id;
     int         parallel_devices;
+    int         streams;
+    int         threads;
+    std::string thread_handle;
+    int         rotating_buffer_mb;
     int32_t     api     = 0;
     bool        fortran = false;
 
@@ -151,6 +718,13 @@ try
     bool atomics_not_allowed = false;
     bool log_function_name   = false;
     bool log_datatype        = false;
+    bool iteration_stats     = false;
+    bool warmup              = false;
+
+    std::string output_format;
+    std::string output_file;
+    std::string sweep;
+    std::string sweep_range;
 
     options_description desc("hipblas-bench command line options");
 
@@ -337,6 +911,32 @@ try
          value<uint32_t>(&arg.flags)->default_value(0),
          "gemm_ex flags")
 
+        ("split_k",
+         value<int32_t>(&arg.split_k)->default_value(0),
+         "Run gemm_ex with the split-K algorithm. Number of chunks k is split into, or -1 to let hipBLAS choose")
+
+        ("emulation_slices",
+         value<int32_t>(&arg.emulation_slices)->default_value(0),
+         "Number of slices for gemm_ex_emulated, 0 for the default of the emulated compute type")
+
+        ("strassen_levels",
+         value<int32_t>(&arg.strassen_levels)->default_value(0),
+         "Run double and double complex gemm and gemm_ex with the Strassen-Winograd algorithm. Number of levels, or -1 to let hipBLAS choose")
+
+        ("gemm_order",
+         value<int32_t>(&arg.gemm_order)->default_value(0),
+         "hipblasGemmOrderMode_t for gemm and gemm_ex: 0 default, 1 transposed C. With -1, gemm times both layouts of C "
+         "and appends the problem to the order table named by HIPBLAS_GEMM_ORDER_TABLE_FILE if the transposed layout is faster")
+
+        ("qr_algo",
+         value<int32_t>(&arg.qr_algo)->default_value(0),
+         "hipblasQrAlgo_t for geqrf and gels: 0 default, 1 tall-skinny QR")
+
+        ("warmup",
+         bool_switch(&warmup)->default_value(false),
+         "Load the kernels of the gemm, gemm_ex, gemm_strided_batched and gemm_strided_batched_ex problems with hipblasWarmup "
+         "before they are benchmarked, and print the time taken by each")
+
         ("atomics_not_allowed",
          bool_switch(&atomics_not_allowed)->default_value(false),
          "Atomic operations with non-determinism in results are not allowed")
@@ -345,10 +945,40 @@ try
          value<int>(&device_id)->default_value(0),
          "Set default device to be used for subsequent program runs")
 
+        ("sweep",
+         value<std::string>(&sweep)->default_value(""),
+         "Comma separated sizes to sweep in a single process, any of m, n and k. Each point of --sweep_range sets them all. "
+         "Leading dimensions are raised to the size of the point if smaller")
+
+        ("sweep_range",
+         value<std::string>(&sweep_range)->default_value("128:16384:x2"),
+         "Sizes of --sweep as start:end:step where step is added to the size, or start:end:xfactor where the size is multiplied by factor")
+
+        ("rotating_buffer_mb",
+         value<int>(&rotating_buffer_mb)->default_value(0),
+         "Cycle the timed calls through copies of the device buffers, enough copies to exceed this size in MB, "
+         "so that the operands are not in the caches. 0 times every call on the same buffers")
+
         ("parallel_devices",
          value<int>(&parallel_devices)->default_value(0),
          "Set number of devices used for parallel runs (device 0 to parallel_devices-1)")
 
+        ("streams",
+         value<int>(&streams)->default_value(0),
+         "Run the case on this number of streams of the device at once, each with its own handle and buffers, "
+         "and report the Gflop/s of each stream, the aggregate Gflop/s and the speedup over running them one after the other. "
+         "With --yaml, the cases are run as mixed groups of this size")
+
+        ("threads",
+         value<int>(&threads)->default_value(0),
+         "Submit the calls of the case from this number of host threads at once, each with its own buffers, "
+         "and report the aggregate call rate, the host time to submit each call and the aggregate Gflop/s")
+
+        ("thread_handle",
+         value<std::string>(&thread_handle)->default_value("per_thread"),
+         "Handles of --threads: shared (one handle and stream), per_thread (a handle and stream each) "
+         "or per_thread_shared_stream (a handle each on one stream)")
+
         // ("c_noalias_d",
         //  bool_switch(&arg.c_noalias_d)->default_value(false),
         //  "C and D are stored in separate memory")
@@ -361,6 +991,19 @@ try
          bool_switch(&log_datatype)->default_value(false),
          "Include datatypes used in output.")
 
+        ("iteration_stats",
+         bool_switch(&iteration_stats)->default_value(false),
+         "Time each hot iteration with hip events and include min, median, p90, p99, max and stddev of the times in output.")
+
+        ("output_format",
+         value<std::string>(&output_format)->default_value("text"),
+         "Output format: text, json (one object per line) or csv. Each json or csv record has every argument, "
+         "the timing, the device and the hipBLAS and backend versions")
+
+        ("output_file",
+         value<std::string>(&output_file)->default_value(""),
+         "Append json or csv records to this file instead of writing them to stdout")
+
         ("fortran",
          bool_switch(&fortran)->default_value(false),
          "Run using Fortran interface")
@@ -406,6 +1049,23 @@ try
 
     ArgumentModel_set_log_datatype(log_datatype);
 
+    ArgumentModel_set_log_iteration_stats(iteration_stats);
+
+    if(rotating_buffer_mb < 0)
+        throw std::invalid_argument("Invalid value for --rotating_buffer_mb "
+                                    + std::to_string(rotating_buffer_mb));
+    d_vector_set_rotating_bytes(size_t(rotating_buffer_mb) << 20);
+
+    if(!ArgumentModel_set_output(output_format, output_file))
+        return -1;
+
+    if(streams < 0)
+        throw std::invalid_argument("Invalid value for --streams " + std::to_string(streams));
+    if(threads < 0)
+        throw std::invalid_argument("Invalid value for --threads " + std::to_string(threads));
+    if(streams && threads)
+        throw std::invalid_argument("--streams and --threads can't be used together");
+
     // Device Query
     int device_count = query_device_property();
 
@@ -415,7 +1075,7 @@ try
     set_device(device_id);
 
     if(datafile)
-        return hipblas_bench_datafile();
+        return hipblas_bench_datafile(warmup, streams, threads, thread_handle);
 
     std::transform(precision.begin(), precision.end(), precision.begin(), ::tolower);
     auto prec = string2hipblas_datatype(precision);
@@ -459,6 +1119,21 @@ try
     if(copied <= 0 || copied >= sizeof(arg.function))
         throw std::invalid_argument("Invalid value for --function");
 
+    if(!sweep.empty())
+    {
+        bool geometric = hipblas_bench_sweep_range(sweep_range, arg);
+        return hipblas_bench_sweep(arg, sweep, geometric, warmup);
+    }
+
+    if(warmup)
+        hipblas_bench_warmup({arg});
+
+    if(streams)
+        return hipblas_bench_streams({arg}, streams);
+
+    if(threads)
+        return hipblas_bench_threads({arg}, threads, thread_handle);
+
     if(!parallel_devices)
         return run_bench_test(arg, 0, 1);
     else
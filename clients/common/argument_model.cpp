@@ -21,6 +21,17 @@
  * ************************************************************************ */
 
 #include "argument_model.hpp"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <mutex>
+#include <random>
+#include <type_traits>
+#include <vector>
 
 // this should have been a member variable but due to the complex variadic template this singleton allows global control
 
@@ -47,3 +58,420 @@ bool ArgumentModel_get_log_datatype()
 {
     return log_datatype;
 }
+
+static bool log_iteration_stats = false;
+
+void ArgumentModel_set_log_iteration_stats(bool s)
+{
+    log_iteration_stats = s;
+}
+
+bool ArgumentModel_get_log_iteration_stats()
+{
+    return log_iteration_stats;
+}
+
+void ArgumentModel_log_iteration_stats(std::stringstream&         name_line,
+                                       std::stringstream&         val_line,
+                                       double                     gflops,
+                                       ArgumentModel_perf_record& perf)
+{
+    std::vector<double> times_us;
+    if(!hipblas_take_iteration_times(times_us))
+        return;
+
+    std::sort(times_us.begin(), times_us.end());
+    size_t n = times_us.size();
+
+    // nearest rank percentile
+    auto percentile = [&](double p) {
+        size_t rank = size_t(std::ceil(p / 100.0 * n));
+        return times_us[rank ? rank - 1 : 0];
+    };
+
+    double mean = 0.0;
+    for(double t : times_us)
+        mean += t;
+    mean /= n;
+
+    double variance = 0.0;
+    for(double t : times_us)
+        variance += (t - mean) * (t - mean);
+    variance /= n;
+
+    perf.min_us    = times_us.front();
+    perf.median_us = n % 2 ? times_us[n / 2] : (times_us[n / 2 - 1] + times_us[n / 2]) / 2.0;
+    perf.p90_us    = percentile(90);
+    perf.p99_us    = percentile(99);
+    perf.max_us    = times_us.back();
+    perf.stddev_us = std::sqrt(variance);
+    if(perf.median_us > 0)
+        perf.gflops_median = gflops / perf.median_us * 1e6;
+
+    name_line << "min-us,median-us,p90-us,p99-us,max-us,stddev-us,hipblas-Gflops-median,";
+    val_line << perf.min_us << ", " << perf.median_us << ", " << perf.p90_us << ", " << perf.p99_us
+             << ", " << perf.max_us << ", " << perf.stddev_us << ", " << perf.gflops_median << ", ";
+}
+
+namespace
+{
+    enum class record_format
+    {
+        none,
+        json,
+        csv
+    };
+
+    struct record_output
+    {
+        record_format format = record_format::none;
+        std::ofstream file;
+        bool          to_file = false;
+        bool          header  = true;
+        std::string   run_id;
+        std::string   hipblas_version;
+        std::string   backend_version;
+        std::mutex    mutex;
+
+        std::ostream& stream()
+        {
+            return to_file ? file : std::cout;
+        }
+    };
+
+    record_output output;
+
+    // run metadata, queried when a record is written as the device may be changed after parsing
+    struct record_device
+    {
+        int         id = -1;
+        std::string name;
+        std::string arch;
+        int         compute_units    = 0;
+        int         clock_mhz        = 0;
+        int         memory_clock_mhz = 0;
+    };
+
+    // records may be written from several threads, which share the cached device
+    record_device query_record_device()
+    {
+        static std::mutex    mutex;
+        static record_device device;
+
+        std::lock_guard<std::mutex> lock(mutex);
+
+        int id = 0;
+        if(hipGetDevice(&id) != hipSuccess || id == device.id)
+            return device;
+
+        hipDeviceProp_t props;
+        if(hipGetDeviceProperties(&props, id) != hipSuccess)
+            return device;
+
+        device.id               = id;
+        device.name             = props.name;
+        device.arch             = props.gcnArchName;
+        device.compute_units    = props.multiProcessorCount;
+        device.clock_mhz        = props.clockRate / 1000;
+        device.memory_clock_mhz = props.memoryClockRate / 1000;
+        return device;
+    }
+
+    std::string make_run_id()
+    {
+        std::time_t now = std::time(nullptr);
+        char        date[32];
+        std::strftime(date, sizeof(date), "%Y%m%dT%H%M%S", std::gmtime(&now));
+
+        std::random_device rd;
+        std::stringstream  id;
+        id << date << "-" << std::hex << std::setw(8) << std::setfill('0') << rd();
+        return id.str();
+    }
+
+    std::string json_string(const std::string& str)
+    {
+        std::string out = "\"";
+        for(char c : str)
+        {
+            switch(c)
+            {
+            case '"':
+                out += "\\\"";
+                break;
+            case '\\':
+                out += "\\\\";
+                break;
+            case '\b':
+                out += "\\b";
+                break;
+            case '\f':
+                out += "\\f";
+                break;
+            case '\n':
+                out += "\\n";
+                break;
+            case '\r':
+                out += "\\r";
+                break;
+            case '\t':
+                out += "\\t";
+                break;
+            default:
+                // the other control characters have no short escape
+                if(static_cast<unsigned char>(c) < 0x20)
+                {
+                    char escape[8];
+                    std::snprintf(escape, sizeof(escape), "\\u%04x", c);
+                    out += escape;
+                }
+                else
+                    out += c;
+            }
+        }
+        return out + "\"";
+    }
+
+    std::string csv_cell(const std::string& str)
+    {
+        if(str.find_first_of(",\"\n") == std::string::npos)
+            return str;
+
+        std::string out = "\"";
+        for(char c : str)
+        {
+            if(c == '"')
+                out += '"';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    class record_writer
+    {
+        record_format            format;
+        std::vector<std::string> names;
+        std::vector<std::string> values;
+
+    public:
+        explicit record_writer(record_format format)
+            : format(format)
+        {
+        }
+
+        void add_string(const char* name, const std::string& value)
+        {
+            names.push_back(name);
+            values.push_back(format == record_format::json ? json_string(value) : csv_cell(value));
+        }
+
+        void add_number(const char* name, double value)
+        {
+            std::stringstream str;
+            str << std::setprecision(std::numeric_limits<double>::max_digits10);
+            if(value == ArgumentLogging::NA_value || !std::isfinite(value))
+                str << (format == record_format::json ? "null" : "");
+            else
+                str << value;
+            names.push_back(name);
+            values.push_back(str.str());
+        }
+
+        void add(const char* name, bool value)
+        {
+            names.push_back(name);
+            values.push_back(value ? "true" : "false");
+        }
+
+        void add(const char* name, char value)
+        {
+            add_string(name, std::string(1, value));
+        }
+
+        template <size_t N>
+        void add(const char* name, const char (&value)[N])
+        {
+            add_string(name, std::string(value, strnlen(value, N)));
+        }
+
+        void add(const char* name, hipblasDatatype_t value)
+        {
+            add_string(name, hipblas_datatype2string(value));
+        }
+
+        void add(const char* name, hipblasComputeType_t value)
+        {
+            add_string(name, hipblas_computetype2string(value));
+        }
+
+        void add(const char* name, hipblas_initialization value)
+        {
+            add_string(name, hipblas_initialization2string(value));
+        }
+
+        template <typename T, std::enable_if_t<std::is_enum<T>{}, int> = 0>
+        void add(const char* name, T value)
+        {
+            names.push_back(name);
+            values.push_back(std::to_string(int64_t(value)));
+        }
+
+        template <typename T, std::enable_if_t<std::is_integral<T>{}, int> = 0>
+        void add(const char* name, T value)
+        {
+            names.push_back(name);
+            values.push_back(std::to_string(value));
+        }
+
+        // floating point arguments go through add_number, so non-finite values are null
+        template <typename T, std::enable_if_t<std::is_floating_point<T>{}, int> = 0>
+        void add(const char* name, T value)
+        {
+            add_number(name, value);
+        }
+
+        void write(std::ostream& str, bool header)
+        {
+            if(format == record_format::json)
+            {
+                str << "{";
+                for(size_t i = 0; i < names.size(); i++)
+                    str << (i ? ", " : "") << json_string(names[i]) << ": " << values[i];
+                str << "}\n";
+            }
+            else
+            {
+                if(header)
+                {
+                    for(size_t i = 0; i < names.size(); i++)
+                        str << (i ? "," : "") << names[i];
+                    str << "\n";
+                }
+                for(size_t i = 0; i < values.size(); i++)
+                    str << (i ? "," : "") << values[i];
+                str << "\n";
+            }
+            str.flush();
+        }
+    };
+}
+
+bool ArgumentModel_set_output(const std::string& format, const std::string& file)
+{
+    if(format == "json")
+        output.format = record_format::json;
+    else if(format == "csv")
+        output.format = record_format::csv;
+    else if(format == "text")
+        output.format = record_format::none;
+    else
+    {
+        std::cerr << "Invalid output format: " << format << std::endl;
+        return false;
+    }
+
+    output.to_file = !file.empty();
+    if(output.to_file)
+    {
+        output.file.open(file, std::ios::out | std::ios::app);
+        if(!output.file)
+        {
+            std::cerr << "Cannot open output file: " << file << std::endl;
+            return false;
+        }
+
+        // records are appended, so the CSV header is only written to an empty file
+        output.file.seekp(0, std::ios::end);
+        output.header = output.file.tellp() <= 0;
+    }
+
+    if(output.format == record_format::none)
+        return true;
+
+    output.run_id = make_run_id();
+
+    output.hipblas_version = std::to_string(hipblasVersionMajor) + "."
+                             + std::to_string(hipblasVersionMinor) + "."
+                             + std::to_string(hipblasVersionPatch);
+
+    char backend_version[256];
+    if(hipblasGetBackendVersionString(backend_version, sizeof(backend_version))
+       == HIPBLAS_STATUS_SUCCESS)
+        output.backend_version = backend_version;
+
+    return true;
+}
+
+bool ArgumentModel_get_log_record()
+{
+    return output.format != record_format::none;
+}
+
+bool ArgumentModel_get_log_to_file()
+{
+    return output.to_file;
+}
+
+void ArgumentModel_log_record(const Arguments& arg, const ArgumentModel_perf_record& perf)
+{
+    record_writer record(output.format);
+    record_device device = query_record_device();
+
+    record.add_string("run_id", output.run_id);
+    record.add_string("hipblas_version", output.hipblas_version);
+    record.add_string("backend_version", output.backend_version);
+    record.add("device_id", device.id);
+    record.add_string("device_name", device.name);
+    record.add_string("arch", device.arch);
+    record.add("compute_units", device.compute_units);
+    record.add("clock_mhz", device.clock_mhz);
+    record.add("memory_clock_mhz", device.memory_clock_mhz);
+
+#define ADD_ARGUMENT(NAME) record.add(#NAME, arg.NAME)
+    FOR_EACH_ARGUMENT(ADD_ARGUMENT, ;);
+#undef ADD_ARGUMENT
+
+    record.add_number("hipblas-Gflops", perf.gflops);
+    record.add_number("hipblas-GB/s", perf.gbytes_per_s);
+    record.add_number("hipblas-us", perf.us);
+    record.add_number("min-us", perf.min_us);
+    record.add_number("median-us", perf.median_us);
+    record.add_number("p90-us", perf.p90_us);
+    record.add_number("p99-us", perf.p99_us);
+    record.add_number("max-us", perf.max_us);
+    record.add_number("stddev-us", perf.stddev_us);
+    record.add_number("hipblas-Gflops-median", perf.gflops_median);
+    record.add_number("norm_error_host_ptr", perf.norm_error_host);
+    record.add_number("norm_error_device_ptr", perf.norm_error_device);
+
+    std::lock_guard<std::mutex> lock(output.mutex);
+    record.write(output.stream(), output.header);
+    output.header = false;
+}
+
+static thread_local bool                              capture_results = false;
+static thread_local std::vector<ArgumentModel_result> captured_results;
+
+void ArgumentModel_set_capture_results(bool capture)
+{
+    capture_results = capture;
+}
+
+bool ArgumentModel_get_capture_results()
+{
+    return capture_results;
+}
+
+void ArgumentModel_capture_result(const std::string&               names,
+                                  const std::string&               values,
+                                  const ArgumentModel_perf_record& perf)
+{
+    captured_results.push_back({names, values, perf});
+}
+
+std::vector<ArgumentModel_result> ArgumentModel_take_results()
+{
+    std::vector<ArgumentModel_result> results;
+    std::swap(results, captured_results);
+    return results;
+}
@@ -194,6 +194,95 @@ void zgels_(char*                 trans,
             int64_t*              lwork,
             int64_t*              info);
 
+void sorgqr_(int64_t* m,
+             int64_t* n,
+             int64_t* k,
+             float*   A,
+             int64_t* lda,
+             float*   tau,
+             float*   work,
+             int64_t* lwork,
+             int64_t* info);
+void dorgqr_(int64_t* m,
+             int64_t* n,
+             int64_t* k,
+             double*  A,
+             int64_t* lda,
+             double*  tau,
+             double*  work,
+             int64_t* lwork,
+             int64_t* info);
+void cungqr_(int64_t*        m,
+             int64_t*        n,
+             int64_t*        k,
+             hipblasComplex* A,
+             int64_t*        lda,
+             hipblasComplex* tau,
+             hipblasComplex* work,
+             int64_t*        lwork,
+             int64_t*        info);
+void zungqr_(int64_t*              m,
+             int64_t*              n,
+             int64_t*              k,
+             hipblasDoubleComplex* A,
+             int64_t*              lda,
+             hipblasDoubleComplex* tau,
+             hipblasDoubleComplex* work,
+             int64_t*              lwork,
+             int64_t*              info);
+void sormqr_(char*    side,
+             char*    trans,
+             int64_t* m,
+             int64_t* n,
+             int64_t* k,
+             float*   A,
+             int64_t* lda,
+             float*   tau,
+             float*   C,
+             int64_t* ldc,
+             float*   work,
+             int64_t* lwork,
+             int64_t* info);
+void dormqr_(char*    side,
+             char*    trans,
+             int64_t* m,
+             int64_t* n,
+             int64_t* k,
+             double*  A,
+             int64_t* lda,
+             double*  tau,
+             double*  C,
+             int64_t* ldc,
+             double*  work,
+             int64_t* lwork,
+             int64_t* info);
+void cunmqr_(char*           side,
+             char*           trans,
+             int64_t*        m,
+             int64_t*        n,
+             int64_t*        k,
+             hipblasComplex* A,
+             int64_t*        lda,
+             hipblasComplex* tau,
+             hipblasComplex* C,
+             int64_t*        ldc,
+             hipblasComplex* work,
+             int64_t*        lwork,
+             int64_t*        info);
+void zunmqr_(char*                 side,
+             char*                 trans,
+             int64_t*              m,
+             int64_t*              n,
+             int64_t*              k,
+             hipblasDoubleComplex* A,
+             int64_t*              lda,
+             hipblasDoubleComplex* tau,
+             hipblasDoubleComplex* C,
+             int64_t*              ldc,
+             hipblasDoubleComplex* work,
+             int64_t*              lwork,
+             int64_t*              info);
+
 /*
 void strtri_(char* uplo, char* diag, int64_t* n, float* A, int64_t* lda, int64_t* info);
 void dtrtri_(char* uplo, char* diag, int64_t* n, double* A, int64_t* lda, int64_t* info);
@@ -4458,4 +4547,248 @@ int64_t ref_gels<hipblasDoubleComplex>(char                  trans,
     return info;
 }
 
+// orgqr
+template <>
+int64_t ref_orgqr<float>(
+    int64_t m, int64_t n, int64_t k, float* A, int64_t lda, float* tau, float* work, int64_t lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_sorgqr_work(LAPACK_COL_MAJOR, m, n, k, A, lda, tau, work, lwork);
+#else
+    sorgqr_(&m, &n, &k, A, &lda, tau, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int64_t ref_orgqr<double>(int64_t m,
+                          int64_t n,
+                          int64_t k,
+                          double* A,
+                          int64_t lda,
+                          double* tau,
+                          double* work,
+                          int64_t lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_dorgqr_work(LAPACK_COL_MAJOR, m, n, k, A, lda, tau, work, lwork);
+#else
+    dorgqr_(&m, &n, &k, A, &lda, tau, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int64_t ref_orgqr<hipblasComplex>(int64_t         m,
+                                  int64_t         n,
+                                  int64_t         k,
+                                  hipblasComplex* A,
+                                  int64_t         lda,
+                                  hipblasComplex* tau,
+                                  hipblasComplex* work,
+                                  int64_t         lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_cungqr_work(LAPACK_COL_MAJOR,
+                               m,
+                               n,
+                               k,
+                               (lapack_complex_float*)A,
+                               lda,
+                               (lapack_complex_float*)tau,
+                               (lapack_complex_float*)work,
+                               lwork);
+#else
+    cungqr_(&m, &n, &k, A, &lda, tau, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int64_t ref_orgqr<hipblasDoubleComplex>(int64_t               m,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        hipblasDoubleComplex* A,
+                                        int64_t               lda,
+                                        hipblasDoubleComplex* tau,
+                                        hipblasDoubleComplex* work,
+                                        int64_t               lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_zungqr_work(LAPACK_COL_MAJOR,
+                               m,
+                               n,
+                               k,
+                               (lapack_complex_double*)A,
+                               lda,
+                               (lapack_complex_double*)tau,
+                               (lapack_complex_double*)work,
+                               lwork);
+#else
+    zungqr_(&m, &n, &k, A, &lda, tau, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+// ormqr
+template <>
+int64_t ref_ormqr<float>(char    side,
+                         char    trans,
+                         int64_t m,
+                         int64_t n,
+                         int64_t k,
+                         float*  A,
+                         int64_t lda,
+                         float*  tau,
+                         float*  C,
+                         int64_t ldc,
+                         float*  work,
+                         int64_t lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_sormqr_work(LAPACK_COL_MAJOR,
+                               side,
+                               trans,
+                               m,
+                               n,
+                               k,
+                               A,
+                               lda,
+                               tau,
+                               C,
+                               ldc,
+                               work,
+                               lwork);
+#else
+    sormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int64_t ref_ormqr<double>(char    side,
+                          char    trans,
+                          int64_t m,
+                          int64_t n,
+                          int64_t k,
+                          double* A,
+                          int64_t lda,
+                          double* tau,
+                          double* C,
+                          int64_t ldc,
+                          double* work,
+                          int64_t lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_dormqr_work(LAPACK_COL_MAJOR,
+                               side,
+                               trans,
+                               m,
+                               n,
+                               k,
+                               A,
+                               lda,
+                               tau,
+                               C,
+                               ldc,
+                               work,
+                               lwork);
+#else
+    dormqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int64_t ref_ormqr<hipblasComplex>(char            side,
+                                  char            trans,
+                                  int64_t         m,
+                                  int64_t         n,
+                                  int64_t         k,
+                                  hipblasComplex* A,
+                                  int64_t         lda,
+                                  hipblasComplex* tau,
+                                  hipblasComplex* C,
+                                  int64_t         ldc,
+                                  hipblasComplex* work,
+                                  int64_t         lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_cunmqr_work(LAPACK_COL_MAJOR,
+                               side,
+                               trans,
+                               m,
+                               n,
+                               k,
+                               (lapack_complex_float*)A,
+                               lda,
+                               (lapack_complex_float*)tau,
+                               (lapack_complex_float*)C,
+                               ldc,
+                               (lapack_complex_float*)work,
+                               lwork);
+#else
+    cunmqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
+template <>
+int64_t ref_ormqr<hipblasDoubleComplex>(char                  side,
+                                        char                  trans,
+                                        int64_t               m,
+                                        int64_t               n,
+                                        int64_t               k,
+                                        hipblasDoubleComplex* A,
+                                        int64_t               lda,
+                                        hipblasDoubleComplex* tau,
+                                        hipblasDoubleComplex* C,
+                                        int64_t               ldc,
+                                        hipblasDoubleComplex* work,
+                                        int64_t               lwork)
+{
+    int64_t info;
+
+#ifdef FLA_ENABLE_ILP64
+    info = LAPACKE_zunmqr_work(LAPACK_COL_MAJOR,
+                               side,
+                               trans,
+                               m,
+                               n,
+                               k,
+                               (lapack_complex_double*)A,
+                               lda,
+                               (lapack_complex_double*)tau,
+                               (lapack_complex_double*)C,
+                               ldc,
+                               (lapack_complex_double*)work,
+                               lwork);
+#else
+    zunmqr_(&side, &trans, &m, &n, &k, A, &lda, tau, C, &ldc, work, &lwork, &info);
+#endif
+
+    return info;
+}
+
 #endif
@@ -43,6 +43,7 @@
 #include <string>
 #include <type_traits>
 // aux
+#include "auxil/testing_pack_unpack_batched.hpp"
 #include "auxil/testing_set_get_matrix.hpp"
 #include "auxil/testing_set_get_matrix_async.hpp"
 #include "auxil/testing_set_get_vector.hpp"
@@ -93,6 +94,7 @@
 #include "blas2/testing_gemv_strided_batched.hpp"
 #include "blas2/testing_ger.hpp"
 #include "blas2/testing_ger_batched.hpp"
+#include "blas2/testing_ger_deferred.hpp"
 #include "blas2/testing_ger_strided_batched.hpp"
 #include "blas2/testing_hbmv.hpp"
 #include "blas2/testing_hbmv_batched.hpp"
@@ -153,6 +155,7 @@
 #include "blas2/testing_trmv_strided_batched.hpp"
 #include "blas2/testing_trsv.hpp"
 #include "blas2/testing_trsv_batched.hpp"
+#include "blas2/testing_trsv_deferred.hpp"
 #include "blas2/testing_trsv_strided_batched.hpp"
 // blas3
 #include "blas3/testing_dgmm.hpp"
@@ -163,6 +166,9 @@
 #include "blas3/testing_geam_strided_batched.hpp"
 #include "blas3/testing_gemm.hpp"
 #include "blas3/testing_gemm_batched.hpp"
+#include "blas3/testing_gemm_real.hpp"
+#include "blas3/testing_gemm_real_batched.hpp"
+#include "blas3/testing_gemm_real_strided_batched.hpp"
 #include "blas3/testing_gemm_strided_batched.hpp"
 #include "blas3/testing_hemm.hpp"
 #include "blas3/testing_hemm_batched.hpp"
@@ -202,11 +208,15 @@
 #include "blas_ex/testing_axpy_batched_ex.hpp"
 #include "blas_ex/testing_axpy_ex.hpp"
 #include "blas_ex/testing_axpy_strided_batched_ex.hpp"
+#include "blas_ex/testing_copy_ex.hpp"
 #include "blas_ex/testing_dot_batched_ex.hpp"
 #include "blas_ex/testing_dot_ex.hpp"
 #include "blas_ex/testing_dot_strided_batched_ex.hpp"
 #include "blas_ex/testing_gemm_batched_ex.hpp"
+#include "blas_ex/testing_gemm_batched_reduce_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_emulated.hpp"
+#include "blas_ex/testing_gemm_indexed_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_batched_ex.hpp"
 #include "blas_ex/testing_nrm2_ex.hpp"
@@ -228,17 +238,29 @@
 #include "solver/testing_geqrf.hpp"
 #include "solver/testing_geqrf_batched.hpp"
 #include "solver/testing_geqrf_strided_batched.hpp"
+#include "solver/testing_gesv_ir.hpp"
+#include "solver/testing_gesv_ir_batched.hpp"
+#include "solver/testing_gesv_ir_strided_batched.hpp"
 #include "solver/testing_getrf.hpp"
 #include "solver/testing_getrf_batched.hpp"
 #include "solver/testing_getrf_npvt.hpp"
 #include "solver/testing_getrf_npvt_batched.hpp"
 #include "solver/testing_getrf_npvt_strided_batched.hpp"
+#include "solver/testing_getrf_refactor.hpp"
+#include "solver/testing_getrf_refactor_batched.hpp"
+#include "solver/testing_getrf_refactor_strided_batched.hpp"
 #include "solver/testing_getrf_strided_batched.hpp"
 #include "solver/testing_getri_batched.hpp"
 #include "solver/testing_getri_npvt_batched.hpp"
 #include "solver/testing_getrs.hpp"
 #include "solver/testing_getrs_batched.hpp"
 #include "solver/testing_getrs_strided_batched.hpp"
+#include "solver/testing_orgqr.hpp"
+#include "solver/testing_orgqr_batched.hpp"
+#include "solver/testing_orgqr_strided_batched.hpp"
+#include "solver/testing_ormqr.hpp"
+#include "solver/testing_ormqr_batched.hpp"
+#include "solver/testing_ormqr_strided_batched.hpp"
 #endif
 
 #include "utility.h"
@@ -286,6 +308,8 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"axpy_ex", testname_axpy_ex},
         {"axpy_batched_ex", testname_axpy_batched_ex},
         {"axpy_strided_batched_ex", testname_axpy_strided_batched_ex},
+        {"copy_ex", testname_copy_ex},
+        {"copy_matrix_ex", testname_copy_matrix_ex},
         {"copy", testname_copy},
         {"copy_batched", testname_copy_batched},
         {"copy_strided_batched", testname_copy_strided_batched},
@@ -348,6 +372,9 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gerc", testname_ger},
         {"gerc_batched", testname_ger_batched},
         {"gerc_strided_batched", testname_ger_strided_batched},
+        {"ger_deferred", testname_ger_deferred},
+        {"geru_deferred", testname_ger_deferred},
+        {"gerc_deferred", testname_ger_deferred},
         {"hbmv", testname_hbmv},
         {"hbmv_batched", testname_hbmv_batched},
         {"hbmv_strided_batched", testname_hbmv_strided_batched},
@@ -408,6 +435,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"trsv", testname_trsv},
         {"trsv_batched", testname_trsv_batched},
         {"trsv_strided_batched", testname_trsv_strided_batched},
+        {"trsv_deferred", testname_trsv_deferred},
 
         // L3
         {"dgmm", testname_dgmm},
@@ -419,7 +447,16 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"gemm", testname_gemm},
         {"gemm_batched", testname_gemm_batched},
         {"gemm_strided_batched", testname_gemm_strided_batched},
+        {"gemm_real_b", testname_gemm_real},
+        {"gemm_real_b_batched", testname_gemm_real_batched},
+        {"gemm_real_b_strided_batched", testname_gemm_real_strided_batched},
+        {"gemm_real_a", testname_gemm_real},
+        {"gemm_real_a_batched", testname_gemm_real_batched},
+        {"gemm_real_a_strided_batched", testname_gemm_real_strided_batched},
         {"gemm_ex", testname_gemm_ex},
+        {"gemm_ex_emulated", testname_gemm_ex_emulated},
+        {"gemm_batched_reduce_ex", testname_gemm_batched_reduce_ex},
+        {"gemm_indexed_ex", testname_gemm_indexed_ex},
         {"gemm_batched_ex", testname_gemm_batched_ex},
         {"gemm_strided_batched_ex", testname_gemm_strided_batched_ex},
         {"hemm", testname_hemm},
@@ -463,12 +500,24 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"geqrf", testname_geqrf},
         {"geqrf_batched", testname_geqrf_batched},
         {"geqrf_strided_batched", testname_geqrf_strided_batched},
+        {"gesv_ir", testname_gesv_ir},
+        {"gesv_ir_batched", testname_gesv_ir_batched},
+        {"gesv_ir_strided_batched", testname_gesv_ir_strided_batched},
+        {"orgqr", testname_orgqr},
+        {"orgqr_batched", testname_orgqr_batched},
+        {"orgqr_strided_batched", testname_orgqr_strided_batched},
+        {"ormqr", testname_ormqr},
+        {"ormqr_batched", testname_ormqr_batched},
+        {"ormqr_strided_batched", testname_ormqr_strided_batched},
         {"getrf", testname_getrf},
         {"getrf_batched", testname_getrf_batched},
         {"getrf_strided_batched", testname_getrf_strided_batched},
         {"getrf_npvt", testname_getrf_npvt},
         {"getrf_npvt_batched", testname_getrf_npvt_batched},
         {"getrf_npvt_strided_batched", testname_getrf_npvt_strided_batched},
+        {"getrf_refactor", testname_getrf_refactor},
+        {"getrf_refactor_batched", testname_getrf_refactor_batched},
+        {"getrf_refactor_strided_batched", testname_getrf_refactor_strided_batched},
         {"getri_batched", testname_getri_batched},
         {"getri_npvt_batched", testname_getri_npvt_batched},
         {"getrs", testname_getrs},
@@ -484,6 +533,7 @@ void get_test_name(const Arguments& arg, std::string& name)
         {"set_get_vector_async", testname_set_get_vector_async},
         {"set_get_matrix", testname_set_get_matrix},
         {"set_get_matrix_async", testname_set_get_matrix_async},
+        {"pack_unpack_batched", testname_pack_unpack_batched},
     };
 
     auto match = fmap.find(arg.function);
@@ -542,6 +592,45 @@ struct perf_gemm_strided_batched_ex<
     }
 };
 
+#ifdef __HIP_PLATFORM_SOLVER__
+// gesvIR only exists in double precision
+template <typename T, typename = void>
+struct perf_gesv_ir : hipblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_gesv_ir<T, std::enable_if_t<std::is_same<T, double>{}>> : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gesv_ir", testing_gesv_ir<T>},
+            {"gesv_ir_batched", testing_gesv_ir_batched<T>},
+            {"gesv_ir_strided_batched", testing_gesv_ir_strided_batched<T>},
+        };
+        run_function(map, arg);
+    }
+};
+#endif
+
+template <typename T, typename = void>
+struct perf_gemm_ex_emulated : hipblas_test_invalid
+{
+};
+
+template <typename T>
+struct perf_gemm_ex_emulated<T, std::enable_if_t<std::is_same<T, float>{}>> : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"gemm_ex_emulated", testing_gemm_ex_emulated<T>},
+        };
+        run_function(map, arg);
+    }
+};
+
 template <typename T, typename U = T, typename = void>
 struct perf_blas : hipblas_test_invalid
 {
@@ -602,6 +691,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"ger", testing_ger<T, false>},
             {"ger_batched", testing_ger_batched<T, false>},
             {"ger_strided_batched", testing_ger_strided_batched<T, false>},
+            {"ger_deferred", testing_ger_deferred<T, false>},
             {"sbmv", testing_sbmv<T>},
             {"sbmv_batched", testing_sbmv_batched<T>},
             {"sbmv_strided_batched", testing_sbmv_strided_batched<T>},
@@ -641,6 +731,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"trsv", testing_trsv<T>},
             {"trsv_batched", testing_trsv_batched<T>},
             {"trsv_strided_batched", testing_trsv_strided_batched<T>},
+            {"trsv_deferred", testing_trsv_deferred<T>},
 
             // L3
             {"geam", testing_geam<T>},
@@ -655,6 +746,8 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_batched_reduce_ex", testing_gemm_batched_reduce_ex<T>},
+            {"gemm_indexed_ex", testing_gemm_indexed_ex<T>},
             {"symm", testing_symm<T>},
             {"symm_batched", testing_symm_batched<T>},
             {"symm_strided_batched", testing_symm_strided_batched<T>},
@@ -681,12 +774,21 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"geqrf", testing_geqrf<T>},
             {"geqrf_batched", testing_geqrf_batched<T>},
             {"geqrf_strided_batched", testing_geqrf_strided_batched<T>},
+            {"orgqr", testing_orgqr<T>},
+            {"orgqr_batched", testing_orgqr_batched<T>},
+            {"orgqr_strided_batched", testing_orgqr_strided_batched<T>},
+            {"ormqr", testing_ormqr<T>},
+            {"ormqr_batched", testing_ormqr_batched<T>},
+            {"ormqr_strided_batched", testing_ormqr_strided_batched<T>},
             {"getrf", testing_getrf<T>},
             {"getrf_batched", testing_getrf_batched<T>},
             {"getrf_strided_batched", testing_getrf_strided_batched<T>},
             {"getrf_npvt", testing_getrf_npvt<T>},
             {"getrf_npvt_batched", testing_getrf_npvt_batched<T>},
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
+            {"getrf_refactor", testing_getrf_refactor<T>},
+            {"getrf_refactor_batched", testing_getrf_refactor_batched<T>},
+            {"getrf_refactor_strided_batched", testing_getrf_refactor_strided_batched<T>},
             {"getri_batched", testing_getri_batched<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
             {"getrs", testing_getrs<T>},
@@ -702,6 +804,7 @@ struct perf_blas<T, U, std::enable_if_t<std::is_same<T, float>{} || std::is_same
             {"set_get_vector_async", testing_set_get_vector_async<T>},
             {"set_get_matrix", testing_set_get_matrix<T>},
             {"set_get_matrix_async", testing_set_get_matrix_async<T>},
+            {"pack_unpack_batched", testing_pack_unpack_batched<T>},
         };
         run_function(fmap, arg);
     }
@@ -800,6 +903,8 @@ struct perf_blas<
             {"gerc", testing_ger<T, true>},
             {"gerc_batched", testing_ger_batched<T, true>},
             {"gerc_strided_batched", testing_ger_strided_batched<T, true>},
+            {"geru_deferred", testing_ger_deferred<T, false>},
+            {"gerc_deferred", testing_ger_deferred<T, true>},
             {"hbmv", testing_hbmv<T>},
             {"hbmv_batched", testing_hbmv_batched<T>},
             {"hbmv_strided_batched", testing_hbmv_strided_batched<T>},
@@ -851,6 +956,7 @@ struct perf_blas<
             {"trsv", testing_trsv<T>},
             {"trsv_batched", testing_trsv_batched<T>},
             {"trsv_strided_batched", testing_trsv_strided_batched<T>},
+            {"trsv_deferred", testing_trsv_deferred<T>},
 
             // L3
             {"dgmm", testing_dgmm<T>},
@@ -862,6 +968,14 @@ struct perf_blas<
             {"gemm", testing_gemm<T>},
             {"gemm_batched", testing_gemm_batched<T>},
             {"gemm_strided_batched", testing_gemm_strided_batched<T>},
+            {"gemm_real_b", testing_gemm_real<T, true>},
+            {"gemm_real_b_batched", testing_gemm_real_batched<T, true>},
+            {"gemm_real_b_strided_batched", testing_gemm_real_strided_batched<T, true>},
+            {"gemm_real_a", testing_gemm_real<T, false>},
+            {"gemm_real_a_batched", testing_gemm_real_batched<T, false>},
+            {"gemm_real_a_strided_batched", testing_gemm_real_strided_batched<T, false>},
+            {"gemm_batched_reduce_ex", testing_gemm_batched_reduce_ex<T>},
+            {"gemm_indexed_ex", testing_gemm_indexed_ex<T>},
             {"hemm", testing_hemm<T>},
             {"hemm_batched", testing_hemm_batched<T>},
             {"hemm_strided_batched", testing_hemm_strided_batched<T>},
@@ -903,12 +1017,21 @@ struct perf_blas<
             {"geqrf", testing_geqrf<T>},
             {"geqrf_batched", testing_geqrf_batched<T>},
             {"geqrf_strided_batched", testing_geqrf_strided_batched<T>},
+            {"orgqr", testing_orgqr<T>},
+            {"orgqr_batched", testing_orgqr_batched<T>},
+            {"orgqr_strided_batched", testing_orgqr_strided_batched<T>},
+            {"ormqr", testing_ormqr<T>},
+            {"ormqr_batched", testing_ormqr_batched<T>},
+            {"ormqr_strided_batched", testing_ormqr_strided_batched<T>},
             {"getrf", testing_getrf<T>},
             {"getrf_batched", testing_getrf_batched<T>},
             {"getrf_strided_batched", testing_getrf_strided_batched<T>},
             {"getrf_npvt", testing_getrf_npvt<T>},
             {"getrf_npvt_batched", testing_getrf_npvt_batched<T>},
             {"getrf_npvt_strided_batched", testing_getrf_npvt_strided_batched<T>},
+            {"getrf_refactor", testing_getrf_refactor<T>},
+            {"getrf_refactor_batched", testing_getrf_refactor_batched<T>},
+            {"getrf_refactor_strided_batched", testing_getrf_refactor_strided_batched<T>},
             {"getri_batched", testing_getri_batched<T>},
             {"getri_npvt_batched", testing_getri_npvt_batched<T>},
             {"getrs", testing_getrs<T>},
@@ -1048,6 +1171,35 @@ struct perf_blas_nrm2_ex<
     }
 };
 
+template <typename Ta, typename Tb = Ta, typename = void>
+struct perf_blas_copy_ex : hipblas_test_invalid
+{
+};
+
+template <typename Ta, typename Tb>
+struct perf_blas_copy_ex<
+    Ta,
+    Tb,
+    std::enable_if_t<((std::is_same<Ta, hipblasHalf>{} || std::is_same<Ta, hipblasBfloat16>{}
+                       || std::is_same<Ta, float>{} || std::is_same<Ta, double>{})
+                      && (std::is_same<Tb, hipblasHalf>{} || std::is_same<Tb, hipblasBfloat16>{}
+                          || std::is_same<Tb, float>{} || std::is_same<Tb, double>{}))
+                     || ((std::is_same<Ta, hipblasComplex>{}
+                          || std::is_same<Ta, hipblasDoubleComplex>{})
+                         && (std::is_same<Tb, hipblasComplex>{}
+                             || std::is_same<Tb, hipblasDoubleComplex>{}))>>
+    : hipblas_test_valid
+{
+    void operator()(const Arguments& arg)
+    {
+        static const func_map map = {
+            {"copy_ex", testing_copy_ex<Ta, Tb>},
+            {"copy_matrix_ex", testing_copy_matrix_ex<Ta, Tb>},
+        };
+        run_function(map, arg);
+    }
+};
+
 template <typename Tx, typename Ty = Tx, typename Tcs = Ty, typename Tex = Tcs, typename = void>
 struct perf_blas_rot_ex : hipblas_test_invalid
 {
@@ -1208,7 +1360,9 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
     if(!strncmp(function, prefix, sizeof(prefix) - 1))
         function += sizeof(prefix) - 1;
 
-    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched"))
+    if(!strcmp(function, "gemm") || !strcmp(function, "gemm_batched")
+       || !strcmp(function, "gemm_ex_emulated")
+       || !strcmp(function, "gemm_batched_reduce_ex"))
     {
         // adjust dimension for GEMM routines
         int64_t min_lda = arg.transA == 'N' ? arg.M : arg.K;
@@ -1365,6 +1519,8 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         else if(!strcmp(function, "axpy_ex") || !strcmp(function, "axpy_batched_ex")
                 || !strcmp(function, "axpy_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_axpy_ex>(arg);
+        else if(!strcmp(function, "copy_ex") || !strcmp(function, "copy_matrix_ex"))
+            hipblas_copy_ex_dispatch<perf_blas_copy_ex>(arg);
         else if(!strcmp(function, "dot_ex") || !strcmp(function, "dot_batched_ex")
                 || !strcmp(function, "dot_strided_batched_ex") || !strcmp(function, "dotc_ex")
                 || !strcmp(function, "dotc_batched_ex")
@@ -1376,6 +1532,13 @@ int run_bench_test(Arguments& arg, int unit_check, int timing)
         else if(!strcmp(function, "rot_ex") || !strcmp(function, "rot_batched_ex")
                 || !strcmp(function, "rot_strided_batched_ex"))
             hipblas_blas1_ex_dispatch<perf_blas_rot_ex>(arg);
+        else if(!strcmp(function, "gemm_ex_emulated"))
+            hipblas_simple_dispatch<perf_gemm_ex_emulated>(arg);
+#ifdef __HIP_PLATFORM_SOLVER__
+        else if(!strcmp(function, "gesv_ir") || !strcmp(function, "gesv_ir_batched")
+                || !strcmp(function, "gesv_ir_strided_batched"))
+            hipblas_simple_dispatch<perf_gesv_ir>(arg);
+#endif
         else
             hipblas_simple_dispatch<perf_blas>(arg);
     }
@@ -13798,6 +13798,419 @@ hipblasStatus_t hipblasZgeamStridedBatchedCast_64(hipblasHandle_t             ha
                                          batchCount);
 }
 
+// gemm with a real operand
+hipblasStatus_t hipblasCgemmRealBCast(hipblasHandle_t       handle,
+                                      hipblasOperation_t    transA,
+                                      hipblasOperation_t    transB,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const float*          B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+{
+    return hipblasCgemmRealB(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             (const hipComplex*)alpha,
+                             (const hipComplex*)A,
+                             lda,
+                             B,
+                             ldb,
+                             (const hipComplex*)beta,
+                             (hipComplex*)C,
+                             ldc);
+}
+
+hipblasStatus_t hipblasZgemmRealBCast(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transA,
+                                      hipblasOperation_t          transB,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const double*               B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+{
+    return hipblasZgemmRealB(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             (const hipDoubleComplex*)alpha,
+                             (const hipDoubleComplex*)A,
+                             lda,
+                             B,
+                             ldb,
+                             (const hipDoubleComplex*)beta,
+                             (hipDoubleComplex*)C,
+                             ldc);
+}
+
+hipblasStatus_t hipblasCgemmRealACast(hipblasHandle_t       handle,
+                                      hipblasOperation_t    transA,
+                                      hipblasOperation_t    transB,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const float*          A,
+                                      int                   lda,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+{
+    return hipblasCgemmRealA(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             (const hipComplex*)alpha,
+                             A,
+                             lda,
+                             (const hipComplex*)B,
+                             ldb,
+                             (const hipComplex*)beta,
+                             (hipComplex*)C,
+                             ldc);
+}
+
+hipblasStatus_t hipblasZgemmRealACast(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transA,
+                                      hipblasOperation_t          transB,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const double*               A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+{
+    return hipblasZgemmRealA(handle,
+                             transA,
+                             transB,
+                             m,
+                             n,
+                             k,
+                             (const hipDoubleComplex*)alpha,
+                             A,
+                             lda,
+                             (const hipDoubleComplex*)B,
+                             ldb,
+                             (const hipDoubleComplex*)beta,
+                             (hipDoubleComplex*)C,
+                             ldc);
+}
+
+hipblasStatus_t hipblasCgemmRealBBatchedCast(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transA,
+                                             hipblasOperation_t          transB,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasComplex*       alpha,
+                                             const hipblasComplex* const A[],
+                                             int                         lda,
+                                             const float* const          B[],
+                                             int                         ldb,
+                                             const hipblasComplex*       beta,
+                                             hipblasComplex* const       C[],
+                                             int                         ldc,
+                                             int                         batchCount)
+{
+    return hipblasCgemmRealBBatched(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    (const hipComplex*)alpha,
+                                    (const hipComplex* const*)A,
+                                    lda,
+                                    B,
+                                    ldb,
+                                    (const hipComplex*)beta,
+                                    (hipComplex* const*)C,
+                                    ldc,
+                                    batchCount);
+}
+
+hipblasStatus_t hipblasZgemmRealBBatchedCast(hipblasHandle_t                   handle,
+                                             hipblasOperation_t                transA,
+                                             hipblasOperation_t                transB,
+                                             int                               m,
+                                             int                               n,
+                                             int                               k,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const hipblasDoubleComplex* const A[],
+                                             int                               lda,
+                                             const double* const               B[],
+                                             int                               ldb,
+                                             const hipblasDoubleComplex*       beta,
+                                             hipblasDoubleComplex* const       C[],
+                                             int                               ldc,
+                                             int                               batchCount)
+{
+    return hipblasZgemmRealBBatched(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    (const hipDoubleComplex*)alpha,
+                                    (const hipDoubleComplex* const*)A,
+                                    lda,
+                                    B,
+                                    ldb,
+                                    (const hipDoubleComplex*)beta,
+                                    (hipDoubleComplex* const*)C,
+                                    ldc,
+                                    batchCount);
+}
+
+hipblasStatus_t hipblasCgemmRealABatchedCast(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transA,
+                                             hipblasOperation_t          transB,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasComplex*       alpha,
+                                             const float* const          A[],
+                                             int                         lda,
+                                             const hipblasComplex* const B[],
+                                             int                         ldb,
+                                             const hipblasComplex*       beta,
+                                             hipblasComplex* const       C[],
+                                             int                         ldc,
+                                             int                         batchCount)
+{
+    return hipblasCgemmRealABatched(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    (const hipComplex*)alpha,
+                                    A,
+                                    lda,
+                                    (const hipComplex* const*)B,
+                                    ldb,
+                                    (const hipComplex*)beta,
+                                    (hipComplex* const*)C,
+                                    ldc,
+                                    batchCount);
+}
+
+hipblasStatus_t hipblasZgemmRealABatchedCast(hipblasHandle_t                   handle,
+                                             hipblasOperation_t                transA,
+                                             hipblasOperation_t                transB,
+                                             int                               m,
+                                             int                               n,
+                                             int                               k,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const double* const               A[],
+                                             int                               lda,
+                                             const hipblasDoubleComplex* const B[],
+                                             int                               ldb,
+                                             const hipblasDoubleComplex*       beta,
+                                             hipblasDoubleComplex* const       C[],
+                                             int                               ldc,
+                                             int                               batchCount)
+{
+    return hipblasZgemmRealABatched(handle,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    k,
+                                    (const hipDoubleComplex*)alpha,
+                                    A,
+                                    lda,
+                                    (const hipDoubleComplex* const*)B,
+                                    ldb,
+                                    (const hipDoubleComplex*)beta,
+                                    (hipDoubleComplex* const*)C,
+                                    ldc,
+                                    batchCount);
+}
+
+hipblasStatus_t hipblasCgemmRealBStridedBatchedCast(hipblasHandle_t       handle,
+                                                    hipblasOperation_t    transA,
+                                                    hipblasOperation_t    transB,
+                                                    int                   m,
+                                                    int                   n,
+                                                    int                   k,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* A,
+                                                    int                   lda,
+                                                    hipblasStride         strideA,
+                                                    const float*          B,
+                                                    int                   ldb,
+                                                    hipblasStride         strideB,
+                                                    const hipblasComplex* beta,
+                                                    hipblasComplex*       C,
+                                                    int                   ldc,
+                                                    hipblasStride         strideC,
+                                                    int                   batchCount)
+{
+    return hipblasCgemmRealBStridedBatched(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           (const hipComplex*)alpha,
+                                           (const hipComplex*)A,
+                                           lda,
+                                           strideA,
+                                           B,
+                                           ldb,
+                                           strideB,
+                                           (const hipComplex*)beta,
+                                           (hipComplex*)C,
+                                           ldc,
+                                           strideC,
+                                           batchCount);
+}
+
+hipblasStatus_t hipblasZgemmRealBStridedBatchedCast(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int                         lda,
+                                                    hipblasStride               strideA,
+                                                    const double*               B,
+                                                    int                         ldb,
+                                                    hipblasStride               strideB,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc,
+                                                    hipblasStride               strideC,
+                                                    int                         batchCount)
+{
+    return hipblasZgemmRealBStridedBatched(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           (const hipDoubleComplex*)alpha,
+                                           (const hipDoubleComplex*)A,
+                                           lda,
+                                           strideA,
+                                           B,
+                                           ldb,
+                                           strideB,
+                                           (const hipDoubleComplex*)beta,
+                                           (hipDoubleComplex*)C,
+                                           ldc,
+                                           strideC,
+                                           batchCount);
+}
+
+hipblasStatus_t hipblasCgemmRealAStridedBatchedCast(hipblasHandle_t       handle,
+                                                    hipblasOperation_t    transA,
+                                                    hipblasOperation_t    transB,
+                                                    int                   m,
+                                                    int                   n,
+                                                    int                   k,
+                                                    const hipblasComplex* alpha,
+                                                    const float*          A,
+                                                    int                   lda,
+                                                    hipblasStride         strideA,
+                                                    const hipblasComplex* B,
+                                                    int                   ldb,
+                                                    hipblasStride         strideB,
+                                                    const hipblasComplex* beta,
+                                                    hipblasComplex*       C,
+                                                    int                   ldc,
+                                                    hipblasStride         strideC,
+                                                    int                   batchCount)
+{
+    return hipblasCgemmRealAStridedBatched(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           (const hipComplex*)alpha,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           (const hipComplex*)B,
+                                           ldb,
+                                           strideB,
+                                           (const hipComplex*)beta,
+                                           (hipComplex*)C,
+                                           ldc,
+                                           strideC,
+                                           batchCount);
+}
+
+hipblasStatus_t hipblasZgemmRealAStridedBatchedCast(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const double*               A,
+                                                    int                         lda,
+                                                    hipblasStride               strideA,
+                                                    const hipblasDoubleComplex* B,
+                                                    int                         ldb,
+                                                    hipblasStride               strideB,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc,
+                                                    hipblasStride               strideC,
+                                                    int                         batchCount)
+{
+    return hipblasZgemmRealAStridedBatched(handle,
+                                           transA,
+                                           transB,
+                                           m,
+                                           n,
+                                           k,
+                                           (const hipDoubleComplex*)alpha,
+                                           A,
+                                           lda,
+                                           strideA,
+                                           (const hipDoubleComplex*)B,
+                                           ldb,
+                                           strideB,
+                                           (const hipDoubleComplex*)beta,
+                                           (hipDoubleComplex*)C,
+                                           ldc,
+                                           strideC,
+                                           batchCount);
+}
+
 #ifdef __HIP_PLATFORM_SOLVER__
 
 // getrf
@@ -13870,6 +14283,85 @@ hipblasStatus_t hipblasZgetrfStridedBatchedCast(hipblasHandle_t       handle,
         handle, n, (hipDoubleComplex*)A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
+// getrf_refactor
+hipblasStatus_t hipblasCgetrfRefactorCast(hipblasHandle_t handle,
+                                          const int       n,
+                                          hipblasComplex* A,
+                                          const int       lda,
+                                          const int*      ipiv,
+                                          const float     maxGrowth,
+                                          int*            info)
+{
+    return hipblasCgetrfRefactor(handle, n, (hipComplex*)A, lda, ipiv, maxGrowth, info);
+}
+
+hipblasStatus_t hipblasZgetrfRefactorCast(hipblasHandle_t       handle,
+                                          const int             n,
+                                          hipblasDoubleComplex* A,
+                                          const int             lda,
+                                          const int*            ipiv,
+                                          const double          maxGrowth,
+                                          int*                  info)
+{
+    return hipblasZgetrfRefactor(handle, n, (hipDoubleComplex*)A, lda, ipiv, maxGrowth, info);
+}
+
+hipblasStatus_t hipblasCgetrfRefactorBatchedCast(hipblasHandle_t       handle,
+                                                 const int             n,
+                                                 hipblasComplex* const A[],
+                                                 const int             lda,
+                                                 const int*            ipiv,
+                                                 const float           maxGrowth,
+                                                 int*                  info,
+                                                 const int             batchCount)
+{
+    return hipblasCgetrfRefactorBatched(
+        handle, n, (hipComplex* const*)A, lda, ipiv, maxGrowth, info, batchCount);
+}
+
+hipblasStatus_t hipblasZgetrfRefactorBatchedCast(hipblasHandle_t             handle,
+                                                 const int                   n,
+                                                 hipblasDoubleComplex* const A[],
+                                                 const int                   lda,
+                                                 const int*                  ipiv,
+                                                 const double                maxGrowth,
+                                                 int*                        info,
+                                                 const int                   batchCount)
+{
+    return hipblasZgetrfRefactorBatched(
+        handle, n, (hipDoubleComplex* const*)A, lda, ipiv, maxGrowth, info, batchCount);
+}
+
+hipblasStatus_t hipblasCgetrfRefactorStridedBatchedCast(hipblasHandle_t     handle,
+                                                        const int           n,
+                                                        hipblasComplex*     A,
+                                                        const int           lda,
+                                                        const hipblasStride strideA,
+                                                        const int*          ipiv,
+                                                        const hipblasStride strideP,
+                                                        const float         maxGrowth,
+                                                        int*                info,
+                                                        const int           batchCount)
+{
+    return hipblasCgetrfRefactorStridedBatched(
+        handle, n, (hipComplex*)A, lda, strideA, ipiv, strideP, maxGrowth, info, batchCount);
+}
+
+hipblasStatus_t hipblasZgetrfRefactorStridedBatchedCast(hipblasHandle_t       handle,
+                                                        const int             n,
+                                                        hipblasDoubleComplex* A,
+                                                        const int             lda,
+                                                        const hipblasStride   strideA,
+                                                        const int*            ipiv,
+                                                        const hipblasStride   strideP,
+                                                        const double          maxGrowth,
+                                                        int*                  info,
+                                                        const int             batchCount)
+{
+    return hipblasZgetrfRefactorStridedBatched(
+        handle, n, (hipDoubleComplex*)A, lda, strideA, ipiv, strideP, maxGrowth, info, batchCount);
+}
+
 // getrs
 hipblasStatus_t hipblasCgetrsCast(hipblasHandle_t          handle,
                                   const hipblasOperation_t trans,
@@ -14146,6 +14638,310 @@ hipblasStatus_t hipblasZgeqrfStridedBatchedCast(hipblasHandle_t       handle,
                                        batchCount);
 }
 
+// orgqr
+hipblasStatus_t hipblasCungqrCast(hipblasHandle_t handle,
+                                  const int       m,
+                                  const int       n,
+                                  const int       k,
+                                  hipblasComplex* A,
+                                  const int       lda,
+                                  hipblasComplex* ipiv,
+                                  int*            info)
+{
+    return hipblasCungqr(handle, m, n, k, (hipComplex*)A, lda, (hipComplex*)ipiv, info);
+}
+
+hipblasStatus_t hipblasZungqrCast(hipblasHandle_t       handle,
+                                  const int             m,
+                                  const int             n,
+                                  const int             k,
+                                  hipblasDoubleComplex* A,
+                                  const int             lda,
+                                  hipblasDoubleComplex* ipiv,
+                                  int*                  info)
+{
+    return hipblasZungqr(handle, m, n, k, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)ipiv, info);
+}
+
+// orgqr_batched
+hipblasStatus_t hipblasCungqrBatchedCast(hipblasHandle_t       handle,
+                                         const int             m,
+                                         const int             n,
+                                         const int             k,
+                                         hipblasComplex* const A[],
+                                         const int             lda,
+                                         hipblasComplex* const ipiv[],
+                                         int*                  info,
+                                         const int             batchCount)
+{
+    return hipblasCungqrBatched(handle,
+                                m,
+                                n,
+                                k,
+                                (hipComplex* const*)A,
+                                lda,
+                                (hipComplex* const*)ipiv,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZungqrBatchedCast(hipblasHandle_t             handle,
+                                         const int                   m,
+                                         const int                   n,
+                                         const int                   k,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const ipiv[],
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZungqrBatched(handle,
+                                m,
+                                n,
+                                k,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                (hipDoubleComplex* const*)ipiv,
+                                info,
+                                batchCount);
+}
+
+// orgqr_strided_batched
+hipblasStatus_t hipblasCungqrStridedBatchedCast(hipblasHandle_t     handle,
+                                                const int           m,
+                                                const int           n,
+                                                const int           k,
+                                                hipblasComplex*     A,
+                                                const int           lda,
+                                                const hipblasStride strideA,
+                                                hipblasComplex*     ipiv,
+                                                const hipblasStride strideP,
+                                                int*                info,
+                                                const int           batchCount)
+{
+    return hipblasCungqrStridedBatched(handle,
+                                       m,
+                                       n,
+                                       k,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipComplex*)ipiv,
+                                       strideP,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZungqrStridedBatchedCast(hipblasHandle_t       handle,
+                                                const int             m,
+                                                const int             n,
+                                                const int             k,
+                                                hipblasDoubleComplex* A,
+                                                const int             lda,
+                                                const hipblasStride   strideA,
+                                                hipblasDoubleComplex* ipiv,
+                                                const hipblasStride   strideP,
+                                                int*                  info,
+                                                const int             batchCount)
+{
+    return hipblasZungqrStridedBatched(handle,
+                                       m,
+                                       n,
+                                       k,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipDoubleComplex*)ipiv,
+                                       strideP,
+                                       info,
+                                       batchCount);
+}
+
+// ormqr
+hipblasStatus_t hipblasCunmqrCast(hipblasHandle_t    handle,
+                                  hipblasSideMode_t  side,
+                                  hipblasOperation_t trans,
+                                  const int          m,
+                                  const int          n,
+                                  const int          k,
+                                  hipblasComplex*    A,
+                                  const int          lda,
+                                  hipblasComplex*    ipiv,
+                                  hipblasComplex*    C,
+                                  const int          ldc,
+                                  int*               info)
+{
+    return hipblasCunmqr(handle,
+                         side,
+                         trans,
+                         m,
+                         n,
+                         k,
+                         (hipComplex*)A,
+                         lda,
+                         (hipComplex*)ipiv,
+                         (hipComplex*)C,
+                         ldc,
+                         info);
+}
+
+hipblasStatus_t hipblasZunmqrCast(hipblasHandle_t       handle,
+                                  hipblasSideMode_t     side,
+                                  hipblasOperation_t    trans,
+                                  const int             m,
+                                  const int             n,
+                                  const int             k,
+                                  hipblasDoubleComplex* A,
+                                  const int             lda,
+                                  hipblasDoubleComplex* ipiv,
+                                  hipblasDoubleComplex* C,
+                                  const int             ldc,
+                                  int*                  info)
+{
+    return hipblasZunmqr(handle,
+                         side,
+                         trans,
+                         m,
+                         n,
+                         k,
+                         (hipDoubleComplex*)A,
+                         lda,
+                         (hipDoubleComplex*)ipiv,
+                         (hipDoubleComplex*)C,
+                         ldc,
+                         info);
+}
+
+// ormqr_batched
+hipblasStatus_t hipblasCunmqrBatchedCast(hipblasHandle_t       handle,
+                                         hipblasSideMode_t     side,
+                                         hipblasOperation_t    trans,
+                                         const int             m,
+                                         const int             n,
+                                         const int             k,
+                                         hipblasComplex* const A[],
+                                         const int             lda,
+                                         hipblasComplex* const ipiv[],
+                                         hipblasComplex* const C[],
+                                         const int             ldc,
+                                         int*                  info,
+                                         const int             batchCount)
+{
+    return hipblasCunmqrBatched(handle,
+                                side,
+                                trans,
+                                m,
+                                n,
+                                k,
+                                (hipComplex* const*)A,
+                                lda,
+                                (hipComplex* const*)ipiv,
+                                (hipComplex* const*)C,
+                                ldc,
+                                info,
+                                batchCount);
+}
+
+hipblasStatus_t hipblasZunmqrBatchedCast(hipblasHandle_t             handle,
+                                         hipblasSideMode_t           side,
+                                         hipblasOperation_t          trans,
+                                         const int                   m,
+                                         const int                   n,
+                                         const int                   k,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const ipiv[],
+                                         hipblasDoubleComplex* const C[],
+                                         const int                   ldc,
+                                         int*                        info,
+                                         const int                   batchCount)
+{
+    return hipblasZunmqrBatched(handle,
+                                side,
+                                trans,
+                                m,
+                                n,
+                                k,
+                                (hipDoubleComplex* const*)A,
+                                lda,
+                                (hipDoubleComplex* const*)ipiv,
+                                (hipDoubleComplex* const*)C,
+                                ldc,
+                                info,
+                                batchCount);
+}
+
+// ormqr_strided_batched
+hipblasStatus_t hipblasCunmqrStridedBatchedCast(hipblasHandle_t     handle,
+                                                hipblasSideMode_t   side,
+                                                hipblasOperation_t  trans,
+                                                const int           m,
+                                                const int           n,
+                                                const int           k,
+                                                hipblasComplex*     A,
+                                                const int           lda,
+                                                const hipblasStride strideA,
+                                                hipblasComplex*     ipiv,
+                                                const hipblasStride strideP,
+                                                hipblasComplex*     C,
+                                                const int           ldc,
+                                                const hipblasStride strideC,
+                                                int*                info,
+                                                const int           batchCount)
+{
+    return hipblasCunmqrStridedBatched(handle,
+                                       side,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       (hipComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipComplex*)ipiv,
+                                       strideP,
+                                       (hipComplex*)C,
+                                       ldc,
+                                       strideC,
+                                       info,
+                                       batchCount);
+}
+
+hipblasStatus_t hipblasZunmqrStridedBatchedCast(hipblasHandle_t       handle,
+                                                hipblasSideMode_t     side,
+                                                hipblasOperation_t    trans,
+                                                const int             m,
+                                                const int             n,
+                                                const int             k,
+                                                hipblasDoubleComplex* A,
+                                                const int             lda,
+                                                const hipblasStride   strideA,
+                                                hipblasDoubleComplex* ipiv,
+                                                const hipblasStride   strideP,
+                                                hipblasDoubleComplex* C,
+                                                const int             ldc,
+                                                const hipblasStride   strideC,
+                                                int*                  info,
+                                                const int             batchCount)
+{
+    return hipblasZunmqrStridedBatched(handle,
+                                       side,
+                                       trans,
+                                       m,
+                                       n,
+                                       k,
+                                       (hipDoubleComplex*)A,
+                                       lda,
+                                       strideA,
+                                       (hipDoubleComplex*)ipiv,
+                                       strideP,
+                                       (hipDoubleComplex*)C,
+                                       ldc,
+                                       strideC,
+                                       info,
+                                       batchCount);
+}
+
 // gels
 hipblasStatus_t hipblasCgelsCast(hipblasHandle_t    handle,
                                  hipblasOperation_t trans,
@@ -33,6 +33,7 @@
 #include <map>
 #include <mutex>
 #include <stdlib.h>
+#include <vector>
 
 #include "hipblas_test.hpp"
 #include "host_alloc.hpp"
@@ -62,6 +63,72 @@ inline void free_ptr_use(void* ptr)
     }
 }
 
+// blocks kept for reuse while host_set_retain_allocations is on
+static bool                         retain_allocations = false;
+static std::map<void*, size_t>      retained;
+static std::multimap<size_t, void*> parked;
+
+// smallest parked block which is large enough, or nullptr
+inline void* retained_ptr_use(size_t size)
+{
+    std::lock_guard<std::mutex> lock(mem_mutex);
+    if(!retain_allocations)
+        return nullptr;
+
+    auto block = parked.lower_bound(size);
+    if(block == parked.end())
+        return nullptr;
+
+    void* ptr = block->second;
+    parked.erase(block);
+    return ptr;
+}
+
+inline void retained_ptr_alloc(void* ptr, size_t size)
+{
+    std::lock_guard<std::mutex> lock(mem_mutex);
+    if(ptr && retain_allocations)
+        retained[ptr] = size;
+}
+
+// returns true if the block is kept for reuse instead of freed
+inline bool retained_ptr_free(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(mem_mutex);
+    auto                        block = retained.find(ptr);
+    if(block == retained.end())
+        return false;
+
+    if(retain_allocations)
+    {
+        parked.emplace(block->second, ptr);
+        return true;
+    }
+    retained.erase(block);
+    return false;
+}
+
+void host_set_retain_allocations(bool retain)
+{
+    std::vector<void*> release;
+    {
+        std::lock_guard<std::mutex> lock(mem_mutex);
+        retain_allocations = retain;
+        if(!retain)
+        {
+            for(auto& block : parked)
+            {
+                retained.erase(block.second);
+                release.push_back(block.second);
+            }
+            parked.clear();
+        }
+    }
+
+    for(void* ptr : release)
+        host_free(ptr);
+}
+
 size_t host_bytes_allocated()
 {
     std::lock_guard<std::mutex> lock(mem_mutex);
@@ -182,6 +249,9 @@ inline bool host_mem_safe(size_t n_bytes)
 
 void* host_malloc(size_t size)
 {
+    if(void* ptr = retained_ptr_use(size))
+        return ptr;
+
     if(host_mem_safe(size))
     {
         void* ptr = malloc(size);
@@ -203,6 +273,7 @@ void* host_malloc(size_t size)
             memset(ptr, value, size);
 
         alloc_ptr_use(ptr, size);
+        retained_ptr_alloc(ptr, size);
 
         return ptr;
     }
@@ -212,10 +283,14 @@ void* host_malloc(size_t size)
 
 void* host_calloc(size_t nmemb, size_t size)
 {
+    if(void* ptr = retained_ptr_use(nmemb * size))
+        return memset(ptr, 0, nmemb * size);
+
     if(host_mem_safe(nmemb * size))
     {
         void* ptr = calloc(nmemb, size);
         alloc_ptr_use(ptr, size);
+        retained_ptr_alloc(ptr, nmemb * size);
         return ptr;
     }
     else
@@ -224,6 +299,9 @@ void* host_calloc(size_t nmemb, size_t size)
 
 void host_free(void* ptr)
 {
+    if(retained_ptr_free(ptr))
+        return;
+
     free(ptr);
     free_ptr_use(ptr);
 }
@@ -28,12 +28,18 @@
 #include <random>
 #endif
 
+#include "argument_model.hpp"
+#include "d_vector.hpp"
 #include "hipblas.h"
 #include "hipblas_test.hpp"
 #include "utility.h"
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <stdexcept>
 #include <stdlib.h>
 
@@ -62,6 +68,163 @@ void d_vector_set_pad_length(size_t pad)
     g_DVEC_PAD = pad;
 }
 
+// device blocks kept for reuse while d_vector_set_retain_allocations is on
+static bool                         d_vector_retain = false;
+static std::map<void*, size_t>      d_vector_retained;
+static std::multimap<size_t, void*> d_vector_parked;
+static std::mutex                   d_vector_retain_mutex;
+
+void d_vector_set_retain_allocations(bool retain)
+{
+    std::lock_guard<std::mutex> lock(d_vector_retain_mutex);
+    d_vector_retain = retain;
+    if(!retain)
+    {
+        for(auto& block : d_vector_parked)
+        {
+            d_vector_retained.erase(block.second);
+            CHECK_HIP_ERROR((hipFree)(block.second));
+        }
+        d_vector_parked.clear();
+    }
+}
+
+hipError_t d_vector_malloc(void** ptr, size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(d_vector_retain_mutex);
+    if(d_vector_retain)
+    {
+        // smallest parked block which is large enough
+        auto block = d_vector_parked.lower_bound(bytes);
+        if(block != d_vector_parked.end())
+        {
+            *ptr = block->second;
+            d_vector_parked.erase(block);
+            return hipSuccess;
+        }
+    }
+
+    hipError_t status = (hipMalloc)(ptr, bytes);
+    if(status == hipSuccess && d_vector_retain)
+        d_vector_retained[*ptr] = bytes;
+    return status;
+}
+
+hipError_t d_vector_free(void* ptr)
+{
+    std::lock_guard<std::mutex> lock(d_vector_retain_mutex);
+    auto block = d_vector_retained.find(ptr);
+    if(block != d_vector_retained.end())
+    {
+        if(d_vector_retain)
+        {
+            d_vector_parked.emplace(block->second, ptr);
+            return hipSuccess;
+        }
+        d_vector_retained.erase(block);
+    }
+    return (hipFree)(ptr);
+}
+
+// rotating buffers of the timing loops of a thread, see d_vector.hpp
+static size_t d_vector_rotating_size = 0;
+
+namespace
+{
+    struct d_vector_rotation_state
+    {
+        std::vector<d_vector_rotating*> objects;
+        bool                            active = false;
+        bool                            hot    = false;
+        size_t                          index  = 0;
+    };
+
+    thread_local d_vector_rotation_state rotation;
+}
+
+d_vector_rotating::d_vector_rotating()
+{
+    rotation.objects.push_back(this);
+}
+
+d_vector_rotating::~d_vector_rotating()
+{
+    auto& objects = rotation.objects;
+    objects.erase(std::remove(objects.begin(), objects.end(), this), objects.end());
+}
+
+void d_vector_set_rotating_bytes(size_t bytes)
+{
+    d_vector_rotating_size = bytes;
+}
+
+void d_vector_start_rotation()
+{
+    d_vector_rotation_state& state = rotation;
+    if(state.active)
+    {
+        state.hot = true;
+        d_vector_end_rotation();
+    }
+
+    if(!d_vector_rotating_size)
+        return;
+
+    size_t bytes = 0;
+    for(d_vector_rotating* object : state.objects)
+        bytes += object->rotating_bytes();
+
+    // enough copies that their total exceeds the rotating size
+    size_t copies = bytes ? d_vector_rotating_size / bytes + 1 : 1;
+    if(copies < 2)
+        return;
+
+    for(d_vector_rotating* object : state.objects)
+    {
+        if(!object->rotating_setup(copies))
+        {
+            std::cout << "Warning: hip can't allocate " << copies << " rotating copies of "
+                      << bytes << " bytes, timing without rotating buffers" << std::endl;
+
+            for(d_vector_rotating* object : state.objects)
+                object->rotating_teardown();
+            return;
+        }
+    }
+
+    state.active = true;
+    state.hot    = false;
+    state.index  = 0;
+}
+
+void d_vector_rotate(size_t index, bool hot)
+{
+    d_vector_rotation_state& state = rotation;
+    if(state.active)
+    {
+        state.index = index;
+        state.hot   = hot;
+    }
+}
+
+void d_vector_end_rotation()
+{
+    d_vector_rotation_state& state = rotation;
+    if(!state.active || !state.hot)
+        return;
+
+    for(d_vector_rotating* object : state.objects)
+        object->rotating_teardown();
+
+    state.active = false;
+    state.index  = 0;
+}
+
+size_t d_vector_rotation()
+{
+    return rotation.index;
+}
+
 hipblas_rng_t hipblas_rng(69069);
 hipblas_rng_t hipblas_seed(hipblas_rng);
 
@@ -188,9 +351,34 @@ std::string hipblas_tempname()
  * local handles *
  *****************/
 
+// stream of the handles created by this thread, see hipblas_client_set_stream
+static thread_local hipStream_t client_stream = nullptr;
+
+// handle shared by the local handles of this thread, see hipblas_client_set_handle
+static thread_local hipblasHandle_t client_handle = nullptr;
+
+void hipblas_client_set_stream(hipStream_t stream)
+{
+    client_stream = stream;
+}
+
+void hipblas_client_set_handle(hipblasHandle_t handle)
+{
+    client_handle = handle;
+}
+
 hipblasLocalHandle::hipblasLocalHandle()
 {
+    if(client_handle)
+    {
+        m_handle = client_handle;
+        m_owned  = false;
+        return;
+    }
+
     auto status = hipblasCreate(&m_handle);
+    if(status == HIPBLAS_STATUS_SUCCESS && client_stream)
+        status = hipblasSetStream(m_handle, client_stream);
     if(status != HIPBLAS_STATUS_SUCCESS)
         throw std::runtime_error(hipblasStatusToString(status));
 }
@@ -198,6 +386,13 @@ hipblasLocalHandle::hipblasLocalHandle()
 hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
     : hipblasLocalHandle()
 {
+    // memory guard control, with multi-threading should not change values across threads
+    d_vector_set_pad_length(arg.pad);
+
+    // a shared handle is configured by its owner
+    if(!m_owned)
+        return;
+
     hipblasAtomicsMode_t mode;
     auto                 status = hipblasGetAtomicsMode(m_handle, &mode);
     if(status != HIPBLAS_STATUS_SUCCESS)
@@ -221,9 +416,6 @@ hipblasLocalHandle::hipblasLocalHandle(const Arguments& arg)
     {
         throw std::runtime_error(hipblasStatusToString(status));
     }
-
-    // memory guard control, with multi-threading should not change values across threads
-    d_vector_set_pad_length(arg.pad);
 }
 
 hipblasLocalHandle::~hipblasLocalHandle()
@@ -238,6 +430,9 @@ hipblasLocalHandle::~hipblasLocalHandle()
                       << hipGetErrorString(hipStatus) << "\n";
         }
     }
+    if(!m_owned)
+        return;
+
     hipblasStatus_t status = hipblasDestroy(m_handle);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
@@ -323,6 +518,157 @@ std::string getArchString()
     return deviceString;
 }
 
+namespace
+{
+    // Hip events recorded at the start of every hot iteration of a timing loop, and once more
+    // by the get_time_us_sync which ends the loop. The events are pooled for the later loops of
+    // the thread, and are not destroyed as the HIP runtime may be torn down before the thread.
+    struct hipblas_iteration_timer
+    {
+        bool                    active = false;
+        hipStream_t             stream = nullptr;
+        std::vector<hipEvent_t> events;
+        size_t                  recorded = 0;
+        std::vector<double>     times_us;
+
+        void record()
+        {
+            if(recorded == events.size())
+            {
+                hipEvent_t event;
+                if(hipEventCreate(&event) != hipSuccess)
+                {
+                    active = false;
+                    return;
+                }
+                events.push_back(event);
+            }
+            if(hipEventRecord(events[recorded], stream) == hipSuccess)
+                recorded++;
+        }
+    };
+
+    thread_local hipblas_iteration_timer iteration_timer;
+
+    // Host times taken to submit the hot iterations of a timing loop, each from the end of its
+    // hipblas_time_iteration to the next one, or to the get_time_us_sync which ends the loop
+    struct hipblas_submission_timer
+    {
+        bool                enabled  = false;
+        bool                active   = false;
+        hipStream_t         stream   = nullptr;
+        double              start_us = 0.0;
+        std::vector<double> times_us;
+
+        static double now_us()
+        {
+            auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return std::chrono::duration<double, std::micro>(now).count();
+        }
+
+        void end(hipStream_t s)
+        {
+            if(active && stream == s)
+            {
+                times_us.push_back(now_us() - start_us);
+                active = false;
+            }
+        }
+    };
+
+    thread_local hipblas_submission_timer submission_timer;
+
+    // see hipblas_set_timing_start_hook and hipblas_last_timing_start_us
+    thread_local std::function<void()> timing_start_hook;
+    thread_local double                timing_start_us = 0.0;
+}
+
+void hipblas_set_timing_start_hook(std::function<void()> hook)
+{
+    timing_start_hook = std::move(hook);
+}
+
+double hipblas_last_timing_start_us()
+{
+    return timing_start_us;
+}
+
+void hipblas_set_time_submission(bool time_submission)
+{
+    submission_timer.enabled = time_submission;
+}
+
+bool hipblas_take_submission_times(std::vector<double>& times_us)
+{
+    times_us.clear();
+    std::swap(times_us, submission_timer.times_us);
+    return !times_us.empty();
+}
+
+void hipblas_time_iteration(const Arguments& arg, int iter, hipStream_t stream, double& time_us)
+{
+    // the submission of the previous hot iteration ends here
+    hipblas_submission_timer& submission = submission_timer;
+    submission.end(stream);
+
+    // the copies of rotating buffers are made before the loop is timed
+    if(iter == 0)
+        d_vector_start_rotation();
+
+    if(iter == arg.cold_iters)
+    {
+        if(timing_start_hook)
+        {
+            std::function<void()> hook;
+            std::swap(hook, timing_start_hook);
+
+            (void)hipStreamSynchronize(stream);
+            hook();
+        }
+
+        time_us         = get_time_us_sync(stream);
+        timing_start_us = time_us;
+    }
+
+    // the loop ends at the next get_time_us_sync once it is hot, or at once without hot iterations
+    d_vector_rotate(iter, iter >= arg.cold_iters || arg.iters < 1);
+
+    if(iter < arg.cold_iters)
+        return;
+
+    if(ArgumentModel_get_log_iteration_stats())
+    {
+        hipblas_iteration_timer& timer = iteration_timer;
+        if(iter == arg.cold_iters)
+        {
+            timer.active   = true;
+            timer.stream   = stream;
+            timer.recorded = 0;
+            timer.times_us.clear();
+        }
+        if(timer.active)
+            timer.record();
+    }
+
+    if(submission.enabled)
+    {
+        if(iter == arg.cold_iters)
+        {
+            submission.stream = stream;
+            submission.times_us.clear();
+        }
+        submission.active   = true;
+        submission.start_us = hipblas_submission_timer::now_us();
+    }
+}
+
+bool hipblas_take_iteration_times(std::vector<double>& times_us)
+{
+    times_us.clear();
+    std::swap(times_us, iteration_timer.times_us);
+    return !times_us.empty();
+}
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -346,13 +692,36 @@ double get_time_us(void)
 /*! \brief  CPU Timer(in microsecond): synchronize with given queue/stream and return wall time */
 double get_time_us_sync(hipStream_t stream)
 {
+    // ends the submission and per-iteration timing of the loop on stream
+    submission_timer.end(stream);
+
+    hipblas_iteration_timer& timer  = iteration_timer;
+    bool                     finish = timer.active && timer.stream == stream;
+    if(finish)
+        timer.record();
+
     (void)hipStreamSynchronize(stream);
 
+    if(finish)
+    {
+        timer.active = false;
+        for(size_t i = 1; i < timer.recorded; i++)
+        {
+            float ms;
+            if(hipEventElapsedTime(&ms, timer.events[i - 1], timer.events[i]) == hipSuccess)
+                timer.times_us.push_back(ms * 1000.0);
+        }
+    }
+
     auto now = std::chrono::steady_clock::now();
     // now.time_since_epoch() is the dureation since epogh
     // which is converted to microseconds
     auto duration
         = std::chrono::duration_cast<std::chrono::microseconds>(now.time_since_epoch()).count();
+
+    // the copies of rotating buffers are freed after the loop is timed
+    d_vector_end_rotation();
+
     return (static_cast<double>(duration));
 };
 
@@ -20,6 +20,7 @@
  *
  * ************************************************************************ */
 
+#include "auxil/testing_pack_unpack_batched.hpp"
 #include "auxil/testing_set_get_matrix.hpp"
 #include "auxil/testing_set_get_matrix_async.hpp"
 #include "auxil/testing_set_get_vector.hpp"
@@ -36,7 +37,8 @@ namespace
         SG_MATRIX,
         SG_MATRIX_ASYNC,
         SG_VECTOR,
-        SG_VECTOR_ASYNC
+        SG_VECTOR_ASYNC,
+        PACK_UNPACK_BATCHED
     };
 
     // aux test template
@@ -76,6 +78,8 @@ namespace
                 return !strcmp(arg.function, "set_get_vector");
             case SG_VECTOR_ASYNC:
                 return !strcmp(arg.function, "set_get_vector_async");
+            case PACK_UNPACK_BATCHED:
+                return !strcmp(arg.function, "pack_unpack_batched");
             }
             return false;
         }
@@ -92,6 +96,8 @@ namespace
                 testname_set_get_vector(arg, name);
             else if constexpr(AUX_TYPE == SG_VECTOR_ASYNC)
                 testname_set_get_vector_async(arg, name);
+            else if constexpr(AUX_TYPE == PACK_UNPACK_BATCHED)
+                testname_pack_unpack_batched(arg, name);
             return std::move(name);
         }
     };
@@ -124,6 +130,8 @@ namespace
                 testing_set_get_vector<T>(arg);
             else if(!strcmp(arg.function, "set_get_vector_async"))
                 testing_set_get_vector_async<T>(arg);
+            else if(!strcmp(arg.function, "pack_unpack_batched"))
+                testing_pack_unpack_batched<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -157,4 +165,11 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(set_get_vector_async);
 
+    using pack_unpack_batched = aux_template<aux_testing, PACK_UNPACK_BATCHED>;
+    TEST_P(pack_unpack_batched, aux)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<aux_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(pack_unpack_batched);
+
 } // namespace
@@ -22,6 +22,7 @@
 
 #include "blas2/testing_ger.hpp"
 #include "blas2/testing_ger_batched.hpp"
+#include "blas2/testing_ger_deferred.hpp"
 #include "blas2/testing_ger_strided_batched.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -40,7 +41,10 @@ namespace
         GERC_BATCHED,
         GER_STRIDED_BATCHED,
         GERU_STRIDED_BATCHED,
-        GERC_STRIDED_BATCHED
+        GERC_STRIDED_BATCHED,
+        GER_DEFERRED,
+        GERU_DEFERRED,
+        GERC_DEFERRED
     };
 
     //ger test template
@@ -96,6 +100,12 @@ namespace
             case GERC_STRIDED_BATCHED:
                 return !strcmp(arg.function, "gerc_strided_batched")
                        || !strcmp(arg.function, "gerc_strided_batched_bad_arg");
+            case GER_DEFERRED:
+                return !strcmp(arg.function, "ger_deferred");
+            case GERU_DEFERRED:
+                return !strcmp(arg.function, "geru_deferred");
+            case GERC_DEFERRED:
+                return !strcmp(arg.function, "gerc_deferred");
             }
             return false;
         }
@@ -112,6 +122,9 @@ namespace
             else if constexpr(GER_TYPE == GER_STRIDED_BATCHED || GER_TYPE == GERU_STRIDED_BATCHED
                               || GER_TYPE == GERC_STRIDED_BATCHED)
                 testname_ger_strided_batched(arg, name);
+            else if constexpr(GER_TYPE == GER_DEFERRED || GER_TYPE == GERU_DEFERRED
+                              || GER_TYPE == GERC_DEFERRED)
+                testname_ger_deferred(arg, name);
             return std::move(name);
         }
     };
@@ -143,6 +156,8 @@ namespace
                 testing_ger_strided_batched<T, false>(arg);
             else if(!strcmp(arg.function, "ger_strided_batched_bad_arg"))
                 testing_ger_strided_batched_bad_arg<T, false>(arg);
+            else if(!strcmp(arg.function, "ger_deferred"))
+                testing_ger_deferred<T, false>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -174,6 +189,8 @@ namespace
                 testing_ger_strided_batched<T, false>(arg);
             else if(!strcmp(arg.function, "geru_strided_batched_bad_arg"))
                 testing_ger_strided_batched_bad_arg<T, false>(arg);
+            else if(!strcmp(arg.function, "geru_deferred"))
+                testing_ger_deferred<T, false>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -205,6 +222,8 @@ namespace
                 testing_ger_strided_batched<T, true>(arg);
             else if(!strcmp(arg.function, "gerc_strided_batched_bad_arg"))
                 testing_ger_strided_batched_bad_arg<T, true>(arg);
+            else if(!strcmp(arg.function, "gerc_deferred"))
+                testing_ger_deferred<T, true>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -273,4 +292,25 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gerc_strided_batched);
 
+    using ger_deferred = ger_template<ger_testing, GER_DEFERRED>;
+    TEST_P(ger_deferred, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<ger_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(ger_deferred);
+
+    using geru_deferred = ger_template<geru_testing, GERU_DEFERRED>;
+    TEST_P(geru_deferred, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<geru_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(geru_deferred);
+
+    using gerc_deferred = ger_template<gerc_testing, GERC_DEFERRED>;
+    TEST_P(gerc_deferred, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<gerc_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gerc_deferred);
+
 } // namespace
@@ -22,6 +22,7 @@
 
 #include "blas2/testing_trsv.hpp"
 #include "blas2/testing_trsv_batched.hpp"
+#include "blas2/testing_trsv_deferred.hpp"
 #include "blas2/testing_trsv_strided_batched.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +36,7 @@ namespace
         TRSV,
         TRSV_BATCHED,
         TRSV_STRIDED_BATCHED,
+        TRSV_DEFERRED,
     };
 
     //trsv test template
@@ -74,6 +76,8 @@ namespace
             case TRSV_STRIDED_BATCHED:
                 return !strcmp(arg.function, "trsv_strided_batched")
                        || !strcmp(arg.function, "trsv_strided_batched_bad_arg");
+            case TRSV_DEFERRED:
+                return !strcmp(arg.function, "trsv_deferred");
             }
             return false;
         }
@@ -88,6 +92,8 @@ namespace
                 testname_trsv_batched(arg, name);
             else if constexpr(TRSV_TYPE == TRSV_STRIDED_BATCHED)
                 testname_trsv_strided_batched(arg, name);
+            else if constexpr(TRSV_TYPE == TRSV_DEFERRED)
+                testname_trsv_deferred(arg, name);
             return std::move(name);
         }
     };
@@ -124,6 +130,8 @@ namespace
                 testing_trsv_strided_batched<T>(arg);
             else if(!strcmp(arg.function, "trsv_strided_batched_bad_arg"))
                 testing_trsv_strided_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "trsv_deferred"))
+                testing_trsv_deferred<T>(arg);
             else
                 FAIL() << "Internal error: Test called with unknown function: " << arg.function;
         }
@@ -150,4 +158,11 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(trsv_strided_batched);
 
+    using trsv_deferred = trsv_template<trsv_testing, TRSV_DEFERRED>;
+    TEST_P(trsv_deferred, blas2)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(hipblas_simple_dispatch<trsv_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(trsv_deferred);
+
 } // namespace
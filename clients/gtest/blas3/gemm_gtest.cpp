@@ -22,6 +22,9 @@
 
 #include "blas3/testing_gemm.hpp"
 #include "blas3/testing_gemm_batched.hpp"
+#include "blas3/testing_gemm_real.hpp"
+#include "blas3/testing_gemm_real_batched.hpp"
+#include "blas3/testing_gemm_real_strided_batched.hpp"
 #include "blas3/testing_gemm_strided_batched.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +38,9 @@ namespace
         GEMM,
         GEMM_BATCHED,
         GEMM_STRIDED_BATCHED,
+        GEMM_REAL,
+        GEMM_REAL_BATCHED,
+        GEMM_REAL_STRIDED_BATCHED,
     };
 
     // gemm test template
@@ -74,6 +80,14 @@ namespace
             case GEMM_STRIDED_BATCHED:
                 return !strcmp(arg.function, "gemm_strided_batched")
                        || !strcmp(arg.function, "gemm_strided_batched_bad_arg");
+            case GEMM_REAL:
+                return !strcmp(arg.function, "gemm_real_b") || !strcmp(arg.function, "gemm_real_a");
+            case GEMM_REAL_BATCHED:
+                return !strcmp(arg.function, "gemm_real_b_batched")
+                       || !strcmp(arg.function, "gemm_real_a_batched");
+            case GEMM_REAL_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gemm_real_b_strided_batched")
+                       || !strcmp(arg.function, "gemm_real_a_strided_batched");
             }
             return false;
         }
@@ -88,6 +102,12 @@ namespace
                 testname_gemm_batched(arg, name);
             else if constexpr(GEMM_TYPE == GEMM_STRIDED_BATCHED)
                 testname_gemm_strided_batched(arg, name);
+            else if constexpr(GEMM_TYPE == GEMM_REAL)
+                testname_gemm_real(arg, name);
+            else if constexpr(GEMM_TYPE == GEMM_REAL_BATCHED)
+                testname_gemm_real_batched(arg, name);
+            else if constexpr(GEMM_TYPE == GEMM_REAL_STRIDED_BATCHED)
+                testname_gemm_real_strided_batched(arg, name);
             return std::move(name);
         }
     };
@@ -129,6 +149,38 @@ namespace
         }
     };
 
+    // gemm with one real operand is only defined for complex types
+    template <typename, typename = void>
+    struct gemm_real_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm_real_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, hipblasComplex>
+                         || std::is_same_v<T, hipblasDoubleComplex>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_real_b"))
+                testing_gemm_real<T, true>(arg);
+            else if(!strcmp(arg.function, "gemm_real_a"))
+                testing_gemm_real<T, false>(arg);
+            else if(!strcmp(arg.function, "gemm_real_b_batched"))
+                testing_gemm_real_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "gemm_real_a_batched"))
+                testing_gemm_real_batched<T, false>(arg);
+            else if(!strcmp(arg.function, "gemm_real_b_strided_batched"))
+                testing_gemm_real_strided_batched<T, true>(arg);
+            else if(!strcmp(arg.function, "gemm_real_a_strided_batched"))
+                testing_gemm_real_strided_batched<T, false>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
     using gemm = gemm_template<gemm_testing, GEMM>;
     TEST_P(gemm, blas3)
     {
@@ -150,4 +202,28 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched);
 
+    using gemm_real = gemm_template<gemm_real_testing, GEMM_REAL>;
+    TEST_P(gemm_real, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_real_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_real);
+
+    using gemm_real_batched = gemm_template<gemm_real_testing, GEMM_REAL_BATCHED>;
+    TEST_P(gemm_real_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_real_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_real_batched);
+
+    using gemm_real_strided_batched = gemm_template<gemm_real_testing, GEMM_REAL_STRIDED_BATCHED>;
+    TEST_P(gemm_real_strided_batched, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_real_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_real_strided_batched);
+
 } // namespace
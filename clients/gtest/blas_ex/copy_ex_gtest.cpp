@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "blas_ex/testing_copy_ex.hpp"
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible copy_ex test cases
+    enum copy_ex_test_type
+    {
+        COPY_EX,
+        COPY_MATRIX_EX,
+    };
+
+    // copy_ex test template
+    template <template <typename...> class FILTER, copy_ex_test_type COPY_EX_TYPE>
+    struct copy_ex_template : HipBLAS_Test<copy_ex_template<FILTER, COPY_EX_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_copy_ex_dispatch<copy_ex_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(COPY_EX_TYPE)
+            {
+            case COPY_EX:
+                return !strcmp(arg.function, "copy_ex") || !strcmp(arg.function, "copy_ex_bad_arg");
+            case COPY_MATRIX_EX:
+                return !strcmp(arg.function, "copy_matrix_ex")
+                       || !strcmp(arg.function, "copy_matrix_ex_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(COPY_EX_TYPE == COPY_EX)
+                testname_copy_ex(arg, name);
+            else if constexpr(COPY_EX_TYPE == COPY_MATRIX_EX)
+                testname_copy_matrix_ex(arg, name);
+            return std::move(name);
+        }
+    };
+
+    template <typename T>
+    constexpr bool copy_ex_type
+        = std::is_same_v<T, hipblasHalf> || std::is_same_v<T, hipblasBfloat16>
+          || std::is_same_v<T, float> || std::is_same_v<T, double>
+          || std::is_same_v<T, hipblasComplex> || std::is_same_v<T, hipblasDoubleComplex>;
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed third parameter is used for enable_if_t below.
+    template <typename, typename = void, typename = void>
+    struct copy_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    // Copies within one type, and conversions from half and bfloat16 to float, are valid
+    template <typename Ta, typename Tb>
+    struct copy_ex_testing<
+        Ta,
+        Tb,
+        std::enable_if_t<copy_ex_type<Ta>
+                         && (std::is_same_v<Ta, Tb>
+                             || ((std::is_same_v<Ta, hipblasHalf>
+                                  || std::is_same_v<Ta, hipblasBfloat16>)
+                                 && std::is_same_v<Tb, float>))>> : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "copy_ex"))
+                testing_copy_ex<Ta, Tb>(arg);
+            else if(!strcmp(arg.function, "copy_ex_bad_arg"))
+                testing_copy_ex_bad_arg<Ta, Tb>(arg);
+            else if(!strcmp(arg.function, "copy_matrix_ex"))
+                testing_copy_matrix_ex<Ta, Tb>(arg);
+            else if(!strcmp(arg.function, "copy_matrix_ex_bad_arg"))
+                testing_copy_matrix_ex_bad_arg<Ta, Tb>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using copy_ex = copy_ex_template<copy_ex_testing, COPY_EX>;
+    TEST_P(copy_ex, blas_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_copy_ex_dispatch<copy_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(copy_ex);
+
+    using copy_matrix_ex = copy_ex_template<copy_ex_testing, COPY_MATRIX_EX>;
+    TEST_P(copy_matrix_ex, blas_ex)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_copy_ex_dispatch<copy_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(copy_matrix_ex);
+
+} // namespace
@@ -21,7 +21,10 @@
  * ************************************************************************ */
 
 #include "blas_ex/testing_gemm_batched_ex.hpp"
+#include "blas_ex/testing_gemm_batched_reduce_ex.hpp"
 #include "blas_ex/testing_gemm_ex.hpp"
+#include "blas_ex/testing_gemm_ex_emulated.hpp"
+#include "blas_ex/testing_gemm_indexed_ex.hpp"
 #include "blas_ex/testing_gemm_strided_batched_ex.hpp"
 #include "hipblas_data.hpp"
 #include "hipblas_test.hpp"
@@ -35,6 +38,9 @@ namespace
         GEMM_EX,
         GEMM_BATCHED_EX,
         GEMM_STRIDED_BATCHED_EX,
+        GEMM_EX_EMULATED,
+        GEMM_BATCHED_REDUCE_EX,
+        GEMM_INDEXED_EX,
     };
 
     // gemm test template
@@ -82,6 +88,12 @@ namespace
             case GEMM_STRIDED_BATCHED_EX:
                 return !strcmp(arg.function, "gemm_strided_batched_ex")
                        || !strcmp(arg.function, "gemm_strided_batched_ex_bad_arg");
+            case GEMM_EX_EMULATED:
+                return !strcmp(arg.function, "gemm_ex_emulated");
+            case GEMM_BATCHED_REDUCE_EX:
+                return !strcmp(arg.function, "gemm_batched_reduce_ex");
+            case GEMM_INDEXED_EX:
+                return !strcmp(arg.function, "gemm_indexed_ex");
             }
             return false;
         }
@@ -96,6 +108,12 @@ namespace
                 testname_gemm_batched_ex(arg, name);
             else if constexpr(GEMM_EX_TYPE == GEMM_STRIDED_BATCHED_EX)
                 testname_gemm_strided_batched_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_EX_EMULATED)
+                testname_gemm_ex_emulated(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_BATCHED_REDUCE_EX)
+                testname_gemm_batched_reduce_ex(arg, name);
+            else if constexpr(GEMM_EX_TYPE == GEMM_INDEXED_EX)
+                testname_gemm_indexed_ex(arg, name);
             return std::move(name);
         }
     };
@@ -163,4 +181,90 @@ namespace
     }
     INSTANTIATE_TEST_CATEGORIES(gemm_strided_batched_ex);
 
+    // The emulated compute type is only defined for float
+    template <typename T, typename = void>
+    struct gemm_ex_emulated_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm_ex_emulated_testing<T, std::enable_if_t<std::is_same_v<T, float>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_ex_emulated"))
+                testing_gemm_ex_emulated<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_ex_emulated = gemm_ex_template<gemm_ex_emulated_testing, GEMM_EX_EMULATED>;
+    TEST_P(gemm_ex_emulated, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_ex_emulated_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_ex_emulated);
+
+    template <typename T, typename = void>
+    struct gemm_batched_reduce_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm_batched_reduce_ex_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>
+                         || std::is_same_v<T, hipblasComplex>
+                         || std::is_same_v<T, hipblasDoubleComplex>>> : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_batched_reduce_ex"))
+                testing_gemm_batched_reduce_ex<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_batched_reduce_ex
+        = gemm_ex_template<gemm_batched_reduce_ex_testing, GEMM_BATCHED_REDUCE_EX>;
+    TEST_P(gemm_batched_reduce_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_batched_reduce_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_batched_reduce_ex);
+
+    template <typename T, typename = void>
+    struct gemm_indexed_ex_testing : hipblas_test_invalid
+    {
+    };
+
+    template <typename T>
+    struct gemm_indexed_ex_testing<
+        T,
+        std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>
+                         || std::is_same_v<T, hipblasComplex>
+                         || std::is_same_v<T, hipblasDoubleComplex>>> : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gemm_indexed_ex"))
+                testing_gemm_indexed_ex<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gemm_indexed_ex = gemm_ex_template<gemm_indexed_ex_testing, GEMM_INDEXED_EX>;
+    TEST_P(gemm_indexed_ex, blas3)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gemm_indexed_ex_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gemm_indexed_ex);
+
 } // namespace
@@ -0,0 +1,151 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_data.hpp"
+#include "hipblas_test.hpp"
+#include "solver/testing_gesv_ir.hpp"
+#include "solver/testing_gesv_ir_batched.hpp"
+#include "solver/testing_gesv_ir_strided_batched.hpp"
+#include "type_dispatch.hpp"
+
+namespace
+{
+    // possible gesv_ir test cases
+    enum gesv_ir_test_type
+    {
+        GESV_IR,
+        GESV_IR_BATCHED,
+        GESV_IR_STRIDED_BATCHED,
+    };
+
+    //gesv_ir test template
+    template <template <typename...> class FILTER, gesv_ir_test_type GESV_IR_TYPE>
+    struct gesv_ir_template : HipBLAS_Test<gesv_ir_template<FILTER, GESV_IR_TYPE>, FILTER>
+    {
+        template <typename... T>
+        struct type_filter_functor
+        {
+            bool operator()(const Arguments& args)
+            {
+                // additional global filters applied first
+                if(!hipblas_client_global_filters(args))
+                    return false;
+
+                // type filters
+                return static_cast<bool>(FILTER<T...>{});
+            }
+        };
+
+        // Filter for which types apply to this suite
+        static bool type_filter(const Arguments& arg)
+        {
+            return hipblas_simple_dispatch<gesv_ir_template::template type_filter_functor>(arg);
+        }
+
+        // Filter for which functions apply to this suite
+        static bool function_filter(const Arguments& arg)
+        {
+            switch(GESV_IR_TYPE)
+            {
+            case GESV_IR:
+                return !strcmp(arg.function, "gesv_ir") || !strcmp(arg.function, "gesv_ir_bad_arg");
+            case GESV_IR_BATCHED:
+                return !strcmp(arg.function, "gesv_ir_batched")
+                       || !strcmp(arg.function, "gesv_ir_batched_bad_arg");
+            case GESV_IR_STRIDED_BATCHED:
+                return !strcmp(arg.function, "gesv_ir_strided_batched")
+                       || !strcmp(arg.function, "gesv_ir_strided_batched_bad_arg");
+            }
+            return false;
+        }
+
+        // Google Test name suffix based on parameters
+        static std::string name_suffix(const Arguments& arg)
+        {
+            std::string name;
+            if constexpr(GESV_IR_TYPE == GESV_IR)
+                testname_gesv_ir(arg, name);
+            else if constexpr(GESV_IR_TYPE == GESV_IR_BATCHED)
+                testname_gesv_ir_batched(arg, name);
+            else if constexpr(GESV_IR_TYPE == GESV_IR_STRIDED_BATCHED)
+                testname_gesv_ir_strided_batched(arg, name);
+            return std::move(name);
+        }
+    };
+
+    // By default, arbitrary type combinations are invalid.
+    // The unnamed second parameter is used for enable_if_t below.
+    template <typename, typename = void>
+    struct gesv_ir_testing : hipblas_test_invalid
+    {
+    };
+
+    // When the condition in the second argument is satisfied, the type combination
+    // is valid. When the condition is false, this specialization does not apply.
+    template <typename T>
+    struct gesv_ir_testing<T, std::enable_if_t<std::is_same_v<T, double>>>
+        : hipblas_test_valid
+    {
+        void operator()(const Arguments& arg)
+        {
+            if(!strcmp(arg.function, "gesv_ir"))
+                testing_gesv_ir<T>(arg);
+            else if(!strcmp(arg.function, "gesv_ir_bad_arg"))
+                testing_gesv_ir_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesv_ir_batched"))
+                testing_gesv_ir_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesv_ir_batched_bad_arg"))
+                testing_gesv_ir_batched_bad_arg<T>(arg);
+            else if(!strcmp(arg.function, "gesv_ir_strided_batched"))
+                testing_gesv_ir_strided_batched<T>(arg);
+            else if(!strcmp(arg.function, "gesv_ir_strided_batched_bad_arg"))
+                testing_gesv_ir_strided_batched_bad_arg<T>(arg);
+            else
+                FAIL() << "Internal error: Test called with unknown function: " << arg.function;
+        }
+    };
+
+    using gesv_ir = gesv_ir_template<gesv_ir_testing, GESV_IR>;
+    TEST_P(gesv_ir, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesv_ir_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesv_ir);
+
+    using gesv_ir_batched = gesv_ir_template<gesv_ir_testing, GESV_IR_BATCHED>;
+    TEST_P(gesv_ir_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesv_ir_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesv_ir_batched);
+
+    using gesv_ir_strided_batched = gesv_ir_template<gesv_ir_testing, GESV_IR_STRIDED_BATCHED>;
+    TEST_P(gesv_ir_strided_batched, solver)
+    {
+        CATCH_SIGNALS_AND_EXCEPTIONS_AS_FAILURES(
+            hipblas_simple_dispatch<gesv_ir_testing>(GetParam()));
+    }
+    INSTANTIATE_TEST_CATEGORIES(gesv_ir_strided_batched);
+
+} // namespace
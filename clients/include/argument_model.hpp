@@ -28,6 +28,8 @@
 #include <algorithm>
 #include <iostream>
 #include <sstream>
+#include <string>
+#include <vector>
 
 namespace ArgumentLogging
 {
@@ -41,6 +43,57 @@ bool ArgumentModel_get_log_function_name();
 void ArgumentModel_set_log_datatype(bool d);
 bool ArgumentModel_get_log_datatype();
 
+void ArgumentModel_set_log_iteration_stats(bool s);
+bool ArgumentModel_get_log_iteration_stats();
+
+// timing and error fields of a structured output record, NA_value when not measured
+struct ArgumentModel_perf_record
+{
+    double gflops            = ArgumentLogging::NA_value;
+    double gbytes_per_s      = ArgumentLogging::NA_value;
+    double us                = ArgumentLogging::NA_value;
+    double min_us            = ArgumentLogging::NA_value;
+    double median_us         = ArgumentLogging::NA_value;
+    double p90_us            = ArgumentLogging::NA_value;
+    double p99_us            = ArgumentLogging::NA_value;
+    double max_us            = ArgumentLogging::NA_value;
+    double stddev_us         = ArgumentLogging::NA_value;
+    double gflops_median     = ArgumentLogging::NA_value;
+    double norm_error_host   = ArgumentLogging::NA_value;
+    double norm_error_device = ArgumentLogging::NA_value;
+};
+
+// appends the statistics of the hot iterations of the last timing loop, if they were timed
+void ArgumentModel_log_iteration_stats(std::stringstream&         name_line,
+                                       std::stringstream&         val_line,
+                                       double                     gflops,
+                                       ArgumentModel_perf_record& perf);
+
+// structured output of hipblas-bench, format is "json" (one object per line) or "csv", and records
+// are appended to file, or written to stdout instead of the name and value lines if file is empty
+bool ArgumentModel_set_output(const std::string& format, const std::string& file);
+bool ArgumentModel_get_log_record();
+bool ArgumentModel_get_log_to_file();
+
+// writes the record of one timed call with every argument, the timing and the run metadata
+void ArgumentModel_log_record(const Arguments& arg, const ArgumentModel_perf_record& perf);
+
+// the name and value lines of one call, captured by the thread instead of being printed
+struct ArgumentModel_result
+{
+    std::string               names;
+    std::string               values;
+    ArgumentModel_perf_record perf;
+};
+
+// while capturing, log_args of this thread saves its results for ArgumentModel_take_results
+void ArgumentModel_set_capture_results(bool capture);
+bool ArgumentModel_get_capture_results();
+void ArgumentModel_capture_result(const std::string&               names,
+                                  const std::string&               values,
+                                  const ArgumentModel_perf_record& perf);
+std::vector<ArgumentModel_result> ArgumentModel_take_results();
+
 // ArgumentModel template has a variadic list of argument enums
 template <hipblas_argument... Args>
 class ArgumentModel
@@ -59,15 +112,35 @@ class ArgumentModel
         return has(param, rest...);
     }
 
+    // Tuning knobs of a routine are only printed when set, so that the default columns and test
+    // names are those of the routine's own arguments
+    static bool unset_knob(hipblas_argument param, const Arguments& arg)
+    {
+        switch(param)
+        {
+        case e_split_k:
+            return !arg.split_k;
+        case e_strassen_levels:
+            return !arg.strassen_levels;
+        case e_gemm_order:
+            return !arg.gemm_order;
+        case e_qr_algo:
+            return !arg.qr_algo;
+        default:
+            return false;
+        }
+    }
+
 public:
-    void log_perf(std::stringstream& name_line,
-                  std::stringstream& val_line,
-                  const Arguments&   arg,
-                  double             gpu_us,
-                  double             gflops,
-                  double             gbytes,
-                  double             norm1,
-                  double             norm2)
+    void log_perf(std::stringstream&         name_line,
+                  std::stringstream&         val_line,
+                  const Arguments&           arg,
+                  double                     gpu_us,
+                  double                     gflops,
+                  double                     gbytes,
+                  double                     norm1,
+                  double                     norm2,
+                  ArgumentModel_perf_record& perf)
     {
         bool has_batch_count = has(e_batch_count, Args...);
         int  batch_count     = has_batch_count ? arg.batch_count : 1;
@@ -85,12 +158,22 @@ public:
             val_line << ",";
         val_line << hipblas_gflops << ", " << hipblas_GBps << ", " << gpu_us / hot_calls << ", ";
 
+        perf.gflops       = hipblas_gflops;
+        perf.gbytes_per_s = hipblas_GBps;
+        perf.us           = gpu_us / hot_calls;
+
+        if(ArgumentModel_get_log_iteration_stats())
+            ArgumentModel_log_iteration_stats(name_line, val_line, gflops * batch_count, perf);
+
         if(arg.unit_check || arg.norm_check)
         {
             if(arg.norm_check)
             {
                 name_line << "norm_error_host_ptr,norm_error_device_ptr,";
                 val_line << norm1 << ", " << norm2 << ", ";
+
+                perf.norm_error_host   = norm1;
+                perf.norm_error_device = norm2;
             }
         }
     }
@@ -168,16 +251,25 @@ public:
 
 #if __cplusplus >= 201703L
         // C++17
-        (ArgumentsHelper::apply<Args>(print, arg, T{}), ...);
+        ((unset_knob(Args, arg) ? void() : ArgumentsHelper::apply<Args>(print, arg, T{})), ...);
 #else
         // C++14. TODO: Remove when C++17 is used
-        (void)(int[]){(ArgumentsHelper::apply<Args>{}()(print, arg, T{}), 0)...};
+        (void)(int[]){
+            (unset_knob(Args, arg) ? void() : ArgumentsHelper::apply<Args>{}()(print, arg, T{}),
+             0)...};
 #endif
 
+        ArgumentModel_perf_record perf;
         if(arg.timing)
-            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2);
+            log_perf(name_list, value_list, arg, gpu_us, gflops, gpu_bytes, norm1, norm2, perf);
+
+        if(ArgumentModel_get_log_record())
+            ArgumentModel_log_record(arg, perf);
 
-        str << name_list.str() << "\n" << value_list.str() << std::endl;
+        if(ArgumentModel_get_capture_results())
+            ArgumentModel_capture_result(name_list.str(), value_list.str(), perf);
+        else if(!ArgumentModel_get_log_record() || ArgumentModel_get_log_to_file())
+            str << name_list.str() << "\n" << value_list.str() << std::endl;
     }
 
     void test_name(const Arguments& arg, std::string& name)
@@ -196,10 +288,13 @@ public:
 
 #if __cplusplus >= 201703L
         // C++17
-        (ArgumentsHelper::apply<Args>(print, arg, float{}), ...);
+        ((unset_knob(Args, arg) ? void() : ArgumentsHelper::apply<Args>(print, arg, float{})),
+         ...);
 #else
         // C++14. TODO: Remove when C++17 is used
-        (void)(int[]){(ArgumentsHelper::apply<Args>{}()(print, arg, float{}), 0)...};
+        (void)(int[]){
+            (unset_knob(Args, arg) ? void() : ArgumentsHelper::apply<Args>{}()(print, arg, float{}),
+             0)...};
 #endif
 
         std::string params = name_list.str();
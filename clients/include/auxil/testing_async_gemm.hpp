@@ -0,0 +1,142 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <iostream>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#include "hipblas_async.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasAsyncGemmModel = ArgumentModel<e_M, e_N, e_K>;
+
+inline void testname_async_gemm(const Arguments& arg, std::string& name)
+{
+    hipblasAsyncGemmModel{}.test_name(arg, name);
+}
+
+// The future returned by hipblas::gemm must hold the result of hipblasSgemm once waited for, and
+// a continuation attached with then must run through the given executor. Errors found when the
+// call is queued make the future ready at once.
+void testing_async_gemm(const Arguments& arg)
+{
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    hipblasLocalHandle handle(arg);
+    float              alpha = 2, beta = 1;
+
+    if(M < 0 || N < 0 || K < 0)
+    {
+        hipblas::future bad = hipblas::gemm<float>(handle,
+                                                   HIPBLAS_OP_N,
+                                                   HIPBLAS_OP_N,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &alpha,
+                                                   nullptr,
+                                                   std::max(M, 1),
+                                                   nullptr,
+                                                   std::max(K, 1),
+                                                   &beta,
+                                                   nullptr,
+                                                   std::max(M, 1));
+        EXPECT_TRUE(bad.ready());
+        EXPECT_HIPBLAS_STATUS(bad.wait(), HIPBLAS_STATUS_INVALID_VALUE);
+        return;
+    }
+
+    int lda = std::max(M, 1), ldb = std::max(K, 1), ldc = std::max(M, 1);
+
+    host_matrix<float> hA(M, K, lda);
+    host_matrix<float> hB(K, N, ldb);
+    host_matrix<float> hC(M, N, ldc);
+    host_matrix<float> hC_sync(M, N, ldc);
+    host_matrix<float> hC_async(M, N, ldc);
+
+    device_matrix<float> dA(M, K, lda);
+    device_matrix<float> dB(K, N, ldb);
+    device_matrix<float> dC(M, N, ldc);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // reference result from the synchronous interface
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc));
+    CHECK_HIP_ERROR(hC_sync.transfer_from(dC));
+
+    // wait
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    hipblas::future done = hipblas::gemm<float>(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+    ASSERT_TRUE(done.valid());
+    CHECK_HIPBLAS_ERROR(done.wait());
+    EXPECT_TRUE(done.ready());
+    CHECK_HIP_ERROR(hC_async.transfer_from(dC));
+    unit_check_general<float>(M, N, ldc, hC_sync, hC_async);
+
+    // then, with the continuation passed to an executor counting its calls
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    std::atomic<int> executed{0};
+    std::atomic<int> status{-1};
+
+    auto executor = [&](std::function<void()> f) {
+        executed++;
+        f();
+    };
+    done = hipblas::gemm<float>(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+    done.then(executor, [&](hipblasStatus_t s) { status = s; });
+    CHECK_HIPBLAS_ERROR(done.wait());
+
+    // the continuation runs after the state becomes ready, so it may still be in flight
+    while(status.load() < 0)
+        std::this_thread::yield();
+    EXPECT_EQ(executed.load(), 1);
+    EXPECT_EQ(status.load(), int(HIPBLAS_STATUS_SUCCESS));
+    CHECK_HIP_ERROR(hC_async.transfer_from(dC));
+    unit_check_general<float>(M, N, ldc, hC_sync, hC_async);
+
+    // then on a finished future runs the continuation at once
+    status = -1;
+    done.then([&](hipblasStatus_t s) { status = s; });
+    EXPECT_EQ(status.load(), int(HIPBLAS_STATUS_SUCCESS));
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas_expr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasExpressionModel = ArgumentModel<e_M, e_N, e_K>;
+
+inline void testname_expression(const Arguments& arg, std::string& name)
+{
+    hipblasExpressionModel{}.test_name(arg, name);
+}
+
+// Each expression must give the same result as the routine it is mapped onto, called directly
+void testing_expression(const Arguments& arg)
+{
+    using namespace hipblas;
+
+    int M = arg.M;
+    int N = arg.N;
+    int K = arg.K;
+
+    hipblasLocalHandle handle(arg);
+
+    // sizes are checked when an expression is assigned
+    if(M <= 0 || N <= 0 || K <= 0)
+    {
+        matrix_view<float> A(handle, nullptr, M, K, std::max(M, 1));
+        matrix_view<float> B(handle, nullptr, K + 1, N, std::max(K + 1, 1));
+        matrix_view<float> C(handle, nullptr, M, N, std::max(M, 1));
+        EXPECT_HIPBLAS_STATUS(assign(C, A * B), HIPBLAS_STATUS_INVALID_VALUE);
+        EXPECT_THROW(C = A * B, hipblas::error);
+        return;
+    }
+
+    float alpha = 2, beta = -1;
+
+    host_matrix<float> hA(M, K, M);
+    host_matrix<float> hB(K, N, K);
+    host_matrix<float> hC(M, N, M);
+    host_matrix<float> hT(M, M, M);
+    host_vector<float> hx(K);
+    host_vector<float> hy(M);
+    host_matrix<float> hC_ref(M, N, M);
+    host_matrix<float> hC_expr(M, N, M);
+    host_vector<float> hy_ref(M);
+    host_vector<float> hy_expr(M);
+
+    device_matrix<float> dA(M, K, M);
+    device_matrix<float> dB(K, N, K);
+    device_matrix<float> dC(M, N, M);
+    device_matrix<float> dT(M, M, M);
+    device_matrix<float> dS(M, M, M);
+    device_vector<float> dx(K);
+    device_vector<float> dy(M);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(dT.memcheck());
+    CHECK_DEVICE_ALLOCATION(dS.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    hipblas_init_matrix(hT, arg, hipblas_client_never_set_nan, hipblas_triangular_matrix);
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, false, true);
+    hipblas_init_vector(hy, arg, hipblas_client_never_set_nan);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dT.transfer_from(hT));
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    // scalars are read from the host in either pointer mode
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+    matrix_view<float> A(handle, dA, M, K);
+    matrix_view<float> B(handle, dB, K, N);
+    matrix_view<float> C(handle, dC, M, N);
+    matrix_view<float> T(handle, dT, M, M);
+    matrix_view<float> S(handle, dS, M, M);
+    vector_view<float> x(handle, dx, K);
+    vector_view<float> y(handle, dy, M);
+
+    // gemm
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    C = alpha * A * B + beta * C;
+    CHECK_HIP_ERROR(hC_expr.transfer_from(dC));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasSgemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, M, N, K, &alpha, dA, M, dB, K, &beta, dC, M));
+    CHECK_HIP_ERROR(hC_ref.transfer_from(dC));
+    unit_check_general<float>(M, N, M, hC_ref, hC_expr);
+
+    // syrk, which leaves the other triangle of S as it was
+    host_matrix<float> hS_ref(M, M, M);
+    host_matrix<float> hS_expr(M, M, M);
+    CHECK_HIP_ERROR(dS.transfer_from(hT));
+    lower(S) = alpha * A * transpose(A) + beta * S;
+    CHECK_HIP_ERROR(hS_expr.transfer_from(dS));
+
+    CHECK_HIP_ERROR(dS.transfer_from(hT));
+    CHECK_HIPBLAS_ERROR(hipblasSsyrk(
+        handle, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_OP_N, M, K, &alpha, dA, M, &beta, dS, M));
+    CHECK_HIP_ERROR(hS_ref.transfer_from(dS));
+    unit_check_general<float>(M, M, M, hS_ref, hS_expr);
+
+    // trmm, in place
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    C = alpha * transpose(upper(T)) * C;
+    CHECK_HIP_ERROR(hC_expr.transfer_from(dC));
+
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIPBLAS_ERROR(hipblasStrmm(handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     HIPBLAS_FILL_MODE_UPPER,
+                                     HIPBLAS_OP_T,
+                                     HIPBLAS_DIAG_NON_UNIT,
+                                     M,
+                                     N,
+                                     &alpha,
+                                     dT,
+                                     M,
+                                     dC,
+                                     M,
+                                     dC,
+                                     M));
+    CHECK_HIP_ERROR(hC_ref.transfer_from(dC));
+    unit_check_general<float>(M, N, M, hC_ref, hC_expr);
+
+    // gemv
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    y = A * x + beta * y;
+    CHECK_HIP_ERROR(hy_expr.transfer_from(dy));
+
+    float one = 1;
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+    CHECK_HIPBLAS_ERROR(
+        hipblasSgemv(handle, HIPBLAS_OP_N, M, K, &one, dA, M, dx, 1, &beta, dy, 1));
+    CHECK_HIP_ERROR(hy_ref.transfer_from(dy));
+    unit_check_general<float>(1, M, 1, hy_ref, hy_expr);
+
+    // a product which does not conform
+    EXPECT_HIPBLAS_STATUS(assign(C, B * A), HIPBLAS_STATUS_INVALID_VALUE);
+}
@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasInfoSummaryModel = ArgumentModel<e_batch_count>;
+
+inline void testname_info_summary(const Arguments& arg, std::string& name)
+{
+    hipblasInfoSummaryModel{}.test_name(arg, name);
+}
+
+void testing_info_summary_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+    const int          batch_count = 100;
+    int                first, count;
+
+    device_vector<int> dInfo(batch_count);
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummary(nullptr, dInfo, batch_count, &first, &count),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummary(handle, dInfo, -1, &first, &count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummary(handle, nullptr, batch_count, &first, &count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummary(handle, dInfo, batch_count, nullptr, &count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasInfoSummary(handle, dInfo, batch_count, &first, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If batch_count == 0, info can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasInfoSummary(handle, nullptr, 0, &first, &count));
+}
+
+// Every seventh entry of info from index 3 on is nonzero, with alternating signs, so the first
+// failure is at index 3 when batch_count > 3 and there is none otherwise.
+void testing_info_summary(const Arguments& arg)
+{
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    if(batch_count <= 0)
+    {
+        int first, count;
+        EXPECT_HIPBLAS_STATUS(hipblasInfoSummary(handle, nullptr, batch_count, &first, &count),
+                              batch_count < 0 ? HIPBLAS_STATUS_INVALID_VALUE
+                                              : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    host_vector<int>   hInfo(batch_count);
+    device_vector<int> dInfo(batch_count);
+    device_vector<int> dFirst(1);
+    device_vector<int> dCount(1);
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+    CHECK_DEVICE_ALLOCATION(dFirst.memcheck());
+    CHECK_DEVICE_ALLOCATION(dCount.memcheck());
+
+    double gpu_time_used;
+
+    int first_cpu = -1, count_cpu = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hInfo[b] = b % 7 == 3 ? (b % 2 ? b + 1 : -b - 1) : 0;
+        if(hInfo[b])
+        {
+            if(first_cpu < 0)
+                first_cpu = b;
+            count_cpu++;
+        }
+    }
+    CHECK_HIP_ERROR(dInfo.transfer_from(hInfo));
+
+    hipStream_t stream;
+    CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        // results in host memory, written once the stream reaches the reduction
+        int first_host = -2, count_host = -2;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(
+            hipblasInfoSummary(handle, dInfo, batch_count, &first_host, &count_host));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+
+        // results in device memory
+        int first_device, count_device;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasInfoSummary(handle, dInfo, batch_count, dFirst, dCount));
+        CHECK_HIP_ERROR(hipMemcpy(&first_device, dFirst, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(&count_device, dCount, sizeof(int), hipMemcpyDeviceToHost));
+
+        if(arg.unit_check)
+        {
+            unit_check_general(1, 1, 1, &first_cpu, &first_host);
+            unit_check_general(1, 1, 1, &count_cpu, &count_host);
+            unit_check_general(1, 1, 1, &first_cpu, &first_device);
+            unit_check_general(1, 1, 1, &count_cpu, &count_device);
+        }
+    }
+
+    if(arg.timing)
+    {
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasInfoSummary(handle, dInfo, batch_count, dFirst, dCount));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasInfoSummaryModel{}.log_args<int>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                ArgumentLogging::NA_value,
+                                                sizeof(int) * double(batch_count) / 1e9,
+                                                ArgumentLogging::NA_value);
+    }
+}
@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasPackUnpackBatchedModel
+    = ArgumentModel<e_a_type, e_M, e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_pack_unpack_batched(const Arguments& arg, std::string& name)
+{
+    hipblasPackUnpackBatchedModel{}.test_name(arg, name);
+}
+
+// The matrices A_i are packed into B and unpacked into zeroed A_i. In layout 0 the A_i follow each
+// other with stride lda * N, so with lda == ldb the whole batch is a single copy. In layout 1 the
+// array of pointers is reversed, so every matrix is copied on its own.
+template <typename T>
+void testing_pack_unpack_batched(const Arguments& arg)
+{
+    constexpr hipDataType data_type = std::is_same_v<T, float>            ? HIP_R_32F
+                                      : std::is_same_v<T, double>         ? HIP_R_64F
+                                      : std::is_same_v<T, hipblasComplex> ? HIP_C_32F
+                                                                          : HIP_C_64F;
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < std::max(M, 1) || ldb < std::max(M, 1)
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        hipblasStatus_t status
+            = invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS;
+        hipblasStride stride_B = hipblasStride(ldb) * N;
+        EXPECT_HIPBLAS_STATUS(
+            hipblasPackBatched(
+                handle, M, N, data_type, nullptr, lda, nullptr, ldb, stride_B, batch_count),
+            status);
+        EXPECT_HIPBLAS_STATUS(
+            hipblasUnpackBatched(
+                handle, M, N, data_type, nullptr, ldb, stride_B, nullptr, lda, batch_count),
+            status);
+        return;
+    }
+
+    hipblasStride stride_A = hipblasStride(lda) * N;
+    hipblasStride stride_B = hipblasStride(ldb) * N;
+    size_t        size_A   = size_t(stride_A) * batch_count;
+    size_t        size_B   = size_t(stride_B) * batch_count;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    host_vector<T> hA(size_A);
+    host_vector<T> hA_gpu(size_A);
+    host_vector<T> hB_gpu(size_B);
+    host_vector<T> hB_cpu(size_B);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dB(size_B);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    hipblas_unique_ptr dA_array(hipblas::device_malloc(sizeof(T*) * batch_count),
+                                hipblas::device_free);
+
+    double gpu_time_used, hipblas_error = 0.0;
+
+    // Initial Data on CPU
+    hipblas_init_vector(hA, arg, hipblas_client_never_set_nan, true);
+
+    auto set_array = [&](int layout) {
+        std::vector<T*> hA_array(batch_count);
+        for(int b = 0; b < batch_count; b++)
+            hA_array[b] = (T*)dA + (layout == 0 ? b : batch_count - 1 - b) * stride_A;
+        CHECK_HIP_ERROR(hipMemcpy(
+            dA_array.get(), hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int layout = 0; layout < 2; layout++)
+        {
+            /* =====================================================================
+                        CPU BLAS
+            =================================================================== */
+            for(size_t i = 0; i < size_B; i++)
+                hB_cpu[i] = T(0);
+            for(int b = 0; b < batch_count; b++)
+            {
+                int a = layout == 0 ? b : batch_count - 1 - b;
+                for(int j = 0; j < N; j++)
+                    for(int i = 0; i < M; i++)
+                        hB_cpu[b * stride_B + i + size_t(j) * ldb]
+                            = hA[a * stride_A + i + size_t(j) * lda];
+            }
+
+            /* =====================================================================
+                        HIPBLAS
+            =================================================================== */
+            set_array(layout);
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(T) * size_B));
+            CHECK_HIPBLAS_ERROR(hipblasPackBatched(handle,
+                                                   M,
+                                                   N,
+                                                   data_type,
+                                                   (const void* const*)dA_array.get(),
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   stride_B,
+                                                   batch_count));
+            CHECK_HIP_ERROR(hB_gpu.transfer_from(dB));
+
+            // unpack into zeroed matrices, which must give back A
+            CHECK_HIP_ERROR(hipMemset(dA, 0, sizeof(T) * size_A));
+            CHECK_HIPBLAS_ERROR(hipblasUnpackBatched(handle,
+                                                     M,
+                                                     N,
+                                                     data_type,
+                                                     dB,
+                                                     ldb,
+                                                     stride_B,
+                                                     (void* const*)dA_array.get(),
+                                                     lda,
+                                                     batch_count));
+            CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+
+            if(arg.unit_check)
+            {
+                unit_check_general<T>(M, N, batch_count, ldb, stride_B, hB_cpu, hB_gpu);
+                unit_check_general<T>(M, N, batch_count, lda, stride_A, hA, hA_gpu);
+            }
+            if(arg.norm_check)
+            {
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<T>('F', M, N, ldb, stride_B, hB_cpu, hB_gpu, batch_count));
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<T>('F', M, N, lda, stride_A, hA, hA_gpu, batch_count));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        set_array(0);
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasPackBatched(handle,
+                                                   M,
+                                                   N,
+                                                   data_type,
+                                                   (const void* const*)dA_array.get(),
+                                                   lda,
+                                                   dB,
+                                                   ldb,
+                                                   stride_B,
+                                                   batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasPackUnpackBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            set_get_matrix_gbyte_count<T>(M, N) * batch_count,
+            hipblas_error);
+    }
+}
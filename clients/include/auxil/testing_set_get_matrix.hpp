@@ -124,8 +124,7 @@ void testing_set_get_matrix(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasSetMatrixFn(rows, cols, sizeof(T), (void*)ha, lda, (void*)dc, ldc));
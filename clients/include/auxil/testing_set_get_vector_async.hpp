@@ -117,8 +117,7 @@ void testing_set_get_vector_async(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             CHECK_HIPBLAS_ERROR(
                 hipblasSetVectorAsyncFn(M, sizeof(T), (void*)hx, incx, (void*)db, incd, stream));
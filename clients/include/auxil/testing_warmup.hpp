@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasWarmupModel = ArgumentModel<e_M, e_N, e_K, e_batch_count>;
+
+inline void testname_warmup(const Arguments& arg, std::string& name)
+{
+    hipblasWarmupModel{}.test_name(arg, name);
+}
+
+inline hipblasWarmupDescriptor_t warmup_descriptor(hipblasWarmupRoutine_t routine,
+                                                   hipblasOperation_t     transA,
+                                                   hipblasOperation_t     transB,
+                                                   int                    m,
+                                                   int                    n,
+                                                   int                    k,
+                                                   int                    batch_count,
+                                                   hipDataType            type,
+                                                   hipblasComputeType_t   compute_type)
+{
+    hipblasWarmupDescriptor_t desc{};
+    desc.routine     = routine;
+    desc.transA      = transA;
+    desc.transB      = transB;
+    desc.m           = m;
+    desc.n           = n;
+    desc.k           = k;
+    desc.batchCount  = batch_count;
+    desc.aType       = type;
+    desc.bType       = type;
+    desc.cType       = type;
+    desc.computeType = compute_type;
+    desc.time_us     = -1;
+    desc.status      = HIPBLAS_STATUS_NOT_INITIALIZED;
+    return desc;
+}
+
+void testing_warmup_bad_arg(const Arguments& arg)
+{
+    hipblasLocalHandle handle(arg);
+
+    hipblasWarmupDescriptor_t desc = warmup_descriptor(HIPBLAS_WARMUP_GEMM,
+                                                       HIPBLAS_OP_N,
+                                                       HIPBLAS_OP_N,
+                                                       8,
+                                                       8,
+                                                       8,
+                                                       1,
+                                                       HIP_R_32F,
+                                                       HIPBLAS_COMPUTE_32F);
+
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(nullptr, &desc, 1), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, &desc, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, nullptr, 1), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If count == 0, descriptors can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasWarmup(handle, nullptr, 0));
+
+    // The status of a bad problem is returned, and written to its descriptor
+    desc.routine = hipblasWarmupRoutine_t(-1);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, &desc, 1), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(desc.status, HIPBLAS_STATUS_INVALID_ENUM);
+
+    desc.routine = HIPBLAS_WARMUP_GEMM;
+    desc.aType   = hipDataType(-1);
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, &desc, 1), HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(desc.status, HIPBLAS_STATUS_NOT_SUPPORTED);
+}
+
+// Gemm and strided batched gemm problems of the size of arg are warmed up in single and double
+// precision. A problem with a negative size in the middle of the list must fail on its own, and
+// the problems after it must still be warmed up. The user's matrices are left as they were.
+void testing_warmup(const Arguments& arg)
+{
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    std::vector<hipblasWarmupDescriptor_t> descriptors;
+    for(auto routine : {HIPBLAS_WARMUP_GEMM, HIPBLAS_WARMUP_GEMM_STRIDED_BATCHED})
+        for(auto trans : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+        {
+            descriptors.push_back(warmup_descriptor(routine,
+                                                    trans,
+                                                    HIPBLAS_OP_N,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    batch_count,
+                                                    HIP_R_32F,
+                                                    HIPBLAS_COMPUTE_32F));
+            descriptors.push_back(warmup_descriptor(routine,
+                                                    HIPBLAS_OP_N,
+                                                    trans,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    batch_count,
+                                                    HIP_R_64F,
+                                                    HIPBLAS_COMPUTE_64F));
+        }
+
+    // a problem with a negative size in the middle of the list
+    size_t bad = descriptors.size() / 2;
+    descriptors.insert(descriptors.begin() + bad,
+                       warmup_descriptor(HIPBLAS_WARMUP_GEMM,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         -1,
+                                         N,
+                                         K,
+                                         1,
+                                         HIP_R_32F,
+                                         HIPBLAS_COMPUTE_32F));
+
+    // user data on the device, which the warm-up must not touch
+    const int          size = 1000;
+    host_vector<float> hx(size), hx_gpu(size);
+    for(int i = 0; i < size; i++)
+        hx[i] = float(i);
+    device_vector<float> dx(size);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    EXPECT_HIPBLAS_STATUS(hipblasWarmup(handle, descriptors.data(), int(descriptors.size())),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // the batch count of the plain gemm problems is ignored
+    for(size_t i = 0; i < descriptors.size(); i++)
+    {
+        const hipblasWarmupDescriptor_t& desc = descriptors[i];
+
+        bool            batched = desc.routine == HIPBLAS_WARMUP_GEMM_STRIDED_BATCHED;
+        hipblasStatus_t expected
+            = i == bad || M < 0 || N < 0 || K < 0 || (batched && batch_count < 0)
+                  ? HIPBLAS_STATUS_INVALID_VALUE
+                  : HIPBLAS_STATUS_SUCCESS;
+        EXPECT_EQ(desc.status, expected) << "problem " << i;
+        if(expected == HIPBLAS_STATUS_SUCCESS)
+            EXPECT_GE(desc.time_us, 0) << "problem " << i;
+    }
+
+    CHECK_HIP_ERROR(hx_gpu.transfer_from(dx));
+    unit_check_general<float>(1, size, 1, hx, hx_gpu);
+}
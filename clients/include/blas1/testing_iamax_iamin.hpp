@@ -183,8 +183,7 @@ void testing_iamax_iamin(const Arguments& arg, FUNC func)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             CHECK_HIPBLAS_ERROR(func(handle, N, dx, incx, d_hipblas_result));
         }
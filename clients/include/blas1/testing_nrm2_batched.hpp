@@ -188,8 +188,7 @@ void testing_nrm2_batched(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             DAPI_CHECK(hipblasNrm2BatchedFn,
                        (handle, N, dx.ptr_on_device(), incx, batch_count, d_hipblas_result));
@@ -134,8 +134,7 @@ void testing_rotmg(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             DAPI_CHECK(hipblasRotmgFn,
                        (handle, dparams, dparams + 1, dparams + 2, dparams + 3, dparams + 4));
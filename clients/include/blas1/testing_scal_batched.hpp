@@ -159,8 +159,7 @@ void testing_scal_batched(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             DAPI_CHECK(hipblasScalBatchedFn,
                        (handle, N, &alpha, dx.ptr_on_device(), incx, batch_count));
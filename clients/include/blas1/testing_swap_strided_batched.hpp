@@ -175,8 +175,7 @@ void testing_swap_strided_batched(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             DAPI_CHECK(hipblasSwapStridedBatchedFn,
                        (handle, N, dx, incx, stride_x, dy, incy, stride_y, batch_count));
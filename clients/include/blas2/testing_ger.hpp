@@ -249,8 +249,7 @@ void testing_ger(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             DAPI_DISPATCH(hipblasGerFn, (handle, M, N, d_alpha, dx, incx, dy, incy, dA, lda));
         }
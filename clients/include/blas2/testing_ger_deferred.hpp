@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGerDeferredModel
+    = ArgumentModel<e_a_type, e_M, e_N, e_alpha, e_incx, e_incy, e_lda, e_batch_count>;
+
+inline void testname_ger_deferred(const Arguments& arg, std::string& name)
+{
+    hipblasGerDeferredModel{}.test_name(arg, name);
+}
+
+// batch_count rank-1 updates of the same matrix are queued between hipblasDeferredBegin and
+// hipblasDeferredEnd and compared against batch_count reference ger calls.
+template <typename T, bool CONJ>
+void testing_ger_deferred(const Arguments& arg)
+{
+    auto hipblasGerFn = CONJ ? hipblasGer<T, true, false> : hipblasGer<T, false, false>;
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int incy        = arg.incy;
+    int lda         = arg.lda;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // only calls with positive increments are queued
+    if(M <= 0 || N <= 0 || incx <= 0 || incy <= 0 || lda < M || batch_count <= 0)
+        return;
+
+    // Vectors are laid out either as the columns of a matrix (x_i = x + i * M * incx) or
+    // interleaved (x_i = x + i with increment incx * batch_count), so that both the
+    // in-place and the gathered fused paths are exercised.
+    size_t size_x = 1 + (size_t(M) * batch_count - 1) * incx;
+    size_t size_y = 1 + (size_t(N) * batch_count - 1) * incy;
+
+    host_matrix<T> hA(M, N, lda);
+    host_matrix<T> hA_gpu(M, N, lda);
+    host_matrix<T> hA_cpu(M, N, lda);
+    host_vector<T> hx(size_x);
+    host_vector<T> hy(size_y);
+
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dx(size_x);
+    device_vector<T> dy(size_y);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    double hipblas_error = 0.0;
+
+    T h_alpha = arg.get_alpha<T>();
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_vector(hx, arg, hipblas_client_alpha_sets_nan, false, true);
+    hipblas_init_vector(hy, arg, hipblas_client_alpha_sets_nan);
+
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+    CHECK_HIP_ERROR(dy.transfer_from(hy));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    // layout 0: x_i are columns, y_i are interleaved, same alpha for every call
+    // layout 1: x_i are interleaved, y_i are columns, different alpha for every call
+    auto run_layout = [&](int layout, T* x, T* y, T* A, bool device) {
+        int x_inc  = layout == 0 ? incx : incx * batch_count;
+        int y_inc  = layout == 0 ? incy * batch_count : incy;
+        int x_step = layout == 0 ? M * incx : 1;
+        int y_step = layout == 0 ? 1 : N * incy;
+        for(int i = 0; i < batch_count; i++)
+        {
+            T alpha_i = layout == 0 ? h_alpha : T(h_alpha * T(i + 1));
+            if(device)
+                CHECK_HIPBLAS_ERROR(hipblasGerFn(handle,
+                                                 M,
+                                                 N,
+                                                 &alpha_i,
+                                                 x + size_t(i) * x_step,
+                                                 x_inc,
+                                                 y + size_t(i) * y_step,
+                                                 y_inc,
+                                                 A,
+                                                 lda));
+            else
+                ref_ger<T, CONJ>(M,
+                                 N,
+                                 alpha_i,
+                                 x + size_t(i) * x_step,
+                                 x_inc,
+                                 y + size_t(i) * y_step,
+                                 y_inc,
+                                 A,
+                                 lda);
+        }
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int layout = 0; layout < 2; layout++)
+        {
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(hipblasDeferredBegin(handle));
+            run_layout(layout, dx, dy, dA, true);
+            CHECK_HIPBLAS_ERROR(hipblasDeferredEnd(handle));
+            CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+
+            /* =====================================================================
+               CPU BLAS
+            =================================================================== */
+            hA_cpu = hA;
+            run_layout(layout, hx, hy, hA_cpu, false);
+
+            if(arg.unit_check)
+                unit_check_general<T>(M, N, lda, hA_cpu.data(), hA_gpu.data());
+            if(arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<T>('F', M, N, lda, hA_cpu.data(), hA_gpu.data()));
+        }
+    }
+
+    if(arg.timing)
+    {
+        double gpu_time_used;
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasDeferredBegin(handle));
+            run_layout(0, dx, dy, dA, true);
+            CHECK_HIPBLAS_ERROR(hipblasDeferredEnd(handle));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGerDeferredModel{}.log_args<T>(std::cout,
+                                              arg,
+                                              gpu_time_used,
+                                              ger_gflop_count<T>(M, N) * batch_count,
+                                              ger_gbyte_count<T>(M, N) * batch_count,
+                                              hipblas_error);
+    }
+}
@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasTrsvDeferredModel
+    = ArgumentModel<e_a_type, e_uplo, e_transA, e_diag, e_N, e_lda, e_incx, e_batch_count>;
+
+inline void testname_trsv_deferred(const Arguments& arg, std::string& name)
+{
+    hipblasTrsvDeferredModel{}.test_name(arg, name);
+}
+
+// batch_count solves with the same matrix are queued between hipblasDeferredBegin and
+// hipblasDeferredEnd and compared against the known solutions.
+template <typename T>
+void testing_trsv_deferred(const Arguments& arg)
+{
+    auto hipblasTrsvFn = hipblasTrsv<T, false>;
+
+    hipblasFillMode_t  uplo        = char2hipblas_fill(arg.uplo);
+    hipblasDiagType_t  diag        = char2hipblas_diagonal(arg.diag);
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    int                N           = arg.N;
+    int                incx        = arg.incx;
+    int                lda         = arg.lda;
+    int                batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // only calls with positive increments are queued
+    if(N <= 0 || incx <= 0 || lda < N || batch_count <= 0)
+        return;
+
+    // Right-hand sides are laid out either as the columns of a matrix (x_i = x + i * N * incx) or
+    // interleaved (x_i = x + i with increment incx * batch_count).
+    size_t size_x = 1 + (size_t(N) * batch_count - 1) * incx;
+
+    host_matrix<T> hA(N, N, lda);
+    host_vector<T> hx(size_x);
+    host_vector<T> hb(size_x);
+    host_vector<T> hx_gpu(size_x);
+
+    device_matrix<T> dA(N, N, lda);
+    device_vector<T> dx_or_b(size_x);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dx_or_b.memcheck());
+
+    double hipblas_error = 0.0;
+
+    hipblas_init_matrix(hA,
+                        arg,
+                        hipblas_client_never_set_nan,
+                        hipblas_diagonally_dominant_triangular_matrix,
+                        true,
+                        false);
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, false, true);
+
+    if(diag == HIPBLAS_DIAG_UNIT)
+    {
+        make_unit_diagonal(uplo, (T*)hA, lda, N);
+    }
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+    auto x_inc  = [&](int layout) { return layout == 0 ? incx : incx * batch_count; };
+    auto x_step = [&](int layout) { return layout == 0 ? N * incx : 1; };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int layout = 0; layout < 2; layout++)
+        {
+            // Calculate hb_i = op(hA) * hx_i
+            hb = hx;
+            for(int i = 0; i < batch_count; i++)
+                ref_trmv<T>(uplo,
+                            transA,
+                            diag,
+                            N,
+                            hA.data(),
+                            lda,
+                            hb.data() + size_t(i) * x_step(layout),
+                            x_inc(layout));
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(dx_or_b.transfer_from(hb));
+            CHECK_HIPBLAS_ERROR(hipblasDeferredBegin(handle));
+            for(int i = 0; i < batch_count; i++)
+                CHECK_HIPBLAS_ERROR(hipblasTrsvFn(handle,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  N,
+                                                  dA,
+                                                  lda,
+                                                  (T*)dx_or_b + size_t(i) * x_step(layout),
+                                                  x_inc(layout)));
+            CHECK_HIPBLAS_ERROR(hipblasDeferredEnd(handle));
+            CHECK_HIP_ERROR(hx_gpu.transfer_from(dx_or_b));
+
+            for(int i = 0; i < batch_count; i++)
+            {
+                size_t offset = size_t(i) * x_step(layout);
+                double error  = hipblas_abs(vector_norm_1<T>(
+                    N, x_inc(layout), hx.data() + offset, hx_gpu.data() + offset));
+                hipblas_error = std::max(hipblas_error, error);
+            }
+
+            if(arg.unit_check)
+            {
+                double tolerance = std::numeric_limits<real_t<T>>::epsilon() * 40 * N;
+                unit_check_error(hipblas_error, tolerance);
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        double      gpu_time_used;
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasDeferredBegin(handle));
+            for(int i = 0; i < batch_count; i++)
+                CHECK_HIPBLAS_ERROR(hipblasTrsvFn(handle,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  N,
+                                                  dA,
+                                                  lda,
+                                                  (T*)dx_or_b + size_t(i) * x_step(0),
+                                                  x_inc(0)));
+            CHECK_HIPBLAS_ERROR(hipblasDeferredEnd(handle));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used; // in microseconds
+
+        hipblasTrsvDeferredModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               trsv_gflop_count<T>(N) * batch_count,
+                                               trsv_gbyte_count<T>(N) * batch_count,
+                                               hipblas_error);
+    }
+}
@@ -41,13 +41,41 @@ using hipblasGemmModel = ArgumentModel<e_a_type,
                                        e_lda,
                                        e_ldb,
                                        e_beta,
-                                       e_ldc>;
+                                       e_ldc,
+                                       e_strassen_levels,
+                                       e_gemm_order>;
 
 inline void testname_gemm(const Arguments& arg, std::string& name)
 {
     hipblasGemmModel{}.test_name(arg, name);
 }
 
+// Appends the problem of arg to the order table named by HIPBLAS_GEMM_ORDER_TABLE_FILE, see
+// hipblasSetGemmOrderMode
+inline void hipblas_gemm_order_append(const Arguments& arg)
+{
+    char precision = arg.a_type == HIPBLAS_R_32F   ? 's'
+                     : arg.a_type == HIPBLAS_R_64F ? 'd'
+                     : arg.a_type == HIPBLAS_C_32F ? 'c'
+                     : arg.a_type == HIPBLAS_C_64F ? 'z'
+                                                   : 0;
+    if(!precision)
+        return;
+
+    const char* path = getenv("HIPBLAS_GEMM_ORDER_TABLE_FILE");
+    if(!path || !*path)
+    {
+        std::cerr << "HIPBLAS_GEMM_ORDER_TABLE_FILE is not set, the transposed layout of this "
+                     "problem is not recorded"
+                  << std::endl;
+        return;
+    }
+
+    std::ofstream file(path, std::ios::app);
+    file << getArchString() << ' ' << precision << ' ' << arg.transA << ' ' << arg.transB << ' '
+         << arg.M << ' ' << arg.N << ' ' << arg.K << std::endl;
+}
+
 template <typename T>
 void testing_gemm_bad_arg(const Arguments& arg)
 {
@@ -285,14 +313,44 @@ void testing_gemm(const Arguments& arg)
     T h_beta  = arg.get_beta<T>();
 
     hipblasLocalHandle handle(arg);
+    if(arg.strassen_levels)
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmStrassenLevels(handle, arg.strassen_levels));
+    if(arg.gemm_order > 0)
+        CHECK_HIPBLAS_ERROR(
+            hipblasSetGemmOrderMode(handle, hipblasGemmOrderMode_t(arg.gemm_order)));
 
     int64_t A_row = transA == HIPBLAS_OP_N ? M : std::max(K, int64_t(1));
     int64_t A_col = transA == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : M;
     int64_t B_row = transB == HIPBLAS_OP_N ? std::max(K, int64_t(1)) : N;
     int64_t B_col = transB == HIPBLAS_OP_N ? N : std::max(K, int64_t(1));
 
+    // with HIPBLAS_GEMM_ORDER_TRANSPOSED_C, C holds C^T = op(B)^T * op(A)^T
+    bool    transposed_C = arg.gemm_order == HIPBLAS_GEMM_ORDER_TRANSPOSED_C;
+    int64_t C_row        = transposed_C ? N : M;
+    int64_t C_col        = transposed_C ? M : N;
+    if(transposed_C && is_complex<T> && (transA == HIPBLAS_OP_C || transB == HIPBLAS_OP_C))
+    {
+        DAPI_EXPECT(HIPBLAS_STATUS_NOT_SUPPORTED,
+                    hipblasGemmFn,
+                    (handle,
+                     transA,
+                     transB,
+                     M,
+                     N,
+                     K,
+                     &h_alpha,
+                     nullptr,
+                     lda,
+                     nullptr,
+                     ldb,
+                     &h_beta,
+                     nullptr,
+                     ldc));
+        return;
+    }
+
     // check here to prevent undefined memory allocation error
-    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < C_row;
     if(invalid_size || !M || !N)
     {
         DAPI_EXPECT(invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS,
@@ -321,14 +379,14 @@ void testing_gemm(const Arguments& arg)
     // Allocate host memory
     host_matrix<T> hA(A_row, A_col, lda);
     host_matrix<T> hB(B_row, B_col, ldb);
-    host_matrix<T> hC_host(M, N, ldc);
-    host_matrix<T> hC_device(M, N, ldc);
-    host_matrix<T> hC_cpu(M, N, ldc);
+    host_matrix<T> hC_host(C_row, C_col, ldc);
+    host_matrix<T> hC_device(C_row, C_col, ldc);
+    host_matrix<T> hC_cpu(C_row, C_col, ldc);
 
     // Allocate device memory
     device_matrix<T> dA(A_row, A_col, lda);
     device_matrix<T> dB(B_row, B_col, ldb);
-    device_matrix<T> dC(M, N, ldc);
+    device_matrix<T> dC(C_row, C_col, ldc);
     device_vector<T> d_alpha(1);
     device_vector<T> d_beta(1);
 
@@ -380,19 +438,39 @@ void testing_gemm(const Arguments& arg)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        ref_gemm<T>(transA,
-                    transB,
-                    M,
-                    N,
-                    K,
-                    h_alpha,
-                    hA.data(),
-                    lda,
-                    hB.data(),
-                    ldb,
-                    h_beta,
-                    hC_cpu.data(),
-                    ldc);
+        if(transposed_C)
+        {
+            auto transpose = [](hipblasOperation_t trans) {
+                return trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+            };
+            ref_gemm<T>(transpose(transB),
+                        transpose(transA),
+                        N,
+                        M,
+                        K,
+                        h_alpha,
+                        hB.data(),
+                        ldb,
+                        hA.data(),
+                        lda,
+                        h_beta,
+                        hC_cpu.data(),
+                        ldc);
+        }
+        else
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA.data(),
+                        lda,
+                        hB.data(),
+                        ldb,
+                        h_beta,
+                        hC_cpu.data(),
+                        ldc);
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -401,21 +479,21 @@ void testing_gemm(const Arguments& arg)
             if(std::is_same_v<T, hipblasHalf> && (getArchMajor() == 11))
             {
                 const double tol = K * sum_error_tolerance_for_gfx11<T, T, T>;
-                near_check_general<T>(M, N, ldc, hC_cpu.data(), hC_host.data(), tol);
-                near_check_general<T>(M, N, ldc, hC_cpu.data(), hC_device.data(), tol);
+                near_check_general<T>(C_row, C_col, ldc, hC_cpu.data(), hC_host.data(), tol);
+                near_check_general<T>(C_row, C_col, ldc, hC_cpu.data(), hC_device.data(), tol);
             }
             else
             {
-                unit_check_general<T>(M, N, ldc, hC_cpu, hC_host);
-                unit_check_general<T>(M, N, ldc, hC_cpu, hC_device);
+                unit_check_general<T>(C_row, C_col, ldc, hC_cpu, hC_host);
+                unit_check_general<T>(C_row, C_col, ldc, hC_cpu, hC_device);
             }
         }
         if(arg.norm_check)
         {
             hipblas_error_host
-                = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_host));
+                = hipblas_abs(norm_check_general<T>('F', C_row, C_col, ldc, hC_cpu, hC_host));
             hipblas_error_device
-                = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_device));
+                = hipblas_abs(norm_check_general<T>('F', C_row, C_col, ldc, hC_cpu, hC_device));
         }
 
     } // end of if unit/norm check
@@ -429,17 +507,49 @@ void testing_gemm(const Arguments& arg)
         // we need to copy alpha and beta to the host.
         CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
 
-        int runs = arg.cold_iters + arg.iters;
-        for(int iter = 0; iter < runs; iter++)
+        auto time_gemm = [&](int64_t ldc) {
+            double time_used;
+            int    runs = arg.cold_iters + arg.iters;
+            for(int iter = 0; iter < runs; iter++)
+            {
+                hipblas_time_iteration(arg, iter, stream, time_used);
+
+                DAPI_DISPATCH(hipblasGemmFn,
+                              (handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               &h_alpha,
+                               dA,
+                               lda,
+                               dB,
+                               ldb,
+                               &h_beta,
+                               dC,
+                               ldc));
+            }
+            return get_time_us_sync(stream) - time_used;
+        };
+
+        gpu_time_used = time_gemm(ldc);
+
+        // calibrate the order table: the faster of both layouts of C is reported, and the problem
+        // is recorded if that is the transposed layout. C^T fits into dC with leading dimension N.
+        if(arg.gemm_order < 0
+           && !(is_complex<T> && (transA == HIPBLAS_OP_C || transB == HIPBLAS_OP_C)))
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            CHECK_HIPBLAS_ERROR(hipblasSetGemmOrderMode(handle, HIPBLAS_GEMM_ORDER_TRANSPOSED_C));
+            double swapped_time_used = time_gemm(std::max(N, int64_t(1)));
+            CHECK_HIPBLAS_ERROR(hipblasSetGemmOrderMode(handle, HIPBLAS_GEMM_ORDER_DEFAULT));
 
-            DAPI_DISPATCH(
-                hipblasGemmFn,
-                (handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+            if(swapped_time_used < gpu_time_used)
+            {
+                hipblas_gemm_order_append(arg);
+                gpu_time_used = swapped_time_used;
+            }
         }
-        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
 
         hipblasGemmModel{}.log_args<T>(std::cout,
                                        arg,
@@ -0,0 +1,227 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmRealModel = ArgumentModel<e_a_type,
+                                           e_transA,
+                                           e_transB,
+                                           e_M,
+                                           e_N,
+                                           e_K,
+                                           e_alpha,
+                                           e_lda,
+                                           e_ldb,
+                                           e_beta,
+                                           e_ldc>;
+
+inline void testname_gemm_real(const Arguments& arg, std::string& name)
+{
+    hipblasGemmRealModel{}.test_name(arg, name);
+}
+
+// hipblasGemmRealB if B is the real matrix, hipblasGemmRealA otherwise
+template <typename T, bool REAL_B>
+auto hipblas_gemm_real_fn()
+{
+    if constexpr(REAL_B)
+        return hipblasGemmRealB<T, real_t<T>>;
+    else
+        return hipblasGemmRealA<T, real_t<T>>;
+}
+
+// Results are compared against gemm with the real matrix promoted to complex.
+template <typename T, bool REAL_B>
+void testing_gemm_real(const Arguments& arg)
+{
+    using U  = real_t<T>;
+    using Ta = std::conditional_t<REAL_B, T, U>;
+    using Tb = std::conditional_t<REAL_B, U, T>;
+
+    auto hipblasGemmRealFn = hipblas_gemm_real_fn<T, REAL_B>();
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : M;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmRealFn(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                nullptr,
+                                                nullptr,
+                                                lda,
+                                                nullptr,
+                                                ldb,
+                                                nullptr,
+                                                nullptr,
+                                                ldc),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<Ta> hA(A_row, A_col, lda);
+    host_matrix<Tb> hB(B_row, B_col, ldb);
+    host_matrix<T>  hC_host(M, N, ldc);
+    host_matrix<T>  hC_device(M, N, ldc);
+    host_matrix<T>  hC_cpu(M, N, ldc);
+
+    // Allocate device memory
+    device_matrix<Ta> dA(A_row, A_col, lda);
+    device_matrix<Tb> dB(B_row, B_col, ldb);
+    device_matrix<T>  dC(M, N, ldc);
+    device_vector<T>  d_alpha(1);
+    device_vector<T>  d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_cpu    = hC_host;
+    hC_device = hC_host;
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmRealFn(
+            handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmRealFn(
+            handle, transA, transB, M, N, K, d_alpha, dA, lda, dB, ldb, d_beta, dC, ldc));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        host_matrix<T> hA_cpu(hA);
+        host_matrix<T> hB_cpu(hB);
+        ref_gemm<T>(transA,
+                    transB,
+                    M,
+                    N,
+                    K,
+                    h_alpha,
+                    hA_cpu.data(),
+                    lda,
+                    hB_cpu.data(),
+                    ldb,
+                    h_beta,
+                    hC_cpu.data(),
+                    ldc);
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_cpu, hC_host);
+            unit_check_general<T>(M, N, ldc, hC_cpu, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_host));
+            hipblas_error_device
+                = hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_device));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmRealFn(
+                handle, transA, transB, M, N, K, &h_alpha, dA, lda, dB, ldb, &h_beta, dC, ldc));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // half of the flops of a complex gemm
+        hipblasGemmRealModel{}.log_args<T>(std::cout,
+                                           arg,
+                                           gpu_time_used,
+                                           gemm_gflop_count<T>(M, N, K) / 2,
+                                           gemm_gbyte_count<T>(M, N, K),
+                                           hipblas_error_host,
+                                           hipblas_error_device);
+    }
+}
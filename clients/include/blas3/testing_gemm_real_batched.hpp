@@ -0,0 +1,282 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmRealBatchedModel = ArgumentModel<e_a_type,
+                                                  e_transA,
+                                                  e_transB,
+                                                  e_M,
+                                                  e_N,
+                                                  e_K,
+                                                  e_alpha,
+                                                  e_lda,
+                                                  e_ldb,
+                                                  e_beta,
+                                                  e_ldc,
+                                                  e_batch_count>;
+
+inline void testname_gemm_real_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGemmRealBatchedModel{}.test_name(arg, name);
+}
+
+// hipblasGemmRealBBatched if B is the real matrix, hipblasGemmRealABatched otherwise
+template <typename T, bool REAL_B>
+auto hipblas_gemm_real_batched_fn()
+{
+    if constexpr(REAL_B)
+        return hipblasGemmRealBBatched<T, real_t<T>>;
+    else
+        return hipblasGemmRealABatched<T, real_t<T>>;
+}
+
+// Results are compared against gemm with the real matrices promoted to complex.
+template <typename T, bool REAL_B>
+void testing_gemm_real_batched(const Arguments& arg)
+{
+    using U  = real_t<T>;
+    using Ta = std::conditional_t<REAL_B, T, U>;
+    using Tb = std::conditional_t<REAL_B, U, T>;
+
+    auto hipblasGemmRealBatchedFn = hipblas_gemm_real_batched_fn<T, REAL_B>();
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : M;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || batch_count < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmRealBatchedFn(handle,
+                                                       transA,
+                                                       transB,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       nullptr,
+                                                       lda,
+                                                       nullptr,
+                                                       ldb,
+                                                       nullptr,
+                                                       nullptr,
+                                                       ldc,
+                                                       batch_count),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_batch_matrix<Ta> hA(A_row, A_col, lda, batch_count);
+    host_batch_matrix<Tb> hB(B_row, B_col, ldb, batch_count);
+    host_batch_matrix<T>  hC_host(M, N, ldc, batch_count);
+    host_batch_matrix<T>  hC_device(M, N, ldc, batch_count);
+    host_batch_matrix<T>  hC_cpu(M, N, ldc, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hC_host.memcheck());
+    CHECK_HIP_ERROR(hC_device.memcheck());
+    CHECK_HIP_ERROR(hC_cpu.memcheck());
+
+    // Allocate device memory
+    device_batch_matrix<Ta> dA(A_row, A_col, lda, batch_count);
+    device_batch_matrix<Tb> dB(B_row, B_col, ldb, batch_count);
+    device_batch_matrix<T>  dC(M, N, ldc, batch_count);
+    device_vector<T>        d_alpha(1);
+    device_vector<T>        d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_alpha_sets_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC_host, arg, hipblas_client_beta_sets_nan, hipblas_general_matrix);
+
+    hC_device.copy_from(hC_host);
+    hC_cpu.copy_from(hC_host);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC_host));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmRealBatchedFn(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     &h_alpha,
+                                                     (const Ta* const*)dA.ptr_on_device(),
+                                                     lda,
+                                                     (const Tb* const*)dB.ptr_on_device(),
+                                                     ldb,
+                                                     &h_beta,
+                                                     dC.ptr_on_device(),
+                                                     ldc,
+                                                     batch_count));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC_device));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmRealBatchedFn(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     d_alpha,
+                                                     (const Ta* const*)dA.ptr_on_device(),
+                                                     lda,
+                                                     (const Tb* const*)dB.ptr_on_device(),
+                                                     ldb,
+                                                     d_beta,
+                                                     dC.ptr_on_device(),
+                                                     ldc,
+                                                     batch_count));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        host_vector<T> hA_cpu(hA.nmemb());
+        host_vector<T> hB_cpu(hB.nmemb());
+        for(int b = 0; b < batch_count; b++)
+        {
+            std::copy(hA[b], hA[b] + hA.nmemb(), hA_cpu.data());
+            std::copy(hB[b], hB[b] + hB.nmemb(), hB_cpu.data());
+            ref_gemm<T>(transA,
+                        transB,
+                        M,
+                        N,
+                        K,
+                        h_alpha,
+                        hA_cpu.data(),
+                        lda,
+                        hB_cpu.data(),
+                        ldb,
+                        h_beta,
+                        hC_cpu[b],
+                        ldc);
+        }
+
+        if(arg.unit_check)
+        {
+            unit_check_general<T>(M, N, batch_count, ldc, hC_cpu, hC_host);
+            unit_check_general<T>(M, N, batch_count, ldc, hC_cpu, hC_device);
+        }
+        if(arg.norm_check)
+        {
+            hipblas_error_host
+                = norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_host, batch_count);
+            hipblas_error_device
+                = norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_device, batch_count);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmRealBatchedFn(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         &h_alpha,
+                                                         (const Ta* const*)dA.ptr_on_device(),
+                                                         lda,
+                                                         (const Tb* const*)dB.ptr_on_device(),
+                                                         ldb,
+                                                         &h_beta,
+                                                         dC.ptr_on_device(),
+                                                         ldc,
+                                                         batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        // half of the flops of a complex gemm
+        hipblasGemmRealBatchedModel{}.log_args<T>(std::cout,
+                                                  arg,
+                                                  gpu_time_used,
+                                                  gemm_gflop_count<T>(M, N, K) / 2,
+                                                  gemm_gbyte_count<T>(M, N, K),
+                                                  hipblas_error_host,
+                                                  hipblas_error_device);
+    }
+}
@@ -258,8 +258,7 @@ void testing_trtri_strided_batched(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             CHECK_HIPBLAS_ERROR(hipblasTrtriStridedBatchedFn(
                 handle, uplo, diag, N, dA, lda, stride_A, dinvA, ldinvA, stride_A, batch_count));
@@ -0,0 +1,485 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <complex>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasCopyExModel = ArgumentModel<e_a_type, e_b_type, e_N, e_incx, e_incy, e_batch_count>;
+
+using hipblasCopyMatrixExModel
+    = ArgumentModel<e_a_type, e_b_type, e_M, e_N, e_lda, e_ldb, e_batch_count>;
+
+inline void testname_copy_ex(const Arguments& arg, std::string& name)
+{
+    hipblasCopyExModel{}.test_name(arg, name);
+}
+
+inline void testname_copy_matrix_ex(const Arguments& arg, std::string& name)
+{
+    hipblasCopyMatrixExModel{}.test_name(arg, name);
+}
+
+template <typename T>
+constexpr hipDataType copy_ex_datatype = std::is_same_v<T, hipblasHalf>       ? HIP_R_16F
+                                         : std::is_same_v<T, hipblasBfloat16> ? HIP_R_16BF
+                                         : std::is_same_v<T, float>           ? HIP_R_32F
+                                         : std::is_same_v<T, double>          ? HIP_R_64F
+                                         : std::is_same_v<T, hipblasComplex>  ? HIP_C_32F
+                                                                              : HIP_C_64F;
+
+// The reference conversion, which like the library converts half precision values through float
+template <typename Tb, typename Ta>
+Tb copy_ex_convert(const Ta& x)
+{
+    if constexpr(std::is_same_v<Ta, hipblasHalf>)
+        return convert_alpha_beta<Tb>(half_to_float(x), 0);
+    else if constexpr(std::is_same_v<Ta, hipblasBfloat16>)
+        return convert_alpha_beta<Tb>(bfloat16_to_float(x), 0);
+    else if constexpr(is_complex<Ta>)
+        return convert_alpha_beta<Tb>(std::real(x), std::imag(x));
+    else
+        return convert_alpha_beta<Tb>(x, 0);
+}
+
+template <typename Ta, typename Tb = Ta>
+void testing_copy_ex_bad_arg(const Arguments& arg)
+{
+    constexpr hipDataType x_type = copy_ex_datatype<Ta>;
+    constexpr hipDataType y_type = copy_ex_datatype<Tb>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N = 100;
+
+    device_vector<Ta> dx(N);
+    device_vector<Tb> dy(N);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(nullptr, N, dx, x_type, 1, dy, y_type, 1),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, -1, dx, x_type, 1, dy, y_type, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, N, nullptr, x_type, 1, dy, y_type, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, N, dx, x_type, 1, nullptr, y_type, 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, N, dx, HIP_R_8I, 1, dy, y_type, 1),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // Conversions other than f16 and bf16 to f32 have no device path
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, N, dx, HIP_R_32F, 1, dy, HIP_R_16F, 1),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyEx(handle, N, dx, HIP_C_32F, 1, dy, HIP_C_64F, 1),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyStridedBatchedEx(handle, N, dx, x_type, 1, N, dy, y_type, 1, N, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyBatchedEx(handle, N, nullptr, x_type, 1, nullptr, y_type, 1, 1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0 or batchCount == 0, x and y can be nullptr, whatever the increments
+    CHECK_HIPBLAS_ERROR(hipblasCopyEx(handle, 0, nullptr, x_type, 1, nullptr, y_type, 1));
+    CHECK_HIPBLAS_ERROR(hipblasCopyEx(handle, 0, nullptr, x_type, 0, nullptr, y_type, -3));
+    CHECK_HIPBLAS_ERROR(
+        hipblasCopyStridedBatchedEx(handle, N, nullptr, x_type, 1, N, nullptr, y_type, 1, N, 0));
+    CHECK_HIPBLAS_ERROR(
+        hipblasCopyBatchedEx(handle, N, nullptr, x_type, 1, nullptr, y_type, 1, 0));
+}
+
+// batch_count vectors x_i are copied into zeroed vectors y_i, through hipblasCopyEx for a single
+// vector and through both batched functions otherwise. The vectors follow each other with
+// stride N * |inc|, so with positive increments the strided batch is copied as one vector of
+// N * batch_count elements. The array of pointers of the batched function is reversed, so every
+// vector is copied on its own. Negative increments index the vectors from their last element as
+// in BLAS copy, and with incy = 0 the last element of x is left in y.
+template <typename Ta, typename Tb = Ta>
+void testing_copy_ex(const Arguments& arg)
+{
+    constexpr hipDataType x_type = copy_ex_datatype<Ta>;
+    constexpr hipDataType y_type = copy_ex_datatype<Tb>;
+
+    int N           = arg.N;
+    int incx        = arg.incx;
+    int incy        = arg.incy;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = N < 0 || batch_count < 0;
+    if(invalid_size || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasCopyStridedBatchedEx(handle,
+                                                          N,
+                                                          nullptr,
+                                                          x_type,
+                                                          incx,
+                                                          hipblasStride(N) * incx,
+                                                          nullptr,
+                                                          y_type,
+                                                          incy,
+                                                          hipblasStride(N) * incy,
+                                                          batch_count),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    int           abs_incx = std::max(std::abs(incx), 1);
+    int           abs_incy = std::max(std::abs(incy), 1);
+    hipblasStride stride_x = hipblasStride(N) * abs_incx;
+    hipblasStride stride_y = hipblasStride(N) * abs_incy;
+    size_t        size_x   = size_t(stride_x) * batch_count;
+    size_t        size_y   = size_t(stride_y) * batch_count;
+
+    // Naming: `h` is in CPU (host) memory(eg hx), `d` is in GPU (device) memory (eg dx).
+    host_vector<Ta> hx(size_x);
+    host_vector<Tb> hy_cpu(size_y);
+    host_vector<Tb> hy_gpu(size_y);
+
+    device_vector<Ta> dx(size_x);
+    device_vector<Tb> dy(size_y);
+    CHECK_DEVICE_ALLOCATION(dx.memcheck());
+    CHECK_DEVICE_ALLOCATION(dy.memcheck());
+
+    hipblas_unique_ptr dx_array(hipblas::device_malloc(sizeof(Ta*) * batch_count),
+                                hipblas::device_free);
+    hipblas_unique_ptr dy_array(hipblas::device_malloc(sizeof(Tb*) * batch_count),
+                                hipblas::device_free);
+
+    double gpu_time_used, hipblas_error = 0.0;
+
+    // Initial Data on CPU
+    hipblas_init_vector(hx, arg, hipblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(dx.transfer_from(hx));
+
+    std::vector<Ta*> hx_array(batch_count);
+    std::vector<Tb*> hy_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hx_array[b] = (Ta*)dx + (batch_count - 1 - b) * stride_x;
+        hy_array[b] = (Tb*)dy + (batch_count - 1 - b) * stride_y;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(
+        dx_array.get(), hx_array.data(), sizeof(Ta*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dy_array.get(), hy_array.data(), sizeof(Tb*) * batch_count, hipMemcpyHostToDevice));
+
+    auto hipblasCopyExFn = [&](int batched) {
+        if(batch_count == 1)
+            return hipblasCopyEx(handle, N, dx, x_type, incx, dy, y_type, incy);
+        if(batched)
+            return hipblasCopyBatchedEx(handle,
+                                        N,
+                                        (const void* const*)dx_array.get(),
+                                        x_type,
+                                        incx,
+                                        (void* const*)dy_array.get(),
+                                        y_type,
+                                        incy,
+                                        batch_count);
+        return hipblasCopyStridedBatchedEx(
+            handle, N, dx, x_type, incx, stride_x, dy, y_type, incy, stride_y, batch_count);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(size_t i = 0; i < size_y; i++)
+            hy_cpu[i] = convert_alpha_beta<Tb>(0, 0);
+        for(int b = 0; b < batch_count; b++)
+            for(int i = 0; i < N; i++)
+            {
+                size_t ix = incx >= 0 ? size_t(i) * incx : size_t(N - 1 - i) * abs_incx;
+                size_t iy = incy >= 0 ? size_t(i) * incy : size_t(N - 1 - i) * abs_incy;
+                hy_cpu[b * stride_y + iy] = copy_ex_convert<Tb>(hx[b * stride_x + ix]);
+            }
+
+        for(int batched = 0; batched < 2; batched++)
+        {
+            /* =====================================================================
+                        HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(Tb) * size_y));
+            CHECK_HIPBLAS_ERROR(hipblasCopyExFn(batched));
+            CHECK_HIP_ERROR(hy_gpu.transfer_from(dy));
+
+            if(arg.unit_check)
+                unit_check_general<Tb>(1, N, batch_count, abs_incy, stride_y, hy_cpu, hy_gpu);
+            if(arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<Tb>(
+                        'F', 1, N, abs_incy, stride_y, hy_cpu, hy_gpu, batch_count));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasCopyExFn(0));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasCopyExModel{}.log_args<Tb>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            double(N) * batch_count * (sizeof(Ta) + sizeof(Tb)) / 1e9,
+            hipblas_error);
+    }
+}
+
+template <typename Ta, typename Tb = Ta>
+void testing_copy_matrix_ex_bad_arg(const Arguments& arg)
+{
+    constexpr hipDataType a_type = copy_ex_datatype<Ta>;
+    constexpr hipDataType b_type = copy_ex_datatype<Tb>;
+
+    hipblasLocalHandle handle(arg);
+    const int          M   = 101;
+    const int          N   = 100;
+    const int          lda = 102;
+    const int          ldb = 103;
+
+    device_matrix<Ta> dA(M, N, lda);
+    device_matrix<Tb> dB(M, N, ldb);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixEx(nullptr, M, N, dA, a_type, lda, dB, b_type, ldb),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixEx(handle, -1, N, dA, a_type, lda, dB, b_type, ldb),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixEx(handle, M, -1, dA, a_type, lda, dB, b_type, ldb),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixEx(handle, M, N, dA, a_type, M - 1, dB, b_type, ldb),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixEx(handle, M, N, dA, a_type, lda, dB, b_type, M - 1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyMatrixEx(handle, M, N, nullptr, a_type, lda, dB, b_type, ldb),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyMatrixEx(handle, M, N, dA, a_type, lda, nullptr, b_type, ldb),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixEx(handle, M, N, dA, HIP_R_8I, lda, dB, b_type, ldb),
+                          HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixStridedBatchedEx(
+                              handle, M, N, dA, a_type, lda, 0, dB, b_type, ldb, 0, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasCopyMatrixBatchedEx(handle, M, N, nullptr, a_type, lda, nullptr, b_type, ldb, 1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If M == 0, N == 0 or batchCount == 0, A and B can be nullptr
+    CHECK_HIPBLAS_ERROR(
+        hipblasCopyMatrixEx(handle, 0, N, nullptr, a_type, lda, nullptr, b_type, ldb));
+    CHECK_HIPBLAS_ERROR(
+        hipblasCopyMatrixEx(handle, M, 0, nullptr, a_type, lda, nullptr, b_type, ldb));
+    CHECK_HIPBLAS_ERROR(hipblasCopyMatrixStridedBatchedEx(
+        handle, M, N, nullptr, a_type, lda, 0, nullptr, b_type, ldb, 0, 0));
+    CHECK_HIPBLAS_ERROR(
+        hipblasCopyMatrixBatchedEx(handle, M, N, nullptr, a_type, lda, nullptr, b_type, ldb, 0));
+}
+
+// batch_count matrices A_i are copied into zeroed matrices B_i, through hipblasCopyMatrixEx for a
+// single matrix and through both batched functions otherwise. The matrices follow each other
+// with stride ld * N, so the strided batch is copied as one matrix of N * batch_count columns.
+// The array of pointers of the batched function is reversed, so every matrix is copied on its own.
+template <typename Ta, typename Tb = Ta>
+void testing_copy_matrix_ex(const Arguments& arg)
+{
+    constexpr hipDataType a_type = copy_ex_datatype<Ta>;
+    constexpr hipDataType b_type = copy_ex_datatype<Tb>;
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int batch_count = arg.batch_count;
+
+    hipblasLocalHandle handle(arg);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || lda < std::max(M, 1) || ldb < std::max(M, 1)
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasCopyMatrixStridedBatchedEx(handle,
+                                                                M,
+                                                                N,
+                                                                nullptr,
+                                                                a_type,
+                                                                lda,
+                                                                hipblasStride(lda) * N,
+                                                                nullptr,
+                                                                b_type,
+                                                                ldb,
+                                                                hipblasStride(ldb) * N,
+                                                                batch_count),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    hipblasStride stride_A = hipblasStride(lda) * N;
+    hipblasStride stride_B = hipblasStride(ldb) * N;
+    size_t        size_A   = size_t(stride_A) * batch_count;
+    size_t        size_B   = size_t(stride_B) * batch_count;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    host_vector<Ta> hA(size_A);
+    host_vector<Tb> hB_cpu(size_B);
+    host_vector<Tb> hB_gpu(size_B);
+
+    device_vector<Ta> dA(size_A);
+    device_vector<Tb> dB(size_B);
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+
+    hipblas_unique_ptr dA_array(hipblas::device_malloc(sizeof(Ta*) * batch_count),
+                                hipblas::device_free);
+    hipblas_unique_ptr dB_array(hipblas::device_malloc(sizeof(Tb*) * batch_count),
+                                hipblas::device_free);
+
+    double gpu_time_used, hipblas_error = 0.0;
+
+    // Initial Data on CPU
+    hipblas_init_vector(hA, arg, hipblas_client_never_set_nan, true);
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+    std::vector<Ta*> hA_array(batch_count);
+    std::vector<Tb*> hB_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = (Ta*)dA + (batch_count - 1 - b) * stride_A;
+        hB_array[b] = (Tb*)dB + (batch_count - 1 - b) * stride_B;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array.get(), hA_array.data(), sizeof(Ta*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_array.get(), hB_array.data(), sizeof(Tb*) * batch_count, hipMemcpyHostToDevice));
+
+    auto hipblasCopyMatrixExFn = [&](int batched) {
+        if(batch_count == 1)
+            return hipblasCopyMatrixEx(handle, M, N, dA, a_type, lda, dB, b_type, ldb);
+        if(batched)
+            return hipblasCopyMatrixBatchedEx(handle,
+                                              M,
+                                              N,
+                                              (const void* const*)dA_array.get(),
+                                              a_type,
+                                              lda,
+                                              (void* const*)dB_array.get(),
+                                              b_type,
+                                              ldb,
+                                              batch_count);
+        return hipblasCopyMatrixStridedBatchedEx(
+            handle, M, N, dA, a_type, lda, stride_A, dB, b_type, ldb, stride_B, batch_count);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(size_t i = 0; i < size_B; i++)
+            hB_cpu[i] = convert_alpha_beta<Tb>(0, 0);
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hB_cpu[b * stride_B + i + size_t(j) * ldb]
+                        = copy_ex_convert<Tb>(hA[b * stride_A + i + size_t(j) * lda]);
+
+        for(int batched = 0; batched < 2; batched++)
+        {
+            /* =====================================================================
+                        HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(hipMemset(dB, 0, sizeof(Tb) * size_B));
+            CHECK_HIPBLAS_ERROR(hipblasCopyMatrixExFn(batched));
+            CHECK_HIP_ERROR(hB_gpu.transfer_from(dB));
+
+            if(arg.unit_check)
+                unit_check_general<Tb>(M, N, batch_count, ldb, stride_B, hB_cpu, hB_gpu);
+            if(arg.norm_check)
+                hipblas_error = std::max(
+                    hipblas_error,
+                    norm_check_general<Tb>('F', M, N, ldb, stride_B, hB_cpu, hB_gpu, batch_count));
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasCopyMatrixExFn(0));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasCopyMatrixExModel{}.log_args<Tb>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ArgumentLogging::NA_value,
+            double(M) * N * batch_count * (sizeof(Ta) + sizeof(Tb)) / 1e9,
+            hipblas_error);
+    }
+}
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas_unique_ptr.hpp"
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmBatchedReduceExModel = ArgumentModel<e_a_type,
+                                                      e_transA,
+                                                      e_transB,
+                                                      e_M,
+                                                      e_N,
+                                                      e_K,
+                                                      e_alpha,
+                                                      e_lda,
+                                                      e_ldb,
+                                                      e_beta,
+                                                      e_ldc,
+                                                      e_batch_count>;
+
+inline void testname_gemm_batched_reduce_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmBatchedReduceExModel{}.test_name(arg, name);
+}
+
+// The sum of the products is compared against reference gemm calls accumulating into C, for
+// hipblasGemmStridedBatchedReduceEx and hipblasGemmBatchedReduceEx. In layout 0 the A_i and B_i
+// follow each other so that k can be concatenated, in layout 1 every matrix is padded by a column
+// and the products are accumulated one at a time. The arrays of pointers of layout 1 are
+// reversed, so they aren't evenly spaced either.
+template <typename T>
+void testing_gemm_batched_reduce_ex(const Arguments& arg)
+{
+    constexpr hipDataType data_type = std::is_same_v<T, float>            ? HIP_R_32F
+                                      : std::is_same_v<T, double>         ? HIP_R_64F
+                                      : std::is_same_v<T, hipblasComplex> ? HIP_C_32F
+                                                                          : HIP_C_64F;
+    constexpr hipblasComputeType_t compute_type
+        = std::is_same_v<real_t<T>, float> ? HIPBLAS_COMPUTE_32F : HIPBLAS_COMPUTE_64F;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                lda         = arg.lda;
+    int                ldb         = arg.ldb;
+    int                ldc         = arg.ldc;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : M;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size
+        = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmStridedBatchedReduceEx(handle,
+                                                                transA,
+                                                                transB,
+                                                                M,
+                                                                N,
+                                                                K,
+                                                                nullptr,
+                                                                nullptr,
+                                                                data_type,
+                                                                lda,
+                                                                hipblasStride(lda) * A_col,
+                                                                nullptr,
+                                                                data_type,
+                                                                ldb,
+                                                                hipblasStride(ldb) * B_col,
+                                                                nullptr,
+                                                                nullptr,
+                                                                data_type,
+                                                                ldc,
+                                                                batch_count,
+                                                                compute_type,
+                                                                HIPBLAS_GEMM_DEFAULT),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // k advances along columns of A for op(A) = A and along rows otherwise
+    bool A_k_cols = transA == HIPBLAS_OP_N;
+    bool B_k_cols = transB != HIPBLAS_OP_N;
+    int  K_total  = K * batch_count;
+
+    int           lda_layout[2] = {A_k_cols ? lda : std::max(lda, K_total), lda};
+    int           ldb_layout[2] = {B_k_cols ? ldb : std::max(ldb, K_total), ldb};
+    hipblasStride stride_A[2]
+        = {A_k_cols ? hipblasStride(lda) * K : K, hipblasStride(lda) * (A_col + 1)};
+    hipblasStride stride_B[2]
+        = {B_k_cols ? hipblasStride(ldb) * K : K, hipblasStride(ldb) * (B_col + 1)};
+
+    double gpu_time_used, hipblas_error_host = 0.0, hipblas_error_device = 0.0;
+
+    size_t size_A[2], size_B[2];
+    for(int layout = 0; layout < 2; layout++)
+    {
+        size_A[layout] = stride_A[layout] * (batch_count - 1) + size_t(lda_layout[layout]) * A_col;
+        size_B[layout] = stride_B[layout] * (batch_count - 1) + size_t(ldb_layout[layout]) * B_col;
+    }
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_vector<T> hA[2] = {host_vector<T>(size_A[0]), host_vector<T>(size_A[1])};
+    host_vector<T> hB[2] = {host_vector<T>(size_B[0]), host_vector<T>(size_B[1])};
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_gpu(M, N, ldc);
+    host_matrix<T> hC_cpu(M, N, ldc);
+
+    // Allocate device memory
+    device_vector<T> dA0(size_A[0]), dA1(size_A[1]);
+    device_vector<T> dB0(size_B[0]), dB1(size_B[1]);
+    device_matrix<T> dC(M, N, ldc);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    hipblas_unique_ptr dA_array(hipblas::device_malloc(sizeof(T*) * batch_count),
+                                hipblas::device_free);
+    hipblas_unique_ptr dB_array(hipblas::device_malloc(sizeof(T*) * batch_count),
+                                hipblas::device_free);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA0.memcheck());
+    CHECK_DEVICE_ALLOCATION(dA1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB0.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB1.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    T* dA[2] = {dA0, dA1};
+    T* dB[2] = {dB0, dB1};
+
+    // Initial Data on CPU
+    for(int layout = 0; layout < 2; layout++)
+    {
+        hipblas_init_vector(hA[layout], arg, hipblas_client_never_set_nan, true);
+        hipblas_init_vector(hB[layout], arg, hipblas_client_never_set_nan, false, true);
+    }
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA0.transfer_from(hA[0]));
+    CHECK_HIP_ERROR(dA1.transfer_from(hA[1]));
+    CHECK_HIP_ERROR(dB0.transfer_from(hB[0]));
+    CHECK_HIP_ERROR(dB1.transfer_from(hB[1]));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto hipblasGemmReduceFn = [&](bool strided, int layout, const T* alpha, const T* beta) {
+        if(strided)
+            return hipblasGemmStridedBatchedReduceEx(handle,
+                                                     transA,
+                                                     transB,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     alpha,
+                                                     dA[layout],
+                                                     data_type,
+                                                     lda_layout[layout],
+                                                     stride_A[layout],
+                                                     dB[layout],
+                                                     data_type,
+                                                     ldb_layout[layout],
+                                                     stride_B[layout],
+                                                     beta,
+                                                     dC,
+                                                     data_type,
+                                                     ldc,
+                                                     batch_count,
+                                                     compute_type,
+                                                     HIPBLAS_GEMM_DEFAULT);
+
+        return hipblasGemmBatchedReduceEx(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          alpha,
+                                          (const void* const*)dA_array.get(),
+                                          data_type,
+                                          lda_layout[layout],
+                                          (const void* const*)dB_array.get(),
+                                          data_type,
+                                          ldb_layout[layout],
+                                          beta,
+                                          dC,
+                                          data_type,
+                                          ldc,
+                                          batch_count,
+                                          compute_type,
+                                          HIPBLAS_GEMM_DEFAULT);
+    };
+
+    // pointers of layout 1 are in reverse order, which doesn't change the sum
+    auto set_arrays = [&](int layout) {
+        std::vector<T*> hA_array(batch_count), hB_array(batch_count);
+        for(int b = 0; b < batch_count; b++)
+        {
+            int i       = layout == 0 ? b : batch_count - 1 - b;
+            hA_array[b] = dA[layout] + i * stride_A[layout];
+            hB_array[b] = dB[layout] + i * stride_B[layout];
+        }
+        CHECK_HIP_ERROR(hipMemcpy(
+            dA_array.get(), hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(
+            dB_array.get(), hB_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int layout = 0; layout < 2; layout++)
+        {
+            /* =====================================================================
+                        CPU BLAS
+            =================================================================== */
+            hC_cpu = hC;
+            for(int i = 0; i < batch_count; i++)
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA[layout].data() + i * stride_A[layout],
+                            lda_layout[layout],
+                            hB[layout].data() + i * stride_B[layout],
+                            ldb_layout[layout],
+                            i ? T(1) : h_beta,
+                            hC_cpu.data(),
+                            ldc);
+
+            set_arrays(layout);
+            for(bool strided : {true, false})
+            {
+                /* =====================================================================
+                    HIPBLAS
+                =================================================================== */
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+                CHECK_HIPBLAS_ERROR(hipblasGemmReduceFn(strided, layout, &h_alpha, &h_beta));
+                CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldc, hC_cpu, hC_gpu);
+                if(arg.norm_check)
+                    hipblas_error_host = std::max(
+                        hipblas_error_host,
+                        hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_gpu)));
+
+                CHECK_HIP_ERROR(dC.transfer_from(hC));
+                CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+                CHECK_HIPBLAS_ERROR(hipblasGemmReduceFn(strided, layout, d_alpha, d_beta));
+                CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+                if(arg.unit_check)
+                    unit_check_general<T>(M, N, ldc, hC_cpu, hC_gpu);
+                if(arg.norm_check)
+                    hipblas_error_device = std::max(
+                        hipblas_error_device,
+                        hipblas_abs(norm_check_general<T>('F', M, N, ldc, hC_cpu, hC_gpu)));
+            }
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmReduceFn(true, 0, &h_alpha, &h_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmBatchedReduceExModel{}.log_args<T>(std::cout,
+                                                      arg,
+                                                      gpu_time_used,
+                                                      gemm_gflop_count<T>(M, N, K_total),
+                                                      gemm_gbyte_count<T>(M, N, K_total),
+                                                      hipblas_error_host,
+                                                      hipblas_error_device);
+    }
+}
@@ -47,7 +47,10 @@ using hipblasGemmExModel = ArgumentModel<e_a_type,
                                          e_beta,
                                          e_ldc,
                                          e_with_flags,
-                                         e_flags>;
+                                         e_flags,
+                                         e_split_k,
+                                         e_strassen_levels,
+                                         e_gemm_order>;
 
 inline void testname_gemm_ex(const Arguments& arg, std::string& name)
 {
@@ -297,7 +300,9 @@ void testing_gemm_ex(const Arguments& arg)
     auto hipblasGemmExWithFlagsFn_64
         = arg.api == FORTRAN_64 ? hipblasGemmExWithFlags_64Fortran : hipblasGemmExWithFlags_64;
 
-    hipblasGemmAlgo_t algo           = HIPBLAS_GEMM_DEFAULT;
+    hipblasGemmAlgo_t algo           = arg.split_k           ? HIPBLAS_GEMM_SPLIT_K
+                                       : arg.strassen_levels ? HIPBLAS_GEMM_STRASSEN
+                                                             : HIPBLAS_GEMM_DEFAULT;
     size_t*           workspace_size = 0;
     void*             workspace      = 0;
 
@@ -333,9 +338,21 @@ void testing_gemm_ex(const Arguments& arg)
     int64_t B_col = transB == HIPBLAS_OP_N ? N : K;
 
     hipblasLocalHandle handle(arg);
+    if(arg.split_k > 0)
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmSplitK(handle, arg.split_k));
+    if(arg.strassen_levels > 0)
+        CHECK_HIPBLAS_ERROR(hipblasSetGemmStrassenLevels(handle, arg.strassen_levels));
+    if(arg.gemm_order > 0)
+        CHECK_HIPBLAS_ERROR(
+            hipblasSetGemmOrderMode(handle, hipblasGemmOrderMode_t(arg.gemm_order)));
+
+    // with HIPBLAS_GEMM_ORDER_TRANSPOSED_C, C holds C^T = op(B)^T * op(A)^T
+    bool    transposed_C = arg.gemm_order == HIPBLAS_GEMM_ORDER_TRANSPOSED_C;
+    int64_t C_row        = transposed_C ? N : M;
+    int64_t C_col        = transposed_C ? M : N;
 
     // check here to prevent undefined memory allocation error
-    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < C_row;
     if(invalid_size || !M || !N)
     {
         DAPI_EXPECT(invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS,
@@ -366,14 +383,14 @@ void testing_gemm_ex(const Arguments& arg)
     // Allocate host memory
     host_matrix<Ti> hA(A_row, A_col, lda);
     host_matrix<Ti> hB(B_row, B_col, ldb);
-    host_matrix<To> hC_host(M, N, ldc);
-    host_matrix<To> hC_device(M, N, ldc);
-    host_matrix<To> hC_gold(M, N, ldc);
+    host_matrix<To> hC_host(C_row, C_col, ldc);
+    host_matrix<To> hC_device(C_row, C_col, ldc);
+    host_matrix<To> hC_gold(C_row, C_col, ldc);
 
     // Allocate device memory
     device_matrix<Ti>  dA(A_row, A_col, lda);
     device_matrix<Ti>  dB(B_row, B_col, ldb);
-    device_matrix<To>  dC(M, N, ldc);
+    device_matrix<To>  dC(C_row, C_col, ldc);
     device_vector<Tex> d_alpha(1);
     device_vector<Tex> d_beta(1);
 
@@ -502,19 +519,39 @@ void testing_gemm_ex(const Arguments& arg)
         CHECK_HIP_ERROR(hC_device.transfer_from(dC));
 
         // reference BLAS
-        ref_gemm<Ti, To, Tex>(transA,
-                              transB,
-                              M,
-                              N,
-                              K,
-                              h_alpha_Tex,
-                              hA.data(),
-                              lda,
-                              hB.data(),
-                              ldb,
-                              h_beta_Tex,
-                              hC_gold.data(),
-                              ldc);
+        if(transposed_C)
+        {
+            auto transpose = [](hipblasOperation_t trans) {
+                return trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+            };
+            ref_gemm<Ti, To, Tex>(transpose(transB),
+                                  transpose(transA),
+                                  N,
+                                  M,
+                                  K,
+                                  h_alpha_Tex,
+                                  hB.data(),
+                                  ldb,
+                                  hA.data(),
+                                  lda,
+                                  h_beta_Tex,
+                                  hC_gold.data(),
+                                  ldc);
+        }
+        else
+            ref_gemm<Ti, To, Tex>(transA,
+                                  transB,
+                                  M,
+                                  N,
+                                  K,
+                                  h_alpha_Tex,
+                                  hA.data(),
+                                  lda,
+                                  hB.data(),
+                                  ldb,
+                                  h_beta_Tex,
+                                  hC_gold.data(),
+                                  ldc);
 
         if(unit_check)
         {
@@ -525,21 +562,21 @@ void testing_gemm_ex(const Arguments& arg)
                    || (std::is_same<Tex, hipblasHalf>{} && std::is_same<Ti, hipblasHalf>{})))
             {
                 const double tol = K * sum_error_tolerance_for_gfx11<Tex, Ti, To>;
-                near_check_general<To>(M, N, ldc, hC_gold.data(), hC_host.data(), tol);
-                near_check_general<To>(M, N, ldc, hC_gold.data(), hC_device.data(), tol);
+                near_check_general<To>(C_row, C_col, ldc, hC_gold.data(), hC_host.data(), tol);
+                near_check_general<To>(C_row, C_col, ldc, hC_gold.data(), hC_device.data(), tol);
             }
             else
             {
-                unit_check_general<To>(M, N, ldc, hC_gold, hC_host);
-                unit_check_general<To>(M, N, ldc, hC_gold, hC_device);
+                unit_check_general<To>(C_row, C_col, ldc, hC_gold, hC_host);
+                unit_check_general<To>(C_row, C_col, ldc, hC_gold, hC_device);
             }
         }
         if(norm_check)
         {
-            hipblas_error_host
-                = hipblas_abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_host));
-            hipblas_error_device
-                = hipblas_abs(norm_check_general<To>('F', M, N, ldc, hC_gold, hC_device));
+            hipblas_error_host = hipblas_abs(
+                norm_check_general<To>('F', C_row, C_col, ldc, hC_gold, hC_host));
+            hipblas_error_device = hipblas_abs(
+                norm_check_general<To>('F', C_row, C_col, ldc, hC_gold, hC_device));
         }
     }
 
@@ -552,8 +589,7 @@ void testing_gemm_ex(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             if(!arg.with_flags)
             {
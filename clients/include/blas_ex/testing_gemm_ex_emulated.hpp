@@ -0,0 +1,272 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmExEmulatedModel = ArgumentModel<e_a_type,
+                                                 e_transA,
+                                                 e_transB,
+                                                 e_M,
+                                                 e_N,
+                                                 e_K,
+                                                 e_alpha,
+                                                 e_lda,
+                                                 e_ldb,
+                                                 e_beta,
+                                                 e_ldc,
+                                                 e_emulation_slices>;
+
+inline void testname_gemm_ex_emulated(const Arguments& arg, std::string& name)
+{
+    hipblasGemmExEmulatedModel{}.test_name(arg, name);
+}
+
+// Frobenius norm of A - R, or of A if R is nullptr, for column major matrices
+template <typename T>
+double gemm_ex_emulated_norm(int M, int N, int ld, const T* A, const double* R = nullptr)
+{
+    double norm = 0.0;
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+        {
+            size_t idx = i + size_t(j) * ld;
+            double a   = double(A[idx]) - (R ? R[idx] : 0.0);
+            norm += a * a;
+        }
+    return std::sqrt(norm);
+}
+
+// float computed with HIPBLAS_COMPUTE_32F_EMULATED_16BF. The result is compared against a double
+// precision reference gemm, with an error normalized by |alpha| ||A|| ||B|| + |beta| ||C|| and a
+// tolerance derived from the number of bits kept by the slices.
+template <typename T>
+void testing_gemm_ex_emulated(const Arguments& arg)
+{
+    hipDataType          data_type    = HIP_R_32F;
+    hipblasComputeType_t compute_type = HIPBLAS_COMPUTE_32F_EMULATED_16BF;
+
+    hipblasOperation_t transA = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB = char2hipblas_operation(arg.transB);
+    int                M      = arg.M;
+    int                N      = arg.N;
+    int                K      = arg.K;
+    int                lda    = arg.lda;
+    int                ldb    = arg.ldb;
+    int                ldc    = arg.ldc;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    CHECK_HIPBLAS_ERROR(hipblasSetGemmEmulationSlices(handle, arg.emulation_slices));
+
+    int expected = arg.emulation_slices, slices;
+    CHECK_HIPBLAS_ERROR(hipblasGetGemmEmulationSlices(handle, &slices));
+    if(arg.unit_check)
+        unit_check_general<int>(1, 1, 1, &expected, &slices);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : std::max(K, 1);
+    int A_col = transA == HIPBLAS_OP_N ? std::max(K, 1) : M;
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M;
+    if(invalid_size || !M || !N)
+    {
+        EXPECT_HIPBLAS_STATUS(hipblasGemmEx_v2(handle,
+                                               transA,
+                                               transB,
+                                               M,
+                                               N,
+                                               K,
+                                               nullptr,
+                                               nullptr,
+                                               data_type,
+                                               lda,
+                                               nullptr,
+                                               data_type,
+                                               ldb,
+                                               nullptr,
+                                               nullptr,
+                                               data_type,
+                                               ldc,
+                                               compute_type,
+                                               HIPBLAS_GEMM_DEFAULT),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    double gpu_time_used, hipblas_error_host, hipblas_error_device;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T> hA(A_row, A_col, lda);
+    host_matrix<T> hB(B_row, B_col, ldb);
+    host_matrix<T> hC(M, N, ldc);
+    host_matrix<T> hC_host(M, N, ldc);
+    host_matrix<T> hC_device(M, N, ldc);
+
+    // Allocate device memory
+    device_matrix<T> dA(A_row, A_col, lda);
+    device_matrix<T> dB(B_row, B_col, ldb);
+    device_matrix<T> dC(M, N, ldc);
+    device_vector<T> d_alpha(1);
+    device_vector<T> d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto hipblasGemmExEmulatedFn = [&](const T* alpha, const T* beta) {
+        return hipblasGemmEx_v2(handle,
+                                transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                alpha,
+                                dA,
+                                data_type,
+                                lda,
+                                dB,
+                                data_type,
+                                ldb,
+                                beta,
+                                dC,
+                                data_type,
+                                ldc,
+                                compute_type,
+                                HIPBLAS_GEMM_DEFAULT);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExEmulatedFn(&h_alpha, &h_beta));
+
+        CHECK_HIP_ERROR(hC_host.transfer_from(dC));
+
+        CHECK_HIP_ERROR(dC.transfer_from(hC));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+        CHECK_HIPBLAS_ERROR(hipblasGemmExEmulatedFn(d_alpha, d_beta));
+
+        CHECK_HIP_ERROR(hC_device.transfer_from(dC));
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        host_matrix<double> hA_cpu(hA);
+        host_matrix<double> hB_cpu(hB);
+        host_matrix<double> hC_cpu(hC);
+        ref_gemm<double>(transA,
+                         transB,
+                         M,
+                         N,
+                         K,
+                         h_alpha,
+                         hA_cpu.data(),
+                         lda,
+                         hB_cpu.data(),
+                         ldb,
+                         h_beta,
+                         hC_cpu.data(),
+                         ldc);
+
+        double norm_A = gemm_ex_emulated_norm(A_row, A_col, lda, hA.data());
+        double norm_B = gemm_ex_emulated_norm(B_row, B_col, ldb, hB.data());
+        double norm_C = gemm_ex_emulated_norm(M, N, ldc, hC.data());
+        double scale
+            = std::abs(double(h_alpha)) * norm_A * norm_B + std::abs(double(h_beta)) * norm_C;
+        if(scale == 0.0)
+            scale = 1.0;
+
+        hipblas_error_host
+            = gemm_ex_emulated_norm(M, N, ldc, hC_host.data(), hC_cpu.data()) / scale;
+        hipblas_error_device
+            = gemm_ex_emulated_norm(M, N, ldc, hC_device.data(), hC_cpu.data()) / scale;
+
+        if(arg.unit_check)
+        {
+            // every truncated bfloat16 slice keeps 8 bits of the operands, the first one counting
+            // the implicit bit, so the error after used slices is below 2^(-7 used) relative
+            int    used      = slices ? slices : 2;
+            double tolerance = std::max(std::ldexp(16.0, -7 * used),
+                                        double(std::numeric_limits<T>::epsilon()) * K);
+            unit_check_error(hipblas_error_host, tolerance);
+            unit_check_error(hipblas_error_device, tolerance);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmExEmulatedFn(&h_alpha, &h_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmExEmulatedModel{}.log_args<T>(std::cout,
+                                                 arg,
+                                                 gpu_time_used,
+                                                 gemm_gflop_count<T>(M, N, K),
+                                                 gemm_gbyte_count<T>(M, N, K),
+                                                 hipblas_error_host,
+                                                 hipblas_error_device);
+    }
+}
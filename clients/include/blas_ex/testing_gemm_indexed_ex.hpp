@@ -0,0 +1,331 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+/* ============================================================================================ */
+
+using hipblasGemmIndexedExModel = ArgumentModel<e_a_type,
+                                                e_transA,
+                                                e_transB,
+                                                e_M,
+                                                e_N,
+                                                e_K,
+                                                e_alpha,
+                                                e_lda,
+                                                e_ldb,
+                                                e_beta,
+                                                e_ldc,
+                                                e_batch_count>;
+
+inline void testname_gemm_indexed_ex(const Arguments& arg, std::string& name)
+{
+    hipblasGemmIndexedExModel{}.test_name(arg, name);
+}
+
+// batch_count groups of M rows each. A and C hold twice as many rows as the groups use. Index
+// layout 0 passes null index arrays, so the groups use consecutive rows. Index layout 1 takes
+// every row of A from a different place, and alternates the updated rows of C between the two
+// halves of C. The reference gathers the rows on the host, calls gemm for every group and scatters
+// them back.
+template <typename T>
+void testing_gemm_indexed_ex(const Arguments& arg)
+{
+    constexpr hipDataType data_type = std::is_same_v<T, float>            ? HIP_R_32F
+                                      : std::is_same_v<T, double>         ? HIP_R_64F
+                                      : std::is_same_v<T, hipblasComplex> ? HIP_C_32F
+                                                                          : HIP_C_64F;
+    constexpr hipblasComputeType_t compute_type
+        = std::is_same_v<real_t<T>, float> ? HIPBLAS_COMPUTE_32F : HIPBLAS_COMPUTE_64F;
+
+    hipblasOperation_t transA      = char2hipblas_operation(arg.transA);
+    hipblasOperation_t transB      = char2hipblas_operation(arg.transB);
+    int                M           = arg.M;
+    int                N           = arg.N;
+    int                K           = arg.K;
+    int                ldb         = arg.ldb;
+    int                batch_count = arg.batch_count;
+
+    T h_alpha = arg.get_alpha<T>();
+    T h_beta  = arg.get_beta<T>();
+
+    hipblasLocalHandle handle(arg);
+
+    int B_row = transB == HIPBLAS_OP_N ? std::max(K, 1) : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : std::max(K, 1);
+
+    // check here to prevent undefined memory allocation error
+    bool invalid_size = M < 0 || N < 0 || K < 0 || ldb < B_row || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        std::vector<int> group_rows(std::max(batch_count, 0), M);
+        EXPECT_HIPBLAS_STATUS(hipblasGemmGroupedIndexedEx(handle,
+                                                          transA,
+                                                          transB,
+                                                          batch_count,
+                                                          group_rows.data(),
+                                                          N,
+                                                          K,
+                                                          nullptr,
+                                                          nullptr,
+                                                          data_type,
+                                                          std::max(K, 1),
+                                                          nullptr,
+                                                          nullptr,
+                                                          data_type,
+                                                          ldb,
+                                                          hipblasStride(ldb) * B_col,
+                                                          nullptr,
+                                                          nullptr,
+                                                          data_type,
+                                                          1,
+                                                          nullptr,
+                                                          compute_type,
+                                                          HIPBLAS_GEMM_DEFAULT),
+                              invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                           : HIPBLAS_STATUS_SUCCESS);
+        return;
+    }
+
+    // op(A) and C have 2 * rows rows, of which rows are used
+    int  rows     = M * batch_count;
+    bool A_trans  = transA != HIPBLAS_OP_N;
+    int  A_row    = A_trans ? std::max(K, 1) : 2 * rows;
+    int  A_col    = A_trans ? 2 * rows : std::max(K, 1);
+    int  lda      = std::max<int>(arg.lda, A_row);
+    int  ldc      = std::max<int>(arg.ldc, 2 * rows);
+    int  ldag     = A_trans ? std::max(K, 1) : M;
+    int  A_g_cols = A_trans ? M : std::max(K, 1);
+
+    hipblasStride stride_B = hipblasStride(ldb) * B_col;
+
+    std::vector<int> group_rows(batch_count, M);
+    std::vector<int> index_A(rows), index_C(rows);
+    for(int i = 0; i < rows; i++)
+    {
+        index_A[i] = (i * 5 + 1) % (2 * rows);
+        index_C[i] = i % 2 ? rows + i : i;
+    }
+
+    double gpu_time_used, hipblas_error_host = 0.0, hipblas_error_device = 0.0;
+
+    // Naming: `h` is in CPU (host) memory(eg hA), `d` is in GPU (device) memory (eg dA).
+    // Allocate host memory
+    host_matrix<T>               hA(A_row, A_col, lda);
+    host_strided_batch_matrix<T> hB(B_row, B_col, ldb, stride_B, batch_count);
+    host_matrix<T>               hC(2 * rows, N, ldc);
+    host_matrix<T>               hC_gpu(2 * rows, N, ldc);
+    host_matrix<T>               hC_cpu(2 * rows, N, ldc);
+    host_vector<T>               hA_g(size_t(ldag) * A_g_cols);
+    host_vector<T>               hC_g(size_t(M) * N);
+
+    // Allocate device memory
+    device_matrix<T>               dA(A_row, A_col, lda);
+    device_strided_batch_matrix<T> dB(B_row, B_col, ldb, stride_B, batch_count);
+    device_matrix<T>               dC(2 * rows, N, ldc);
+    device_vector<T>               d_alpha(1);
+    device_vector<T>               d_beta(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_alpha.memcheck());
+    CHECK_DEVICE_ALLOCATION(d_beta.memcheck());
+
+    // Initial Data on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(
+        hB, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice));
+
+    // a single group goes through hipblasGemmIndexedEx
+    auto hipblasGemmIndexedFn = [&](int layout, const T* alpha, const T* beta) {
+        const int* row_index_A = layout ? index_A.data() : nullptr;
+        const int* row_index_C = layout ? index_C.data() : nullptr;
+        if(batch_count == 1)
+            return hipblasGemmIndexedEx(handle,
+                                        transA,
+                                        transB,
+                                        M,
+                                        N,
+                                        K,
+                                        alpha,
+                                        dA,
+                                        data_type,
+                                        lda,
+                                        row_index_A,
+                                        dB,
+                                        data_type,
+                                        ldb,
+                                        beta,
+                                        dC,
+                                        data_type,
+                                        ldc,
+                                        row_index_C,
+                                        compute_type,
+                                        HIPBLAS_GEMM_DEFAULT);
+
+        return hipblasGemmGroupedIndexedEx(handle,
+                                           transA,
+                                           transB,
+                                           batch_count,
+                                           group_rows.data(),
+                                           N,
+                                           K,
+                                           alpha,
+                                           dA,
+                                           data_type,
+                                           lda,
+                                           row_index_A,
+                                           dB,
+                                           data_type,
+                                           ldb,
+                                           stride_B,
+                                           beta,
+                                           dC,
+                                           data_type,
+                                           ldc,
+                                           row_index_C,
+                                           compute_type,
+                                           HIPBLAS_GEMM_DEFAULT);
+    };
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        for(int layout = 0; layout < 2; layout++)
+        {
+            /* =====================================================================
+                        CPU BLAS
+            =================================================================== */
+            hC_cpu = hC;
+            for(int g = 0; g < batch_count; g++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    int row_A = layout ? index_A[g * M + i] : g * M + i;
+                    int row_C = layout ? index_C[g * M + i] : g * M + i;
+                    for(int l = 0; l < K; l++)
+                    {
+                        if(A_trans)
+                            hA_g[l + size_t(i) * ldag] = hA.data()[l + size_t(row_A) * lda];
+                        else
+                            hA_g[i + size_t(l) * ldag] = hA.data()[row_A + size_t(l) * lda];
+                    }
+                    for(int j = 0; j < N; j++)
+                        hC_g[i + size_t(j) * M] = hC_cpu.data()[row_C + size_t(j) * ldc];
+                }
+
+                ref_gemm<T>(transA,
+                            transB,
+                            M,
+                            N,
+                            K,
+                            h_alpha,
+                            hA_g.data(),
+                            ldag,
+                            hB[g],
+                            ldb,
+                            h_beta,
+                            hC_g.data(),
+                            M);
+
+                for(int i = 0; i < M; i++)
+                {
+                    int row_C = layout ? index_C[g * M + i] : g * M + i;
+                    for(int j = 0; j < N; j++)
+                        hC_cpu.data()[row_C + size_t(j) * ldc] = hC_g[i + size_t(j) * M];
+                }
+            }
+
+            /* =====================================================================
+                HIPBLAS
+            =================================================================== */
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+            CHECK_HIPBLAS_ERROR(hipblasGemmIndexedFn(layout, &h_alpha, &h_beta));
+            CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+            if(arg.unit_check)
+                unit_check_general<T>(2 * rows, N, ldc, hC_cpu, hC_gpu);
+            if(arg.norm_check)
+                hipblas_error_host = std::max(
+                    hipblas_error_host,
+                    hipblas_abs(norm_check_general<T>('F', 2 * rows, N, ldc, hC_cpu, hC_gpu)));
+
+            CHECK_HIP_ERROR(dC.transfer_from(hC));
+            CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE));
+            CHECK_HIPBLAS_ERROR(hipblasGemmIndexedFn(layout, d_alpha, d_beta));
+            CHECK_HIP_ERROR(hC_gpu.transfer_from(dC));
+
+            if(arg.unit_check)
+                unit_check_general<T>(2 * rows, N, ldc, hC_cpu, hC_gpu);
+            if(arg.norm_check)
+                hipblas_error_device = std::max(
+                    hipblas_error_device,
+                    hipblas_abs(norm_check_general<T>('F', 2 * rows, N, ldc, hC_cpu, hC_gpu)));
+        }
+
+        // an index past the rows of C is rejected
+        int last_C        = index_C[rows - 1];
+        index_C[rows - 1] = ldc;
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+        EXPECT_HIPBLAS_STATUS(hipblasGemmIndexedFn(1, &h_alpha, &h_beta),
+                              HIPBLAS_STATUS_INVALID_VALUE);
+        index_C[rows - 1] = last_C;
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+        CHECK_HIPBLAS_ERROR(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGemmIndexedFn(1, &h_alpha, &h_beta));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGemmIndexedExModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                gemm_gflop_count<T>(M, N, K) * batch_count,
+                                                gemm_gbyte_count<T>(M, N, K) * batch_count,
+                                                hipblas_error_host,
+                                                hipblas_error_device);
+    }
+}
@@ -829,6 +829,26 @@ int64_t ref_gels(char    trans,
                  T*      work,
                  int64_t lwork);
 
+// orgqr and ungqr
+template <typename T>
+int64_t ref_orgqr(
+    int64_t m, int64_t n, int64_t k, T* A, int64_t lda, T* tau, T* work, int64_t lwork);
+
+// ormqr and unmqr
+template <typename T>
+int64_t ref_ormqr(char    side,
+                  char    trans,
+                  int64_t m,
+                  int64_t n,
+                  int64_t k,
+                  T*      A,
+                  int64_t lda,
+                  T*      tau,
+                  T*      C,
+                  int64_t ldc,
+                  T*      work,
+                  int64_t lwork);
+
 #endif
 
 /* ============================================================================================ */
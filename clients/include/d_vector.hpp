@@ -29,6 +29,7 @@
 #include <clocale>
 #include <cstdio>
 #include <iostream>
+#include <vector>
 
 #define MEM_MAX_GUARD_PAD 8192
 
@@ -36,6 +37,42 @@
 extern size_t g_DVEC_PAD;
 void          d_vector_set_pad_length(size_t pad);
 
+// with retention on, freed device memory is kept and reused by later allocations of the same
+// size or smaller, and turning retention off frees the kept memory
+void       d_vector_set_retain_allocations(bool retain);
+hipError_t d_vector_malloc(void** ptr, size_t bytes);
+hipError_t d_vector_free(void* ptr);
+
+// Rotating buffers: with a rotating size set, the timing loops of a thread cycle through copies of
+// the device memory of every d_vector, enough copies that they do not fit in the caches together.
+// d_vector_start_rotation makes the copies, d_vector_rotate selects the copy of an iteration and
+// d_vector_end_rotation frees the copies once a hot iteration was selected.
+void   d_vector_set_rotating_bytes(size_t bytes);
+void   d_vector_start_rotation();
+void   d_vector_rotate(size_t index, bool hot);
+void   d_vector_end_rotation();
+size_t d_vector_rotation();
+
+/* ============================================================================================ */
+/*! \brief  base-class of device memory which has copies while buffers rotate */
+class d_vector_rotating
+{
+public:
+    d_vector_rotating();
+    virtual ~d_vector_rotating();
+
+    d_vector_rotating(const d_vector_rotating&) = delete;
+    d_vector_rotating& operator=(const d_vector_rotating&) = delete;
+
+    // bytes of device memory in one copy
+    virtual size_t rotating_bytes() const = 0;
+
+    // make copies - 1 copies of the device memory, returns false if they cannot be allocated
+    virtual bool rotating_setup(size_t copies) = 0;
+
+    virtual void rotating_teardown() = 0;
+};
+
 //
 // Forward declaration of hipblas_init_nan
 //
@@ -45,7 +82,7 @@ inline void hipblas_init_nan(T* A, size_t N);
 /* ============================================================================================ */
 /*! \brief  base-class to allocate/deallocate device memory */
 template <typename T>
-class d_vector
+class d_vector : public d_vector_rotating
 {
 private:
     size_t m_size;
@@ -95,7 +132,8 @@ public:
     T* device_vector_setup()
     {
         T* d = nullptr;
-        if(use_HMM ? hipMallocManaged(&d, m_bytes) : (hipMalloc)(&d, m_bytes) != hipSuccess)
+        if(use_HMM ? hipMallocManaged(&d, m_bytes)
+                   : d_vector_malloc((void**)&d, m_bytes) != hipSuccess)
         {
             std::cout << "Warning: hip can't allocate " << m_bytes << " bytes (" << (m_bytes >> 30)
                       << " GB)" << std::endl;
@@ -150,6 +188,50 @@ public:
 #endif
     }
 
+    size_t rotating_bytes() const override
+    {
+        return use_HMM ? 0 : m_size * sizeof(T);
+    }
+
+    void rotating_teardown() override
+    {
+        for(size_t copy = 1; copy < m_rotating.size(); copy++)
+            device_vector_teardown(m_rotating[copy]);
+        m_rotating.clear();
+    }
+
+protected:
+    // m_rotating[0] is the device memory itself, followed by its copies
+    std::vector<T*> m_rotating;
+
+    //! \brief  copies of the device memory d which was allocated with device_vector_setup
+    bool rotating_setup_copies(T* d, size_t copies)
+    {
+        rotating_teardown();
+        if(use_HMM || !d || copies < 2)
+            return true;
+
+        m_rotating.push_back(d);
+        for(size_t copy = 1; copy < copies; copy++)
+        {
+            T* c = device_vector_setup();
+            if(!c)
+                return false;
+            m_rotating.push_back(c);
+
+            if(hipMemcpy(c, d, m_size * sizeof(T), hipMemcpyDeviceToDevice) != hipSuccess)
+                return false;
+        }
+        return true;
+    }
+
+    //! \brief  the copy of the device memory d for the current iteration
+    T* rotated(T* d) const
+    {
+        return m_rotating.empty() ? d : m_rotating[d_vector_rotation() % m_rotating.size()];
+    }
+
+public:
     void device_vector_teardown(T* d)
     {
         if(d != nullptr)
@@ -160,7 +242,7 @@ public:
                 d -= m_pad; // restore to start of alloc
 
             // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            CHECK_HIP_ERROR(d_vector_free(d));
         }
     }
 };
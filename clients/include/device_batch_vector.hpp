@@ -115,7 +115,7 @@ public:
     //!
     T** ptr_on_device()
     {
-        return m_device_data;
+        return rotated_device_data();
     }
 
     //!
@@ -124,7 +124,7 @@ public:
     //!
     const T* const* ptr_on_device() const
     {
-        return m_device_data;
+        return rotated_device_data();
     }
 
     //!
@@ -133,7 +133,46 @@ public:
     //!
     T* const* const_batch_ptr()
     {
-        return m_device_data;
+        return rotated_device_data();
+    }
+
+    //!
+    //! @brief Make copies of the device memory and of the array of pointers for rotating buffers.
+    //!
+    bool rotating_setup(size_t copies) override
+    {
+        if(nullptr == m_data || m_batch_count < 1)
+            return true;
+
+        if(!this->rotating_setup_copies(m_data[0], copies))
+            return false;
+
+        std::vector<T*> data(m_batch_count);
+        for(size_t copy = 1; copy < this->m_rotating.size(); copy++)
+        {
+            T** device_data;
+            if(hipSuccess != (hipMalloc)(&device_data, m_batch_count * sizeof(T*)))
+                return false;
+            m_rotating_device_data.push_back(device_data);
+
+            for(int64_t batch_index = 0; batch_index < m_batch_count; ++batch_index)
+                data[batch_index] = this->m_rotating[copy] + batch_index * m_nmemb;
+
+            if(hipSuccess
+               != hipMemcpy(
+                   device_data, data.data(), sizeof(T*) * m_batch_count, hipMemcpyHostToDevice))
+                return false;
+        }
+        return true;
+    }
+
+    void rotating_teardown() override
+    {
+        for(T** device_data : m_rotating_device_data)
+            CHECK_HIP_ERROR((hipFree)(device_data));
+        m_rotating_device_data.clear();
+
+        d_vector<T>::rotating_teardown();
     }
 
     //!
@@ -228,6 +267,15 @@ private:
     T**     m_data{};
     T**     m_device_data{};
 
+    // arrays of pointers to the copies of the device memory while buffers rotate
+    std::vector<T**> m_rotating_device_data;
+
+    T** rotated_device_data() const
+    {
+        size_t copy = d_vector_rotation() % (m_rotating_device_data.size() + 1);
+        return copy ? m_rotating_device_data[copy - 1] : m_device_data;
+    }
+
     static size_t calculate_nmemb(size_t n, int64_t inc)
     {
         // allocate even for zero n
@@ -287,6 +335,8 @@ private:
     //!
     void free_memory()
     {
+        rotating_teardown();
+
         if(nullptr != m_data)
         {
             for(int64_t batch_index = 0; batch_index < m_batch_count; ++batch_index)
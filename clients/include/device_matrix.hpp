@@ -70,6 +70,7 @@ public:
     //!
     ~device_matrix()
     {
+        this->rotating_teardown();
         this->device_vector_teardown(m_data);
         m_data = nullptr;
     }
@@ -119,7 +120,7 @@ public:
     //!
     operator T*()
     {
-        return m_data;
+        return this->rotated(m_data);
     }
 
     //!
@@ -127,7 +128,15 @@ public:
     //!
     operator const T*() const
     {
-        return m_data;
+        return this->rotated(m_data);
+    }
+
+    //!
+    //! @brief Make copies of the device memory for rotating buffers.
+    //!
+    bool rotating_setup(size_t copies) override
+    {
+        return this->rotating_setup_copies(m_data, copies);
     }
 
     //!
@@ -80,6 +80,7 @@ public:
     {
         if(nullptr != this->m_data)
         {
+            this->rotating_teardown();
             this->device_vector_teardown(this->m_data);
             this->m_data = nullptr;
         }
@@ -90,7 +91,7 @@ public:
     //!
     T* data()
     {
-        return this->m_data;
+        return this->rotated(this->m_data);
     }
 
     //!
@@ -98,7 +99,15 @@ public:
     //!
     const T* data() const
     {
-        return this->m_data;
+        return this->rotated(this->m_data);
+    }
+
+    //!
+    //! @brief Make copies of the device memory for rotating buffers.
+    //!
+    bool rotating_setup(size_t copies) override
+    {
+        return this->rotating_setup_copies(this->m_data, copies);
     }
 
     //!
@@ -149,8 +158,8 @@ public:
     T* operator[](int64_t batch_index)
     {
         return (this->m_stride >= 0)
-                   ? this->m_data + batch_index * this->m_stride
-                   : this->m_data + (batch_index + 1 - this->m_batch_count) * this->m_stride;
+                   ? data() + batch_index * this->m_stride
+                   : data() + (batch_index + 1 - this->m_batch_count) * this->m_stride;
     }
 
     //!
@@ -161,8 +170,8 @@ public:
     const T* operator[](int64_t batch_index) const
     {
         return (this->m_stride >= 0)
-                   ? this->m_data + batch_index * this->m_stride
-                   : this->m_data + (batch_index + 1 - this->m_batch_count) * this->m_stride;
+                   ? data() + batch_index * this->m_stride
+                   : data() + (batch_index + 1 - this->m_batch_count) * this->m_stride;
     }
 
     //!
@@ -74,6 +74,7 @@ public:
     {
         if(nullptr != m_data)
         {
+            this->rotating_teardown();
             this->device_vector_teardown(m_data);
             m_data = nullptr;
         }
@@ -84,7 +85,7 @@ public:
     //!
     T* data()
     {
-        return m_data;
+        return this->rotated(m_data);
     }
 
     //!
@@ -92,7 +93,15 @@ public:
     //!
     const T* data() const
     {
-        return m_data;
+        return this->rotated(m_data);
+    }
+
+    //!
+    //! @brief Make copies of the device memory for rotating buffers.
+    //!
+    bool rotating_setup(size_t copies) override
+    {
+        return this->rotating_setup_copies(m_data, copies);
     }
 
     //!
@@ -134,8 +143,8 @@ public:
     //!
     T* operator[](int64_t batch_index)
     {
-        return (m_stride >= 0) ? m_data + batch_index * m_stride
-                               : m_data + (batch_index + 1 - m_batch_count) * m_stride;
+        return (m_stride >= 0) ? data() + batch_index * m_stride
+                               : data() + (batch_index + 1 - m_batch_count) * m_stride;
     }
 
     //!
@@ -145,8 +154,8 @@ public:
     //!
     const T* operator[](int64_t batch_index) const
     {
-        return (m_stride >= 0) ? m_data + batch_index * m_stride
-                               : m_data + (batch_index + 1 - m_batch_count) * m_stride;
+        return (m_stride >= 0) ? data() + batch_index * m_stride
+                               : data() + (batch_index + 1 - m_batch_count) * m_stride;
     }
 
     //!
@@ -905,4 +905,47 @@ constexpr double gels_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n)
     return 4 * gels_gflop_count<float>(m, n);
 }
 
+/* \brief floating point counts of ORGQR */
+template <typename T>
+constexpr double orgqr_gflop_count(int64_t m, int64_t n, int64_t k)
+{
+    return (4.0 * m * n * k - 2.0 * (m + n) * k * k + (4.0 / 3.0) * k * k * k) / 1e9;
+}
+
+template <>
+constexpr double orgqr_gflop_count<hipblasComplex>(int64_t m, int64_t n, int64_t k)
+{
+    return 4 * orgqr_gflop_count<float>(m, n, k);
+}
+
+template <>
+constexpr double orgqr_gflop_count<hipblasDoubleComplex>(int64_t m, int64_t n, int64_t k)
+{
+    return 4 * orgqr_gflop_count<float>(m, n, k);
+}
+
+/* \brief floating point counts of ORMQR */
+template <typename T>
+constexpr double ormqr_gflop_count(hipblasSideMode_t side, int64_t m, int64_t n, int64_t k)
+{
+    return side == HIPBLAS_SIDE_LEFT ? (4.0 * m * n * k - 2.0 * n * k * k) / 1e9
+                                     : (4.0 * m * n * k - 2.0 * m * k * k) / 1e9;
+}
+
+template <>
+constexpr double
+    ormqr_gflop_count<hipblasComplex>(hipblasSideMode_t side, int64_t m, int64_t n, int64_t k)
+{
+    return 4 * ormqr_gflop_count<float>(side, m, n, k);
+}
+
+template <>
+constexpr double ormqr_gflop_count<hipblasDoubleComplex>(hipblasSideMode_t side,
+                                                         int64_t           m,
+                                                         int64_t           n,
+                                                         int64_t           k)
+{
+    return 4 * ormqr_gflop_count<float>(side, m, n, k);
+}
+
 #endif /* _HIPBLAS_FLOPS_H_ */
@@ -148,6 +148,30 @@
 #define MAP2CF_V2(...) MAP2CF(__VA_ARGS__##Cast)
 #endif
 
+// C API only
+#define MAP2C(FN, A, B, PFN) \
+    template <>              \
+    auto FN<A, B> = PFN
+#ifndef HIPBLAS_V2
+#define MAP2C_V2(FN, A, B, PFN) \
+    template <>                 \
+    auto FN<A, B> = PFN
+#else
+#define MAP2C_V2(FN, A, B, PFN) \
+    template <>                 \
+    auto FN<A, B> = PFN##Cast
+#endif
+
+// C API only, single type
+#define MAP2C3(FN, A, PFN) \
+    template <>            \
+    auto FN<A> = PFN
+#ifndef HIPBLAS_V2
+#define MAP2C3_V2(...) MAP2C3(__VA_ARGS__)
+#else
+#define MAP2C3_V2(...) MAP2C3(__VA_ARGS__##Cast)
+#endif
+
 // Need these temporarily during transition period between hipblasComplex -> hipComplex
 #ifdef HIPBLAS_V2
 
@@ -7059,6 +7083,63 @@ hipblasStatus_t hipblasZgetrfStridedBatchedCast(hipblasHandle_t       handle,
                                                 int*                  info,
                                                 const int             batchCount);
 
+// getrf_refactor
+hipblasStatus_t hipblasCgetrfRefactorCast(hipblasHandle_t handle,
+                                          const int       n,
+                                          hipblasComplex* A,
+                                          const int       lda,
+                                          const int*      ipiv,
+                                          const float     maxGrowth,
+                                          int*            info);
+
+hipblasStatus_t hipblasZgetrfRefactorCast(hipblasHandle_t       handle,
+                                          const int             n,
+                                          hipblasDoubleComplex* A,
+                                          const int             lda,
+                                          const int*            ipiv,
+                                          const double          maxGrowth,
+                                          int*                  info);
+
+hipblasStatus_t hipblasCgetrfRefactorBatchedCast(hipblasHandle_t       handle,
+                                                 const int             n,
+                                                 hipblasComplex* const A[],
+                                                 const int             lda,
+                                                 const int*            ipiv,
+                                                 const float           maxGrowth,
+                                                 int*                  info,
+                                                 const int             batchCount);
+
+hipblasStatus_t hipblasZgetrfRefactorBatchedCast(hipblasHandle_t             handle,
+                                                 const int                   n,
+                                                 hipblasDoubleComplex* const A[],
+                                                 const int                   lda,
+                                                 const int*                  ipiv,
+                                                 const double                maxGrowth,
+                                                 int*                        info,
+                                                 const int                   batchCount);
+
+hipblasStatus_t hipblasCgetrfRefactorStridedBatchedCast(hipblasHandle_t     handle,
+                                                        const int           n,
+                                                        hipblasComplex*     A,
+                                                        const int           lda,
+                                                        const hipblasStride strideA,
+                                                        const int*          ipiv,
+                                                        const hipblasStride strideP,
+                                                        const float         maxGrowth,
+                                                        int*                info,
+                                                        const int           batchCount);
+
+hipblasStatus_t hipblasZgetrfRefactorStridedBatchedCast(hipblasHandle_t       handle,
+                                                        const int             n,
+                                                        hipblasDoubleComplex* A,
+                                                        const int             lda,
+                                                        const hipblasStride   strideA,
+                                                        const int*            ipiv,
+                                                        const hipblasStride   strideP,
+                                                        const double          maxGrowth,
+                                                        int*                  info,
+                                                        const int             batchCount);
+
 // getrs
 hipblasStatus_t hipblasCgetrsCast(hipblasHandle_t          handle,
                                   const hipblasOperation_t trans,
@@ -7213,6 +7294,162 @@ hipblasStatus_t hipblasZgeqrfStridedBatchedCast(hipblasHandle_t       handle,
                                                 int*                  info,
                                                 const int             batchCount);
 
+// orgqr
+hipblasStatus_t hipblasCungqrCast(hipblasHandle_t handle,
+                                  const int       m,
+                                  const int       n,
+                                  const int       k,
+                                  hipblasComplex* A,
+                                  const int       lda,
+                                  hipblasComplex* ipiv,
+                                  int*            info);
+
+hipblasStatus_t hipblasZungqrCast(hipblasHandle_t       handle,
+                                  const int             m,
+                                  const int             n,
+                                  const int             k,
+                                  hipblasDoubleComplex* A,
+                                  const int             lda,
+                                  hipblasDoubleComplex* ipiv,
+                                  int*                  info);
+
+// orgqr_batched
+hipblasStatus_t hipblasCungqrBatchedCast(hipblasHandle_t       handle,
+                                         const int             m,
+                                         const int             n,
+                                         const int             k,
+                                         hipblasComplex* const A[],
+                                         const int             lda,
+                                         hipblasComplex* const ipiv[],
+                                         int*                  info,
+                                         const int             batchCount);
+
+hipblasStatus_t hipblasZungqrBatchedCast(hipblasHandle_t             handle,
+                                         const int                   m,
+                                         const int                   n,
+                                         const int                   k,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const ipiv[],
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// orgqr_strided_batched
+hipblasStatus_t hipblasCungqrStridedBatchedCast(hipblasHandle_t     handle,
+                                                const int           m,
+                                                const int           n,
+                                                const int           k,
+                                                hipblasComplex*     A,
+                                                const int           lda,
+                                                const hipblasStride strideA,
+                                                hipblasComplex*     ipiv,
+                                                const hipblasStride strideP,
+                                                int*                info,
+                                                const int           batchCount);
+
+hipblasStatus_t hipblasZungqrStridedBatchedCast(hipblasHandle_t       handle,
+                                                const int             m,
+                                                const int             n,
+                                                const int             k,
+                                                hipblasDoubleComplex* A,
+                                                const int             lda,
+                                                const hipblasStride   strideA,
+                                                hipblasDoubleComplex* ipiv,
+                                                const hipblasStride   strideP,
+                                                int*                  info,
+                                                const int             batchCount);
+
+// ormqr
+hipblasStatus_t hipblasCunmqrCast(hipblasHandle_t    handle,
+                                  hipblasSideMode_t  side,
+                                  hipblasOperation_t trans,
+                                  const int          m,
+                                  const int          n,
+                                  const int          k,
+                                  hipblasComplex*    A,
+                                  const int          lda,
+                                  hipblasComplex*    ipiv,
+                                  hipblasComplex*    C,
+                                  const int          ldc,
+                                  int*               info);
+
+hipblasStatus_t hipblasZunmqrCast(hipblasHandle_t       handle,
+                                  hipblasSideMode_t     side,
+                                  hipblasOperation_t    trans,
+                                  const int             m,
+                                  const int             n,
+                                  const int             k,
+                                  hipblasDoubleComplex* A,
+                                  const int             lda,
+                                  hipblasDoubleComplex* ipiv,
+                                  hipblasDoubleComplex* C,
+                                  const int             ldc,
+                                  int*                  info);
+
+// ormqr_batched
+hipblasStatus_t hipblasCunmqrBatchedCast(hipblasHandle_t       handle,
+                                         hipblasSideMode_t     side,
+                                         hipblasOperation_t    trans,
+                                         const int             m,
+                                         const int             n,
+                                         const int             k,
+                                         hipblasComplex* const A[],
+                                         const int             lda,
+                                         hipblasComplex* const ipiv[],
+                                         hipblasComplex* const C[],
+                                         const int             ldc,
+                                         int*                  info,
+                                         const int             batchCount);
+
+hipblasStatus_t hipblasZunmqrBatchedCast(hipblasHandle_t             handle,
+                                         hipblasSideMode_t           side,
+                                         hipblasOperation_t          trans,
+                                         const int                   m,
+                                         const int                   n,
+                                         const int                   k,
+                                         hipblasDoubleComplex* const A[],
+                                         const int                   lda,
+                                         hipblasDoubleComplex* const ipiv[],
+                                         hipblasDoubleComplex* const C[],
+                                         const int                   ldc,
+                                         int*                        info,
+                                         const int                   batchCount);
+
+// ormqr_strided_batched
+hipblasStatus_t hipblasCunmqrStridedBatchedCast(hipblasHandle_t     handle,
+                                                hipblasSideMode_t   side,
+                                                hipblasOperation_t  trans,
+                                                const int           m,
+                                                const int           n,
+                                                const int           k,
+                                                hipblasComplex*     A,
+                                                const int           lda,
+                                                const hipblasStride strideA,
+                                                hipblasComplex*     ipiv,
+                                                const hipblasStride strideP,
+                                                hipblasComplex*     C,
+                                                const int           ldc,
+                                                const hipblasStride strideC,
+                                                int*                info,
+                                                const int           batchCount);
+
+hipblasStatus_t hipblasZunmqrStridedBatchedCast(hipblasHandle_t       handle,
+                                                hipblasSideMode_t     side,
+                                                hipblasOperation_t    trans,
+                                                const int             m,
+                                                const int             n,
+                                                const int             k,
+                                                hipblasDoubleComplex* A,
+                                                const int             lda,
+                                                const hipblasStride   strideA,
+                                                hipblasDoubleComplex* ipiv,
+                                                const hipblasStride   strideP,
+                                                hipblasDoubleComplex* C,
+                                                const int             ldc,
+                                                const hipblasStride   strideC,
+                                                int*                  info,
+                                                const int             batchCount);
+
 // gels
 hipblasStatus_t hipblasCgelsCast(hipblasHandle_t    handle,
                                  hipblasOperation_t trans,
@@ -7294,6 +7531,207 @@ hipblasStatus_t hipblasZgelsStridedBatchedCast(hipblasHandle_t       handle,
                                                int*                  deviceInfo,
                                                const int             batchCount);
 
+// gemm with a real operand
+hipblasStatus_t hipblasCgemmRealBCast(hipblasHandle_t       handle,
+                                      hipblasOperation_t    transA,
+                                      hipblasOperation_t    transB,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const float*          B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc);
+
+hipblasStatus_t hipblasZgemmRealBCast(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transA,
+                                      hipblasOperation_t          transB,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const double*               B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc);
+
+hipblasStatus_t hipblasCgemmRealACast(hipblasHandle_t       handle,
+                                      hipblasOperation_t    transA,
+                                      hipblasOperation_t    transB,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const float*          A,
+                                      int                   lda,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc);
+
+hipblasStatus_t hipblasZgemmRealACast(hipblasHandle_t             handle,
+                                      hipblasOperation_t          transA,
+                                      hipblasOperation_t          transB,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const double*               A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc);
+
+hipblasStatus_t hipblasCgemmRealBBatchedCast(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transA,
+                                             hipblasOperation_t          transB,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasComplex*       alpha,
+                                             const hipblasComplex* const A[],
+                                             int                         lda,
+                                             const float* const          B[],
+                                             int                         ldb,
+                                             const hipblasComplex*       beta,
+                                             hipblasComplex* const       C[],
+                                             int                         ldc,
+                                             int                         batchCount);
+
+hipblasStatus_t hipblasZgemmRealBBatchedCast(hipblasHandle_t                   handle,
+                                             hipblasOperation_t                transA,
+                                             hipblasOperation_t                transB,
+                                             int                               m,
+                                             int                               n,
+                                             int                               k,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const hipblasDoubleComplex* const A[],
+                                             int                               lda,
+                                             const double* const               B[],
+                                             int                               ldb,
+                                             const hipblasDoubleComplex*       beta,
+                                             hipblasDoubleComplex* const       C[],
+                                             int                               ldc,
+                                             int                               batchCount);
+
+hipblasStatus_t hipblasCgemmRealABatchedCast(hipblasHandle_t             handle,
+                                             hipblasOperation_t          transA,
+                                             hipblasOperation_t          transB,
+                                             int                         m,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasComplex*       alpha,
+                                             const float* const          A[],
+                                             int                         lda,
+                                             const hipblasComplex* const B[],
+                                             int                         ldb,
+                                             const hipblasComplex*       beta,
+                                             hipblasComplex* const       C[],
+                                             int                         ldc,
+                                             int                         batchCount);
+
+hipblasStatus_t hipblasZgemmRealABatchedCast(hipblasHandle_t                   handle,
+                                             hipblasOperation_t                transA,
+                                             hipblasOperation_t                transB,
+                                             int                               m,
+                                             int                               n,
+                                             int                               k,
+                                             const hipblasDoubleComplex*       alpha,
+                                             const double* const               A[],
+                                             int                               lda,
+                                             const hipblasDoubleComplex* const B[],
+                                             int                               ldb,
+                                             const hipblasDoubleComplex*       beta,
+                                             hipblasDoubleComplex* const       C[],
+                                             int                               ldc,
+                                             int                               batchCount);
+
+hipblasStatus_t hipblasCgemmRealBStridedBatchedCast(hipblasHandle_t       handle,
+                                                    hipblasOperation_t    transA,
+                                                    hipblasOperation_t    transB,
+                                                    int                   m,
+                                                    int                   n,
+                                                    int                   k,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* A,
+                                                    int                   lda,
+                                                    hipblasStride         strideA,
+                                                    const float*          B,
+                                                    int                   ldb,
+                                                    hipblasStride         strideB,
+                                                    const hipblasComplex* beta,
+                                                    hipblasComplex*       C,
+                                                    int                   ldc,
+                                                    hipblasStride         strideC,
+                                                    int                   batchCount);
+
+hipblasStatus_t hipblasZgemmRealBStridedBatchedCast(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int                         lda,
+                                                    hipblasStride               strideA,
+                                                    const double*               B,
+                                                    int                         ldb,
+                                                    hipblasStride               strideB,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc,
+                                                    hipblasStride               strideC,
+                                                    int                         batchCount);
+
+hipblasStatus_t hipblasCgemmRealAStridedBatchedCast(hipblasHandle_t       handle,
+                                                    hipblasOperation_t    transA,
+                                                    hipblasOperation_t    transB,
+                                                    int                   m,
+                                                    int                   n,
+                                                    int                   k,
+                                                    const hipblasComplex* alpha,
+                                                    const float*          A,
+                                                    int                   lda,
+                                                    hipblasStride         strideA,
+                                                    const hipblasComplex* B,
+                                                    int                   ldb,
+                                                    hipblasStride         strideB,
+                                                    const hipblasComplex* beta,
+                                                    hipblasComplex*       C,
+                                                    int                   ldc,
+                                                    hipblasStride         strideC,
+                                                    int                   batchCount);
+
+hipblasStatus_t hipblasZgemmRealAStridedBatchedCast(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const double*               A,
+                                                    int                         lda,
+                                                    hipblasStride               strideA,
+                                                    const hipblasDoubleComplex* B,
+                                                    int                         ldb,
+                                                    hipblasStride               strideB,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc,
+                                                    hipblasStride               strideC,
+                                                    int                         batchCount);
+
 #endif
 
 namespace
@@ -10505,6 +10943,134 @@ namespace
     MAP2CF_D64_V2(hipblasGemmStridedBatched, hipblasComplex, hipblasCgemmStridedBatched);
     MAP2CF_D64_V2(hipblasGemmStridedBatched, hipblasDoubleComplex, hipblasZgemmStridedBatched);
 
+    // gemm with a real operand
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGemmRealB)(hipblasHandle_t    handle,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const T*           alpha,
+                                        const T*           A,
+                                        int                lda,
+                                        const U*           B,
+                                        int                ldb,
+                                        const T*           beta,
+                                        T*                 C,
+                                        int                ldc);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGemmRealA)(hipblasHandle_t    handle,
+                                        hipblasOperation_t transA,
+                                        hipblasOperation_t transB,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const T*           alpha,
+                                        const U*           A,
+                                        int                lda,
+                                        const T*           B,
+                                        int                ldb,
+                                        const T*           beta,
+                                        T*                 C,
+                                        int                ldc);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGemmRealBBatched)(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const T*           alpha,
+                                               const T* const     A[],
+                                               int                lda,
+                                               const U* const     B[],
+                                               int                ldb,
+                                               const T*           beta,
+                                               T* const           C[],
+                                               int                ldc,
+                                               int                batch_count);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGemmRealABatched)(hipblasHandle_t    handle,
+                                               hipblasOperation_t transA,
+                                               hipblasOperation_t transB,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const T*           alpha,
+                                               const U* const     A[],
+                                               int                lda,
+                                               const T* const     B[],
+                                               int                ldb,
+                                               const T*           beta,
+                                               T* const           C[],
+                                               int                ldc,
+                                               int                batch_count);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGemmRealBStridedBatched)(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const T*           alpha,
+                                                      const T*           A,
+                                                      int                lda,
+                                                      hipblasStride      strideA,
+                                                      const U*           B,
+                                                      int                ldb,
+                                                      hipblasStride      strideB,
+                                                      const T*           beta,
+                                                      T*                 C,
+                                                      int                ldc,
+                                                      hipblasStride      strideC,
+                                                      int                batch_count);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGemmRealAStridedBatched)(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transA,
+                                                      hipblasOperation_t transB,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const T*           alpha,
+                                                      const U*           A,
+                                                      int                lda,
+                                                      hipblasStride      strideA,
+                                                      const T*           B,
+                                                      int                ldb,
+                                                      hipblasStride      strideB,
+                                                      const T*           beta,
+                                                      T*                 C,
+                                                      int                ldc,
+                                                      hipblasStride      strideC,
+                                                      int                batch_count);
+
+    MAP2C_V2(hipblasGemmRealB, hipblasComplex, float, hipblasCgemmRealB);
+    MAP2C_V2(hipblasGemmRealB, hipblasDoubleComplex, double, hipblasZgemmRealB);
+    MAP2C_V2(hipblasGemmRealA, hipblasComplex, float, hipblasCgemmRealA);
+    MAP2C_V2(hipblasGemmRealA, hipblasDoubleComplex, double, hipblasZgemmRealA);
+    MAP2C_V2(hipblasGemmRealBBatched, hipblasComplex, float, hipblasCgemmRealBBatched);
+    MAP2C_V2(hipblasGemmRealBBatched, hipblasDoubleComplex, double, hipblasZgemmRealBBatched);
+    MAP2C_V2(hipblasGemmRealABatched, hipblasComplex, float, hipblasCgemmRealABatched);
+    MAP2C_V2(hipblasGemmRealABatched, hipblasDoubleComplex, double, hipblasZgemmRealABatched);
+    MAP2C_V2(
+        hipblasGemmRealBStridedBatched, hipblasComplex, float, hipblasCgemmRealBStridedBatched);
+    MAP2C_V2(hipblasGemmRealBStridedBatched,
+             hipblasDoubleComplex,
+             double,
+             hipblasZgemmRealBStridedBatched);
+    MAP2C_V2(
+        hipblasGemmRealAStridedBatched, hipblasComplex, float, hipblasCgemmRealAStridedBatched);
+    MAP2C_V2(hipblasGemmRealAStridedBatched,
+             hipblasDoubleComplex,
+             double,
+             hipblasZgemmRealAStridedBatched);
+
     // herk
     template <typename T, typename U, bool FORTRAN = false>
     hipblasStatus_t (*hipblasHerk)(hipblasHandle_t    handle,
@@ -11926,6 +12492,60 @@ namespace
     MAP2CF_V2(hipblasGetrfStridedBatched, hipblasComplex, hipblasCgetrfStridedBatched);
     MAP2CF_V2(hipblasGetrfStridedBatched, hipblasDoubleComplex, hipblasZgetrfStridedBatched);
 
+    // getrf_refactor
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGetrfRefactor)(hipblasHandle_t handle,
+                                            const int       n,
+                                            T*              A,
+                                            const int       lda,
+                                            const int*      ipiv,
+                                            const U         maxGrowth,
+                                            int*            info);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGetrfRefactorBatched)(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   T* const        A[],
+                                                   const int       lda,
+                                                   const int*      ipiv,
+                                                   const U         maxGrowth,
+                                                   int*            info,
+                                                   const int       batchCount);
+
+    template <typename T, typename U>
+    hipblasStatus_t (*hipblasGetrfRefactorStridedBatched)(hipblasHandle_t     handle,
+                                                          const int           n,
+                                                          T*                  A,
+                                                          const int           lda,
+                                                          const hipblasStride strideA,
+                                                          const int*          ipiv,
+                                                          const hipblasStride strideP,
+                                                          const U             maxGrowth,
+                                                          int*                info,
+                                                          const int           batchCount);
+
+    MAP2C(hipblasGetrfRefactor, float, float, hipblasSgetrfRefactor);
+    MAP2C(hipblasGetrfRefactor, double, double, hipblasDgetrfRefactor);
+    MAP2C_V2(hipblasGetrfRefactor, hipblasComplex, float, hipblasCgetrfRefactor);
+    MAP2C_V2(hipblasGetrfRefactor, hipblasDoubleComplex, double, hipblasZgetrfRefactor);
+
+    MAP2C(hipblasGetrfRefactorBatched, float, float, hipblasSgetrfRefactorBatched);
+    MAP2C(hipblasGetrfRefactorBatched, double, double, hipblasDgetrfRefactorBatched);
+    MAP2C_V2(hipblasGetrfRefactorBatched, hipblasComplex, float, hipblasCgetrfRefactorBatched);
+    MAP2C_V2(
+        hipblasGetrfRefactorBatched, hipblasDoubleComplex, double, hipblasZgetrfRefactorBatched);
+
+    MAP2C(hipblasGetrfRefactorStridedBatched, float, float, hipblasSgetrfRefactorStridedBatched);
+    MAP2C(hipblasGetrfRefactorStridedBatched, double, double, hipblasDgetrfRefactorStridedBatched);
+    MAP2C_V2(hipblasGetrfRefactorStridedBatched,
+             hipblasComplex,
+             float,
+             hipblasCgetrfRefactorStridedBatched);
+    MAP2C_V2(hipblasGetrfRefactorStridedBatched,
+             hipblasDoubleComplex,
+             double,
+             hipblasZgetrfRefactorStridedBatched);
+
     // getrs
     template <typename T, bool FORTRAN = false>
     hipblasStatus_t (*hipblasGetrs)(hipblasHandle_t          handle,
@@ -12042,6 +12662,173 @@ namespace
     MAP2CF_V2(hipblasGeqrfStridedBatched, hipblasComplex, hipblasCgeqrfStridedBatched);
     MAP2CF_V2(hipblasGeqrfStridedBatched, hipblasDoubleComplex, hipblasZgeqrfStridedBatched);
 
+    template <typename T>
+    hipblasStatus_t (*hipblasOrgqr)(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const int       k,
+                                    T*              A,
+                                    const int       lda,
+                                    T*              ipiv,
+                                    int*            info);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasOrgqrBatched)(hipblasHandle_t handle,
+                                           const int       m,
+                                           const int       n,
+                                           const int       k,
+                                           T* const        A[],
+                                           const int       lda,
+                                           T* const        ipiv[],
+                                           int*            info,
+                                           const int       batchCount);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasOrgqrStridedBatched)(hipblasHandle_t     handle,
+                                                  const int           m,
+                                                  const int           n,
+                                                  const int           k,
+                                                  T*                  A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  T*                  ipiv,
+                                                  const hipblasStride strideP,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+    MAP2C3(hipblasOrgqr, float, hipblasSorgqr);
+    MAP2C3(hipblasOrgqr, double, hipblasDorgqr);
+    MAP2C3_V2(hipblasOrgqr, hipblasComplex, hipblasCungqr);
+    MAP2C3_V2(hipblasOrgqr, hipblasDoubleComplex, hipblasZungqr);
+
+    MAP2C3(hipblasOrgqrBatched, float, hipblasSorgqrBatched);
+    MAP2C3(hipblasOrgqrBatched, double, hipblasDorgqrBatched);
+    MAP2C3_V2(hipblasOrgqrBatched, hipblasComplex, hipblasCungqrBatched);
+    MAP2C3_V2(hipblasOrgqrBatched, hipblasDoubleComplex, hipblasZungqrBatched);
+
+    MAP2C3(hipblasOrgqrStridedBatched, float, hipblasSorgqrStridedBatched);
+    MAP2C3(hipblasOrgqrStridedBatched, double, hipblasDorgqrStridedBatched);
+    MAP2C3_V2(hipblasOrgqrStridedBatched, hipblasComplex, hipblasCungqrStridedBatched);
+    MAP2C3_V2(hipblasOrgqrStridedBatched, hipblasDoubleComplex, hipblasZungqrStridedBatched);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasOrmqr)(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasOperation_t trans,
+                                    const int          m,
+                                    const int          n,
+                                    const int          k,
+                                    T*                 A,
+                                    const int          lda,
+                                    T*                 ipiv,
+                                    T*                 C,
+                                    const int          ldc,
+                                    int*               info);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasOrmqrBatched)(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasOperation_t trans,
+                                           const int          m,
+                                           const int          n,
+                                           const int          k,
+                                           T* const           A[],
+                                           const int          lda,
+                                           T* const           ipiv[],
+                                           T* const           C[],
+                                           const int          ldc,
+                                           int*               info,
+                                           const int          batchCount);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasOrmqrStridedBatched)(hipblasHandle_t     handle,
+                                                  hipblasSideMode_t   side,
+                                                  hipblasOperation_t  trans,
+                                                  const int           m,
+                                                  const int           n,
+                                                  const int           k,
+                                                  T*                  A,
+                                                  const int           lda,
+                                                  const hipblasStride strideA,
+                                                  T*                  ipiv,
+                                                  const hipblasStride strideP,
+                                                  T*                  C,
+                                                  const int           ldc,
+                                                  const hipblasStride strideC,
+                                                  int*                info,
+                                                  const int           batchCount);
+
+    MAP2C3(hipblasOrmqr, float, hipblasSormqr);
+    MAP2C3(hipblasOrmqr, double, hipblasDormqr);
+    MAP2C3_V2(hipblasOrmqr, hipblasComplex, hipblasCunmqr);
+    MAP2C3_V2(hipblasOrmqr, hipblasDoubleComplex, hipblasZunmqr);
+
+    MAP2C3(hipblasOrmqrBatched, float, hipblasSormqrBatched);
+    MAP2C3(hipblasOrmqrBatched, double, hipblasDormqrBatched);
+    MAP2C3_V2(hipblasOrmqrBatched, hipblasComplex, hipblasCunmqrBatched);
+    MAP2C3_V2(hipblasOrmqrBatched, hipblasDoubleComplex, hipblasZunmqrBatched);
+
+    MAP2C3(hipblasOrmqrStridedBatched, float, hipblasSormqrStridedBatched);
+    MAP2C3(hipblasOrmqrStridedBatched, double, hipblasDormqrStridedBatched);
+    MAP2C3_V2(hipblasOrmqrStridedBatched, hipblasComplex, hipblasCunmqrStridedBatched);
+    MAP2C3_V2(hipblasOrmqrStridedBatched, hipblasDoubleComplex, hipblasZunmqrStridedBatched);
+
+    // gesvIR
+    template <typename T>
+    hipblasStatus_t (*hipblasGesvIR)(hipblasHandle_t handle,
+                                     const int       n,
+                                     const int       nrhs,
+                                     T*              A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     T*              B,
+                                     const int       ldb,
+                                     T*              X,
+                                     const int       ldx,
+                                     int*            iter,
+                                     int*            info,
+                                     int*            deviceInfo);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasGesvIRBatched)(hipblasHandle_t handle,
+                                            const int       n,
+                                            const int       nrhs,
+                                            T* const        A[],
+                                            const int       lda,
+                                            int*            ipiv,
+                                            T* const        B[],
+                                            const int       ldb,
+                                            T* const        X[],
+                                            const int       ldx,
+                                            int*            iter,
+                                            int*            info,
+                                            int*            deviceInfo,
+                                            const int       batchCount);
+
+    template <typename T>
+    hipblasStatus_t (*hipblasGesvIRStridedBatched)(hipblasHandle_t     handle,
+                                                   const int           n,
+                                                   const int           nrhs,
+                                                   T*                  A,
+                                                   const int           lda,
+                                                   const hipblasStride strideA,
+                                                   int*                ipiv,
+                                                   const hipblasStride strideP,
+                                                   T*                  B,
+                                                   const int           ldb,
+                                                   const hipblasStride strideB,
+                                                   T*                  X,
+                                                   const int           ldx,
+                                                   const hipblasStride strideX,
+                                                   int*                iter,
+                                                   int*                info,
+                                                   int*                deviceInfo,
+                                                   const int           batchCount);
+
+    MAP2C3(hipblasGesvIR, double, hipblasDgesvIR);
+    MAP2C3(hipblasGesvIRBatched, double, hipblasDgesvIRBatched);
+    MAP2C3(hipblasGesvIRStridedBatched, double, hipblasDgesvIRStridedBatched);
+
     // gels
     template <typename T, bool FORTRAN = false>
     hipblasStatus_t (*hipblasGels)(hipblasHandle_t    handle,
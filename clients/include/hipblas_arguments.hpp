@@ -177,6 +177,11 @@ struct Arguments
     uint32_t algo;
     int32_t  solution_index;
     uint32_t flags;
+    int32_t  split_k; // 0: standard gemm_ex algorithm, -1: split-K with automatic factor
+    int32_t  emulation_slices; // slices for the emulated gemm_ex compute types, 0: default
+    int32_t  strassen_levels; // Strassen-Winograd levels for gemm, -1: chosen by size
+    int32_t  gemm_order; // hipblasGemmOrderMode_t for gemm, -1: calibrate the order table
+    int32_t  qr_algo; // hipblasQrAlgo_t for geqrf and gels
     char     function[64];
     char     name[64];
     char     category[64];
@@ -257,6 +262,11 @@ struct Arguments
     OPER(algo) SEP                   \
     OPER(solution_index) SEP         \
     OPER(flags) SEP                  \
+    OPER(split_k) SEP                \
+    OPER(emulation_slices) SEP       \
+    OPER(strassen_levels) SEP        \
+    OPER(gemm_order) SEP             \
+    OPER(qr_algo) SEP                \
     OPER(function) SEP               \
     OPER(name) SEP                   \
     OPER(category) SEP               \
@@ -75,6 +75,12 @@ inline void* host_calloc_throw(size_t nmemb, size_t size)
 //!
 void host_free(void* ptr);
 
+//!
+//! @brief With retention on, host_free keeps memory for reuse by later host_ allocations of the
+//!        same size or smaller. Turning retention off releases the kept memory.
+//!
+void host_set_retain_allocations(bool retain);
+
 //!
 //! @brief  Allocator which allocates with host_calloc
 //!
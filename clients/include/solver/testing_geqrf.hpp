@@ -28,7 +28,7 @@
 
 #include "testing_common.hpp"
 
-using hipblasGeqrfModel = ArgumentModel<e_a_type, e_M, e_N, e_lda>;
+using hipblasGeqrfModel = ArgumentModel<e_a_type, e_M, e_N, e_lda, e_qr_algo>;
 
 inline void testname_geqrf(const Arguments& arg, std::string& name)
 {
@@ -148,6 +148,9 @@ void testing_geqrf(const Arguments& arg)
 
     hipblasLocalHandle handle(arg);
 
+    if(arg.qr_algo)
+        CHECK_HIPBLAS_ERROR(hipblasSetQrAlgo(handle, hipblasQrAlgo_t(arg.qr_algo)));
+
     // Check to prevent memory allocation error
     bool invalid_size = M < 0 || N < 0 || lda < std::max(1, M);
     if(invalid_size || !M || !N)
@@ -220,8 +223,7 @@ void testing_geqrf(const Arguments& arg)
         int runs = arg.cold_iters + arg.iters;
         for(int iter = 0; iter < runs; iter++)
         {
-            if(iter == arg.cold_iters)
-                gpu_time_used = get_time_us_sync(stream);
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
 
             CHECK_HIPBLAS_ERROR(hipblasGeqrfFn(handle, M, N, dA, lda, dIpiv, &info));
         }
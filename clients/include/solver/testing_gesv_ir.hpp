@@ -0,0 +1,317 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvIRModel = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb, e_ldc>;
+
+inline void testname_gesv_ir(const Arguments& arg, std::string& name)
+{
+    hipblasGesvIRModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void setup_gesv_ir_testing(const Arguments& arg,
+                           host_matrix<T>&  hA,
+                           host_matrix<T>&  hB,
+                           int              N,
+                           int              nrhs,
+                           int              lda,
+                           int              ldb)
+{
+    host_matrix<T> hX(N, nrhs, ldb);
+
+    // Initial hA, hX on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hX, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    // scale A to avoid singularities, this also keeps the float factorization well conditioned
+    for(int i = 0; i < N; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                hA[i + j * lda] += 400;
+            else
+                hA[i + j * lda] -= 4;
+        }
+    }
+
+    // Calculate hB = hA*hX;
+    hipblasOperation_t opN = HIPBLAS_OP_N;
+    ref_gemm<T>(opN, opN, N, nrhs, N, (T)1, hA.data(), lda, hX.data(), ldb, (T)0, hB.data(), ldb);
+}
+
+template <typename T>
+void testing_gesv_ir_bad_arg(const Arguments& arg)
+{
+    auto hipblasGesvIRFn = hipblasGesvIR<T>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N    = 100;
+    const int          nrhs = 2;
+    const int          lda  = 101;
+    const int          ldb  = 102;
+    const int          ldx  = 103;
+
+    device_matrix<T>   dA(N, N, lda);
+    device_matrix<T>   dB(N, nrhs, ldb);
+    device_matrix<T>   dX(N, nrhs, ldx);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+    int                iter = 0;
+    int                info = 0;
+    int                expectedInfo;
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, nullptr, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle, -1, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle, N, -1, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, nrhs, nullptr, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle, N, nrhs, dA, N - 1, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, nrhs, dA, lda, nullptr, dB, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, nrhs, dA, lda, dIpiv, nullptr, ldb, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle, N, nrhs, dA, lda, dIpiv, dB, N - 1, dX, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -7;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, nullptr, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, N - 1, &iter, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, nullptr, &info, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -10;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, nullptr),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If N == 0, A, B, X, and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(handle,
+                        0,
+                        nrhs,
+                        nullptr,
+                        lda,
+                        nullptr,
+                        nullptr,
+                        ldb,
+                        nullptr,
+                        ldx,
+                        &iter,
+                        &info,
+                        dInfo),
+        HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+    unit_check_general(1, 1, 1, &expectedInfo, &iter);
+
+    // if nrhs == 0, B and X can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRFn(
+            handle, N, 0, dA, lda, dIpiv, nullptr, ldb, nullptr, ldx, &iter, &info, dInfo),
+        HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+    unit_check_general(1, 1, 1, &expectedInfo, &iter);
+}
+
+template <typename T>
+void testing_gesv_ir(const Arguments& arg)
+{
+    using U              = real_t<T>;
+    auto hipblasGesvIRFn = hipblasGesvIR<T>;
+
+    int N    = arg.N;
+    int nrhs = arg.K;
+    int lda  = arg.lda;
+    int ldb  = arg.ldb;
+    int ldx  = arg.ldc;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || ldx < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<T>       hA(N, N, lda);
+    host_matrix<T>       hA1(N, N, lda);
+    host_matrix<T>       hB(N, nrhs, ldb);
+    host_matrix<T>       hB1(N, nrhs, ldb);
+    host_matrix<T>       hX(N, nrhs, ldx);
+    host_vector<int64_t> hIpiv64(N);
+    int                  iter, info, hInfo;
+
+    device_matrix<T>   dA(N, N, lda);
+    device_matrix<T>   dB(N, nrhs, ldb);
+    device_matrix<T>   dX(N, nrhs, ldx);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_gesv_ir_testing(arg, hA, hB, N, nrhs, lda, ldb);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvIRFn(
+            handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hX.transfer_from(dX));
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(hB1.transfer_from(dB));
+        CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        host_matrix<T> hA_ref(N, N, lda);
+        host_matrix<T> hX_ref(N, nrhs, ldx);
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+                hA_ref[i + j * lda] = hA[i + j * lda];
+        for(int j = 0; j < nrhs; j++)
+            for(int i = 0; i < N; i++)
+                hX_ref[i + j * ldx] = hB[i + j * ldb];
+
+        ref_getrf<T>(N, N, hA_ref.data(), lda, hIpiv64.data());
+        ref_getrs('N', N, nrhs, hA_ref.data(), lda, hIpiv64.data(), hX_ref.data(), ldx);
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldx, hX_ref.data(), hX.data());
+
+        if(arg.unit_check)
+        {
+            // the refined solution must reach double precision accuracy
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            unit_check_general(1, 1, 1, &zero, &hInfo);
+
+            // A is well conditioned, so refinement must succeed and leave A and B untouched
+            EXPECT_GE(iter, 0);
+            unit_check_general<T>(N, N, lda, hA.data(), hA1.data());
+            unit_check_general<T>(N, nrhs, ldb, hB.data(), hB1.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int it = 0; it < runs; it++)
+        {
+            hipblas_time_iteration(arg, it, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvIRFn(
+                handle, N, nrhs, dA, lda, dIpiv, dB, ldb, dX, ldx, &iter, &info, dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvIRModel{}.log_args<T>(std::cout,
+                                         arg,
+                                         gpu_time_used,
+                                         getrf_gflop_count<T>(N, N)
+                                             + getrs_gflop_count<T>(N, nrhs),
+                                         ArgumentLogging::NA_value,
+                                         hipblas_error);
+    }
+}
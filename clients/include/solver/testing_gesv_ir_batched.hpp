@@ -0,0 +1,369 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGesvIRBatchedModel
+    = ArgumentModel<e_a_type, e_N, e_K, e_lda, e_ldb, e_ldc, e_batch_count>;
+
+inline void testname_gesv_ir_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGesvIRBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void setup_gesv_ir_batched_testing(const Arguments&      arg,
+                                   host_batch_matrix<T>& hA,
+                                   host_batch_matrix<T>& hB,
+                                   int                   N,
+                                   int                   nrhs,
+                                   int                   lda,
+                                   int                   ldb,
+                                   int                   batch_count)
+{
+    host_batch_matrix<T> hX(N, nrhs, ldb, batch_count);
+
+    // Initial hA, hX on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hX, arg, hipblas_client_never_set_nan, hipblas_general_matrix, false, true);
+
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+
+        // Calculate hB = hA*hX;
+        ref_gemm<T>(op, op, N, nrhs, N, (T)1, hA[b], lda, hX[b], ldb, (T)0, hB[b], ldb);
+    }
+}
+
+template <typename T>
+void testing_gesv_ir_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasGesvIRBatchedFn = hipblasGesvIRBatched<T>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 100;
+    const int          nrhs        = 2;
+    const int          lda         = 101;
+    const int          ldb         = 102;
+    const int          ldx         = 103;
+    const int          batch_count = 2;
+
+    device_batch_matrix<T> dA(N, N, lda, batch_count);
+    device_batch_matrix<T> dB(N, nrhs, ldb, batch_count);
+    device_batch_matrix<T> dX(N, nrhs, ldx, batch_count);
+    device_vector<int>     dIpiv(size_t(N) * batch_count);
+    device_vector<int>     dInfo(batch_count);
+    host_vector<int>       hIter(batch_count);
+    int                    info = 0;
+    int                    expectedInfo;
+
+    T* const* dAp = dA.ptr_on_device();
+    T* const* dBp = dB.ptr_on_device();
+    T* const* dXp = dX.ptr_on_device();
+
+    auto call = [&](int       n,
+                    int       rhs,
+                    T* const* A,
+                    int       lda_,
+                    int*      ipiv,
+                    T* const* B,
+                    int       ldb_,
+                    T* const* X,
+                    int       ldx_,
+                    int*      iter,
+                    int*      dinfo,
+                    int       bc) {
+        return hipblasGesvIRBatchedFn(
+            handle, n, rhs, A, lda_, ipiv, B, ldb_, X, ldx_, iter, &info, dinfo, bc);
+    };
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGesvIRBatchedFn(handle,
+                               N,
+                               nrhs,
+                               dAp,
+                               lda,
+                               dIpiv,
+                               dBp,
+                               ldb,
+                               dXp,
+                               ldx,
+                               hIter,
+                               nullptr,
+                               dInfo,
+                               batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(-1, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, -1, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, nullptr, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, N - 1, dIpiv, dBp, ldb, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, nullptr, dBp, ldb, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, nullptr, ldb, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, N - 1, dXp, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -7;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, ldb, nullptr, ldx, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, N - 1, hIter, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, nullptr, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -10;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, hIter, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -13;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If batch_count == 0, iter and deviceInfo can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        call(N, nrhs, dAp, lda, dIpiv, dBp, ldb, dXp, ldx, nullptr, nullptr, 0),
+        HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_gesv_ir_batched(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto hipblasGesvIRBatchedFn = hipblasGesvIRBatched<T>;
+
+    int N           = arg.N;
+    int nrhs        = arg.K;
+    int lda         = arg.lda;
+    int ldb         = arg.ldb;
+    int ldx         = arg.ldc;
+    int batch_count = arg.batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < N || ldb < N || ldx < N || batch_count <= 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_matrix<T> hA(N, N, lda, batch_count);
+    host_batch_matrix<T> hA1(N, N, lda, batch_count);
+    host_batch_matrix<T> hB(N, nrhs, ldb, batch_count);
+    host_batch_matrix<T> hX(N, nrhs, ldx, batch_count);
+    host_batch_matrix<T> hX_ref(N, nrhs, ldx, batch_count);
+    host_vector<int64_t> hIpiv64(N);
+    host_vector<int>     hIter(batch_count);
+    host_vector<int>     hInfo(batch_count);
+    int                  info;
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+    CHECK_HIP_ERROR(hB.memcheck());
+    CHECK_HIP_ERROR(hX.memcheck());
+    CHECK_HIP_ERROR(hX_ref.memcheck());
+
+    device_batch_matrix<T> dA(N, N, lda, batch_count);
+    device_batch_matrix<T> dB(N, nrhs, ldb, batch_count);
+    device_batch_matrix<T> dX(N, nrhs, ldx, batch_count);
+    device_vector<int>     dIpiv(size_t(N) * batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dB.memcheck());
+    CHECK_DEVICE_ALLOCATION(dX.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error;
+    hipblasLocalHandle handle(arg);
+
+    setup_gesv_ir_batched_testing(arg, hA, hB, N, nrhs, lda, ldb, batch_count);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dB.transfer_from(hB));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIPBLAS_ERROR(hipblasGesvIRBatchedFn(handle,
+                                                   N,
+                                                   nrhs,
+                                                   dA.ptr_on_device(),
+                                                   lda,
+                                                   dIpiv,
+                                                   dB.ptr_on_device(),
+                                                   ldb,
+                                                   dX.ptr_on_device(),
+                                                   ldx,
+                                                   hIter,
+                                                   &info,
+                                                   dInfo,
+                                                   batch_count));
+
+        // copy output from device to CPU
+        CHECK_HIP_ERROR(hX.transfer_from(dX));
+        CHECK_HIP_ERROR(hA1.transfer_from(dA));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            host_matrix<T> hLU(N, N, lda);
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < N; i++)
+                    hLU[i + j * lda] = hA[b][i + j * lda];
+            for(int j = 0; j < nrhs; j++)
+                for(int i = 0; i < N; i++)
+                    hX_ref[b][i + j * ldx] = hB[b][i + j * ldb];
+
+            ref_getrf<T>(N, N, hLU.data(), lda, hIpiv64.data());
+            ref_getrs('N', N, nrhs, hLU.data(), lda, hIpiv64.data(), hX_ref[b], ldx);
+        }
+
+        hipblas_error = norm_check_general<T>('F', N, nrhs, ldx, hX_ref, hX, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = N * eps * 100;
+            int    zero      = 0;
+
+            unit_check_error(hipblas_error, tolerance);
+            unit_check_general(1, 1, 1, &zero, &info);
+            for(int b = 0; b < batch_count; b++)
+            {
+                unit_check_general(1, 1, 1, &zero, hInfo.data() + b);
+                EXPECT_GE(hIter[b], 0);
+            }
+            unit_check_general<T>(N, N, batch_count, lda, hA, hA1);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int it = 0; it < runs; it++)
+        {
+            hipblas_time_iteration(arg, it, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGesvIRBatchedFn(handle,
+                                                       N,
+                                                       nrhs,
+                                                       dA.ptr_on_device(),
+                                                       lda,
+                                                       dIpiv,
+                                                       dB.ptr_on_device(),
+                                                       ldb,
+                                                       dX.ptr_on_device(),
+                                                       ldx,
+                                                       hIter,
+                                                       &info,
+                                                       dInfo,
+                                                       batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGesvIRBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            (getrf_gflop_count<T>(N, N) + getrs_gflop_count<T>(N, nrhs)) * batch_count,
+            ArgumentLogging::NA_value,
+            hipblas_error);
+    }
+}
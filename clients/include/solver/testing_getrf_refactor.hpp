@@ -0,0 +1,204 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGetrfRefactorModel = ArgumentModel<e_a_type, e_N, e_lda>;
+
+inline void testname_getrf_refactor(const Arguments& arg, std::string& name)
+{
+    hipblasGetrfRefactorModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_getrf_refactor_bad_arg(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto hipblasGetrfRefactorFn = hipblasGetrfRefactor<T, U>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N          = 101;
+    const int          lda        = 102;
+    const U            max_growth = 100;
+
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfRefactorFn(nullptr, N, dA, lda, dIpiv, max_growth, dInfo),
+                          HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfRefactorFn(handle, -1, dA, lda, dIpiv, max_growth, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfRefactorFn(handle, N, dA, N - 1, dIpiv, max_growth, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfRefactorFn(handle, N, dA, lda, dIpiv, U(-1), dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorFn(handle, N, nullptr, lda, dIpiv, max_growth, dInfo),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfRefactorFn(handle, N, dA, lda, nullptr, max_growth, dInfo),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasGetrfRefactorFn(handle, N, dA, lda, dIpiv, max_growth, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A and ipiv can be nullptr
+    CHECK_HIPBLAS_ERROR(
+        hipblasGetrfRefactorFn(handle, 0, nullptr, lda, nullptr, max_growth, dInfo));
+}
+
+// The rows of a diagonally dominant matrix are reversed, so its factorization with partial
+// pivoting has row interchanges. Refactorizing the matrix with its own pivots must give the
+// factors of getrf, and a growth bound below 1 must be reported as exceeded.
+template <typename T>
+void testing_getrf_refactor(const Arguments& arg)
+{
+    using U                     = real_t<T>;
+    auto hipblasGetrfRefactorFn = hipblasGetrfRefactor<T, U>;
+
+    int N   = arg.N;
+    int lda = arg.lda;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<T>       hA(N, N, lda);
+    host_matrix<T>       hA_ref(N, N, lda);
+    host_matrix<T>       hA_gpu(N, N, lda);
+    host_vector<int>     hIpiv(N);
+    host_vector<int64_t> hIpiv64(N);
+    int                  hInfo, expectedInfo;
+
+    // Allocate device memory
+    device_matrix<T>   dA(N, N, lda);
+    device_vector<int> dIpiv(N);
+    device_vector<int> dInfo(1);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    T* A = (T*)hA;
+    for(int j = 0; j < N; j++)
+    {
+        // scale A to avoid singularities
+        for(int i = 0; i < N; i++)
+        {
+            if(i == j)
+                A[i + j * lda] += 400;
+            else
+                A[i + j * lda] -= 4;
+        }
+        std::reverse(A + j * lda, A + j * lda + N);
+    }
+
+    // the pivots of the reference factorization are reused by the refactorization
+    hA_ref = hA;
+    ref_getrf(N, N, hA_ref.data(), lda, hIpiv64.data());
+    for(int i = 0; i < N; i++)
+        hIpiv[i] = hIpiv64[i];
+
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIPBLAS_ERROR(hipblasGetrfRefactorFn(handle, N, dA, lda, dIpiv, U(100), dInfo));
+
+        CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+        CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+        expectedInfo = 0;
+        unit_check_general(1, 1, 1, &expectedInfo, &hInfo);
+
+        hipblas_error = norm_check_general<T>('F', N, N, lda, hA_ref, hA_gpu);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+        }
+
+        // the growth of a diagonally dominant matrix is close to 1
+        if(N)
+        {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(
+                hipblasGetrfRefactorFn(handle, N, dA, lda, dIpiv, U(0.5), dInfo));
+            CHECK_HIP_ERROR(hipMemcpy(&hInfo, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+            expectedInfo = N + 1;
+            unit_check_general(1, 1, 1, &expectedInfo, &hInfo);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(
+                hipblasGetrfRefactorFn(handle, N, dA, lda, dIpiv, U(100), dInfo));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGetrfRefactorModel{}.log_args<T>(std::cout,
+                                                arg,
+                                                gpu_time_used,
+                                                getrf_gflop_count<T>(N, N),
+                                                ArgumentLogging::NA_value,
+                                                hipblas_error);
+    }
+}
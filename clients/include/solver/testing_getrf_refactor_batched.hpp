@@ -0,0 +1,242 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasGetrfRefactorBatchedModel = ArgumentModel<e_a_type, e_N, e_lda, e_batch_count>;
+
+inline void testname_getrf_refactor_batched(const Arguments& arg, std::string& name)
+{
+    hipblasGetrfRefactorBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void testing_getrf_refactor_batched_bad_arg(const Arguments& arg)
+{
+    using U                            = real_t<T>;
+    auto hipblasGetrfRefactorBatchedFn = hipblasGetrfRefactorBatched<T, U>;
+
+    hipblasLocalHandle handle(arg);
+    const int          N           = 101;
+    const int          lda         = 102;
+    const int          batch_count = 2;
+    const U            max_growth  = 100;
+
+    device_batch_matrix<T> dA(N, N, lda, batch_count);
+    device_vector<int>     dIpiv(N * batch_count);
+    device_vector<int>     dInfo(batch_count);
+
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            nullptr, N, dA.ptr_on_device(), lda, dIpiv, max_growth, dInfo, batch_count),
+        HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, -1, dA.ptr_on_device(), lda, dIpiv, max_growth, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, N, dA.ptr_on_device(), N - 1, dIpiv, max_growth, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, N, dA.ptr_on_device(), lda, dIpiv, U(-1), dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, N, dA.ptr_on_device(), lda, dIpiv, max_growth, dInfo, -1),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, N, nullptr, lda, dIpiv, max_growth, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, N, dA.ptr_on_device(), lda, nullptr, max_growth, dInfo, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasGetrfRefactorBatchedFn(
+            handle, N, dA.ptr_on_device(), lda, dIpiv, max_growth, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    // If N == 0, A and ipiv can be nullptr
+    CHECK_HIPBLAS_ERROR(hipblasGetrfRefactorBatchedFn(
+        handle, 0, nullptr, lda, nullptr, max_growth, dInfo, batch_count));
+}
+
+template <typename T>
+void testing_getrf_refactor_batched(const Arguments& arg)
+{
+    using U                            = real_t<T>;
+    auto hipblasGetrfRefactorBatchedFn = hipblasGetrfRefactorBatched<T, U>;
+
+    int N           = arg.N;
+    int lda         = arg.lda;
+    int batch_count = arg.batch_count;
+
+    hipblasStride strideP   = N;
+    size_t        Ipiv_size = strideP * batch_count;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return;
+    }
+    if(batch_count == 0)
+    {
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_matrix<T> hA(N, N, lda, batch_count);
+    host_batch_matrix<T> hA_ref(N, N, lda, batch_count);
+    host_batch_matrix<T> hA_gpu(N, N, lda, batch_count);
+    host_vector<int>     hIpiv(Ipiv_size);
+    host_vector<int64_t> hIpiv64(Ipiv_size);
+    host_vector<int>     hInfo(batch_count);
+    host_vector<int>     hInfo_gpu(batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA_ref.memcheck());
+    CHECK_HIP_ERROR(hA_gpu.memcheck());
+
+    // Allocate device memory
+    device_batch_matrix<T> dA(N, N, lda, batch_count);
+    device_vector<int>     dIpiv(Ipiv_size);
+    device_vector<int>     dInfo(batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dInfo.memcheck());
+
+    double             gpu_time_used, hipblas_error = 0.0;
+    hipblasLocalHandle handle(arg);
+
+    // Initial hA on CPU
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            // scale A to avoid singularities
+            for(int i = 0; i < N; i++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+            std::reverse(hA[b] + j * lda, hA[b] + j * lda + N);
+        }
+    }
+
+    // the pivots of the reference factorizations are reused by the refactorization
+    hA_ref.copy_from(hA);
+    for(int b = 0; b < batch_count; b++)
+        ref_getrf(N, N, hA_ref[b], lda, hIpiv64.data() + b * strideP);
+    for(size_t i = 0; i < Ipiv_size; i++)
+        hIpiv[i] = hIpiv64[i];
+
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+            HIPBLAS
+        =================================================================== */
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIPBLAS_ERROR(hipblasGetrfRefactorBatchedFn(
+            handle, N, dA.ptr_on_device(), lda, dIpiv, U(100), dInfo, batch_count));
+
+        CHECK_HIP_ERROR(hA_gpu.transfer_from(dA));
+        CHECK_HIP_ERROR(hInfo_gpu.transfer_from(dInfo));
+
+        for(int b = 0; b < batch_count; b++)
+            hInfo[b] = 0;
+        unit_check_general(1, batch_count, 1, hInfo.data(), hInfo_gpu.data());
+
+        hipblas_error = norm_check_general<T>('F', N, N, lda, hA_ref, hA_gpu, batch_count);
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+        }
+
+        // the growth of a diagonally dominant matrix is close to 1
+        if(N)
+        {
+            CHECK_HIP_ERROR(dA.transfer_from(hA));
+            CHECK_HIPBLAS_ERROR(hipblasGetrfRefactorBatchedFn(
+                handle, N, dA.ptr_on_device(), lda, dIpiv, U(0.5), dInfo, batch_count));
+            CHECK_HIP_ERROR(hInfo_gpu.transfer_from(dInfo));
+
+            for(int b = 0; b < batch_count; b++)
+                hInfo[b] = N + 1;
+            unit_check_general(1, batch_count, 1, hInfo.data(), hInfo_gpu.data());
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasGetrfRefactorBatchedFn(
+                handle, N, dA.ptr_on_device(), lda, dIpiv, U(100), dInfo, batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasGetrfRefactorBatchedModel{}.log_args<T>(std::cout,
+                                                       arg,
+                                                       gpu_time_used,
+                                                       getrf_gflop_count<T>(N, N),
+                                                       ArgumentLogging::NA_value,
+                                                       hipblas_error);
+    }
+}
@@ -0,0 +1,244 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasOrgqrModel = ArgumentModel<e_a_type, e_M, e_N, e_K, e_lda>;
+
+inline void testname_orgqr(const Arguments& arg, std::string& name)
+{
+    hipblasOrgqrModel{}.test_name(arg, name);
+}
+
+// Fills A with the Householder vectors and ipiv with the scalar factors of the QR factorization of
+// a random M-by-N matrix, as returned by geqrf.
+template <typename T>
+void setup_orgqr_testing(T* A, T* ipiv, int M, int N, int lda)
+{
+    for(int i = 0; i < M; i++)
+    {
+        for(int j = 0; j < N; j++)
+        {
+            if(i == j)
+                A[i + j * lda] += 400;
+            else
+                A[i + j * lda] -= 4;
+        }
+    }
+
+    host_vector<T> work(1);
+    ref_geqrf(M, N, A, lda, ipiv, work.data(), -1);
+    int lwork = type2int(work[0]);
+
+    work = host_vector<T>(lwork);
+    ref_geqrf(M, N, A, lda, ipiv, work.data(), lwork);
+}
+
+template <typename T>
+void testing_orgqr_bad_arg(const Arguments& arg)
+{
+    auto hipblasOrgqrFn = hipblasOrgqr<T>;
+
+    hipblasLocalHandle handle(arg);
+    const int          M   = 100;
+    const int          N   = 90;
+    const int          K   = 80;
+    const int          lda = 102;
+
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dIpiv(N);
+    int              info = 0;
+    int              expectedInfo;
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, N, K, dA, lda, dIpiv, nullptr),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, -1, N, K, dA, lda, dIpiv, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, M + 1, K, dA, lda, dIpiv, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, N, N + 1, dA, lda, dIpiv, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, N, K, nullptr, lda, dIpiv, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, N, K, dA, M - 1, dIpiv, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, N, K, dA, lda, nullptr, &info),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If M == 0 || N == 0, A and ipiv can be nullptr, and ipiv isn't used when K == 0
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, 0, 0, 0, nullptr, lda, nullptr, &info),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrFn(handle, M, N, 0, dA, lda, nullptr, &info),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_orgqr(const Arguments& arg)
+{
+    using U             = real_t<T>;
+    auto hipblasOrgqrFn = hipblasOrgqr<T>;
+
+    int M   = arg.M;
+    int N   = arg.N;
+    int K   = arg.K;
+    int lda = arg.lda;
+
+    int info;
+
+    hipblasLocalHandle handle(arg);
+
+    // Check to prevent memory allocation error
+    bool invalid_size = M < 0 || N < 0 || N > M || K < 0 || K > N || lda < std::max(1, M);
+    if(invalid_size || !M || !N)
+    {
+        // including pointers so can test other params
+        device_vector<T> dA(1);
+        device_vector<T> dIpiv(1);
+        hipblasStatus_t  status = hipblasOrgqrFn(handle, M, N, K, dA, lda, dIpiv, &info);
+        EXPECT_HIPBLAS_STATUS(
+            status, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+
+        int expected_info = 0;
+        if(M < 0)
+            expected_info = -1;
+        else if(N < 0 || N > M)
+            expected_info = -2;
+        else if(K < 0 || K > N)
+            expected_info = -3;
+        else if(lda < std::max(1, M))
+            expected_info = -5;
+        unit_check_general(1, 1, 1, &expected_info, &info);
+
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_matrix<T> hA(M, N, lda);
+    host_matrix<T> hA1(M, N, lda);
+    host_vector<T> hIpiv(N);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+    CHECK_HIP_ERROR(hIpiv.memcheck());
+
+    device_matrix<T> dA(M, N, lda);
+    device_vector<T> dIpiv(N);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+
+    double gpu_time_used, hipblas_error;
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    setup_orgqr_testing<T>(hA, hIpiv, M, N, lda);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasOrgqrFn(handle, M, N, K, dA, lda, dIpiv, &info));
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hA1.transfer_from(dA));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        // Workspace query
+        host_vector<T> work(1);
+        ref_orgqr(M, N, K, (T*)hA, lda, (T*)hIpiv, work.data(), -1);
+        int lwork = type2int(work[0]);
+
+        work = host_vector<T>(lwork);
+        ref_orgqr(M, N, K, (T*)hA, lda, (T*)hIpiv, work.data(), lwork);
+
+        hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            int zero = 0;
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasOrgqrFn(handle, M, N, K, dA, lda, dIpiv, &info));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasOrgqrModel{}.log_args<T>(std::cout,
+                                        arg,
+                                        gpu_time_used,
+                                        orgqr_gflop_count<T>(M, N, K),
+                                        ArgumentLogging::NA_value,
+                                        hipblas_error);
+    }
+}
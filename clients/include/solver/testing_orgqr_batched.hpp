@@ -0,0 +1,286 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasOrgqrBatchedModel = ArgumentModel<e_a_type, e_M, e_N, e_K, e_lda, e_batch_count>;
+
+inline void testname_orgqr_batched(const Arguments& arg, std::string& name)
+{
+    hipblasOrgqrBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void setup_orgqr_batched_testing(host_batch_matrix<T>& hA,
+                                 host_batch_matrix<T>& hIpiv,
+                                 int                   M,
+                                 int                   N,
+                                 int                   lda,
+                                 int                   batch_count)
+{
+    host_vector<T> work(1);
+    ref_geqrf(M, N, hA[0], lda, hIpiv[0], work.data(), -1);
+    int lwork = type2int(work[0]);
+    work      = host_vector<T>(lwork);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        // scale A to avoid singularities
+        for(int i = 0; i < M; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+
+        // Householder vectors and scalar factors as returned by geqrf
+        ref_geqrf(M, N, hA[b], lda, hIpiv[b], work.data(), lwork);
+    }
+}
+
+template <typename T>
+void testing_orgqr_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasOrgqrBatchedFn = hipblasOrgqrBatched<T>;
+
+    hipblasLocalHandle handle(arg);
+    const int          M           = 100;
+    const int          N           = 90;
+    const int          K           = 80;
+    const int          lda         = 102;
+    const int          batch_count = 2;
+
+    device_batch_matrix<T> dA(M, N, lda, batch_count);
+    device_batch_matrix<T> dIpiv(1, N, 1, batch_count);
+    int                    info = 0;
+    int                    expectedInfo;
+
+    T* const* dAp    = dA.ptr_on_device();
+    T* const* dIpivp = dIpiv.ptr_on_device();
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, M, N, K, dAp, lda, dIpivp, nullptr, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, -1, N, K, dAp, lda, dIpivp, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, M, M + 1, K, dAp, lda, dIpivp, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, M, N, N + 1, dAp, lda, dIpivp, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, M, N, K, nullptr, lda, dIpivp, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, M, N, K, dAp, M - 1, dIpivp, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, M, N, K, dAp, lda, nullptr, &info, batch_count),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrBatchedFn(handle, M, N, K, dAp, lda, dIpivp, &info, -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -8;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If M == 0 || N == 0, A and ipiv can be nullptr
+    EXPECT_HIPBLAS_STATUS(
+        hipblasOrgqrBatchedFn(handle, 0, 0, 0, nullptr, lda, nullptr, &info, batch_count),
+        HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrgqrBatchedFn(handle, M, N, K, dAp, lda, dIpivp, &info, 0),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_orgqr_batched(const Arguments& arg)
+{
+    using U                    = real_t<T>;
+    auto hipblasOrgqrBatchedFn = hipblasOrgqrBatched<T>;
+
+    int M           = arg.M;
+    int N           = arg.N;
+    int K           = arg.K;
+    int lda         = arg.lda;
+    int batch_count = arg.batch_count;
+
+    int info;
+
+    hipblasLocalHandle handle(arg);
+
+    // Check to prevent memory allocation error
+    bool invalid_size = M < 0 || N < 0 || N > M || K < 0 || K > N || lda < std::max(1, M)
+                        || batch_count < 0;
+    if(invalid_size || !M || !N || !batch_count)
+    {
+        // including pointers so can test other params
+        device_batch_matrix<T> dA(1, 1, 1, 1);
+        device_batch_matrix<T> dIpiv(1, 1, 1, 1);
+        hipblasStatus_t        status = hipblasOrgqrBatchedFn(
+            handle, M, N, K, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count);
+        EXPECT_HIPBLAS_STATUS(
+            status, (invalid_size ? HIPBLAS_STATUS_INVALID_VALUE : HIPBLAS_STATUS_SUCCESS));
+
+        int expected_info = 0;
+        if(M < 0)
+            expected_info = -1;
+        else if(N < 0 || N > M)
+            expected_info = -2;
+        else if(K < 0 || K > N)
+            expected_info = -3;
+        else if(lda < std::max(1, M))
+            expected_info = -5;
+        else if(batch_count < 0)
+            expected_info = -8;
+        unit_check_general(1, 1, 1, &expected_info, &info);
+
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_batch_matrix<T> hA(M, N, lda, batch_count);
+    host_batch_matrix<T> hA1(M, N, lda, batch_count);
+    host_batch_matrix<T> hIpiv(1, N, 1, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hA1.memcheck());
+    CHECK_HIP_ERROR(hIpiv.memcheck());
+
+    device_batch_matrix<T> dA(M, N, lda, batch_count);
+    device_batch_matrix<T> dIpiv(1, N, 1, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+
+    double gpu_time_used, hipblas_error;
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    setup_orgqr_batched_testing(hA, hIpiv, M, N, lda, batch_count);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasOrgqrBatchedFn(
+        handle, M, N, K, dA.ptr_on_device(), lda, dIpiv.ptr_on_device(), &info, batch_count));
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hA1.transfer_from(dA));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        // Workspace query
+        host_vector<T> work(1);
+        ref_orgqr(M, N, K, hA[0], lda, hIpiv[0], work.data(), -1);
+        int lwork = type2int(work[0]);
+
+        work = host_vector<T>(lwork);
+        for(int b = 0; b < batch_count; b++)
+        {
+            ref_orgqr(M, N, K, hA[b], lda, hIpiv[b], work.data(), lwork);
+        }
+
+        hipblas_error = norm_check_general<T>('F', M, N, lda, hA, hA1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            int zero = 0;
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasOrgqrBatchedFn(handle,
+                                                      M,
+                                                      N,
+                                                      K,
+                                                      dA.ptr_on_device(),
+                                                      lda,
+                                                      dIpiv.ptr_on_device(),
+                                                      &info,
+                                                      batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasOrgqrBatchedModel{}.log_args<T>(std::cout,
+                                               arg,
+                                               gpu_time_used,
+                                               orgqr_gflop_count<T>(M, N, K) * batch_count,
+                                               ArgumentLogging::NA_value,
+                                               hipblas_error);
+    }
+}
@@ -0,0 +1,600 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "testing_common.hpp"
+
+using hipblasOrmqrStridedBatchedModel = ArgumentModel<e_a_type,
+                                                      e_side,
+                                                      e_transA,
+                                                      e_M,
+                                                      e_N,
+                                                      e_K,
+                                                      e_lda,
+                                                      e_ldc,
+                                                      e_stride_scale,
+                                                      e_batch_count>;
+
+inline void testname_ormqr_strided_batched(const Arguments& arg, std::string& name)
+{
+    hipblasOrmqrStridedBatchedModel{}.test_name(arg, name);
+}
+
+template <typename T>
+void setup_ormqr_strided_batched_testing(host_strided_batch_matrix<T>& hA,
+                                         host_vector<T>&               hIpiv,
+                                         int                           nq,
+                                         int                           K,
+                                         int                           lda,
+                                         hipblasStride                 strideP,
+                                         int                           batch_count)
+{
+    host_vector<T> work(1);
+    ref_geqrf(nq, K, hA[0], lda, hIpiv.data(), work.data(), -1);
+    int lwork = type2int(work[0]);
+    work      = host_vector<T>(lwork);
+
+    for(int b = 0; b < batch_count; b++)
+    {
+        // scale A to avoid singularities
+        for(int i = 0; i < nq; i++)
+        {
+            for(int j = 0; j < K; j++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] += 400;
+                else
+                    hA[b][i + j * lda] -= 4;
+            }
+        }
+
+        // Householder vectors and scalar factors as returned by geqrf
+        ref_geqrf(nq, K, hA[b], lda, hIpiv.data() + b * strideP, work.data(), lwork);
+    }
+}
+
+template <typename T>
+void testing_ormqr_strided_batched_bad_arg(const Arguments& arg)
+{
+    auto hipblasOrmqrStridedBatchedFn = hipblasOrmqrStridedBatched<T>;
+
+    hipblasLocalHandle handle(arg);
+    const int          M           = 100;
+    const int          N           = 90;
+    const int          K           = 80;
+    const int          lda         = 102;
+    const int          ldc         = 101;
+    const int          batch_count = 2;
+
+    hipblasSideMode_t  side      = HIPBLAS_SIDE_LEFT;
+    hipblasOperation_t trans     = HIPBLAS_OP_N;
+    hipblasOperation_t bad_trans = is_complex<T> ? HIPBLAS_OP_T : HIPBLAS_OP_C;
+
+    hipblasStride strideA = size_t(lda) * K;
+    hipblasStride strideP = K;
+    hipblasStride strideC = size_t(ldc) * N;
+
+    device_strided_batch_matrix<T> dA(M, K, lda, strideA, batch_count);
+    device_vector<T>               dIpiv(strideP * batch_count);
+    device_strided_batch_matrix<T> dC(M, N, ldc, strideC, batch_count);
+
+    int info = 0;
+    int expectedInfo;
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       nullptr,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       HIPBLAS_SIDE_BOTH,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -1;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       bad_trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -2;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       -1,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -3;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       -1,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -4;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       M + 1,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -5;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -6;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       M - 1,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -7;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -9;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       nullptr,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -11;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       M - 1,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -12;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       -1),
+                          HIPBLAS_STATUS_INVALID_VALUE);
+    expectedInfo = -15;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    // If M == 0 || N == 0, C can be nullptr, and A and ipiv aren't used when K == 0
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       0,
+                                                       N,
+                                                       0,
+                                                       nullptr,
+                                                       lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       strideP,
+                                                       nullptr,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       batch_count),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+
+    EXPECT_HIPBLAS_STATUS(hipblasOrmqrStridedBatchedFn(handle,
+                                                       side,
+                                                       trans,
+                                                       M,
+                                                       N,
+                                                       K,
+                                                       dA,
+                                                       lda,
+                                                       strideA,
+                                                       dIpiv,
+                                                       strideP,
+                                                       dC,
+                                                       ldc,
+                                                       strideC,
+                                                       &info,
+                                                       0),
+                          HIPBLAS_STATUS_SUCCESS);
+    expectedInfo = 0;
+    unit_check_general(1, 1, 1, &expectedInfo, &info);
+}
+
+template <typename T>
+void testing_ormqr_strided_batched(const Arguments& arg)
+{
+    using U                           = real_t<T>;
+    auto hipblasOrmqrStridedBatchedFn = hipblasOrmqrStridedBatched<T>;
+
+    char               side_c  = arg.side;
+    char               trans_c = arg.transA;
+    hipblasSideMode_t  side    = char2hipblas_side(side_c);
+    hipblasOperation_t trans   = char2hipblas_operation(trans_c);
+
+    int    M            = arg.M;
+    int    N            = arg.N;
+    int    K            = arg.K;
+    int    lda          = arg.lda;
+    int    ldc          = arg.ldc;
+    double stride_scale = arg.stride_scale;
+    int    batch_count  = arg.batch_count;
+    int    nq           = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    hipblasStride strideA = lda * K * stride_scale;
+    hipblasStride strideP = K * stride_scale;
+    hipblasStride strideC = ldc * N * stride_scale;
+
+    size_t Ipiv_size = strideP * batch_count;
+    int    info;
+
+    hipblasLocalHandle handle(arg);
+
+    // Check to prevent memory allocation error
+    bool invalid_trans = trans == (is_complex<T> ? HIPBLAS_OP_T : HIPBLAS_OP_C);
+    bool invalid_size  = M < 0 || N < 0 || K < 0 || K > nq || lda < std::max(1, nq)
+                        || ldc < std::max(1, M) || batch_count < 0;
+    if(invalid_trans || invalid_size || !M || !N || !K || !batch_count)
+    {
+        // including pointers so can test other params
+        device_vector<T> dA(1);
+        device_vector<T> dIpiv(1);
+        device_vector<T> dC(1);
+        hipblasStatus_t  status = hipblasOrmqrStridedBatchedFn(handle,
+                                                              side,
+                                                              trans,
+                                                              M,
+                                                              N,
+                                                              K,
+                                                              dA,
+                                                              lda,
+                                                              strideA,
+                                                              dIpiv,
+                                                              strideP,
+                                                              dC,
+                                                              ldc,
+                                                              strideC,
+                                                              &info,
+                                                              batch_count);
+        EXPECT_HIPBLAS_STATUS(status,
+                              (invalid_trans || invalid_size ? HIPBLAS_STATUS_INVALID_VALUE
+                                                             : HIPBLAS_STATUS_SUCCESS));
+
+        int expected_info = 0;
+        if(invalid_trans)
+            expected_info = -2;
+        else if(M < 0)
+            expected_info = -3;
+        else if(N < 0)
+            expected_info = -4;
+        else if(K < 0 || K > nq)
+            expected_info = -5;
+        else if(lda < std::max(1, nq))
+            expected_info = -7;
+        else if(ldc < std::max(1, M))
+            expected_info = -12;
+        else if(batch_count < 0)
+            expected_info = -15;
+        unit_check_general(1, 1, 1, &expected_info, &info);
+
+        return;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_strided_batch_matrix<T> hA(nq, K, lda, strideA, batch_count);
+    host_vector<T>               hIpiv(Ipiv_size);
+    host_strided_batch_matrix<T> hC(M, N, ldc, strideC, batch_count);
+    host_strided_batch_matrix<T> hC1(M, N, ldc, strideC, batch_count);
+
+    // Check host memory allocation
+    CHECK_HIP_ERROR(hA.memcheck());
+    CHECK_HIP_ERROR(hIpiv.memcheck());
+    CHECK_HIP_ERROR(hC.memcheck());
+    CHECK_HIP_ERROR(hC1.memcheck());
+
+    device_strided_batch_matrix<T> dA(nq, K, lda, strideA, batch_count);
+    device_vector<T>               dIpiv(Ipiv_size);
+    device_strided_batch_matrix<T> dC(M, N, ldc, strideC, batch_count);
+
+    // Check device memory allocation
+    CHECK_DEVICE_ALLOCATION(dA.memcheck());
+    CHECK_DEVICE_ALLOCATION(dIpiv.memcheck());
+    CHECK_DEVICE_ALLOCATION(dC.memcheck());
+
+    double gpu_time_used, hipblas_error;
+
+    hipblas_init_matrix(hA, arg, hipblas_client_never_set_nan, hipblas_general_matrix, true);
+    hipblas_init_matrix(hC, arg, hipblas_client_never_set_nan, hipblas_general_matrix);
+    setup_ormqr_strided_batched_testing(hA, hIpiv, nq, K, lda, strideP, batch_count);
+
+    CHECK_HIP_ERROR(dA.transfer_from(hA));
+    CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    CHECK_HIP_ERROR(dC.transfer_from(hC));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    CHECK_HIPBLAS_ERROR(hipblasOrmqrStridedBatchedFn(handle,
+                                                     side,
+                                                     trans,
+                                                     M,
+                                                     N,
+                                                     K,
+                                                     dA,
+                                                     lda,
+                                                     strideA,
+                                                     dIpiv,
+                                                     strideP,
+                                                     dC,
+                                                     ldc,
+                                                     strideC,
+                                                     &info,
+                                                     batch_count));
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hC1.transfer_from(dC));
+
+    if(arg.unit_check || arg.norm_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        // Workspace query
+        host_vector<T> work(1);
+        ref_ormqr(
+            side_c, trans_c, M, N, K, hA[0], lda, hIpiv.data(), hC[0], ldc, work.data(), -1);
+        int lwork = type2int(work[0]);
+
+        work = host_vector<T>(lwork);
+        for(int b = 0; b < batch_count; b++)
+        {
+            ref_ormqr(side_c,
+                      trans_c,
+                      M,
+                      N,
+                      K,
+                      hA[b],
+                      lda,
+                      hIpiv.data() + b * strideP,
+                      hC[b],
+                      ldc,
+                      work.data(),
+                      lwork);
+        }
+
+        hipblas_error = norm_check_general<T>('F', M, N, ldc, strideC, hC, hC1, batch_count);
+
+        if(arg.unit_check)
+        {
+            U      eps       = std::numeric_limits<U>::epsilon();
+            double tolerance = eps * 2000;
+
+            unit_check_error(hipblas_error, tolerance);
+            int zero = 0;
+            unit_check_general(1, 1, 1, &zero, &info);
+        }
+    }
+
+    if(arg.timing)
+    {
+        hipStream_t stream;
+        CHECK_HIPBLAS_ERROR(hipblasGetStream(handle, &stream));
+
+        int runs = arg.cold_iters + arg.iters;
+        for(int iter = 0; iter < runs; iter++)
+        {
+            hipblas_time_iteration(arg, iter, stream, gpu_time_used);
+
+            CHECK_HIPBLAS_ERROR(hipblasOrmqrStridedBatchedFn(handle,
+                                                             side,
+                                                             trans,
+                                                             M,
+                                                             N,
+                                                             K,
+                                                             dA,
+                                                             lda,
+                                                             strideA,
+                                                             dIpiv,
+                                                             strideP,
+                                                             dC,
+                                                             ldc,
+                                                             strideC,
+                                                             &info,
+                                                             batch_count));
+        }
+        gpu_time_used = get_time_us_sync(stream) - gpu_time_used;
+
+        hipblasOrmqrStridedBatchedModel{}.log_args<T>(
+            std::cout,
+            arg,
+            gpu_time_used,
+            ormqr_gflop_count<T>(side, M, N, K) * batch_count,
+            ArgumentLogging::NA_value,
+            hipblas_error);
+    }
+}
@@ -209,6 +209,57 @@ auto hipblas_blas1_ex_dispatch(const Arguments& arg)
     return TEST<void>{}(arg);
 }
 
+// copy_ex functions, from a_type to b_type within the real or the complex types
+template <template <typename...> class TEST, typename Ta>
+auto hipblas_copy_ex_dispatch_b(const Arguments& arg)
+{
+    switch(arg.b_type)
+    {
+    case HIPBLAS_R_16F:
+        return TEST<Ta, hipblasHalf>{}(arg);
+    case HIPBLAS_R_16B:
+        return TEST<Ta, hipblasBfloat16>{}(arg);
+    case HIPBLAS_R_32F:
+        return TEST<Ta, float>{}(arg);
+    case HIPBLAS_R_64F:
+        return TEST<Ta, double>{}(arg);
+    case HIPBLAS_C_32F:
+        return TEST<Ta, hipblasComplex>{}(arg);
+    case HIPBLAS_C_64F:
+        return TEST<Ta, hipblasDoubleComplex>{}(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
+
+template <template <typename...> class TEST>
+auto hipblas_copy_ex_dispatch(const Arguments& arg)
+{
+    const auto Ta = arg.a_type, Tb = arg.b_type;
+    const bool a_complex = Ta == HIPBLAS_C_32F || Ta == HIPBLAS_C_64F;
+    const bool b_complex = Tb == HIPBLAS_C_32F || Tb == HIPBLAS_C_64F;
+    if(a_complex != b_complex)
+        return TEST<void>{}(arg);
+
+    switch(Ta)
+    {
+    case HIPBLAS_R_16F:
+        return hipblas_copy_ex_dispatch_b<TEST, hipblasHalf>(arg);
+    case HIPBLAS_R_16B:
+        return hipblas_copy_ex_dispatch_b<TEST, hipblasBfloat16>(arg);
+    case HIPBLAS_R_32F:
+        return hipblas_copy_ex_dispatch_b<TEST, float>(arg);
+    case HIPBLAS_R_64F:
+        return hipblas_copy_ex_dispatch_b<TEST, double>(arg);
+    case HIPBLAS_C_32F:
+        return hipblas_copy_ex_dispatch_b<TEST, hipblasComplex>(arg);
+    case HIPBLAS_C_64F:
+        return hipblas_copy_ex_dispatch_b<TEST, hipblasDoubleComplex>(arg);
+    default:
+        return TEST<void>{}(arg);
+    }
+}
+
 // rot
 // giving rot it's own dispatch function so the code is easier to follow
 template <template <typename...> class TEST>
@@ -34,6 +34,7 @@
 #ifdef __cplusplus
 #include "hipblas_datatype2string.hpp"
 #include <cstdio>
+#include <functional>
 #include <iostream>
 #include <random>
 #include <vector>
@@ -532,6 +533,7 @@ class hipblasLocalHandle
 {
     hipblasHandle_t m_handle;
     void*           m_memory = nullptr;
+    bool            m_owned  = true;
 
 public:
     hipblasLocalHandle();
@@ -556,6 +558,37 @@ public:
     }
 };
 
+/*! \brief  Starts iteration iter of a timing loop on stream. The first hot iteration sets time_us
+            to get_time_us_sync(stream), the start of the loop. With per-iteration statistics logged,
+            each hot iteration is also timed with hip events until get_time_us_sync ends the loop */
+void hipblas_time_iteration(const Arguments& arg, int iter, hipStream_t stream, double& time_us);
+
+/*! \brief  Moves the times of the hot iterations of the last loop of the thread into times_us,
+            and returns whether there were any */
+bool hipblas_take_iteration_times(std::vector<double>& times_us);
+
+/*! \brief  Handles created by this thread use stream, or the default stream if nullptr */
+void hipblas_client_set_stream(hipStream_t stream);
+
+/*! \brief  Local handles of this thread use handle instead of creating their own, if not nullptr.
+            The owner of handle configures and destroys it */
+void hipblas_client_set_handle(hipblasHandle_t handle);
+
+/*! \brief  Whether the timing loops of this thread take the host time to submit each hot iteration */
+void hipblas_set_time_submission(bool time_submission);
+
+/*! \brief  Moves the submission times of the hot iterations of the last loop of the thread into
+            times_us, and returns whether there were any */
+bool hipblas_take_submission_times(std::vector<double>& times_us);
+
+/*! \brief  Sets a hook which the next timing loop of this thread calls once its cold iterations are
+            done on the stream, before the start of the hot iterations is timed */
+void hipblas_set_timing_start_hook(std::function<void()> hook);
+
+/*! \brief  The start of the hot iterations of the last timing loop of this thread, in the time of
+            get_time_us_sync */
+double hipblas_last_timing_start_us();
+
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status(hipError_t status);
 
 hipblasStatus_t hipblas_internal_convert_hip_to_hipblas_status_and_log(hipError_t status);
@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright (C) 2026 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ************************************************************************ */
+
+#include <hipblas/hipblas.h>
+#include <hipblas/hipblas_async.hpp>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <stdio.h>
+#include <stdlib.h>
+#include <thread>
+#include <vector>
+
+#ifndef CHECK_HIP_ERROR
+#define CHECK_HIP_ERROR(error)                    \
+    if(error != hipSuccess)                       \
+    {                                             \
+        fprintf(stderr,                           \
+                "Hip error: '%s'(%d) at %s:%d\n", \
+                hipGetErrorString(error),         \
+                error,                            \
+                __FILE__,                         \
+                __LINE__);                        \
+        exit(EXIT_FAILURE);                       \
+    }
+#endif
+
+#ifndef CHECK_HIPBLAS_ERROR
+#define CHECK_HIPBLAS_ERROR(error)                              \
+    if(error != HIPBLAS_STATUS_SUCCESS)                         \
+    {                                                           \
+        fprintf(stderr, "hipBLAS error: ");                     \
+        if(error == HIPBLAS_STATUS_NOT_INITIALIZED)             \
+            fprintf(stderr, "HIPBLAS_STATUS_NOT_INITIALIZED");  \
+        if(error == HIPBLAS_STATUS_ALLOC_FAILED)                \
+            fprintf(stderr, "HIPBLAS_STATUS_ALLOC_FAILED");     \
+        if(error == HIPBLAS_STATUS_INVALID_VALUE)               \
+            fprintf(stderr, "HIPBLAS_STATUS_INVALID_VALUE");    \
+        if(error == HIPBLAS_STATUS_MAPPING_ERROR)               \
+            fprintf(stderr, "HIPBLAS_STATUS_MAPPING_ERROR");    \
+        if(error == HIPBLAS_STATUS_EXECUTION_FAILED)            \
+            fprintf(stderr, "HIPBLAS_STATUS_EXECUTION_FAILED"); \
+        if(error == HIPBLAS_STATUS_INTERNAL_ERROR)              \
+            fprintf(stderr, "HIPBLAS_STATUS_INTERNAL_ERROR");   \
+        if(error == HIPBLAS_STATUS_NOT_SUPPORTED)               \
+            fprintf(stderr, "HIPBLAS_STATUS_NOT_SUPPORTED");    \
+        if(error == HIPBLAS_STATUS_INVALID_ENUM)                \
+            fprintf(stderr, "HIPBLAS_STATUS_INVALID_ENUM");     \
+        if(error == HIPBLAS_STATUS_UNKNOWN)                     \
+            fprintf(stderr, "HIPBLAS_STATUS_UNKNOWN");          \
+        fprintf(stderr, "\n");                                  \
+        exit(EXIT_FAILURE);                                     \
+    }
+#endif
+
+// Executor running the continuations of hipBLAS futures on the main thread, the way an event
+// loop of an application would
+class main_loop
+{
+public:
+    void post(std::function<void()> f)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back(std::move(f));
+    }
+
+    // Runs posted functions until done is set
+    void run(const bool& done)
+    {
+        while(!done)
+        {
+            std::function<void()> f;
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(!queue.empty())
+                {
+                    f = std::move(queue.front());
+                    queue.pop_front();
+                }
+            }
+            if(f)
+                f();
+            else
+                std::this_thread::yield();
+        }
+    }
+
+private:
+    std::mutex                        mutex;
+    std::deque<std::function<void()>> queue;
+};
+
+#ifdef HIPBLAS_ASYNC_COROUTINES
+struct task
+{
+    struct promise_type
+    {
+        task get_return_object()
+        {
+            return {};
+        }
+        std::suspend_never initial_suspend()
+        {
+            return {};
+        }
+        std::suspend_never final_suspend() noexcept
+        {
+            return {};
+        }
+        void return_void() {}
+        void unhandled_exception()
+        {
+            std::terminate();
+        }
+    };
+};
+
+// C = A * A * A, awaiting each product on the main loop
+task cube(hipblasHandle_t handle,
+          int             n,
+          float*          dA,
+          float*          dB,
+          float*          dC,
+          main_loop&      loop,
+          bool&           done)
+{
+    auto  executor = [&loop](std::function<void()> f) { loop.post(std::move(f)); };
+    float alpha = 1, beta = 0;
+
+    hipblas::future AA = hipblas::gemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dA, n, &beta, dB, n);
+    hipblasStatus_t status = co_await AA.via(executor);
+    CHECK_HIPBLAS_ERROR(status);
+    std::cout << "A * A done" << std::endl;
+
+    hipblas::future AAA = hipblas::gemm(
+        handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dB, n, dA, n, &beta, dC, n);
+    status = co_await AAA.via(executor);
+    CHECK_HIPBLAS_ERROR(status);
+    std::cout << "A * A * A done" << std::endl;
+
+    done = true;
+}
+#else
+// Without coroutines the second product is queued from the continuation of the first
+void cube(hipblasHandle_t handle,
+          int             n,
+          float*          dA,
+          float*          dB,
+          float*          dC,
+          main_loop&      loop,
+          bool&           done)
+{
+    auto         executor = [&loop](std::function<void()> f) { loop.post(std::move(f)); };
+    static float alpha = 1, beta = 0;
+
+    hipblas::gemm(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dA, n, &beta, dB, n)
+        .then(executor, [=, &done](hipblasStatus_t status) {
+            CHECK_HIPBLAS_ERROR(status);
+            std::cout << "A * A done" << std::endl;
+
+            hipblas::gemm(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dB, n, dA, n, &beta, dC, n)
+                .then(executor, [&done](hipblasStatus_t status) {
+                    CHECK_HIPBLAS_ERROR(status);
+                    std::cout << "A * A * A done" << std::endl;
+                    done = true;
+                });
+        });
+}
+#endif
+
+int main()
+{
+    int n = 256;
+    std::cout << "asynchronous sgemm example, n = " << n << std::endl;
+
+    // A is a scaled permutation matrix, so A * A * A is known exactly
+    std::vector<float> hA(n * n, 0), hC(n * n);
+    for(int j = 0; j < n; j++)
+        hA[(j + 1) % n + j * n] = 2;
+
+    float *dA, *dB, *dC;
+    CHECK_HIP_ERROR(hipMalloc(&dA, n * n * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, n * n * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, n * n * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), n * n * sizeof(float), hipMemcpyHostToDevice));
+
+    hipblasHandle_t handle;
+    CHECK_HIPBLAS_ERROR(hipblasCreate(&handle));
+
+    main_loop loop;
+    bool      done = false;
+    cube(handle, n, dA, dB, dC, loop, done);
+    loop.run(done);
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, n * n * sizeof(float), hipMemcpyDeviceToHost));
+
+    int errors = 0;
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < n; i++)
+            errors += hC[i + j * n] != (i == (j + 3) % n ? 8 : 0);
+
+    std::cout << (errors ? "FAIL" : "PASS") << ": " << errors << " wrong entries" << std::endl;
+
+    // stops the completion poller while the HIP runtime is still usable
+    hipblas::shutdown();
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIPBLAS_ERROR(hipblasDestroy(handle));
+    return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -522,9 +522,19 @@ typedef enum
 /*! \brief Indicates if layer is active with bitmask. */
 typedef enum
 {
-    HIPBLAS_GEMM_DEFAULT = 160 /**<  enumerator rocblas_gemm_algo_standard */
+    HIPBLAS_GEMM_DEFAULT = 160, /**<  enumerator rocblas_gemm_algo_standard */
+    HIPBLAS_GEMM_SPLIT_K
+    = 161, /**<  split the k dimension into chunks which are reduced afterwards, see hipblasSetGemmSplitK */
+    HIPBLAS_GEMM_STRASSEN
+    = 162 /**<  Strassen-Winograd algorithm for double and double complex, see hipblasSetGemmStrassenLevels */
 } hipblasGemmAlgo_t;
 
+/*! \brief Emulated compute type accepted by hipblasGemmEx_v2 and hipblasGemmExWithFlags_v2 in addition to
+ *         hipblasComputeType_t. The operands are split into low precision slices whose products are computed
+ *         with gemm_ex and accumulated, see hipblasSetGemmEmulationSlices. Only relevant with rocBLAS backend. */
+#define HIPBLAS_COMPUTE_32F_EMULATED_16BF \
+    ((hipblasComputeType_t)0x101) /**< HIP_R_32F gemm computed from bfloat16 slices (bf16x3) */
+
 /*! \brief Indicates if atomics operations are allowed. Not allowing atomic operations may generally improve determinism and repeatability of results at a cost of performance.
  *         By default, the rocBLAS backend will allow atomic operations while the cuBLAS backend will disallow atomic operations. See backend documentation
  *         for more detail. */
@@ -548,6 +558,50 @@ typedef enum
     = 0x10 /**< enumerator rocblas_gemm_flags_fp16_alt_impl_rnz */
 } hipblasGemmFlags_t;
 
+/*! \brief Indicates whether gemm stores C as given or transposed, see hipblasSetGemmOrderMode.
+ *         Only relevant with rocBLAS backend. */
+typedef enum
+{
+    HIPBLAS_GEMM_ORDER_DEFAULT = 0, /**< C is stored as given (default). */
+    HIPBLAS_GEMM_ORDER_TRANSPOSED_C
+    = 1 /**< C is stored transposed, and C^T = op(B)^T * op(A)^T is computed with one gemm. */
+} hipblasGemmOrderMode_t;
+
+/*! \brief Indicates the algorithm used by the QR factorization in geqrf and gels.
+ *         Only relevant with rocBLAS backend. */
+typedef enum
+{
+    HIPBLAS_QR_ALGO_DEFAULT = 0, /**< The factorization of rocSOLVER (default). */
+    HIPBLAS_QR_ALGO_TSQR
+    = 1 /**< Tall-skinny QR for matrices with many more rows than columns, see hipblasSetQrAlgo. */
+} hipblasQrAlgo_t;
+
+/*! \brief Indicates the routine of a problem warmed up by hipblasWarmup. */
+typedef enum
+{
+    HIPBLAS_WARMUP_GEMM = 0, /**< hipblasGemmEx_v2 and the typed gemm functions. */
+    HIPBLAS_WARMUP_GEMM_STRIDED_BATCHED
+    = 1 /**< hipblasGemmStridedBatchedEx_v2 and the typed strided batched gemm functions. */
+} hipblasWarmupRoutine_t;
+
+/*! \brief Describes a problem warmed up by hipblasWarmup, and reports the time taken. */
+typedef struct
+{
+    hipblasWarmupRoutine_t routine; /**< Routine of the problem. */
+    hipblasOperation_t     transA; /**< Operation op(A). */
+    hipblasOperation_t     transB; /**< Operation op(B). */
+    int                    m; /**< Number of rows of op(A) and C. */
+    int                    n; /**< Number of columns of op(B) and C. */
+    int                    k; /**< Number of columns of op(A) and rows of op(B). */
+    int                    batchCount; /**< Number of problems, ignored by HIPBLAS_WARMUP_GEMM. */
+    hipDataType            aType; /**< Type of A. */
+    hipDataType            bType; /**< Type of B. */
+    hipDataType            cType; /**< Type of C. */
+    hipblasComputeType_t   computeType; /**< Compute type. */
+    double                 time_us; /**< [out] Time of the warm-up in microseconds. */
+    hipblasStatus_t        status; /**< [out] Status of the warm-up. */
+} hipblasWarmupDescriptor_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -788,6 +842,248 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixAsync(int         rows,
                                                      int         ldb,
                                                      hipStream_t stream);
 
+/*! \brief copy a batch of matrices between a pointer array and a strided buffer
+    \details
+    hipblasPackBatched copies the m by n matrices A_i, given by an array of device pointers, into the strided
+    batched buffer B, with B_i stored at B + i * strideB. hipblasUnpackBatched copies them back. A batch can be
+    converted once and then used with the strided batched functions for many calls, which avoids reading the
+    pointer array in every call.
+
+    The copies are queued on the stream of the handle. With HIP_R_32F, HIP_R_64F, HIP_C_32F and HIP_C_64F
+    the batch is copied by a single geam_batched call, with an array of pointers into B which uses device
+    memory owned by the handle; the stream is not synchronized, but HIPBLAS_STATUS_NOT_SUPPORTED is returned
+    while the stream is being captured. With the other types the array of pointers is copied to the host and
+    the stream is synchronized before the matrices are copied, so the matrices may still be written by earlier
+    work on the stream, but the pointer array must be ready. Consecutive matrices which are laid out in A as in B
+    (lda == ldb, strideB == ldb * n and A_{i+1} == A_i + strideB) are then copied together with a single copy.
+
+    - Supported precisions in rocBLAS : all types supported by hipblasGemmEx_v2
+    - Supported precisions in cuBLAS  : all types supported by hipblasGemmEx_v2
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[in]
+    m           [int]
+                number of rows of each matrix.
+    @param[in]
+    n           [int]
+                number of columns of each matrix.
+    @param[in]
+    type        [hipDataType]
+                specifies the datatype of the matrices.
+    @param[in]
+    A           device array of device pointers storing each matrix A_i.
+    @param[in]
+    lda         [int]
+                specifies the leading dimension of each A_i, lda >= max(1, m).
+    @param[out]
+    B           device pointer to the first matrix B_1.
+    @param[in]
+    ldb         [int]
+                specifies the leading dimension of each B_i, ldb >= max(1, m).
+    @param[in]
+    strideB     [hipblasStride]
+                stride from the start of one matrix (B_i) to the next one (B_i+1).
+    @param[in]
+    batchCount  [int]
+                number of matrices in the batch.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasPackBatched(hipblasHandle_t   handle,
+                                                  int               m,
+                                                  int               n,
+                                                  hipDataType       type,
+                                                  const void* const A[],
+                                                  int               lda,
+                                                  void*             B,
+                                                  int               ldb,
+                                                  hipblasStride     strideB,
+                                                  int               batchCount);
+
+/*! \brief copy a batch of matrices from a strided buffer to a pointer array
+    \details
+    hipblasUnpackBatched copies the strided batched matrices B_i into the matrices A_i given by an array of
+    device pointers. See hipblasPackBatched for the arguments.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasUnpackBatched(hipblasHandle_t handle,
+                                                    int             m,
+                                                    int             n,
+                                                    hipDataType     type,
+                                                    const void*     B,
+                                                    int             ldb,
+                                                    hipblasStride   strideB,
+                                                    void* const     A[],
+                                                    int             lda,
+                                                    int             batchCount);
+
+/*! \brief typed variants of hipblasPackBatched
+    \details
+    hipblasXpackBatched and hipblasXunpackBatched are hipblasPackBatched and hipblasUnpackBatched for the
+    types float (S), double (D), hipblasComplex (C) and hipblasDoubleComplex (Z).
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpackBatched(hipblasHandle_t    handle,
+                                                   int                m,
+                                                   int                n,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   float*             B,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpackBatched(hipblasHandle_t     handle,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   hipblasStride       strideB,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpackBatched(hipblasHandle_t             handle,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   hipblasComplex*             B,
+                                                   int                         ldb,
+                                                   hipblasStride               strideB,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpackBatched(hipblasHandle_t                   handle,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   hipblasDoubleComplex*             B,
+                                                   int                               ldb,
+                                                   hipblasStride                     strideB,
+                                                   int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpackBatched_v2(hipblasHandle_t         handle,
+                                                      int                     m,
+                                                      int                     n,
+                                                      const hipComplex* const A[],
+                                                      int                     lda,
+                                                      hipComplex*             B,
+                                                      int                     ldb,
+                                                      hipblasStride           strideB,
+                                                      int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpackBatched_v2(hipblasHandle_t               handle,
+                                                      int                           m,
+                                                      int                           n,
+                                                      const hipDoubleComplex* const A[],
+                                                      int                           lda,
+                                                      hipDoubleComplex*             B,
+                                                      int                           ldb,
+                                                      hipblasStride                 strideB,
+                                                      int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSunpackBatched(hipblasHandle_t handle,
+                                                     int             m,
+                                                     int             n,
+                                                     const float*    B,
+                                                     int             ldb,
+                                                     hipblasStride   strideB,
+                                                     float* const    A[],
+                                                     int             lda,
+                                                     int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDunpackBatched(hipblasHandle_t handle,
+                                                     int             m,
+                                                     int             n,
+                                                     const double*   B,
+                                                     int             ldb,
+                                                     hipblasStride   strideB,
+                                                     double* const   A[],
+                                                     int             lda,
+                                                     int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunpackBatched(hipblasHandle_t       handle,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* B,
+                                                     int                   ldb,
+                                                     hipblasStride         strideB,
+                                                     hipblasComplex* const A[],
+                                                     int                   lda,
+                                                     int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunpackBatched(hipblasHandle_t             handle,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* B,
+                                                     int                         ldb,
+                                                     hipblasStride               strideB,
+                                                     hipblasDoubleComplex* const A[],
+                                                     int                         lda,
+                                                     int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunpackBatched_v2(hipblasHandle_t   handle,
+                                                        int               m,
+                                                        int               n,
+                                                        const hipComplex* B,
+                                                        int               ldb,
+                                                        hipblasStride     strideB,
+                                                        hipComplex* const A[],
+                                                        int               lda,
+                                                        int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunpackBatched_v2(hipblasHandle_t         handle,
+                                                        int                     m,
+                                                        int                     n,
+                                                        const hipDoubleComplex* B,
+                                                        int                     ldb,
+                                                        hipblasStride           strideB,
+                                                        hipDoubleComplex* const A[],
+                                                        int                     lda,
+                                                        int                     batchCount);
+
+/*! \brief summarize the info array of a batched solver
+    \details
+    hipblasInfoSummary reduces the device array info of batchCount status values, as written by the batched
+    solver functions, to the index of the first nonzero entry and the number of nonzero entries. This replaces
+    copying the whole array to the host and scanning it to check that a batch succeeded.
+
+    The reduction is queued on the stream of the handle and the function returns without synchronizing. info is
+    copied into pinned host memory owned by the handle, and a host function queued on the stream after the copy
+    scans it. That memory is reused by the next call on the handle which stages a transfer, which waits for the
+    scan to finish first.
+
+    With HIPBLAS_POINTER_MODE_DEVICE, firstFailure and failureCount are device pointers, written by copies from the
+    pinned memory of the handle after the scan. With HIPBLAS_POINTER_MODE_HOST, they are host pointers, which the
+    scan writes directly, so they don't need to be pinned. They must stay valid until the stream is synchronized,
+    and can be read after that.
+
+    The staging memory can't be used while the stream is captured into a graph, and HIPBLAS_STATUS_NOT_SUPPORTED is
+    returned then.
+
+    - Supported in rocBLAS backend
+    - Not supported in cuBLAS backend
+
+    @param[in]
+    handle        [hipblasHandle_t]
+                  handle to the hipblas library context queue.
+    @param[in]
+    info          device pointer to the array of batchCount status values.
+    @param[in]
+    batchCount    [int]
+                  number of entries in info, batchCount >= 0.
+    @param[out]
+    firstFailure  device or host pointer to an int.\n
+                  The 0-based index of the first nonzero entry of info, or -1 if all entries are zero.
+    @param[out]
+    failureCount  device or host pointer to an int.\n
+                  The number of nonzero entries of info.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasInfoSummary(hipblasHandle_t handle,
+                                                  const int*      info,
+                                                  int             batchCount,
+                                                  int*            firstFailure,
+                                                  int*            failureCount);
+
 /*! \brief Set hipblasSetAtomicsMode*/
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle,
                                                      hipblasAtomicsMode_t atomics_mode);
@@ -796,6 +1092,302 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
                                                      hipblasAtomicsMode_t* atomics_mode);
 
+/*! \brief Get the name and version of the backend library
+    \details
+    hipblasGetBackendVersionString writes the name and version of the library which hipBLAS calls,
+    for example "rocBLAS 4.3.0" or "cuBLAS 12.4.1", to buf as a null-terminated string.
+
+    @param[out]
+    buf           host pointer to the string.
+    @param[in]
+    len           [size_t]
+                  size of buf in bytes. HIPBLAS_STATUS_INVALID_VALUE is returned if the string
+                  does not fit.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetBackendVersionString(char* buf, size_t len);
+
+/*! \brief Begin a batch of deferred Level 2 calls
+    \details
+    Between hipblasDeferredBegin and hipblasDeferredEnd, calls to hipblasXger, hipblasXgeru, hipblasXgerc
+    and hipblasXtrsv on the handle are queued instead of being launched. Consecutive calls which update the
+    same matrix A (or solve with the same matrix A) are fused: k rank-1 updates become one rank-k gemm and
+    k triangular solves become one trsm with k right-hand sides. A queueable call which can't be fused
+    with the queued ones launches them before it is queued itself.
+
+    The results of the queued calls are only available after hipblasDeferredEnd. Until then, the matrices
+    and vectors of the queued calls must not be read, modified or freed by any other operation, including
+    other hipBLAS calls. Calls made while the pointer mode is HIPBLAS_POINTER_MODE_DEVICE are never
+    queued. hipblasSetStream and hipblasDestroy launch the queued calls.
+
+    Vectors which don't form a strided matrix are gathered into memory owned by the handle. While the
+    stream of the handle is being captured that memory can't grow, and the queued calls which don't fit
+    in it are launched one by one. Running the batch once before capturing it sizes the memory.
+
+    - Supported precisions in rocBLAS : s,d,c,z
+    - Not supported in cuBLAS backend.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDeferredBegin(hipblasHandle_t handle);
+
+/*! \brief End a batch of deferred Level 2 calls
+    \details
+    Launches the calls queued since hipblasDeferredBegin on the stream of the handle, and stops queueing.
+    This function returns the status of the first fused call which failed, or HIPBLAS_STATUS_SUCCESS.
+    The queue is empty on return either way.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDeferredEnd(hipblasHandle_t handle);
+
+/*! \brief Set the split-K factor used by gemmEx with HIPBLAS_GEMM_SPLIT_K
+    \details
+    With algo == HIPBLAS_GEMM_SPLIT_K, hipblasGemmEx and hipblasGemmExWithFlags split the k dimension into splitK
+    chunks. The chunks are computed as one strided batched gemm into partial m by n matrices in the compute precision,
+    which are then reduced into C with alpha and beta applied. This helps problems with few output tiles and a large
+    k dimension, which otherwise leave most of the device idle.
+
+    With splitK == 0 (default), the factor is chosen per call: first from the tuning file named by the environment
+    variable HIPBLAS_SPLIT_K_TUNING_FILE, if set, and otherwise by a heuristic based on the number of output tiles and
+    compute units. Each line of the tuning file holds "m n k splitK"; an entry applies to problems with the same m and
+    n and at least k, and the entry with the largest such k is used. Lines starting with '#' are ignored.
+
+    A factor of 1 means the standard algorithm is used. Split-K is only used when cType matches the compute precision
+    (HIP_R_32F, HIP_R_64F, HIP_C_32F or HIP_C_64F); other calls with HIPBLAS_GEMM_SPLIT_K use the standard algorithm.
+    The partial matrices are placed in device memory owned by the handle, which also keeps the vector of ones the
+    reduction multiplies by. That vector is uploaded once when the memory is allocated, so calls whose partial
+    matrices fit can be captured into a graph.
+
+    - Not supported in cuBLAS backend; HIPBLAS_GEMM_SPLIT_K is passed to cuBLAS as CUBLAS_GEMM_DEFAULT, which chooses
+      split-K internally, and HIPBLAS_STATUS_NOT_SUPPORTED is returned for any splitK other than 0.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    splitK  [int]
+            number of chunks the k dimension is split into, or 0 to choose automatically.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmSplitK(hipblasHandle_t handle, int splitK);
+
+/*! \brief Get the split-K factor set by hipblasSetGemmSplitK*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmSplitK(hipblasHandle_t handle, int* splitK);
+
+/*! \brief Set the number of Strassen-Winograd levels used by gemm
+    \details
+    Every Strassen-Winograd level splits op(A), op(B) and C into 2 by 2 blocks and computes the product from 7 block
+    products and 16 block additions instead of 8 block products, which saves about 12% of the flops per level for
+    large matrices. The block products are computed by the backend gemm and the additions by geam, with temporaries
+    placed in device memory owned by the handle: about (m * k + k * n + 2 * m * n) / 4 elements for the first level
+    and a quarter of that for the second. Rows, columns and parts of k which don't divide evenly into blocks are
+    computed with standard gemm calls.
+
+    The result is not bitwise identical to the standard algorithm. The normwise error bound grows by a constant
+    factor per level, and the error is larger for matrices whose entries vary widely in magnitude.
+
+    levels applies to hipblasDgemm, hipblasZgemm and to hipblasGemmEx, hipblasGemmEx_v2, hipblasGemmExWithFlags and
+    hipblasGemmExWithFlags_v2 with algo == HIPBLAS_GEMM_STRASSEN, when aType, bType, cType and the compute type are
+    all double (HIP_R_64F) or all double complex (HIP_C_64F):
+
+    - levels == 0 (default): hipblasDgemm and hipblasZgemm use the standard algorithm, gemmEx with
+      HIPBLAS_GEMM_STRASSEN chooses the number of levels like levels == -1.
+    - levels == -1: the number of levels is chosen by size, one level once m, n and k are all at least 16384 and two
+      levels once they are all at least 32768. Smaller problems use the standard algorithm.
+    - levels == 1 or 2: the given number of levels, fewer if a dimension is smaller than 2^levels.
+
+    alpha == 0, k == 0 and HIPBLAS_POINTER_MODE_DEVICE use the standard algorithm, so alpha and beta are never read
+    back from device memory.
+
+    - Not supported in cuBLAS backend; HIPBLAS_GEMM_STRASSEN is passed to cuBLAS as CUBLAS_GEMM_DEFAULT and
+      HIPBLAS_STATUS_NOT_SUPPORTED is returned for any levels other than 0.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    levels  [int]
+            number of Strassen-Winograd levels, between -1 and 2.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmStrassenLevels(hipblasHandle_t handle, int levels);
+
+/*! \brief Get the number of Strassen-Winograd levels set by hipblasSetGemmStrassenLevels*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmStrassenLevels(hipblasHandle_t handle, int* levels);
+
+/*! \brief Set hipblasGemmOrderMode
+    \details
+    C = op(A) * op(B) is the same product as C^T = op(B)^T * op(A)^T, and which of the two runs faster depends on
+    the shape, the operations and the device. A caller which can store C either way opts into the transposed layout
+    with HIPBLAS_GEMM_ORDER_TRANSPOSED_C: C then holds C^T, an n by m matrix with leading dimension ldc >= max(1, n),
+    and the call computes C^T = alpha * op(B)^T * op(A)^T + beta * C^T with the operands of a single backend gemm
+    swapped. m, n, k, A, lda, B and ldb keep their meaning. hipblasGetGemmOrderHint tells for which problems the
+    transposed layout is faster on the device.
+
+    The mode applies to hipblasSgemm, hipblasDgemm, hipblasCgemm, hipblasZgemm (and their _v2 variants) and to
+    hipblasGemmEx, hipblasGemmEx_v2, hipblasGemmExWithFlags and hipblasGemmExWithFlags_v2 with any algo. Other gemm
+    functions, including the batched and 64-bit ones, ignore it. Complex problems with HIPBLAS_OP_C for either operand
+    return HIPBLAS_STATUS_NOT_SUPPORTED in HIPBLAS_GEMM_ORDER_TRANSPOSED_C mode, as the transpose of a conjugate
+    transposed matrix isn't a gemm operation.
+
+    - Not supported in cuBLAS backend; HIPBLAS_STATUS_NOT_SUPPORTED is returned for any mode other than
+      HIPBLAS_GEMM_ORDER_DEFAULT.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    mode    [hipblasGemmOrderMode_t]
+            order mode to use for subsequent gemm calls on this handle.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmOrderMode(hipblasHandle_t        handle,
+                                                       hipblasGemmOrderMode_t mode);
+
+/*! \brief Get hipblasGemmOrderMode*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmOrderMode(hipblasHandle_t         handle,
+                                                       hipblasGemmOrderMode_t* mode);
+
+/*! \brief Look up the faster layout of C for a gemm problem in the order table
+    \details
+    Returns HIPBLAS_GEMM_ORDER_TRANSPOSED_C in mode if the order table has an entry for the problem, and
+    HIPBLAS_GEMM_ORDER_DEFAULT otherwise. A caller that follows the hint stores C transposed and computes the problem
+    with the handle in that mode, see hipblasSetGemmOrderMode.
+
+    The table is read from the file named by the environment variable HIPBLAS_GEMM_ORDER_TABLE_FILE. Each line holds
+    "arch precision transA transB m n k", for example "gfx90a d N T 4096 1024 8192", where arch is the device
+    architecture without target features and precision is one of s, d, c or z. An entry applies to problems on
+    devices of that architecture with the same precision and operations, and with m, n and k in the same power of
+    two ranges [2^i, 2^(i+1)) as the entry. Lines starting with '#' are ignored. Entries are appended to the file by
+    hipblas-bench with --gemm_order -1, for problems where the transposed layout was faster.
+
+    - Not supported in cuBLAS backend; mode is always HIPBLAS_GEMM_ORDER_DEFAULT.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    type    [hipDataType]
+            type of A, B and C: HIP_R_32F, HIP_R_64F, HIP_C_32F or HIP_C_64F. Other types get
+            HIPBLAS_GEMM_ORDER_DEFAULT.
+    @param[in]
+    transA, transB  [hipblasOperation_t]
+            operations of the problem.
+    @param[in]
+    m, n, k [int]
+            dimensions of the problem.
+    @param[out]
+    mode    [hipblasGemmOrderMode_t*]
+            layout of C which the table prefers.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmOrderHint(hipblasHandle_t         handle,
+                                                       hipDataType             type,
+                                                       hipblasOperation_t      transA,
+                                                       hipblasOperation_t      transB,
+                                                       int                     m,
+                                                       int                     n,
+                                                       int                     k,
+                                                       hipblasGemmOrderMode_t* mode);
+
+/*! \brief Set hipblasQrAlgo
+    \details
+    With HIPBLAS_QR_ALGO_TSQR, hipblasSgeqrf, hipblasDgeqrf, hipblasCgeqrf and hipblasZgeqrf (and their _v2
+    variants) factor an m-by-n matrix A with m >= 16 * n as a tall-skinny QR (TSQR). The rows of A are split into
+    up to 256 blocks of at least 8 * n rows, which are factored by a single strided batched geqrf. The stacked R
+    factors of the blocks are factored in the same way until one block is left, whose R is the R of A. The
+    Householder vectors of A are then reconstructed from the explicit Q, so A and tau are overwritten as with
+    HIPBLAS_QR_ALGO_DEFAULT, up to rounding.
+
+    hipblasSgels, hipblasDgels, hipblasCgels and hipblasZgels (and their _v2 variants) with trans == HIPBLAS_OP_N
+    factor [A B] in the same way for such matrices, which applies Q^H to B level by level without forming Q.
+    A is left unchanged, and only the first n rows of B, which hold the solution, are written: rows n to m - 1
+    do not hold the rest of Q^H B as with HIPBLAS_QR_ALGO_DEFAULT.
+
+    The factorization uses device memory owned by the handle. geqrf synchronizes the stream of the handle once,
+    to reconstruct the Householder vectors on the host, and gels once, to check the diagonal of R for info.
+    Batched and strided batched functions, and matrices with m < 16 * n, use the factorization of rocSOLVER.
+
+    - Not supported in cuBLAS backend; HIPBLAS_STATUS_NOT_SUPPORTED is returned for any algorithm other than
+      HIPBLAS_QR_ALGO_DEFAULT.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    algo    [hipblasQrAlgo_t]
+            algorithm to use for subsequent geqrf and gels calls on this handle.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetQrAlgo(hipblasHandle_t handle, hipblasQrAlgo_t algo);
+
+/*! \brief Get hipblasQrAlgo*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetQrAlgo(hipblasHandle_t handle, hipblasQrAlgo_t* algo);
+
+/*! \brief Set the number of slices used by the emulated gemmEx compute type
+    \details
+    With computeType == HIPBLAS_COMPUTE_32F_EMULATED_16BF and aType, bType and cType == HIP_R_32F,
+    hipblasGemmEx_v2 and hipblasGemmExWithFlags_v2 split op(A) and op(B) into bfloat16 slices and compute the
+    product from the products of the slices.
+
+    Every element is truncated to a bfloat16, which is subtracted from it, and the difference is split the same
+    way for the next slice. Three slices hold all 24 bits of a float. The slice products are bfloat16 gemms with
+    float results, accumulated into C. Only the products of slices i and j with i + j < slices are computed, that
+    is slices * (slices + 1) / 2 gemms. More slices give a more accurate result at the cost of more gemms. Default
+    is 2 slices (bf16x3).
+
+    The operands are split on the device. Their float copies and slices are placed in device memory owned by the
+    handle, (4 + 2 * slices) * (m * k + k * n) bytes. Calls with k == 0, alpha == 0 in host pointer mode, or
+    m * k or k * n larger than INT_MAX are computed in float. Infinite or NaN entries of A or B give NaN in the
+    rows and columns of C they contribute to.
+
+    - Not supported in cuBLAS backend.
+
+    @param[in]
+    handle  [hipblasHandle_t]
+            handle to the hipblas library context queue.
+    @param[in]
+    slices  [int]
+            number of slices each operand is split into, between 1 and 3, or 0 for the default.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmEmulationSlices(hipblasHandle_t handle, int slices);
+
+/*! \brief Get the number of slices set by hipblasSetGemmEmulationSlices*/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmEmulationSlices(hipblasHandle_t handle, int* slices);
+
+/*! \brief Load and initialize the kernels of a list of problems ahead of their first call
+    \details
+    The first call of a gemm of a given shape and type in a process loads the code objects of its
+    kernels and initializes them, which makes it much slower than later calls. hipblasWarmup does
+    this work ahead of time: the code objects of the backend are loaded once per process, and then
+    every problem of descriptors is run once on zero filled matrices, with alpha = 1 and beta = 0.
+    No user data is read or written. The matrices are allocated by the call and freed before it
+    returns, at the size of the largest problem.
+
+    The problems are run with the current settings of the handle, such as the split-K factor and
+    the gemm order mode, so they warm up the kernels later calls on the handle use. The stream of
+    the handle is synchronized before the first problem and after every problem, and the time and
+    status of every problem are written to its descriptor. The time of the first problem does not
+    include loading the code objects.
+
+    - Not supported in cuBLAS backend.
+
+    @param[in]
+    handle      [hipblasHandle_t]
+                handle to the hipblas library context queue.
+    @param[inout]
+    descriptors [hipblasWarmupDescriptor_t*]
+                array of count problems. time_us and status are written for every problem.
+    @param[in]
+    count       [int]
+                number of problems.
+
+    \retval HIPBLAS_STATUS_SUCCESS if every problem was warmed up, otherwise the status of the
+            first problem which failed. The other problems are warmed up all the same.
+     ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasWarmup(hipblasHandle_t            handle,
+                                             hipblasWarmupDescriptor_t* descriptors,
+                                             int                        count);
+
 /*
  * ===========================================================================
  *    level 1 BLAS
@@ -20092,6 +20684,641 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched_v2_64(hipblasHandle_t
                                                                 int64_t                 batchCount);
 //! @}
 
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmRealB and gemmRealA perform one of the matrix-matrix operations
+
+        C = alpha*op( A )*op( B ) + beta*C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are complex scalars, and A, B and C are matrices, with
+    op( A ) an m by k matrix, op( B ) a k by n matrix and C an m by n complex matrix.
+    For gemmRealB, B is real and A is complex. For gemmRealA, A is real and B is complex.
+
+    The result is the same as that of gemm with the real matrix promoted to complex, but the
+    real matrix is not promoted. An interleaved complex matrix is viewed as a real matrix with
+    twice as many rows, so that the product is computed by a single real gemm with half of the
+    flops and half of the memory traffic of the complex gemm. This applies when:
+
+        - gemmRealB: transA == HIPBLAS_OP_N. If alpha and beta are real and the pointer mode is
+          HIPBLAS_POINTER_MODE_HOST, C is updated by the real gemm directly. Otherwise the real
+          gemm writes op( A )*op( B ) to a workspace owned by the handle and C is updated by geam.
+        - gemmRealA: transB == HIPBLAS_OP_T or HIPBLAS_OP_C. The real gemm writes
+          (op( A )*op( B ))**T to a workspace owned by the handle and C is updated by geam.
+
+    For other operations the real matrix is promoted to complex in the workspace and
+    a complex gemm is used.
+
+    - Supported precisions in rocBLAS : c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [int]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the complex scalar alpha.
+    @param[in]
+    AP         device pointer storing matrix A, real for gemmRealA.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    BP         device pointer storing matrix B, real for gemmRealB.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    beta      device pointer or host pointer specifying the complex scalar beta.
+    @param[in, out]
+    CP         device pointer storing matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealB(hipblasHandle_t       handle,
+                                                 hipblasOperation_t    transA,
+                                                 hipblasOperation_t    transB,
+                                                 int                   m,
+                                                 int                   n,
+                                                 int                   k,
+                                                 const hipblasComplex* alpha,
+                                                 const hipblasComplex* AP,
+                                                 int                   lda,
+                                                 const float*          BP,
+                                                 int                   ldb,
+                                                 const hipblasComplex* beta,
+                                                 hipblasComplex*       CP,
+                                                 int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmRealB(hipblasHandle_t             handle,
+                                                 hipblasOperation_t          transA,
+                                                 hipblasOperation_t          transB,
+                                                 int                         m,
+                                                 int                         n,
+                                                 int                         k,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const hipblasDoubleComplex* AP,
+                                                 int                         lda,
+                                                 const double*               BP,
+                                                 int                         ldb,
+                                                 const hipblasDoubleComplex* beta,
+                                                 hipblasDoubleComplex*       CP,
+                                                 int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealA(hipblasHandle_t       handle,
+                                                 hipblasOperation_t    transA,
+                                                 hipblasOperation_t    transB,
+                                                 int                   m,
+                                                 int                   n,
+                                                 int                   k,
+                                                 const hipblasComplex* alpha,
+                                                 const float*          AP,
+                                                 int                   lda,
+                                                 const hipblasComplex* BP,
+                                                 int                   ldb,
+                                                 const hipblasComplex* beta,
+                                                 hipblasComplex*       CP,
+                                                 int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmRealA(hipblasHandle_t             handle,
+                                                 hipblasOperation_t          transA,
+                                                 hipblasOperation_t          transB,
+                                                 int                         m,
+                                                 int                         n,
+                                                 int                         k,
+                                                 const hipblasDoubleComplex* alpha,
+                                                 const double*               AP,
+                                                 int                         lda,
+                                                 const hipblasDoubleComplex* BP,
+                                                 int                         ldb,
+                                                 const hipblasDoubleComplex* beta,
+                                                 hipblasDoubleComplex*       CP,
+                                                 int                         ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealB_v2(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const hipComplex*  alpha,
+                                                    const hipComplex*  AP,
+                                                    int                lda,
+                                                    const float*       BP,
+                                                    int                ldb,
+                                                    const hipComplex*  beta,
+                                                    hipComplex*        CP,
+                                                    int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmRealB_v2(hipblasHandle_t         handle,
+                                                    hipblasOperation_t      transA,
+                                                    hipblasOperation_t      transB,
+                                                    int                     m,
+                                                    int                     n,
+                                                    int                     k,
+                                                    const hipDoubleComplex* alpha,
+                                                    const hipDoubleComplex* AP,
+                                                    int                     lda,
+                                                    const double*           BP,
+                                                    int                     ldb,
+                                                    const hipDoubleComplex* beta,
+                                                    hipDoubleComplex*       CP,
+                                                    int                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealA_v2(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const hipComplex*  alpha,
+                                                    const float*       AP,
+                                                    int                lda,
+                                                    const hipComplex*  BP,
+                                                    int                ldb,
+                                                    const hipComplex*  beta,
+                                                    hipComplex*        CP,
+                                                    int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmRealA_v2(hipblasHandle_t         handle,
+                                                    hipblasOperation_t      transA,
+                                                    hipblasOperation_t      transB,
+                                                    int                     m,
+                                                    int                     n,
+                                                    int                     k,
+                                                    const hipDoubleComplex* alpha,
+                                                    const double*           AP,
+                                                    int                     lda,
+                                                    const hipDoubleComplex* BP,
+                                                    int                     ldb,
+                                                    const hipDoubleComplex* beta,
+                                                    hipDoubleComplex*       CP,
+                                                    int                     ldc);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmRealBBatched and gemmRealABatched perform one of the batched matrix-matrix operations
+
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are complex scalars, and A, B and C are batched matrices, with
+    op( A ) an m by k by batchCount batched matrix, op( B ) a k by n by batchCount batched matrix
+    and C an m by n by batchCount complex batched matrix.
+    For gemmRealBBatched, B is real and A is complex. For gemmRealABatched, A is real and
+    B is complex.
+
+    gemmRealBBatched with transA == HIPBLAS_OP_N, real alpha and beta and
+    HIPBLAS_POINTER_MODE_HOST is computed by a single real batched gemm, see gemmRealB.
+    Otherwise all problems are computed together as by gemmRealB or gemmRealA, using device
+    memory owned by the handle. The arrays of pointers are not copied to the host and the stream
+    is not synchronized, but the functions return HIPBLAS_STATUS_NOT_SUPPORTED while the stream
+    is being captured.
+
+    - Supported precisions in rocBLAS : c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [int]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the complex scalar alpha.
+    @param[in]
+    AP         device array of device pointers storing each matrix A_i, real for gemmRealABatched.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    BP         device array of device pointers storing each matrix B_i, real for gemmRealBBatched.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    beta      device pointer or host pointer specifying the complex scalar beta.
+    @param[in, out]
+    CP         device array of device pointers storing each matrix C_i.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealBBatched(hipblasHandle_t             handle,
+                                                        hipblasOperation_t          transA,
+                                                        hipblasOperation_t          transB,
+                                                        int                         m,
+                                                        int                         n,
+                                                        int                         k,
+                                                        const hipblasComplex*       alpha,
+                                                        const hipblasComplex* const AP[],
+                                                        int                         lda,
+                                                        const float* const          BP[],
+                                                        int                         ldb,
+                                                        const hipblasComplex*       beta,
+                                                        hipblasComplex* const       CP[],
+                                                        int                         ldc,
+                                                        int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealBBatched(hipblasHandle_t                   handle,
+                             hipblasOperation_t                transA,
+                             hipblasOperation_t                transB,
+                             int                               m,
+                             int                               n,
+                             int                               k,
+                             const hipblasDoubleComplex*       alpha,
+                             const hipblasDoubleComplex* const AP[],
+                             int                               lda,
+                             const double* const               BP[],
+                             int                               ldb,
+                             const hipblasDoubleComplex*       beta,
+                             hipblasDoubleComplex* const       CP[],
+                             int                               ldc,
+                             int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealABatched(hipblasHandle_t             handle,
+                                                        hipblasOperation_t          transA,
+                                                        hipblasOperation_t          transB,
+                                                        int                         m,
+                                                        int                         n,
+                                                        int                         k,
+                                                        const hipblasComplex*       alpha,
+                                                        const float* const          AP[],
+                                                        int                         lda,
+                                                        const hipblasComplex* const BP[],
+                                                        int                         ldb,
+                                                        const hipblasComplex*       beta,
+                                                        hipblasComplex* const       CP[],
+                                                        int                         ldc,
+                                                        int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealABatched(hipblasHandle_t                   handle,
+                             hipblasOperation_t                transA,
+                             hipblasOperation_t                transB,
+                             int                               m,
+                             int                               n,
+                             int                               k,
+                             const hipblasDoubleComplex*       alpha,
+                             const double* const               AP[],
+                             int                               lda,
+                             const hipblasDoubleComplex* const BP[],
+                             int                               ldb,
+                             const hipblasDoubleComplex*       beta,
+                             hipblasDoubleComplex* const       CP[],
+                             int                               ldc,
+                             int                               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealBBatched_v2(hipblasHandle_t         handle,
+                                                           hipblasOperation_t      transA,
+                                                           hipblasOperation_t      transB,
+                                                           int                     m,
+                                                           int                     n,
+                                                           int                     k,
+                                                           const hipComplex*       alpha,
+                                                           const hipComplex* const AP[],
+                                                           int                     lda,
+                                                           const float* const      BP[],
+                                                           int                     ldb,
+                                                           const hipComplex*       beta,
+                                                           hipComplex* const       CP[],
+                                                           int                     ldc,
+                                                           int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealBBatched_v2(hipblasHandle_t               handle,
+                                hipblasOperation_t            transA,
+                                hipblasOperation_t            transB,
+                                int                           m,
+                                int                           n,
+                                int                           k,
+                                const hipDoubleComplex*       alpha,
+                                const hipDoubleComplex* const AP[],
+                                int                           lda,
+                                const double* const           BP[],
+                                int                           ldb,
+                                const hipDoubleComplex*       beta,
+                                hipDoubleComplex* const       CP[],
+                                int                           ldc,
+                                int                           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealABatched_v2(hipblasHandle_t         handle,
+                                                           hipblasOperation_t      transA,
+                                                           hipblasOperation_t      transB,
+                                                           int                     m,
+                                                           int                     n,
+                                                           int                     k,
+                                                           const hipComplex*       alpha,
+                                                           const float* const      AP[],
+                                                           int                     lda,
+                                                           const hipComplex* const BP[],
+                                                           int                     ldb,
+                                                           const hipComplex*       beta,
+                                                           hipComplex* const       CP[],
+                                                           int                     ldc,
+                                                           int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealABatched_v2(hipblasHandle_t               handle,
+                                hipblasOperation_t            transA,
+                                hipblasOperation_t            transB,
+                                int                           m,
+                                int                           n,
+                                int                           k,
+                                const hipDoubleComplex*       alpha,
+                                const double* const           AP[],
+                                int                           lda,
+                                const hipDoubleComplex* const BP[],
+                                int                           ldb,
+                                const hipDoubleComplex*       beta,
+                                hipDoubleComplex* const       CP[],
+                                int                           ldc,
+                                int                           batchCount);
+//! @}
+
+/*! @{
+    \brief BLAS Level 3 API
+
+    \details
+    gemmRealBStridedBatched and gemmRealAStridedBatched perform one of the strided batched
+    matrix-matrix operations
+
+        C_i = alpha*op( A_i )*op( B_i ) + beta*C_i, for i = 1, ..., batchCount,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are complex scalars, and A, B and C are strided batched matrices, with
+    op( A ) an m by k by batchCount strided_batched matrix, op( B ) a k by n by batchCount
+    strided_batched matrix and C an m by n by batchCount complex strided_batched matrix.
+    For gemmRealBStridedBatched, B is real and A is complex. For gemmRealAStridedBatched,
+    A is real and B is complex. The operations are computed as described for gemmRealB and
+    gemmRealA, with one real strided batched gemm for the whole batch.
+
+    - Supported precisions in rocBLAS : c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A )
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B )
+    @param[in]
+    m         [int]
+              number or rows of matrices op( A ) and C
+    @param[in]
+    n         [int]
+              number of columns of matrices op( B ) and C
+    @param[in]
+    k         [int]
+              number of columns of matrix op( A ) and number of rows of matrix op( B )
+    @param[in]
+    alpha     device pointer or host pointer specifying the complex scalar alpha.
+    @param[in]
+    AP         device pointer pointing to the first matrix A_1, real for gemmRealAStridedBatched.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA  [hipblasStride]
+              stride from the start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    BP         device pointer pointing to the first matrix B_1, real for gemmRealBStridedBatched.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB  [hipblasStride]
+              stride from the start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      device pointer or host pointer specifying the complex scalar beta.
+    @param[in, out]
+    CP         device pointer pointing to the first matrix C_1.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of each C_i.
+    @param[in]
+    strideC  [hipblasStride]
+              stride from the start of one C_i matrix to the next C_(i + 1).
+    @param[in]
+    batchCount
+              [int]
+              number of gemm operations in the batch
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealBStridedBatched(hipblasHandle_t       handle,
+                                                               hipblasOperation_t    transA,
+                                                               hipblasOperation_t    transB,
+                                                               int                   m,
+                                                               int                   n,
+                                                               int                   k,
+                                                               const hipblasComplex* alpha,
+                                                               const hipblasComplex* AP,
+                                                               int                   lda,
+                                                               hipblasStride         strideA,
+                                                               const float*          BP,
+                                                               int                   ldb,
+                                                               hipblasStride         strideB,
+                                                               const hipblasComplex* beta,
+                                                               hipblasComplex*       CP,
+                                                               int                   ldc,
+                                                               hipblasStride         strideC,
+                                                               int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealBStridedBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int                         m,
+                                    int                         n,
+                                    int                         k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* AP,
+                                    int                         lda,
+                                    hipblasStride               strideA,
+                                    const double*               BP,
+                                    int                         ldb,
+                                    hipblasStride               strideB,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       CP,
+                                    int                         ldc,
+                                    hipblasStride               strideC,
+                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealAStridedBatched(hipblasHandle_t       handle,
+                                                               hipblasOperation_t    transA,
+                                                               hipblasOperation_t    transB,
+                                                               int                   m,
+                                                               int                   n,
+                                                               int                   k,
+                                                               const hipblasComplex* alpha,
+                                                               const float*          AP,
+                                                               int                   lda,
+                                                               hipblasStride         strideA,
+                                                               const hipblasComplex* BP,
+                                                               int                   ldb,
+                                                               hipblasStride         strideB,
+                                                               const hipblasComplex* beta,
+                                                               hipblasComplex*       CP,
+                                                               int                   ldc,
+                                                               hipblasStride         strideC,
+                                                               int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealAStridedBatched(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    int                         m,
+                                    int                         n,
+                                    int                         k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const double*               AP,
+                                    int                         lda,
+                                    hipblasStride               strideA,
+                                    const hipblasDoubleComplex* BP,
+                                    int                         ldb,
+                                    hipblasStride               strideB,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       CP,
+                                    int                         ldc,
+                                    hipblasStride               strideC,
+                                    int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealBStridedBatched_v2(hipblasHandle_t    handle,
+                                                                  hipblasOperation_t transA,
+                                                                  hipblasOperation_t transB,
+                                                                  int                m,
+                                                                  int                n,
+                                                                  int                k,
+                                                                  const hipComplex*  alpha,
+                                                                  const hipComplex*  AP,
+                                                                  int                lda,
+                                                                  hipblasStride      strideA,
+                                                                  const float*       BP,
+                                                                  int                ldb,
+                                                                  hipblasStride      strideB,
+                                                                  const hipComplex*  beta,
+                                                                  hipComplex*        CP,
+                                                                  int                ldc,
+                                                                  hipblasStride      strideC,
+                                                                  int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealBStridedBatched_v2(hipblasHandle_t         handle,
+                                       hipblasOperation_t      transA,
+                                       hipblasOperation_t      transB,
+                                       int                     m,
+                                       int                     n,
+                                       int                     k,
+                                       const hipDoubleComplex* alpha,
+                                       const hipDoubleComplex* AP,
+                                       int                     lda,
+                                       hipblasStride           strideA,
+                                       const double*           BP,
+                                       int                     ldb,
+                                       hipblasStride           strideB,
+                                       const hipDoubleComplex* beta,
+                                       hipDoubleComplex*       CP,
+                                       int                     ldc,
+                                       hipblasStride           strideC,
+                                       int                     batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmRealAStridedBatched_v2(hipblasHandle_t    handle,
+                                                                  hipblasOperation_t transA,
+                                                                  hipblasOperation_t transB,
+                                                                  int                m,
+                                                                  int                n,
+                                                                  int                k,
+                                                                  const hipComplex*  alpha,
+                                                                  const float*       AP,
+                                                                  int                lda,
+                                                                  hipblasStride      strideA,
+                                                                  const hipComplex*  BP,
+                                                                  int                ldb,
+                                                                  hipblasStride      strideB,
+                                                                  const hipComplex*  beta,
+                                                                  hipComplex*        CP,
+                                                                  int                ldc,
+                                                                  hipblasStride      strideC,
+                                                                  int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgemmRealAStridedBatched_v2(hipblasHandle_t         handle,
+                                       hipblasOperation_t      transA,
+                                       hipblasOperation_t      transB,
+                                       int                     m,
+                                       int                     n,
+                                       int                     k,
+                                       const hipDoubleComplex* alpha,
+                                       const double*           AP,
+                                       int                     lda,
+                                       hipblasStride           strideA,
+                                       const hipDoubleComplex* BP,
+                                       int                     ldb,
+                                       hipblasStride           strideB,
+                                       const hipDoubleComplex* beta,
+                                       hipDoubleComplex*       CP,
+                                       int                     ldc,
+                                       hipblasStride           strideC,
+                                       int                     batchCount);
+//! @}
+
 /*! @{
     \brief BLAS Level 3 API
 
@@ -29542,6 +30769,358 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfStridedBatched_v2(hipblasHandle_t
                                                               const int           batchCount);
 //! @}
 
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrfRefactor computes the LU factorization of a general n-by-n matrix A
+    reusing the pivot sequence of an earlier factorization, as returned by
+    \ref hipblasSgetrf "getrf" for a matrix with the same sparsity or numerical
+    structure.
+
+    The row interchanges in ipiv are applied to A and the permuted matrix is
+    factorized without pivoting:
+
+    \f[
+        A = PLU
+    \f]
+
+    where P is the permutation matrix given by ipiv. Without the search for pivots the
+    factorization can be unstable, so the pivot growth is checked against maxGrowth.
+    The growth is estimated as
+
+    \f[
+        \frac{\|UX\|_F}{\|LUX\|_F} \approx \frac{\|U\|_F}{\|A\|_F}
+    \f]
+
+    for a fixed n-by-min(n,8) matrix X with entries of magnitude one. If the growth
+    exceeds maxGrowth, info is set to n + 1 and the caller should fall back to
+    \ref hipblasSgetrf "getrf". The check synchronizes the stream of the handle.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns and rows of the matrix A.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the n-by-n matrix A to be factored.
+              On exit, the factors L and U from the factorization.
+              The unit diagonal elements of L are not stored.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of A.
+    @param[in]
+    ipiv      pointer to int. Array on the GPU of dimension n.\n
+              The pivot indices of an earlier factorization, as returned by \ref hipblasSgetrf "getrf".
+              Elements of ipiv are 1-based indices.
+    @param[in]
+    maxGrowth real type. maxGrowth >= 0.\n
+              The largest accepted pivot growth. If maxGrowth = 0, the growth is not checked.
+    @param[out]
+    info      pointer to a int on the GPU.\n
+              If info = 0, successful exit.
+              If info = j > 0 and j <= n, U is singular. U[j,j] is the first zero pivot.
+              If info = n + 1, the pivot growth exceeds maxGrowth.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfRefactor(hipblasHandle_t handle,
+                                                     const int       n,
+                                                     float*          A,
+                                                     const int       lda,
+                                                     const int*      ipiv,
+                                                     const float     maxGrowth,
+                                                     int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfRefactor(hipblasHandle_t handle,
+                                                     const int       n,
+                                                     double*         A,
+                                                     const int       lda,
+                                                     const int*      ipiv,
+                                                     const double    maxGrowth,
+                                                     int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRefactor(hipblasHandle_t handle,
+                                                     const int       n,
+                                                     hipblasComplex* A,
+                                                     const int       lda,
+                                                     const int*      ipiv,
+                                                     const float     maxGrowth,
+                                                     int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRefactor(hipblasHandle_t       handle,
+                                                     const int             n,
+                                                     hipblasDoubleComplex* A,
+                                                     const int             lda,
+                                                     const int*            ipiv,
+                                                     const double          maxGrowth,
+                                                     int*                  info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRefactor_v2(hipblasHandle_t handle,
+                                                        const int       n,
+                                                        hipComplex*     A,
+                                                        const int       lda,
+                                                        const int*      ipiv,
+                                                        const float     maxGrowth,
+                                                        int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRefactor_v2(hipblasHandle_t   handle,
+                                                        const int         n,
+                                                        hipDoubleComplex* A,
+                                                        const int         lda,
+                                                        const int*        ipiv,
+                                                        const double      maxGrowth,
+                                                        int*              info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrfRefactorBatched computes the LU factorization of a batch of general
+    n-by-n matrices reusing the pivot sequences of earlier factorizations, as returned by
+    \ref hipblasSgetrfBatched "getrfBatched". See \ref hipblasSgetrfRefactor "getrfRefactor".
+
+    The factorization of matrix \f$A_i\f$ in the batch has the form:
+
+    \f[
+        A_i = P_iL_iU_i
+    \f]
+
+    where \f$P_i\f$ is the permutation matrix given by ipiv_i. The pivot growth of each
+    matrix is checked on its own, so the caller only has to factorize again the
+    matrices with info[i] = n + 1.
+
+    rocSOLVER has no batched laswp, so the row interchanges are applied to one matrix after the
+    other. The arrays of pointers are copied to the host first, which synchronizes the stream.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns and rows of all matrices A_i in the batch.
+    @param[inout]
+    A         array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the n-by-n matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorizations.
+              The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    ipiv      pointer to int. Array on the GPU.\n
+              Contains the vectors of pivot indices ipiv_i (corresponding to A_i)
+              as returned by \ref hipblasSgetrfBatched "getrfBatched".
+              Dimension of ipiv_i is n.
+              Elements of ipiv_i are 1-based indices.
+    @param[in]
+    maxGrowth real type. maxGrowth >= 0.\n
+              The largest accepted pivot growth. If maxGrowth = 0, the growth is not checked.
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for factorization of A_i.
+              If info[i] = j > 0 and j <= n, U_i is singular. U_i[j,j] is the first zero pivot.
+              If info[i] = n + 1, the pivot growth of A_i exceeds maxGrowth.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfRefactorBatched(hipblasHandle_t handle,
+                                                            const int       n,
+                                                            float* const    A[],
+                                                            const int       lda,
+                                                            const int*      ipiv,
+                                                            const float     maxGrowth,
+                                                            int*            info,
+                                                            const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfRefactorBatched(hipblasHandle_t handle,
+                                                            const int       n,
+                                                            double* const   A[],
+                                                            const int       lda,
+                                                            const int*      ipiv,
+                                                            const double    maxGrowth,
+                                                            int*            info,
+                                                            const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRefactorBatched(hipblasHandle_t       handle,
+                                                            const int             n,
+                                                            hipblasComplex* const A[],
+                                                            const int             lda,
+                                                            const int*            ipiv,
+                                                            const float           maxGrowth,
+                                                            int*                  info,
+                                                            const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRefactorBatched(hipblasHandle_t             handle,
+                                                            const int                   n,
+                                                            hipblasDoubleComplex* const A[],
+                                                            const int                   lda,
+                                                            const int*                  ipiv,
+                                                            const double                maxGrowth,
+                                                            int*                        info,
+                                                            const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRefactorBatched_v2(hipblasHandle_t   handle,
+                                                               const int         n,
+                                                               hipComplex* const A[],
+                                                               const int         lda,
+                                                               const int*        ipiv,
+                                                               const float       maxGrowth,
+                                                               int*              info,
+                                                               const int         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfRefactorBatched_v2(hipblasHandle_t         handle,
+                                                               const int               n,
+                                                               hipDoubleComplex* const A[],
+                                                               const int               lda,
+                                                               const int*              ipiv,
+                                                               const double            maxGrowth,
+                                                               int*                    info,
+                                                               const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    getrfRefactorStridedBatched computes the LU factorization of a batch of general
+    n-by-n matrices reusing the pivot sequences of earlier factorizations, as returned by
+    \ref hipblasSgetrfStridedBatched "getrfStridedBatched". See \ref hipblasSgetrfRefactor "getrfRefactor".
+
+    The factorization of matrix \f$A_i\f$ in the batch has the form:
+
+    \f[
+        A_i = P_iL_iU_i
+    \f]
+
+    where \f$P_i\f$ is the permutation matrix given by ipiv_i. The pivot growth of each
+    matrix is checked on its own, so the caller only has to factorize again the
+    matrices with info[i] = n + 1.
+
+    rocSOLVER has no batched laswp, so the row interchanges are applied to one matrix after the
+    other.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The number of columns and rows of all matrices A_i in the batch.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the n-by-n matrices A_i to be factored.
+              On exit, the factors L_i and U_i from the factorization.
+              The unit diagonal elements of L_i are not stored.
+    @param[in]
+    lda       int. lda >= n.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+              There is no restriction for the value of strideA. Normal use case is strideA >= lda*n
+    @param[in]
+    ipiv      pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+              Contains the vectors of pivots indices ipiv_i (corresponding to A_i)
+              as returned by \ref hipblasSgetrfStridedBatched "getrfStridedBatched".
+              Dimension of ipiv_i is n.
+              Elements of ipiv_i are 1-based indices.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+              There is no restriction for the value of strideP. Normal use case is strideP >= n.
+    @param[in]
+    maxGrowth real type. maxGrowth >= 0.\n
+              The largest accepted pivot growth. If maxGrowth = 0, the growth is not checked.
+    @param[out]
+    info      pointer to int. Array of batchCount integers on the GPU.\n
+              If info[i] = 0, successful exit for factorization of A_i.
+              If info[i] = j > 0 and j <= n, U_i is singular. U_i[j,j] is the first zero pivot.
+              If info[i] = n + 1, the pivot growth of A_i exceeds maxGrowth.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                                   const int           n,
+                                                                   float*              A,
+                                                                   const int           lda,
+                                                                   const hipblasStride strideA,
+                                                                   const int*          ipiv,
+                                                                   const hipblasStride strideP,
+                                                                   const float         maxGrowth,
+                                                                   int*                info,
+                                                                   const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                                   const int           n,
+                                                                   double*             A,
+                                                                   const int           lda,
+                                                                   const hipblasStride strideA,
+                                                                   const int*          ipiv,
+                                                                   const hipblasStride strideP,
+                                                                   const double        maxGrowth,
+                                                                   int*                info,
+                                                                   const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                                   const int           n,
+                                                                   hipblasComplex*     A,
+                                                                   const int           lda,
+                                                                   const hipblasStride strideA,
+                                                                   const int*          ipiv,
+                                                                   const hipblasStride strideP,
+                                                                   const float         maxGrowth,
+                                                                   int*                info,
+                                                                   const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgetrfRefactorStridedBatched(hipblasHandle_t       handle,
+                                        const int             n,
+                                        hipblasDoubleComplex* A,
+                                        const int             lda,
+                                        const hipblasStride   strideA,
+                                        const int*            ipiv,
+                                        const hipblasStride   strideP,
+                                        const double          maxGrowth,
+                                        int*                  info,
+                                        const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCgetrfRefactorStridedBatched_v2(hipblasHandle_t     handle,
+                                           const int           n,
+                                           hipComplex*         A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           const int*          ipiv,
+                                           const hipblasStride strideP,
+                                           const float         maxGrowth,
+                                           int*                info,
+                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZgetrfRefactorStridedBatched_v2(hipblasHandle_t     handle,
+                                           const int           n,
+                                           hipDoubleComplex*   A,
+                                           const int           lda,
+                                           const hipblasStride strideA,
+                                           const int*          ipiv,
+                                           const hipblasStride strideP,
+                                           const double        maxGrowth,
+                                           int*                info,
+                                           const int           batchCount);
+//! @}
+
 /*! @{
     \brief SOLVER API
 
@@ -30904,6 +32483,1057 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t
                                                               const int           batchCount);
 //! @}
 
+/*! @{
+    \brief SOLVER API
+
+    \details
+    orgqr (ungqr for complex types) generates an m-by-n matrix Q with orthonormal columns.
+
+    The matrix Q is defined as the first n columns of the product of k Householder
+    reflectors of order m
+
+    \f[
+        Q = H_1H_2\cdots H_k
+    \f]
+
+    as returned by \ref hipblasSgeqrf "GEQRF" in the first k columns of A and in ipiv.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of the matrix Q.
+    @param[in]
+    n         int. 0 <= n <= m.\n
+              The number of columns of the matrix Q.
+    @param[in]
+    k         int. 0 <= k <= n.\n
+              The number of Householder reflectors.
+    @param[inout]
+    A         pointer to type. Array on the GPU of dimension lda*n.\n
+              On entry, the i-th column has the Householder vector v_i as returned by \ref hipblasSgeqrf "GEQRF".
+              On exit, the computed matrix Q.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of A.
+    @param[in]
+    ipiv      pointer to type. Array on the GPU of dimension at least k.\n
+              The Householder scalars as returned by \ref hipblasSgeqrf "GEQRF".
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSorgqr(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       k,
+                                             float*          A,
+                                             const int       lda,
+                                             float*          ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDorgqr(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       k,
+                                             double*         A,
+                                             const int       lda,
+                                             double*         ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqr(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       k,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             hipblasComplex* ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqr(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             const int             k,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             hipblasDoubleComplex* ipiv,
+                                             int*                  info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqr_v2(hipblasHandle_t handle,
+                                                const int       m,
+                                                const int       n,
+                                                const int       k,
+                                                hipComplex*     A,
+                                                const int       lda,
+                                                hipComplex*     ipiv,
+                                                int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqr_v2(hipblasHandle_t   handle,
+                                                const int         m,
+                                                const int         n,
+                                                const int         k,
+                                                hipDoubleComplex* A,
+                                                const int         lda,
+                                                hipDoubleComplex* ipiv,
+                                                int*              info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    orgqrBatched (ungqrBatched for complex types) generates a batch of m-by-n matrices
+    \f$Q_i\f$ with orthonormal columns from the Householder reflectors returned by
+    \ref hipblasSgeqrfBatched "GEQRF_BATCHED". See \ref hipblasSorgqr "ORGQR".
+
+    rocSOLVER has no batched orgqr, so the matrices are processed one after the other on the stream
+    of the handle. The arrays of pointers are copied to the host first, which synchronizes the stream.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of all the matrices Q_i in the batch.
+    @param[in]
+    n         int. 0 <= n <= m.\n
+              The number of columns of all the matrices Q_i in the batch.
+    @param[in]
+    k         int. 0 <= k <= n.\n
+              The number of Householder reflectors of each matrix.
+    @param[inout]
+    A         Array of pointers to type. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the Householder vectors as returned by \ref hipblasSgeqrfBatched "GEQRF_BATCHED".
+              On exit, the computed matrices Q_i.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    ipiv      array of pointers to type. Each pointer points to an array on the GPU
+              of dimension at least k.\n
+              The Householder scalars of each matrix.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                 Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSorgqrBatched(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    const int       k,
+                                                    float* const    A[],
+                                                    const int       lda,
+                                                    float* const    ipiv[],
+                                                    int*            info,
+                                                    const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDorgqrBatched(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    const int       k,
+                                                    double* const   A[],
+                                                    const int       lda,
+                                                    double* const   ipiv[],
+                                                    int*            info,
+                                                    const int       batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqrBatched(hipblasHandle_t       handle,
+                                                    const int             m,
+                                                    const int             n,
+                                                    const int             k,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    hipblasComplex* const ipiv[],
+                                                    int*                  info,
+                                                    const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqrBatched(hipblasHandle_t             handle,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    const int                   k,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const ipiv[],
+                                                    int*                        info,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqrBatched_v2(hipblasHandle_t   handle,
+                                                       const int         m,
+                                                       const int         n,
+                                                       const int         k,
+                                                       hipComplex* const A[],
+                                                       const int         lda,
+                                                       hipComplex* const ipiv[],
+                                                       int*              info,
+                                                       const int         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqrBatched_v2(hipblasHandle_t         handle,
+                                                       const int               m,
+                                                       const int               n,
+                                                       const int               k,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       hipDoubleComplex* const ipiv[],
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    orgqrStridedBatched (ungqrStridedBatched for complex types) generates a batch of m-by-n
+    matrices \f$Q_i\f$ with orthonormal columns from the Householder reflectors returned by
+    \ref hipblasSgeqrfStridedBatched "GEQRF_STRIDED_BATCHED". See \ref hipblasSorgqr "ORGQR".
+
+    rocSOLVER has no batched orgqr, so the matrices are processed one after the other on the stream
+    of the handle.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    m         int. m >= 0.\n
+              The number of rows of all the matrices Q_i in the batch.
+    @param[in]
+    n         int. 0 <= n <= m.\n
+              The number of columns of all the matrices Q_i in the batch.
+    @param[in]
+    k         int. 0 <= k <= n.\n
+              The number of Householder reflectors of each matrix.
+    @param[inout]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the Householder vectors as returned by \ref hipblasSgeqrfStridedBatched "GEQRF_STRIDED_BATCHED".
+              On exit, the computed matrices Q_i.
+    @param[in]
+    lda       int. lda >= m.\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+    @param[in]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              The Householder scalars of each matrix.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                 Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSorgqrStridedBatched(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           k,
+                                                           float*              A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           float*              ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDorgqrStridedBatched(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           k,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           double*             ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqrStridedBatched(hipblasHandle_t     handle,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           k,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           hipblasComplex*     ipiv,
+                                                           const hipblasStride strideP,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqrStridedBatched(hipblasHandle_t       handle,
+                                                           const int             m,
+                                                           const int             n,
+                                                           const int             k,
+                                                           hipblasDoubleComplex* A,
+                                                           const int             lda,
+                                                           const hipblasStride   strideA,
+                                                           hipblasDoubleComplex* ipiv,
+                                                           const hipblasStride   strideP,
+                                                           int*                  info,
+                                                           const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqrStridedBatched_v2(hipblasHandle_t     handle,
+                                                              const int           m,
+                                                              const int           n,
+                                                              const int           k,
+                                                              hipComplex*         A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              hipComplex*         ipiv,
+                                                              const hipblasStride strideP,
+                                                              int*                info,
+                                                              const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqrStridedBatched_v2(hipblasHandle_t     handle,
+                                                              const int           m,
+                                                              const int           n,
+                                                              const int           k,
+                                                              hipDoubleComplex*   A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              hipDoubleComplex*   ipiv,
+                                                              const hipblasStride strideP,
+                                                              int*                info,
+                                                              const int           batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    ormqr (unmqr for complex types) multiplies a matrix Q with orthonormal columns by a general m-by-n
+    matrix C.
+
+    The matrix Q is applied in one of the following forms, depending on the values of side and trans:
+
+    \f[
+        \begin{array}{cl}
+        QC & \: \text{No transpose from the left,}\\
+        Q^HC & \: \text{Transpose (conjugate transpose for complex types) from the left,}\\
+        CQ & \: \text{No transpose from the right, and}\\
+        CQ^H & \: \text{Transpose (conjugate transpose for complex types) from the right.}
+        \end{array}
+    \f]
+
+    Q is defined as the product of k Householder reflectors
+
+    \f[
+        Q = H_1H_2\cdots H_k
+    \f]
+
+    as returned by \ref hipblasSgeqrf "GEQRF", of order m if applied from the left and of order n
+    if applied from the right.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    side      hipblasSideMode_t.\n
+              Specifies from which side to apply Q.
+    @param[in]
+    trans     hipblasOperation_t.\n
+              Specifies whether Q or its transpose is applied. HIPBLAS_OP_C is not
+              allowed for real types and HIPBLAS_OP_T is not allowed for complex types.
+    @param[in]
+    m         int. m >= 0.\n
+              Number of rows of matrix C.
+    @param[in]
+    n         int. n >= 0.\n
+              Number of columns of matrix C.
+    @param[in]
+    k         int. k >= 0; k <= m if side is left, k <= n if side is right.\n
+              The number of Householder reflectors that form Q.
+    @param[in]
+    A         pointer to type. Array on the GPU of size lda*k.\n
+              The Householder vectors as returned by \ref hipblasSgeqrf "GEQRF"
+              in the first k columns of its argument A.
+    @param[in]
+    lda       int. lda >= m if side is left, or lda >= n if side is right.\n
+              Leading dimension of A.
+    @param[in]
+    ipiv      pointer to type. Array on the GPU of dimension at least k.\n
+              The Householder scalars as returned by \ref hipblasSgeqrf "GEQRF".
+    @param[inout]
+    C         pointer to type. Array on the GPU of size ldc*n.\n
+              On entry, the matrix C. On exit, it is overwritten with
+              Q*C, C*Q, Q'*C, or C*Q'.
+    @param[in]
+    ldc       int. ldc >= m.\n
+              Leading dimension of C.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSormqr(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasOperation_t trans,
+                                             const int          m,
+                                             const int          n,
+                                             const int          k,
+                                             float*             A,
+                                             const int          lda,
+                                             float*             ipiv,
+                                             float*             C,
+                                             const int          ldc,
+                                             int*               info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDormqr(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasOperation_t trans,
+                                             const int          m,
+                                             const int          n,
+                                             const int          k,
+                                             double*            A,
+                                             const int          lda,
+                                             double*            ipiv,
+                                             double*            C,
+                                             const int          ldc,
+                                             int*               info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqr(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasOperation_t trans,
+                                             const int          m,
+                                             const int          n,
+                                             const int          k,
+                                             hipblasComplex*    A,
+                                             const int          lda,
+                                             hipblasComplex*    ipiv,
+                                             hipblasComplex*    C,
+                                             const int          ldc,
+                                             int*               info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqr(hipblasHandle_t       handle,
+                                             hipblasSideMode_t     side,
+                                             hipblasOperation_t    trans,
+                                             const int             m,
+                                             const int             n,
+                                             const int             k,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             hipblasDoubleComplex* ipiv,
+                                             hipblasDoubleComplex* C,
+                                             const int             ldc,
+                                             int*                  info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqr_v2(hipblasHandle_t    handle,
+                                                hipblasSideMode_t  side,
+                                                hipblasOperation_t trans,
+                                                const int          m,
+                                                const int          n,
+                                                const int          k,
+                                                hipComplex*        A,
+                                                const int          lda,
+                                                hipComplex*        ipiv,
+                                                hipComplex*        C,
+                                                const int          ldc,
+                                                int*               info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqr_v2(hipblasHandle_t    handle,
+                                                hipblasSideMode_t  side,
+                                                hipblasOperation_t trans,
+                                                const int          m,
+                                                const int          n,
+                                                const int          k,
+                                                hipDoubleComplex*  A,
+                                                const int          lda,
+                                                hipDoubleComplex*  ipiv,
+                                                hipDoubleComplex*  C,
+                                                const int          ldc,
+                                                int*               info);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    ormqrBatched (unmqrBatched for complex types) multiplies the matrices \f$Q_i\f$ given by
+    the Householder reflectors returned by \ref hipblasSgeqrfBatched "GEQRF_BATCHED" by a batch
+    of general m-by-n matrices \f$C_i\f$. See \ref hipblasSormqr "ORMQR".
+
+    rocSOLVER has no batched ormqr, so the matrices are processed one after the other on the stream
+    of the handle. The arrays of pointers are copied to the host first, which synchronizes the stream.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    side      hipblasSideMode_t.\n
+              Specifies from which side to apply Q_i.
+    @param[in]
+    trans     hipblasOperation_t.\n
+              Specifies whether Q_i or its transpose is applied. HIPBLAS_OP_C is not
+              allowed for real types and HIPBLAS_OP_T is not allowed for complex types.
+    @param[in]
+    m         int. m >= 0.\n
+              Number of rows of matrices C_i.
+    @param[in]
+    n         int. n >= 0.\n
+              Number of columns of matrices C_i.
+    @param[in]
+    k         int. k >= 0; k <= m if side is left, k <= n if side is right.\n
+              The number of Householder reflectors that form each Q_i.
+    @param[in]
+    A         Array of pointers to type. Each pointer points to an array on the GPU of size lda*k.\n
+              The Householder vectors as returned by \ref hipblasSgeqrfBatched "GEQRF_BATCHED".
+    @param[in]
+    lda       int. lda >= m if side is left, or lda >= n if side is right.\n
+              Leading dimension of matrices A_i.
+    @param[in]
+    ipiv      array of pointers to type. Each pointer points to an array on the GPU
+              of dimension at least k.\n
+              The Householder scalars of each matrix.
+    @param[inout]
+    C         Array of pointers to type. Each pointer points to an array on the GPU of size ldc*n.\n
+              On entry, the matrices C_i. On exit, they are overwritten with
+              Q_i*C_i, C_i*Q_i, Q_i'*C_i, or C_i*Q_i'.
+    @param[in]
+    ldc       int. ldc >= m.\n
+              Leading dimension of matrices C_i.
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                 Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSormqrBatched(hipblasHandle_t    handle,
+                                                    hipblasSideMode_t  side,
+                                                    hipblasOperation_t trans,
+                                                    const int          m,
+                                                    const int          n,
+                                                    const int          k,
+                                                    float* const       A[],
+                                                    const int          lda,
+                                                    float* const       ipiv[],
+                                                    float* const       C[],
+                                                    const int          ldc,
+                                                    int*               info,
+                                                    const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDormqrBatched(hipblasHandle_t    handle,
+                                                    hipblasSideMode_t  side,
+                                                    hipblasOperation_t trans,
+                                                    const int          m,
+                                                    const int          n,
+                                                    const int          k,
+                                                    double* const      A[],
+                                                    const int          lda,
+                                                    double* const      ipiv[],
+                                                    double* const      C[],
+                                                    const int          ldc,
+                                                    int*               info,
+                                                    const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqrBatched(hipblasHandle_t       handle,
+                                                    hipblasSideMode_t     side,
+                                                    hipblasOperation_t    trans,
+                                                    const int             m,
+                                                    const int             n,
+                                                    const int             k,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    hipblasComplex* const ipiv[],
+                                                    hipblasComplex* const C[],
+                                                    const int             ldc,
+                                                    int*                  info,
+                                                    const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqrBatched(hipblasHandle_t             handle,
+                                                    hipblasSideMode_t           side,
+                                                    hipblasOperation_t          trans,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    const int                   k,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const ipiv[],
+                                                    hipblasDoubleComplex* const C[],
+                                                    const int                   ldc,
+                                                    int*                        info,
+                                                    const int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqrBatched_v2(hipblasHandle_t    handle,
+                                                       hipblasSideMode_t  side,
+                                                       hipblasOperation_t trans,
+                                                       const int          m,
+                                                       const int          n,
+                                                       const int          k,
+                                                       hipComplex* const  A[],
+                                                       const int          lda,
+                                                       hipComplex* const  ipiv[],
+                                                       hipComplex* const  C[],
+                                                       const int          ldc,
+                                                       int*               info,
+                                                       const int          batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqrBatched_v2(hipblasHandle_t         handle,
+                                                       hipblasSideMode_t       side,
+                                                       hipblasOperation_t      trans,
+                                                       const int               m,
+                                                       const int               n,
+                                                       const int               k,
+                                                       hipDoubleComplex* const A[],
+                                                       const int               lda,
+                                                       hipDoubleComplex* const ipiv[],
+                                                       hipDoubleComplex* const C[],
+                                                       const int               ldc,
+                                                       int*                    info,
+                                                       const int               batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    ormqrStridedBatched (unmqrStridedBatched for complex types) multiplies the matrices \f$Q_i\f$
+    given by the Householder reflectors returned by \ref hipblasSgeqrfStridedBatched "GEQRF_STRIDED_BATCHED"
+    by a batch of general m-by-n matrices \f$C_i\f$. See \ref hipblasSormqr "ORMQR".
+
+    rocSOLVER has no batched ormqr, so the matrices are processed one after the other on the stream
+    of the handle.
+
+    - Supported precisions in rocSOLVER : s,d,c,z
+    - Supported precisions in cuBLAS    : No support
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    side      hipblasSideMode_t.\n
+              Specifies from which side to apply Q_i.
+    @param[in]
+    trans     hipblasOperation_t.\n
+              Specifies whether Q_i or its transpose is applied. HIPBLAS_OP_C is not
+              allowed for real types and HIPBLAS_OP_T is not allowed for complex types.
+    @param[in]
+    m         int. m >= 0.\n
+              Number of rows of matrices C_i.
+    @param[in]
+    n         int. n >= 0.\n
+              Number of columns of matrices C_i.
+    @param[in]
+    k         int. k >= 0; k <= m if side is left, k <= n if side is right.\n
+              The number of Householder reflectors that form each Q_i.
+    @param[in]
+    A         pointer to type. Array on the GPU (the size depends on the value of strideA).\n
+              The Householder vectors as returned by \ref hipblasSgeqrfStridedBatched "GEQRF_STRIDED_BATCHED".
+    @param[in]
+    lda       int. lda >= m if side is left, or lda >= n if side is right.\n
+              Leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+    @param[in]
+    ipiv      pointer to type. Array on the GPU (the size depends on the value of strideP).\n
+              The Householder scalars of each matrix.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+    @param[inout]
+    C         pointer to type. Array on the GPU (the size depends on the value of strideC).\n
+              On entry, the matrices C_i. On exit, they are overwritten with
+              Q_i*C_i, C_i*Q_i, Q_i'*C_i, or C_i*Q_i'.
+    @param[in]
+    ldc       int. ldc >= m.\n
+              Leading dimension of matrices C_i.
+    @param[in]
+    strideC   hipblasStride.\n
+              Stride from the start of one matrix C_i to the next one C_(i+1).
+    @param[out]
+    info      pointer to a int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[in]
+    batchCount  int. batchCount >= 0.\n
+                 Number of matrices in the batch.
+    ********************************************************************/
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSormqrStridedBatched(hipblasHandle_t     handle,
+                                                           hipblasSideMode_t   side,
+                                                           hipblasOperation_t  trans,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           k,
+                                                           float*              A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           float*              ipiv,
+                                                           const hipblasStride strideP,
+                                                           float*              C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDormqrStridedBatched(hipblasHandle_t     handle,
+                                                           hipblasSideMode_t   side,
+                                                           hipblasOperation_t  trans,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           k,
+                                                           double*             A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           double*             ipiv,
+                                                           const hipblasStride strideP,
+                                                           double*             C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqrStridedBatched(hipblasHandle_t     handle,
+                                                           hipblasSideMode_t   side,
+                                                           hipblasOperation_t  trans,
+                                                           const int           m,
+                                                           const int           n,
+                                                           const int           k,
+                                                           hipblasComplex*     A,
+                                                           const int           lda,
+                                                           const hipblasStride strideA,
+                                                           hipblasComplex*     ipiv,
+                                                           const hipblasStride strideP,
+                                                           hipblasComplex*     C,
+                                                           const int           ldc,
+                                                           const hipblasStride strideC,
+                                                           int*                info,
+                                                           const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqrStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasSideMode_t     side,
+                                                           hipblasOperation_t    trans,
+                                                           const int             m,
+                                                           const int             n,
+                                                           const int             k,
+                                                           hipblasDoubleComplex* A,
+                                                           const int             lda,
+                                                           const hipblasStride   strideA,
+                                                           hipblasDoubleComplex* ipiv,
+                                                           const hipblasStride   strideP,
+                                                           hipblasDoubleComplex* C,
+                                                           const int             ldc,
+                                                           const hipblasStride   strideC,
+                                                           int*                  info,
+                                                           const int             batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqrStridedBatched_v2(hipblasHandle_t     handle,
+                                                              hipblasSideMode_t   side,
+                                                              hipblasOperation_t  trans,
+                                                              const int           m,
+                                                              const int           n,
+                                                              const int           k,
+                                                              hipComplex*         A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              hipComplex*         ipiv,
+                                                              const hipblasStride strideP,
+                                                              hipComplex*         C,
+                                                              const int           ldc,
+                                                              const hipblasStride strideC,
+                                                              int*                info,
+                                                              const int           batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqrStridedBatched_v2(hipblasHandle_t     handle,
+                                                              hipblasSideMode_t   side,
+                                                              hipblasOperation_t  trans,
+                                                              const int           m,
+                                                              const int           n,
+                                                              const int           k,
+                                                              hipDoubleComplex*   A,
+                                                              const int           lda,
+                                                              const hipblasStride strideA,
+                                                              hipDoubleComplex*   ipiv,
+                                                              const hipblasStride strideP,
+                                                              hipDoubleComplex*   C,
+                                                              const int           ldc,
+                                                              const hipblasStride strideC,
+                                                              int*                info,
+                                                              const int           batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesvIR solves the system of linear equations \f$A X = B\f$ with a general n-by-n double precision matrix A
+    using mixed precision iterative refinement.
+
+    A is converted to single precision and factorized with \ref hipblasSgetrf "GETRF". The solution computed
+    from the single precision factors is then refined: the residual \f$R = B - A X\f$ is computed in double
+    precision and the correction is solved with the single precision factors. The iteration stops when
+
+    \f[
+        \|r_j\|_\infty \leq \|x_j\|_\infty \|A\|_\infty \epsilon \sqrt{n}
+    \f]
+
+    holds for every column j, where \f$\epsilon\f$ is the double precision machine epsilon. If A or B cannot be
+    converted to single precision, the single precision factorization is singular, or the refinement doesn't
+    converge in 30 iterations, the system is solved with a double precision factorization instead.
+
+    A is only overwritten when the double precision factorization is used. The matrices are converted
+    between the two precisions on the host, so the function synchronizes the stream of the handle.
+
+    - Supported precisions in rocSOLVER : d
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The order of the matrix A.
+    @param[in]
+    nrhs      int. nrhs >= 0.\n
+              The number of columns of matrices B and X.
+    @param[inout]
+    A         pointer to double. Array on the GPU of dimension lda*n.\n
+              On entry, the matrix A. On exit, unchanged if the refinement converged (iter >= 0),
+              otherwise the factors L and U from the double precision factorization \f$A = P L U\f$.
+    @param[in]
+    lda       int. lda >= max(1,n).\n
+              Specifies the leading dimension of A.
+    @param[out]
+    ipiv      pointer to int. Array on the GPU of dimension n.\n
+              The pivot indices of the single precision factorization if iter >= 0, or of the
+              double precision factorization if iter < 0. Elements of ipiv are 1-based indices.
+    @param[in]
+    B         pointer to double. Array on the GPU of dimension ldb*nrhs.\n
+              The matrix B. B is not modified.
+    @param[in]
+    ldb       int. ldb >= max(1,n).\n
+              Specifies the leading dimension of B.
+    @param[out]
+    X         pointer to double. Array on the GPU of dimension ldx*nrhs.\n
+              The solution matrix X.
+    @param[in]
+    ldx       int. ldx >= max(1,n).\n
+              Specifies the leading dimension of X.
+    @param[out]
+    iter      pointer to an int on the host.\n
+              If iter >= 0, the number of refinement iterations needed.
+              If iter < 0, the system was solved in double precision because
+              iter = -2: an element of A or B overflows in single precision,
+              iter = -3: the single precision factorization is singular, or
+              iter = -31: the refinement didn't converge in 30 iterations.
+    @param[out]
+    info      pointer to an int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int on the GPU.\n
+              If deviceInfo = 0, successful exit.
+              If deviceInfo = i > 0, U is singular. U[i,i] is the first zero pivot of the double
+              precision factorization and X wasn't computed.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvIR(hipblasHandle_t handle,
+                                              const int       n,
+                                              const int       nrhs,
+                                              double*         A,
+                                              const int       lda,
+                                              int*            ipiv,
+                                              double*         B,
+                                              const int       ldb,
+                                              double*         X,
+                                              const int       ldx,
+                                              int*            iter,
+                                              int*            info,
+                                              int*            deviceInfo);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesvIRBatched solves a batch of systems of linear equations \f$A_i X_i = B_i\f$ with general n-by-n
+    double precision matrices \f$A_i\f$ using mixed precision iterative refinement, as described for
+    \ref hipblasDgesvIR "GESV_IR". Each system falls back to a double precision solve on its own.
+
+    The systems are solved one after another on the stream of the handle. The arrays of pointers are
+    copied to the host first, and the function synchronizes the stream.
+
+    - Supported precisions in rocSOLVER : d
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The order of each matrix A_i.
+    @param[in]
+    nrhs      int. nrhs >= 0.\n
+              The number of columns of each matrix B_i and X_i.
+    @param[inout]
+    A         array of pointers to double. Each pointer points to an array on the GPU of dimension lda*n.\n
+              On entry, the matrices A_i. On exit, A_i is unchanged if iter[i] >= 0, otherwise it holds
+              the factors L_i and U_i from the double precision factorization.
+    @param[in]
+    lda       int. lda >= max(1,n).\n
+              Specifies the leading dimension of matrices A_i.
+    @param[out]
+    ipiv      pointer to int. Array on the GPU of dimension n*batchCount.\n
+              The pivot indices ipiv_i of each factorization, stored one after another.
+    @param[in]
+    B         array of pointers to double. Each pointer points to an array on the GPU of dimension ldb*nrhs.\n
+              The matrices B_i. B_i is not modified.
+    @param[in]
+    ldb       int. ldb >= max(1,n).\n
+              Specifies the leading dimension of matrices B_i.
+    @param[out]
+    X         array of pointers to double. Each pointer points to an array on the GPU of dimension ldx*nrhs.\n
+              The solution matrices X_i.
+    @param[in]
+    ldx       int. ldx >= max(1,n).\n
+              Specifies the leading dimension of matrices X_i.
+    @param[out]
+    iter      pointer to int. Array on the host of dimension batchCount.\n
+              The number of refinement iterations for each system, or a negative value if the system was
+              solved in double precision, as described for \ref hipblasDgesvIR "GESV_IR".
+    @param[out]
+    info      pointer to an int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array on the GPU of dimension batchCount.\n
+              If deviceInfo[i] = 0, successful exit for the i-th system.
+              If deviceInfo[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot and X_i
+              wasn't computed.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of systems in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvIRBatched(hipblasHandle_t handle,
+                                                     const int       n,
+                                                     const int       nrhs,
+                                                     double* const   A[],
+                                                     const int       lda,
+                                                     int*            ipiv,
+                                                     double* const   B[],
+                                                     const int       ldb,
+                                                     double* const   X[],
+                                                     const int       ldx,
+                                                     int*            iter,
+                                                     int*            info,
+                                                     int*            deviceInfo,
+                                                     const int       batchCount);
+//! @}
+
+/*! @{
+    \brief SOLVER API
+
+    \details
+    gesvIRStridedBatched solves a batch of systems of linear equations \f$A_i X_i = B_i\f$ with general
+    n-by-n double precision matrices \f$A_i\f$ using mixed precision iterative refinement, as described for
+    \ref hipblasDgesvIR "GESV_IR". Each system falls back to a double precision solve on its own.
+
+    The systems are solved one after another on the stream of the handle, and the function synchronizes
+    the stream.
+
+    - Supported precisions in rocSOLVER : d
+    - Supported precisions in cuBLAS    : currently unsupported
+
+    @param[in]
+    handle    hipblasHandle_t.
+    @param[in]
+    n         int. n >= 0.\n
+              The order of each matrix A_i.
+    @param[in]
+    nrhs      int. nrhs >= 0.\n
+              The number of columns of each matrix B_i and X_i.
+    @param[inout]
+    A         pointer to double. Array on the GPU (the size depends on the value of strideA).\n
+              On entry, the matrices A_i. On exit, A_i is unchanged if iter[i] >= 0, otherwise it holds
+              the factors L_i and U_i from the double precision factorization.
+    @param[in]
+    lda       int. lda >= max(1,n).\n
+              Specifies the leading dimension of matrices A_i.
+    @param[in]
+    strideA   hipblasStride.\n
+              Stride from the start of one matrix A_i to the next one A_(i+1).
+    @param[out]
+    ipiv      pointer to int. Array on the GPU (the size depends on the value of strideP).\n
+              The pivot indices ipiv_i of each factorization.
+    @param[in]
+    strideP   hipblasStride.\n
+              Stride from the start of one vector ipiv_i to the next one ipiv_(i+1).
+    @param[in]
+    B         pointer to double. Array on the GPU (the size depends on the value of strideB).\n
+              The matrices B_i. B_i is not modified.
+    @param[in]
+    ldb       int. ldb >= max(1,n).\n
+              Specifies the leading dimension of matrices B_i.
+    @param[in]
+    strideB   hipblasStride.\n
+              Stride from the start of one matrix B_i to the next one B_(i+1).
+    @param[out]
+    X         pointer to double. Array on the GPU (the size depends on the value of strideX).\n
+              The solution matrices X_i.
+    @param[in]
+    ldx       int. ldx >= max(1,n).\n
+              Specifies the leading dimension of matrices X_i.
+    @param[in]
+    strideX   hipblasStride.\n
+              Stride from the start of one matrix X_i to the next one X_(i+1).
+    @param[out]
+    iter      pointer to int. Array on the host of dimension batchCount.\n
+              The number of refinement iterations for each system, or a negative value if the system was
+              solved in double precision, as described for \ref hipblasDgesvIR "GESV_IR".
+    @param[out]
+    info      pointer to an int on the host.\n
+              If info = 0, successful exit.
+              If info = j < 0, the argument at position -j is invalid.
+    @param[out]
+    deviceInfo  pointer to int. Array on the GPU of dimension batchCount.\n
+              If deviceInfo[i] = 0, successful exit for the i-th system.
+              If deviceInfo[i] = j > 0, U_i is singular. U_i[j,j] is the first zero pivot and X_i
+              wasn't computed.
+    @param[in]
+    batchCount int. batchCount >= 0.\n
+                Number of systems in the batch.
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvIRStridedBatched(hipblasHandle_t     handle,
+                                                            const int           n,
+                                                            const int           nrhs,
+                                                            double*             A,
+                                                            const int           lda,
+                                                            const hipblasStride strideA,
+                                                            int*                ipiv,
+                                                            const hipblasStride strideP,
+                                                            double*             B,
+                                                            const int           ldb,
+                                                            const hipblasStride strideB,
+                                                            double*             X,
+                                                            const int           ldx,
+                                                            const hipblasStride strideX,
+                                                            int*                iter,
+                                                            int*                info,
+                                                            int*                deviceInfo,
+                                                            const int           batchCount);
+//! @}
+
 /*
  * ===========================================================================
  *   BLAS Extensions
@@ -30943,6 +33573,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t
       | HIP_C_32F  | HIP_C_32F  | HIP_C_32F  | HIPBLAS_COMPUTE_32F |
       | HIP_C_64F  | HIP_C_64F  | HIP_C_64F  | HIPBLAS_COMPUTE_64F |
 
+      hipblasGemmEx_v2 and hipblasGemmExWithFlags_v2 with the rocBLAS backend additionally accept the emulated
+      compute type, see hipblasSetGemmEmulationSlices:
+
+      |   aType    |   bType    |   cType    |            computeType            |
+      | ---------- | ---------- | ---------- | --------------------------------- |
+      | HIP_R_32F  | HIP_R_32F  | HIP_R_32F  | HIPBLAS_COMPUTE_32F_EMULATED_16BF |
+
     hipblasGemmExWithFlags is also available which is identical to hipblasGemmEx
     with the addition of a "flags" parameter which controls flags used in Tensile to control gemm algorithms with the
     rocBLAS backend. When using a cuBLAS backend this parameter is ignored.
@@ -31108,7 +33745,8 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched_v2(hipblasHandle_t
               specifies the datatype of computation.
     @param[in]
     algo      [hipblasGemmAlgo_t]
-              enumerant specifying the algorithm type.
+              enumerant specifying the algorithm type. HIPBLAS_GEMM_SPLIT_K opts in to splitting the k
+              dimension, see hipblasSetGemmSplitK.
 
     ********************************************************************/
 HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
@@ -32066,6 +34704,500 @@ HIPBLAS_EXPORT hipblasStatus_t
                                                hipblasGemmAlgo_t    algo,
                                                hipblasGemmFlags_t   flags);
 
+/*! BLAS EX API
+
+    \details
+    gemmBatchedReduceEx performs the sum of a batch of matrix-matrix products
+
+        C = alpha * ( op( A_1 ) * op( B_1 ) + ... + op( A_batchCount ) * op( B_batchCount ) ) + beta * C,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, A_i, B_i are matrices and C is a single m by n matrix, with
+    op( A_i ) an m by k matrix and op( B_i ) a k by n matrix.
+
+    The products are accumulated directly into C, without a temporary for every product.
+    When the matrices A_i, placed one after the other, form a single m by ( k * batchCount )
+    matrix op( A ) reachable with lda, and the B_i likewise form a ( k * batchCount ) by n
+    matrix op( B ) reachable with ldb, the sum is computed as a single gemm with the
+    concatenated k. Otherwise the products are accumulated into C one at a time, with beta = 1
+    after the first one.
+
+    For hipblasGemmBatchedReduceEx the arrays of pointers A and B are copied to the host, which
+    synchronizes the stream. Pointers which are evenly spaced take the concatenated path too.
+
+    Supported types are the ones of hipblasGemmEx_v2, without the emulated compute type.
+
+    - Supported precisions in rocBLAS : h,bf,s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A_i ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B_i ).
+    @param[in]
+    m         [int]
+              matrix dimension m.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k of every product.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [const void *]
+              for hipblasGemmStridedBatchedReduceEx, device pointer pointing to the first matrix A_1.\n
+              for hipblasGemmBatchedReduceEx, device array of device pointers storing each matrix A_i.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of each matrix A_i.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of each A_i.
+    @param[in]
+    strideA   [hipblasStride]
+              specifies stride from start of one A_i matrix to the next A_(i + 1).
+    @param[in]
+    B         [const void *]
+              for hipblasGemmStridedBatchedReduceEx, device pointer pointing to the first matrix B_1.\n
+              for hipblasGemmBatchedReduceEx, device array of device pointers storing each matrix B_i.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of each matrix B_i.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of each B_i.
+    @param[in]
+    strideB   [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1).
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in, out]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    batchCount
+              [int]
+              number of products in the sum. If batchCount is 0, C = beta * C.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedReduceEx(hipblasHandle_t      handle,
+                                                          hipblasOperation_t   transA,
+                                                          hipblasOperation_t   transB,
+                                                          int                  m,
+                                                          int                  n,
+                                                          int                  k,
+                                                          const void*          alpha,
+                                                          const void* const    A[],
+                                                          hipDataType          aType,
+                                                          int                  lda,
+                                                          const void* const    B[],
+                                                          hipDataType          bType,
+                                                          int                  ldb,
+                                                          const void*          beta,
+                                                          void*                C,
+                                                          hipDataType          cType,
+                                                          int                  ldc,
+                                                          int                  batchCount,
+                                                          hipblasComputeType_t computeType,
+                                                          hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmStridedBatchedReduceEx(hipblasHandle_t      handle,
+                                      hipblasOperation_t   transA,
+                                      hipblasOperation_t   transB,
+                                      int                  m,
+                                      int                  n,
+                                      int                  k,
+                                      const void*          alpha,
+                                      const void*          A,
+                                      hipDataType          aType,
+                                      int                  lda,
+                                      hipblasStride        strideA,
+                                      const void*          B,
+                                      hipDataType          bType,
+                                      int                  ldb,
+                                      hipblasStride        strideB,
+                                      const void*          beta,
+                                      void*                C,
+                                      hipDataType          cType,
+                                      int                  ldc,
+                                      int                  batchCount,
+                                      hipblasComputeType_t computeType,
+                                      hipblasGemmAlgo_t    algo);
+
+/*! BLAS EX API
+
+    \details
+    gemmIndexedEx performs a matrix-matrix product on rows selected by index arrays
+
+        C[rowIndexC[i], :] = alpha * op( A )[rowIndexA[i], :] * op( B ) + beta * C[rowIndexC[i], :],   i = 0, ..., m - 1,
+
+    where op( X ) is one of
+
+        op( X ) = X      or
+        op( X ) = X**T   or
+        op( X ) = X**H,
+
+    alpha and beta are scalars, op( B ) is a k by n matrix and the rows of op( A ) have k
+    elements. Indices are zero based. A null rowIndexA or rowIndexC selects the rows 0, ..., m - 1.
+    The rows selected in C must be distinct.
+
+    gemmGroupedIndexedEx does the same for groupCount groups, each with its own matrix
+    B_g = B + g * strideB. Group g uses groupRows[g] entries of the index arrays, following the
+    entries of group g - 1; with a null index array these are the rows following the rows of
+    group g - 1.
+
+    Each group is a single batched gemmEx with one batch entry per row, on pointers to the rows of A
+    and C, so the rows are read and written in place without copies. The index arrays are host
+    arrays; the pointer arrays are built from them on the host and uploaded into the handle
+    workspace through pinned memory owned by the handle, without synchronizing the stream. That
+    memory can't be used while the stream is captured into a graph, and HIPBLAS_STATUS_NOT_SUPPORTED
+    is returned then.
+
+    The indices into C must be in [0, ldc), and the indices into A in [0, lda) unless A is
+    transposed, or HIPBLAS_STATUS_INVALID_VALUE is returned before any matrix is read or written.
+
+    Supported types are the ones of hipblasGemmEx_v2, without the emulated compute type.
+
+    - Supported precisions in rocBLAS : h,bf,s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    transA    [hipblasOperation_t]
+              specifies the form of op( A ).
+    @param[in]
+    transB    [hipblasOperation_t]
+              specifies the form of op( B ).
+    @param[in]
+    m         [int]
+              number of rows which are updated, hipblasGemmIndexedEx only.
+    @param[in]
+    groupCount
+              [int]
+              number of groups, hipblasGemmGroupedIndexedEx only.
+    @param[in]
+    groupRows [const int *]
+              host array of groupCount elements with the number of rows updated by each group,
+              hipblasGemmGroupedIndexedEx only.
+    @param[in]
+    n         [int]
+              matrix dimension n.
+    @param[in]
+    k         [int]
+              matrix dimension k.
+    @param[in]
+    alpha     [const void *]
+              device pointer or host pointer specifying the scalar alpha. Same datatype as computeType.
+    @param[in]
+    A         [const void *]
+              device pointer storing matrix A.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of matrix A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A.
+    @param[in]
+    rowIndexA [const int *]
+              host array of the rows of op( A ) used by the product, or null.
+    @param[in]
+    B         [const void *]
+              device pointer storing matrix B, or the first matrix B_1 for hipblasGemmGroupedIndexedEx.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of matrix B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B.
+    @param[in]
+    strideB   [hipblasStride]
+              specifies stride from start of one B_i matrix to the next B_(i + 1),
+              hipblasGemmGroupedIndexedEx only.
+    @param[in]
+    beta      [const void *]
+              device pointer or host pointer specifying the scalar beta. Same datatype as computeType.
+    @param[in, out]
+    C         [void *]
+              device pointer storing matrix C.
+    @param[in]
+    cType     [hipDataType]
+              specifies the datatype of matrix C.
+    @param[in]
+    ldc       [int]
+              specifies the leading dimension of C.
+    @param[in]
+    rowIndexC [const int *]
+              host array of the rows of C which are updated, or null.
+    @param[in]
+    computeType
+              [hipblasComputeType_t]
+              specifies the datatype of computation.
+    @param[in]
+    algo      [hipblasGemmAlgo_t]
+              enumerant specifying the algorithm type.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmIndexedEx(hipblasHandle_t      handle,
+                                                    hipblasOperation_t   transA,
+                                                    hipblasOperation_t   transB,
+                                                    int                  m,
+                                                    int                  n,
+                                                    int                  k,
+                                                    const void*          alpha,
+                                                    const void*          A,
+                                                    hipDataType          aType,
+                                                    int                  lda,
+                                                    const int*           rowIndexA,
+                                                    const void*          B,
+                                                    hipDataType          bType,
+                                                    int                  ldb,
+                                                    const void*          beta,
+                                                    void*                C,
+                                                    hipDataType          cType,
+                                                    int                  ldc,
+                                                    const int*           rowIndexC,
+                                                    hipblasComputeType_t computeType,
+                                                    hipblasGemmAlgo_t    algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmGroupedIndexedEx(hipblasHandle_t      handle,
+                                                           hipblasOperation_t   transA,
+                                                           hipblasOperation_t   transB,
+                                                           int                  groupCount,
+                                                           const int*           groupRows,
+                                                           int                  n,
+                                                           int                  k,
+                                                           const void*          alpha,
+                                                           const void*          A,
+                                                           hipDataType          aType,
+                                                           int                  lda,
+                                                           const int*           rowIndexA,
+                                                           const void*          B,
+                                                           hipDataType          bType,
+                                                           int                  ldb,
+                                                           hipblasStride        strideB,
+                                                           const void*          beta,
+                                                           void*                C,
+                                                           hipDataType          cType,
+                                                           int                  ldc,
+                                                           const int*           rowIndexC,
+                                                           hipblasComputeType_t computeType,
+                                                           hipblasGemmAlgo_t    algo);
+
+/*! BLAS EX API
+
+    \details
+    copyEx copies the vector x into the vector y, converting its elements from xType to yType
+
+        y := x,
+
+    copyBatchedEx and copyStridedBatchedEx do the same for each x_i and y_i, for
+    i = 1, ..., batchCount.
+
+    Copies within one type have no restriction on the type, and the conversions from HIP_R_16F
+    and HIP_R_16BF to HIP_R_32F are supported. The other pairs of types return
+    HIPBLAS_STATUS_NOT_SUPPORTED. Everything runs on the device, but the batched function
+    copies its arrays of pointers to the host, which synchronizes the stream.
+
+    As in BLAS copy, a negative increment reads or writes the vector from its last element
+    backwards, and with incy = 0 the last element of x is copied. Vectors of one byte or two
+    byte complex elements need increments of the same sign. The function returns
+    HIPBLAS_STATUS_SUCCESS without reading its pointers if n = 0 or batchCount = 0, whatever
+    the increments.
+
+    - Supported precisions in rocBLAS : h,bf,s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    n         [int]
+              the number of elements in x and y.
+    @param[in]
+    x         device pointer storing vector x, a device array of device pointers to each x_i
+              for copyBatchedEx, or the first vector x_1 for copyStridedBatchedEx.
+    @param[in]
+    xType     [hipDataType]
+              specifies the datatype of x.
+    @param[in]
+    incx      [int]
+              specifies the increment for the elements of x.
+    @param[in]
+    stridex   [hipblasStride]
+              stride from the start of one vector (x_i) to the next one (x_i+1),
+              copyStridedBatchedEx only.
+    @param[out]
+    y         device pointer storing vector y, a device array of device pointers to each y_i
+              for copyBatchedEx, or the first vector y_1 for copyStridedBatchedEx.
+    @param[in]
+    yType     [hipDataType]
+              specifies the datatype of y.
+    @param[in]
+    incy      [int]
+              specifies the increment for the elements of y.
+    @param[in]
+    stridey   [hipblasStride]
+              stride from the start of one vector (y_i) to the next one (y_i+1),
+              copyStridedBatchedEx only.
+    @param[in]
+    batchCount [int]
+              number of instances in the batch, copyBatchedEx and copyStridedBatchedEx only.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyEx(hipblasHandle_t handle,
+                                             int             n,
+                                             const void*     x,
+                                             hipDataType     xType,
+                                             int             incx,
+                                             void*           y,
+                                             hipDataType     yType,
+                                             int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyBatchedEx(hipblasHandle_t   handle,
+                                                    int               n,
+                                                    const void* const x[],
+                                                    hipDataType       xType,
+                                                    int               incx,
+                                                    void* const       y[],
+                                                    hipDataType       yType,
+                                                    int               incy,
+                                                    int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyStridedBatchedEx(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const void*     x,
+                                                           hipDataType     xType,
+                                                           int             incx,
+                                                           hipblasStride   stridex,
+                                                           void*           y,
+                                                           hipDataType     yType,
+                                                           int             incy,
+                                                           hipblasStride   stridey,
+                                                           int             batchCount);
+
+/*! BLAS EX API
+
+    \details
+    copyMatrixEx copies the m by n matrix A into the matrix B, converting its elements from
+    aType to bType
+
+        B := A,
+
+    copyMatrixBatchedEx and copyMatrixStridedBatchedEx do the same for each A_i and B_i, for
+    i = 1, ..., batchCount.
+
+    The supported pairs of types are the ones of hipblasCopyEx. Strided batches of matrices which
+    follow each other in memory, with strideA = lda * n and strideB = ldb * n, are copied as one
+    matrix.
+
+    - Supported precisions in rocBLAS : h,bf,s,d,c,z
+    - Supported precisions in cuBLAS  : No support
+
+    @param[in]
+    handle    [hipblasHandle_t]
+              handle to the hipblas library context queue.
+    @param[in]
+    m         [int]
+              the number of rows of A and B.
+    @param[in]
+    n         [int]
+              the number of columns of A and B.
+    @param[in]
+    A         device pointer storing matrix A, a device array of device pointers to each A_i
+              for copyMatrixBatchedEx, or the first matrix A_1 for copyMatrixStridedBatchedEx.
+    @param[in]
+    aType     [hipDataType]
+              specifies the datatype of A.
+    @param[in]
+    lda       [int]
+              specifies the leading dimension of A. lda >= max(1, m).
+    @param[in]
+    strideA   [hipblasStride]
+              stride from the start of one matrix (A_i) to the next one (A_i+1),
+              copyMatrixStridedBatchedEx only.
+    @param[out]
+    B         device pointer storing matrix B, a device array of device pointers to each B_i
+              for copyMatrixBatchedEx, or the first matrix B_1 for copyMatrixStridedBatchedEx.
+    @param[in]
+    bType     [hipDataType]
+              specifies the datatype of B.
+    @param[in]
+    ldb       [int]
+              specifies the leading dimension of B. ldb >= max(1, m).
+    @param[in]
+    strideB   [hipblasStride]
+              stride from the start of one matrix (B_i) to the next one (B_i+1),
+              copyMatrixStridedBatchedEx only.
+    @param[in]
+    batchCount [int]
+              number of instances in the batch, copyMatrixBatchedEx and
+              copyMatrixStridedBatchedEx only.
+
+    ********************************************************************/
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyMatrixEx(hipblasHandle_t handle,
+                                                   int             m,
+                                                   int             n,
+                                                   const void*     A,
+                                                   hipDataType     aType,
+                                                   int             lda,
+                                                   void*           B,
+                                                   hipDataType     bType,
+                                                   int             ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyMatrixBatchedEx(hipblasHandle_t   handle,
+                                                          int               m,
+                                                          int               n,
+                                                          const void* const A[],
+                                                          hipDataType       aType,
+                                                          int               lda,
+                                                          void* const       B[],
+                                                          hipDataType       bType,
+                                                          int               ldb,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyMatrixStridedBatchedEx(hipblasHandle_t handle,
+                                                                 int             m,
+                                                                 int             n,
+                                                                 const void*     A,
+                                                                 hipDataType     aType,
+                                                                 int             lda,
+                                                                 hipblasStride   strideA,
+                                                                 void*           B,
+                                                                 hipDataType     bType,
+                                                                 int             ldb,
+                                                                 hipblasStride   strideB,
+                                                                 int             batchCount);
+
 /*! BLAS EX API
 
     \details
@@ -35059,6 +38191,11 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasScalStridedBatchedEx_64 hipblasScalStridedBatchedEx_v2_64
 
 // HIPBLAS_V2 Complex functions using hipComplex
+#define hipblasCpackBatched hipblasCpackBatched_v2
+#define hipblasZpackBatched hipblasZpackBatched_v2
+#define hipblasCunpackBatched hipblasCunpackBatched_v2
+#define hipblasZunpackBatched hipblasZunpackBatched_v2
+
 #define hipblasIcamax hipblasIcamax_v2
 #define hipblasIzamax hipblasIzamax_v2
 #define hipblasIcamax_64 hipblasIcamax_v2_64
@@ -35648,6 +38785,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasCgemmStridedBatched_64 hipblasCgemmStridedBatched_v2_64
 #define hipblasZgemmStridedBatched_64 hipblasZgemmStridedBatched_v2_64
 
+#define hipblasCgemmRealB hipblasCgemmRealB_v2
+#define hipblasZgemmRealB hipblasZgemmRealB_v2
+#define hipblasCgemmRealA hipblasCgemmRealA_v2
+#define hipblasZgemmRealA hipblasZgemmRealA_v2
+#define hipblasCgemmRealBBatched hipblasCgemmRealBBatched_v2
+#define hipblasZgemmRealBBatched hipblasZgemmRealBBatched_v2
+#define hipblasCgemmRealABatched hipblasCgemmRealABatched_v2
+#define hipblasZgemmRealABatched hipblasZgemmRealABatched_v2
+#define hipblasCgemmRealBStridedBatched hipblasCgemmRealBStridedBatched_v2
+#define hipblasZgemmRealBStridedBatched hipblasZgemmRealBStridedBatched_v2
+#define hipblasCgemmRealAStridedBatched hipblasCgemmRealAStridedBatched_v2
+#define hipblasZgemmRealAStridedBatched hipblasZgemmRealAStridedBatched_v2
+
 #define hipblasCherk hipblasCherk_v2
 #define hipblasZherk hipblasZherk_v2
 #define hipblasCherkBatched hipblasCherkBatched_v2
@@ -35830,6 +38980,13 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasCgetrfStridedBatched hipblasCgetrfStridedBatched_v2
 #define hipblasZgetrfStridedBatched hipblasZgetrfStridedBatched_v2
 
+#define hipblasCgetrfRefactor hipblasCgetrfRefactor_v2
+#define hipblasZgetrfRefactor hipblasZgetrfRefactor_v2
+#define hipblasCgetrfRefactorBatched hipblasCgetrfRefactorBatched_v2
+#define hipblasZgetrfRefactorBatched hipblasZgetrfRefactorBatched_v2
+#define hipblasCgetrfRefactorStridedBatched hipblasCgetrfRefactorStridedBatched_v2
+#define hipblasZgetrfRefactorStridedBatched hipblasZgetrfRefactorStridedBatched_v2
+
 #define hipblasCgetrs hipblasCgetrs_v2
 #define hipblasZgetrs hipblasZgetrs_v2
 #define hipblasCgetrsBatched hipblasCgetrsBatched_v2
@@ -35854,6 +39011,19 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx_v2_64(hipblasHandle_t
 #define hipblasCgeqrfStridedBatched hipblasCgeqrfStridedBatched_v2
 #define hipblasZgeqrfStridedBatched hipblasZgeqrfStridedBatched_v2
 
+#define hipblasCungqr hipblasCungqr_v2
+#define hipblasZungqr hipblasZungqr_v2
+#define hipblasCungqrBatched hipblasCungqrBatched_v2
+#define hipblasZungqrBatched hipblasZungqrBatched_v2
+#define hipblasCungqrStridedBatched hipblasCungqrStridedBatched_v2
+#define hipblasZungqrStridedBatched hipblasZungqrStridedBatched_v2
+#define hipblasCunmqr hipblasCunmqr_v2
+#define hipblasZunmqr hipblasZunmqr_v2
+#define hipblasCunmqrBatched hipblasCunmqrBatched_v2
+#define hipblasZunmqrBatched hipblasZunmqrBatched_v2
+#define hipblasCunmqrStridedBatched hipblasCunmqrStridedBatched_v2
+#define hipblasZunmqrStridedBatched hipblasZunmqrStridedBatched_v2
+
 #endif
 
 /*! HIPBLAS Auxiliary API
@@ -0,0 +1,572 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+//! Asynchronous C++ interface to hipBLAS
+//!
+//! Header only layer over the C API. Calls return a hipblas::future which is completed when the
+//! work queued on the stream of the handle has finished, as seen by a single completion poller
+//! thread querying stream events. With C++20 coroutines a future can be awaited:
+//!
+//!     hipblasStatus_t status = co_await hipblas::gemm(handle, ...).via(executor);
+//!
+//! where executor is any callable taking a std::function<void()>, such as a lambda posting the
+//! function to the event loop or thread pool of the caller. Continuations attached by then
+//! without an executor, and coroutines awaiting a future without via, run on the poller thread.
+//! They must not block: every other future waits for them, and one waiting for another future
+//! never returns.
+//!
+//! hipblas::shutdown stops the poller while the HIP runtime is still usable. Otherwise the poller
+//! is stopped at exit without HIP calls, when the runtime may already be torn down, so its events
+//! are not destroyed and futures still pending are never completed.
+
+#ifndef HIPBLAS_ASYNC_HPP
+#define HIPBLAS_ASYNC_HPP
+
+#include "hipblas.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if __cplusplus >= 202002L && __has_include(<coroutine>)
+#include <coroutine>
+#define HIPBLAS_ASYNC_COROUTINES 1
+#endif
+
+namespace hipblas
+{
+    namespace detail
+    {
+        // Completion state shared by a future and the poller
+        struct future_state
+        {
+            std::mutex              mutex;
+            std::condition_variable cv;
+            bool                    ready  = false;
+            hipblasStatus_t         status = HIPBLAS_STATUS_SUCCESS;
+            std::function<void()>   continuation;
+
+            void complete(hipblasStatus_t result)
+            {
+                std::function<void()> next;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    status = result;
+                    ready  = true;
+                    next   = std::move(continuation);
+                }
+                cv.notify_all();
+                if(next)
+                    next();
+            }
+
+            // Stores next to run on completion, or returns false if the state is already ready
+            bool set_continuation(std::function<void()> next)
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                if(ready)
+                    return false;
+                continuation = std::move(next);
+                return true;
+            }
+        };
+
+        // A thread which queries the events of pending futures, backing off exponentially between
+        // queries that find nothing finished, and sleeping while nothing is pending
+        class completion_poller
+        {
+        public:
+            static completion_poller& instance()
+            {
+                static completion_poller poller;
+                return poller;
+            }
+
+            // Returns an event from the pool, or nullptr if none can be created
+            hipEvent_t acquire_event()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!event_pool.empty())
+                    {
+                        hipEvent_t event = event_pool.back();
+                        event_pool.pop_back();
+                        return event;
+                    }
+                }
+                hipEvent_t event;
+                if(hipEventCreateWithFlags(&event, hipEventDisableTiming) != hipSuccess)
+                    return nullptr;
+                return event;
+            }
+
+            // Returns event to the pool, or destroys it once the poller has stopped
+            void release_event(hipEvent_t event)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!stop)
+                    {
+                        event_pool.push_back(event);
+                        return;
+                    }
+                }
+                (void)hipEventDestroy(event);
+            }
+
+            // Completes state once the work recorded by event has finished. Once the poller is
+            // stopping, the work is waited for at once.
+            void watch(hipEvent_t event, std::shared_ptr<future_state> state)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if(!stop)
+                    {
+                        incoming.push_back({event, std::move(state)});
+                        cv.notify_one();
+                        return;
+                    }
+                }
+                drain({event, std::move(state)});
+            }
+
+            // Stops the thread once the pending futures are completed and destroys the events of
+            // the pool. Later work is waited for by the thread queuing it.
+            void shutdown()
+            {
+                halt(false);
+                std::vector<hipEvent_t> events;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    events.swap(event_pool);
+                }
+                for(hipEvent_t event : events)
+                    (void)hipEventDestroy(event);
+            }
+
+            completion_poller(const completion_poller&) = delete;
+            completion_poller& operator=(const completion_poller&) = delete;
+
+        private:
+            struct pending_event
+            {
+                hipEvent_t                    event;
+                std::shared_ptr<future_state> state;
+            };
+
+            struct finished_event
+            {
+                pending_event   pending;
+                hipblasStatus_t status;
+            };
+
+            static constexpr std::chrono::microseconds min_backoff{2};
+            static constexpr std::chrono::microseconds max_backoff{200};
+
+            std::mutex                 mutex;
+            std::condition_variable    cv;
+            std::vector<pending_event> incoming;
+            std::vector<hipEvent_t>    event_pool;
+            bool                       stop    = false;
+            bool                       exiting = false;
+            std::thread                thread;
+
+            completion_poller()
+                : thread([this] { run(); })
+            {
+            }
+
+            // Runs during static destruction, after which the HIP runtime may be gone, so the
+            // thread is stopped without waiting for pending work and the events are leaked
+            ~completion_poller()
+            {
+                halt(true);
+            }
+
+            // Stops the thread, which completes the pending futures first unless exiting
+            void halt(bool at_exit)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    stop    = true;
+                    exiting = at_exit;
+                }
+                cv.notify_one();
+                if(thread.joinable() && thread.get_id() != std::this_thread::get_id())
+                    thread.join();
+            }
+
+            // Waits for the work of p and completes its future
+            void drain(pending_event p)
+            {
+                hipblasStatus_t status = hipEventSynchronize(p.event) == hipSuccess
+                                             ? HIPBLAS_STATUS_SUCCESS
+                                             : HIPBLAS_STATUS_EXECUTION_FAILED;
+                release_event(p.event);
+                p.state->complete(status);
+            }
+
+            void run()
+            {
+                std::vector<pending_event>  pending;
+                std::vector<finished_event> done;
+                auto                        backoff = min_backoff;
+                while(true)
+                {
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        if(pending.empty())
+                            cv.wait(lock, [this] { return stop || !incoming.empty(); });
+                        pending.insert(pending.end(), incoming.begin(), incoming.end());
+                        incoming.clear();
+                        if(stop)
+                            break;
+                    }
+
+                    // events are queried without the lock, so submissions are not held up
+                    size_t kept = 0;
+                    for(size_t i = 0; i < pending.size(); i++)
+                    {
+                        hipError_t result = hipEventQuery(pending[i].event);
+                        if(result == hipErrorNotReady)
+                        {
+                            if(kept != i)
+                                pending[kept] = std::move(pending[i]);
+                            kept++;
+                        }
+                        else
+                        {
+                            hipblasStatus_t status = result == hipSuccess
+                                                         ? HIPBLAS_STATUS_SUCCESS
+                                                         : HIPBLAS_STATUS_EXECUTION_FAILED;
+                            done.push_back({std::move(pending[i]), status});
+                        }
+                    }
+                    pending.resize(kept);
+
+                    if(done.empty())
+                    {
+                        std::this_thread::sleep_for(backoff);
+                        backoff = std::min(backoff * 2, max_backoff);
+                        continue;
+                    }
+                    backoff = min_backoff;
+
+                    for(finished_event& d : done)
+                    {
+                        release_event(d.pending.event);
+                        d.pending.state->complete(d.status);
+                    }
+                    done.clear();
+                }
+
+                // futures still pending on shutdown are completed, so that no waiter is left
+                // blocked, but at exit the runtime may be gone and they are abandoned
+                bool abandon;
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    abandon = exiting;
+                }
+                if(!abandon)
+                    for(pending_event& p : pending)
+                        drain(std::move(p));
+            }
+        };
+    } // namespace detail
+
+    // The status of asynchronous hipBLAS work, which is ready once the work has finished on the
+    // device. Errors found when the work is queued make the future ready at once.
+    class future
+    {
+    public:
+        future() = default;
+
+        explicit future(std::shared_ptr<detail::future_state> state)
+            : state(std::move(state))
+        {
+        }
+
+        static future make_ready(hipblasStatus_t status)
+        {
+            auto state    = std::make_shared<detail::future_state>();
+            state->ready  = true;
+            state->status = status;
+            return future(std::move(state));
+        }
+
+        bool valid() const
+        {
+            return state != nullptr;
+        }
+
+        bool ready() const
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            return state->ready;
+        }
+
+        // Blocks until the work has finished and returns its status
+        hipblasStatus_t wait() const
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            state->cv.wait(lock, [this] { return state->ready; });
+            return state->status;
+        }
+
+        // Calls f(status) through executor once the work has finished. At most one continuation
+        // or awaiting coroutine may be attached to a future.
+        template <typename Executor, typename F>
+        void then(Executor executor, F f) const
+        {
+            auto state = this->state;
+            auto next  = [state, executor, f]() mutable {
+                executor([state, f]() mutable { f(state->status); });
+            };
+            if(!state->set_continuation(next))
+                next();
+        }
+
+        // Calls f(status) on the poller thread, or at once if the work has already finished.
+        // f must not block, nor wait for another future, which the poller would never complete.
+        template <typename F>
+        void then(F f) const
+        {
+            then([](std::function<void()> g) { g(); }, std::move(f));
+        }
+
+#ifdef HIPBLAS_ASYNC_COROUTINES
+        // Resumes the awaiting coroutine on the poller thread, or at once if the work has
+        // already finished. The coroutine must not block until it next suspends; use via to
+        // resume it elsewhere.
+        auto operator co_await() const
+        {
+            struct awaiter
+            {
+                std::shared_ptr<detail::future_state> state;
+
+                bool await_ready() const
+                {
+                    std::lock_guard<std::mutex> lock(state->mutex);
+                    return state->ready;
+                }
+
+                bool await_suspend(std::coroutine_handle<> handle)
+                {
+                    return state->set_continuation([handle] { handle.resume(); });
+                }
+
+                hipblasStatus_t await_resume() const
+                {
+                    return state->status;
+                }
+            };
+            return awaiter{state};
+        }
+
+        // Resumes the awaiting coroutine through executor
+        template <typename Executor>
+        auto via(Executor executor) const
+        {
+            struct awaiter
+            {
+                std::shared_ptr<detail::future_state> state;
+                Executor                              executor;
+
+                bool await_ready() const
+                {
+                    return false;
+                }
+
+                void await_suspend(std::coroutine_handle<> handle)
+                {
+                    // the executor may resume the coroutine before it returns, which destroys
+                    // this awaiter, so it is called through a local copy
+                    auto next = [this, handle] {
+                        Executor run = executor;
+                        run([handle] { handle.resume(); });
+                    };
+                    if(!state->set_continuation(next))
+                        next();
+                }
+
+                hipblasStatus_t await_resume() const
+                {
+                    return state->status;
+                }
+            };
+            return awaiter{state, std::move(executor)};
+        }
+#endif
+
+    private:
+        std::shared_ptr<detail::future_state> state;
+    };
+
+    // Waits for the pending futures to complete, then stops the poller thread and destroys its
+    // events. Call it before the program exits, while the HIP runtime is usable, and not from a
+    // continuation. Work queued afterwards is waited for by the thread queuing it.
+    inline void shutdown()
+    {
+        detail::completion_poller::instance().shutdown();
+    }
+
+    // Queues the hipBLAS call made by call(), which returns a hipblasStatus_t, and returns a
+    // future completed when the stream of handle reaches the end of the queued work. Arguments
+    // such as host scalars are read by call() before async returns.
+    template <typename F>
+    future async(hipblasHandle_t handle, F&& call)
+    {
+        hipblasStatus_t status = std::forward<F>(call)();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return future::make_ready(status);
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return future::make_ready(status);
+
+        auto&      poller = detail::completion_poller::instance();
+        hipEvent_t event  = poller.acquire_event();
+        if(!event)
+            return future::make_ready(HIPBLAS_STATUS_ALLOC_FAILED);
+        if(hipEventRecord(event, stream) != hipSuccess)
+        {
+            poller.release_event(event);
+            return future::make_ready(HIPBLAS_STATUS_INTERNAL_ERROR);
+        }
+
+        auto state = std::make_shared<detail::future_state>();
+        poller.watch(event, state);
+        return future(std::move(state));
+    }
+
+    namespace detail
+    {
+        inline hipblasStatus_t gemm(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const float*       alpha,
+                                    const float*       A,
+                                    int                lda,
+                                    const float*       B,
+                                    int                ldb,
+                                    const float*       beta,
+                                    float*             C,
+                                    int                ldc)
+        {
+            return hipblasSgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        }
+
+        inline hipblasStatus_t gemm(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    int                lda,
+                                    const double*      B,
+                                    int                ldb,
+                                    const double*      beta,
+                                    double*            C,
+                                    int                ldc)
+        {
+            return hipblasDgemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        }
+
+        inline hipblasStatus_t gemm(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const hipComplex*  alpha,
+                                    const hipComplex*  A,
+                                    int                lda,
+                                    const hipComplex*  B,
+                                    int                ldb,
+                                    const hipComplex*  beta,
+                                    hipComplex*        C,
+                                    int                ldc)
+        {
+            return hipblasCgemm_v2(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        }
+
+        inline hipblasStatus_t gemm(hipblasHandle_t         handle,
+                                    hipblasOperation_t      transA,
+                                    hipblasOperation_t      transB,
+                                    int                     m,
+                                    int                     n,
+                                    int                     k,
+                                    const hipDoubleComplex* alpha,
+                                    const hipDoubleComplex* A,
+                                    int                     lda,
+                                    const hipDoubleComplex* B,
+                                    int                     ldb,
+                                    const hipDoubleComplex* beta,
+                                    hipDoubleComplex*       C,
+                                    int                     ldc)
+        {
+            return hipblasZgemm_v2(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        }
+    } // namespace detail
+
+    // gemm for float, double, hipComplex and hipDoubleComplex, see hipblasSgemm
+    template <typename T>
+    future gemm(hipblasHandle_t    handle,
+                hipblasOperation_t transA,
+                hipblasOperation_t transB,
+                int                m,
+                int                n,
+                int                k,
+                const T*           alpha,
+                const T*           A,
+                int                lda,
+                const T*           B,
+                int                ldb,
+                const T*           beta,
+                T*                 C,
+                int                ldc)
+    {
+        return async(handle, [&] {
+            return detail::gemm(
+                handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+        });
+    }
+} // namespace hipblas
+
+#endif // HIPBLAS_ASYNC_HPP
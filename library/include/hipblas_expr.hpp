@@ -0,0 +1,973 @@
+/* ************************************************************************
+ * Copyright (C) 2016-2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ *
+ * ************************************************************************ */
+
+
+//! Expression interface to hipBLAS
+//!
+//! Header only layer over the C API. Views of matrices and vectors in device memory combine into
+//! expressions which are mapped at compile time onto the hipBLAS routine doing the least work:
+//!
+//!     C = alpha * A * B + beta * C;           // gemm
+//!     C = transpose(A) * B;                   // gemm with op(A) = A^T
+//!     lower(C) = A * transpose(A) + beta * C; // syrk, writing the lower triangle of C only
+//!     upper(C) = alpha * adjoint(A) * A;      // herk
+//!     C = alpha * upper(A) * B;               // trmm
+//!     C = symmetric(A, uplo) * B + C;         // symm, and hemm for hermitian(A, uplo)
+//!     y = alpha * A * x + beta * y;           // gemv, and symv or hemv likewise
+//!     y = lower(A) * x;                       // trmv
+//!
+//! The routine is chosen from the types in the expression alone, and expressions with no matching
+//! routine, such as a product of three matrices, do not compile. Assigning to a view throws
+//! hipblas::error when the sizes do not match or the call fails, while hipblas::assign returns the
+//! status. Scalars are passed from the host whatever the pointer mode of the handle is.
+//!
+//! The mapping uses if constexpr and the _v type traits, so the header requires C++17.
+
+#ifndef HIPBLAS_EXPR_HPP
+#define HIPBLAS_EXPR_HPP
+
+#if __cplusplus < 201703L
+#error "hipblas_expr.hpp requires C++17"
+#endif
+
+#include "hipblas.h"
+
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace hipblas
+{
+    // Thrown when assigning an expression to a view fails
+    class error : public std::runtime_error
+    {
+    public:
+        explicit error(hipblasStatus_t status)
+            : std::runtime_error(hipblasStatusToString(status))
+            , status(status)
+        {
+        }
+
+        hipblasStatus_t status;
+    };
+
+    template <typename T>
+    struct matrix_view;
+    template <typename T>
+    struct vector_view;
+
+    template <typename Target, typename E>
+    hipblasStatus_t assign(const Target& target, const E& expr);
+
+    namespace detail
+    {
+        // hipBLAS routines by element type. For real types the hermitian routines are the
+        // symmetric ones.
+        template <typename T>
+        struct routines;
+
+        template <>
+        struct routines<float>
+        {
+            using real_type                  = float;
+            static constexpr bool is_complex = false;
+            static constexpr auto gemm       = hipblasSgemm;
+            static constexpr auto symm       = hipblasSsymm;
+            static constexpr auto hemm       = hipblasSsymm;
+            static constexpr auto syrk       = hipblasSsyrk;
+            static constexpr auto herk       = hipblasSsyrk;
+            static constexpr auto trmm       = hipblasStrmm;
+            static constexpr auto gemv       = hipblasSgemv;
+            static constexpr auto symv       = hipblasSsymv;
+            static constexpr auto hemv       = hipblasSsymv;
+            static constexpr auto trmv       = hipblasStrmv;
+            static constexpr auto copy       = hipblasScopy;
+            static constexpr auto scal       = hipblasSscal;
+        };
+
+        template <>
+        struct routines<double>
+        {
+            using real_type                  = double;
+            static constexpr bool is_complex = false;
+            static constexpr auto gemm       = hipblasDgemm;
+            static constexpr auto symm       = hipblasDsymm;
+            static constexpr auto hemm       = hipblasDsymm;
+            static constexpr auto syrk       = hipblasDsyrk;
+            static constexpr auto herk       = hipblasDsyrk;
+            static constexpr auto trmm       = hipblasDtrmm;
+            static constexpr auto gemv       = hipblasDgemv;
+            static constexpr auto symv       = hipblasDsymv;
+            static constexpr auto hemv       = hipblasDsymv;
+            static constexpr auto trmv       = hipblasDtrmv;
+            static constexpr auto copy       = hipblasDcopy;
+            static constexpr auto scal       = hipblasDscal;
+        };
+
+        template <>
+        struct routines<hipComplex>
+        {
+            using real_type                  = float;
+            static constexpr bool is_complex = true;
+            static constexpr auto gemm       = hipblasCgemm_v2;
+            static constexpr auto symm       = hipblasCsymm_v2;
+            static constexpr auto hemm       = hipblasChemm_v2;
+            static constexpr auto syrk       = hipblasCsyrk_v2;
+            static constexpr auto herk       = hipblasCherk_v2;
+            static constexpr auto trmm       = hipblasCtrmm_v2;
+            static constexpr auto gemv       = hipblasCgemv_v2;
+            static constexpr auto symv       = hipblasCsymv_v2;
+            static constexpr auto hemv       = hipblasChemv_v2;
+            static constexpr auto trmv       = hipblasCtrmv_v2;
+            static constexpr auto copy       = hipblasCcopy_v2;
+            static constexpr auto scal       = hipblasCscal_v2;
+        };
+
+        template <>
+        struct routines<hipDoubleComplex>
+        {
+            using real_type                  = double;
+            static constexpr bool is_complex = true;
+            static constexpr auto gemm       = hipblasZgemm_v2;
+            static constexpr auto symm       = hipblasZsymm_v2;
+            static constexpr auto hemm       = hipblasZhemm_v2;
+            static constexpr auto syrk       = hipblasZsyrk_v2;
+            static constexpr auto herk       = hipblasZherk_v2;
+            static constexpr auto trmm       = hipblasZtrmm_v2;
+            static constexpr auto gemv       = hipblasZgemv_v2;
+            static constexpr auto symv       = hipblasZsymv_v2;
+            static constexpr auto hemv       = hipblasZhemv_v2;
+            static constexpr auto trmv       = hipblasZtrmv_v2;
+            static constexpr auto copy       = hipblasZcopy_v2;
+            static constexpr auto scal       = hipblasZscal_v2;
+        };
+
+        template <typename T>
+        T make_scalar(double value)
+        {
+            if constexpr(routines<T>::is_complex)
+            {
+                T scalar{};
+                scalar.x = static_cast<typename routines<T>::real_type>(value);
+                scalar.y = 0;
+                return scalar;
+            }
+            else
+                return T(value);
+        }
+
+        template <typename T>
+        T multiply(const T& a, const T& b)
+        {
+            if constexpr(routines<T>::is_complex)
+            {
+                T product{};
+                product.x = a.x * b.x - a.y * b.y;
+                product.y = a.x * b.y + a.y * b.x;
+                return product;
+            }
+            else
+                return a * b;
+        }
+
+        template <typename T>
+        bool is_real(const T& value)
+        {
+            if constexpr(routines<T>::is_complex)
+                return value.y == 0;
+            else
+                return true;
+        }
+
+        template <typename T>
+        bool is_one(const T& value)
+        {
+            if constexpr(routines<T>::is_complex)
+                return value.x == 1 && value.y == 0;
+            else
+                return value == 1;
+        }
+
+        template <typename T>
+        typename routines<T>::real_type real_part(const T& value)
+        {
+            if constexpr(routines<T>::is_complex)
+                return value.x;
+            else
+                return value;
+        }
+
+        // Throws the status of a failed assignment
+        inline void check(hipblasStatus_t status)
+        {
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw error(status);
+        }
+    } // namespace detail
+
+    // A column major rows x cols matrix in device memory used with handle. Assigning an
+    // expression to a view writes the result to its memory, views are never rebound.
+    template <typename T>
+    struct matrix_view
+    {
+        hipblasHandle_t handle;
+        T*              data;
+        int             rows;
+        int             cols;
+        int             ld;
+
+        matrix_view(hipblasHandle_t handle, T* data, int rows, int cols, int ld)
+            : handle(handle)
+            , data(data)
+            , rows(rows)
+            , cols(cols)
+            , ld(ld)
+        {
+        }
+
+        matrix_view(hipblasHandle_t handle, T* data, int rows, int cols)
+            : matrix_view(handle, data, rows, cols, rows)
+        {
+        }
+
+        matrix_view(const matrix_view&) = default;
+        matrix_view& operator=(const matrix_view&) = delete;
+
+        template <typename E>
+        matrix_view& operator=(const E& expr)
+        {
+            detail::check(assign(*this, expr));
+            return *this;
+        }
+    };
+
+    // A vector of n elements with increment inc in device memory used with handle
+    template <typename T>
+    struct vector_view
+    {
+        hipblasHandle_t handle;
+        T*              data;
+        int             n;
+        int             inc;
+
+        vector_view(hipblasHandle_t handle, T* data, int n, int inc = 1)
+            : handle(handle)
+            , data(data)
+            , n(n)
+            , inc(inc)
+        {
+        }
+
+        vector_view(const vector_view&) = default;
+        vector_view& operator=(const vector_view&) = delete;
+
+        template <typename E>
+        vector_view& operator=(const E& expr)
+        {
+            detail::check(assign(*this, expr));
+            return *this;
+        }
+    };
+
+    // op(A) for op = HIPBLAS_OP_N, HIPBLAS_OP_T or HIPBLAS_OP_C
+    template <typename T, hipblasOperation_t Op>
+    struct op_view
+    {
+        matrix_view<T> A;
+    };
+
+    // The triangle uplo of A, which is transposed by trans in products. As the target of an
+    // assignment, the triangle is the part of a symmetric or hermitian result which is written.
+    template <typename T>
+    struct triangular_view
+    {
+        matrix_view<T>     A;
+        hipblasFillMode_t  uplo;
+        hipblasDiagType_t  diag;
+        hipblasOperation_t trans;
+
+        template <typename E>
+        const triangular_view& operator=(const E& expr) const
+        {
+            detail::check(assign(*this, expr));
+            return *this;
+        }
+    };
+
+    // A symmetric matrix, or hermitian when Hermitian is true, stored in the triangle uplo of A
+    template <typename T, bool Hermitian>
+    struct symmetric_view
+    {
+        matrix_view<T>    A;
+        hipblasFillMode_t uplo;
+    };
+
+    template <typename T>
+    op_view<T, HIPBLAS_OP_T> transpose(const matrix_view<T>& A)
+    {
+        return {A};
+    }
+
+    template <typename T>
+    op_view<T, HIPBLAS_OP_C> adjoint(const matrix_view<T>& A)
+    {
+        return {A};
+    }
+
+    template <typename T>
+    triangular_view<T> lower(const matrix_view<T>& A)
+    {
+        return {A, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_DIAG_NON_UNIT, HIPBLAS_OP_N};
+    }
+
+    template <typename T>
+    triangular_view<T> upper(const matrix_view<T>& A)
+    {
+        return {A, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_DIAG_NON_UNIT, HIPBLAS_OP_N};
+    }
+
+    template <typename T>
+    triangular_view<T> unit_lower(const matrix_view<T>& A)
+    {
+        return {A, HIPBLAS_FILL_MODE_LOWER, HIPBLAS_DIAG_UNIT, HIPBLAS_OP_N};
+    }
+
+    template <typename T>
+    triangular_view<T> unit_upper(const matrix_view<T>& A)
+    {
+        return {A, HIPBLAS_FILL_MODE_UPPER, HIPBLAS_DIAG_UNIT, HIPBLAS_OP_N};
+    }
+
+    template <typename T>
+    triangular_view<T> transpose(const triangular_view<T>& A)
+    {
+        return {A.A, A.uplo, A.diag, A.trans == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N};
+    }
+
+    template <typename T>
+    triangular_view<T> adjoint(const triangular_view<T>& A)
+    {
+        return {A.A, A.uplo, A.diag, A.trans == HIPBLAS_OP_N ? HIPBLAS_OP_C : HIPBLAS_OP_N};
+    }
+
+    template <typename T>
+    symmetric_view<T, false> symmetric(const matrix_view<T>& A, hipblasFillMode_t uplo)
+    {
+        return {A, uplo};
+    }
+
+    template <typename T>
+    symmetric_view<T, true> hermitian(const matrix_view<T>& A, hipblasFillMode_t uplo)
+    {
+        return {A, uplo};
+    }
+
+    namespace detail
+    {
+        struct none
+        {
+        };
+
+        template <typename L, typename R>
+        struct product
+        {
+            L lhs;
+            R rhs;
+        };
+
+        template <typename X, typename T>
+        struct scaled
+        {
+            T alpha;
+            X operand;
+        };
+
+        // alpha * prod + beta * addend, with no addend when C is none
+        template <typename P, typename C, typename T>
+        struct linear
+        {
+            T alpha;
+            P prod;
+            T beta;
+            C addend;
+        };
+
+        template <typename X>
+        struct operand_traits
+        {
+            static constexpr bool value = false;
+        };
+
+        template <typename T>
+        struct operand_traits<matrix_view<T>>
+        {
+            static constexpr bool value = true;
+            using type                  = T;
+        };
+
+        template <typename T>
+        struct operand_traits<vector_view<T>>
+        {
+            static constexpr bool value = true;
+            using type                  = T;
+        };
+
+        template <typename T, hipblasOperation_t Op>
+        struct operand_traits<op_view<T, Op>>
+        {
+            static constexpr bool value = true;
+            using type                  = T;
+        };
+
+        template <typename T>
+        struct operand_traits<triangular_view<T>>
+        {
+            static constexpr bool value = true;
+            using type                  = T;
+        };
+
+        template <typename T, bool Hermitian>
+        struct operand_traits<symmetric_view<T, Hermitian>>
+        {
+            static constexpr bool value = true;
+            using type                  = T;
+        };
+
+        template <typename X>
+        constexpr bool is_operand = operand_traits<X>::value;
+
+        template <typename X>
+        using value_type = typename operand_traits<X>::type;
+
+        template <typename X>
+        constexpr bool is_addend = false;
+
+        template <typename T>
+        constexpr bool is_addend<matrix_view<T>> = true;
+
+        template <typename T>
+        constexpr bool is_addend<vector_view<T>> = true;
+
+        template <typename S, typename T>
+        constexpr bool is_scalar_of = std::is_arithmetic_v<S> || std::is_same_v<S, T>;
+
+        template <typename T, typename S>
+        T to_scalar(const S& value)
+        {
+            if constexpr(std::is_same_v<S, T>)
+                return value;
+            else
+                return make_scalar<T>(double(value));
+        }
+
+        // A matrix enters products as op(A) with op = HIPBLAS_OP_N
+        template <typename X>
+        const X& as_operand(const X& x)
+        {
+            return x;
+        }
+
+        template <typename T>
+        op_view<T, HIPBLAS_OP_N> as_operand(const matrix_view<T>& A)
+        {
+            return {A};
+        }
+
+        template <typename X>
+        using operand_t = std::decay_t<decltype(as_operand(std::declval<const X&>()))>;
+
+        template <typename T, typename L, typename R>
+        linear<product<operand_t<L>, operand_t<R>>, none, T>
+            make_product(const T& alpha, const L& lhs, const R& rhs)
+        {
+            static_assert(std::is_same_v<value_type<L>, value_type<R>>,
+                          "operands of a product must have the same element type");
+            return {alpha, {as_operand(lhs), as_operand(rhs)}, make_scalar<T>(0), {}};
+        }
+    } // namespace detail
+
+    // A * B
+    template <typename L,
+              typename R,
+              std::enable_if_t<detail::is_operand<L> && detail::is_operand<R>, int> = 0>
+    auto operator*(const L& lhs, const R& rhs)
+    {
+        using T = detail::value_type<L>;
+        return detail::make_product(detail::make_scalar<T>(1), lhs, rhs);
+    }
+
+    // alpha * A
+    template <typename S,
+              typename X,
+              std::enable_if_t<detail::is_operand<X>
+                                   && detail::is_scalar_of<S, detail::value_type<X>>,
+                               int> = 0>
+    detail::scaled<X, detail::value_type<X>> operator*(const S& alpha, const X& x)
+    {
+        return {detail::to_scalar<detail::value_type<X>>(alpha), x};
+    }
+
+    // (alpha * A) * B
+    template <typename X, typename T, typename R, std::enable_if_t<detail::is_operand<R>, int> = 0>
+    auto operator*(const detail::scaled<X, T>& lhs, const R& rhs)
+    {
+        return detail::make_product(lhs.alpha, lhs.operand, rhs);
+    }
+
+    // A * (alpha * B)
+    template <typename L, typename X, typename T, std::enable_if_t<detail::is_operand<L>, int> = 0>
+    auto operator*(const L& lhs, const detail::scaled<X, T>& rhs)
+    {
+        return detail::make_product(rhs.alpha, lhs, rhs.operand);
+    }
+
+    // alpha * (A * B)
+    template <typename S,
+              typename P,
+              typename T,
+              std::enable_if_t<detail::is_scalar_of<S, T>, int> = 0>
+    detail::linear<P, detail::none, T> operator*(const S& alpha,
+                                                 const detail::linear<P, detail::none, T>& expr)
+    {
+        return {detail::multiply(detail::to_scalar<T>(alpha), expr.alpha),
+                expr.prod,
+                expr.beta,
+                expr.addend};
+    }
+
+    // A * B + beta * C
+    template <typename P, typename T, typename C, std::enable_if_t<detail::is_addend<C>, int> = 0>
+    detail::linear<P, C, T> operator+(const detail::linear<P, detail::none, T>& expr,
+                                      const detail::scaled<C, T>&               addend)
+    {
+        return {expr.alpha, expr.prod, addend.alpha, addend.operand};
+    }
+
+    // A * B + C
+    template <typename P, typename T, typename C, std::enable_if_t<detail::is_addend<C>, int> = 0>
+    detail::linear<P, C, T> operator+(const detail::linear<P, detail::none, T>& expr,
+                                      const C&                                  addend)
+    {
+        return {expr.alpha, expr.prod, detail::make_scalar<T>(1), addend};
+    }
+
+    // beta * C + A * B
+    template <typename P, typename T, typename C, std::enable_if_t<detail::is_addend<C>, int> = 0>
+    detail::linear<P, C, T> operator+(const detail::scaled<C, T>&               addend,
+                                      const detail::linear<P, detail::none, T>& expr)
+    {
+        return expr + addend;
+    }
+
+    // C + A * B
+    template <typename P, typename T, typename C, std::enable_if_t<detail::is_addend<C>, int> = 0>
+    detail::linear<P, C, T> operator+(const C&                                  addend,
+                                      const detail::linear<P, detail::none, T>& expr)
+    {
+        return expr + addend;
+    }
+
+    namespace detail
+    {
+        template <typename E>
+        constexpr bool always_false = false;
+
+        inline int op_rows(int rows, int cols, hipblasOperation_t op)
+        {
+            return op == HIPBLAS_OP_N ? rows : cols;
+        }
+
+        template <typename T>
+        bool same_view(const matrix_view<T>& a, const matrix_view<T>& b)
+        {
+            return a.data == b.data && a.rows == b.rows && a.cols == b.cols && a.ld == b.ld;
+        }
+
+        template <typename T>
+        bool same_view(const vector_view<T>& a, const vector_view<T>& b)
+        {
+            return a.data == b.data && a.n == b.n && a.inc == b.inc;
+        }
+
+        // Without an addend beta is zero and any target is accepted
+        template <typename V>
+        bool same_view(const V&, none)
+        {
+            return true;
+        }
+
+        template <typename T>
+        hipblasHandle_t handle_of(const matrix_view<T>& target)
+        {
+            return target.handle;
+        }
+
+        template <typename T>
+        hipblasHandle_t handle_of(const vector_view<T>& target)
+        {
+            return target.handle;
+        }
+
+        template <typename T>
+        hipblasHandle_t handle_of(const triangular_view<T>& target)
+        {
+            return target.A.handle;
+        }
+
+        // Expressions which match none of the overloads below
+        template <typename Target, typename E>
+        hipblasStatus_t evaluate(const Target&, const E&)
+        {
+            static_assert(always_false<E>, "the expression does not map onto a hipBLAS routine");
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+
+        // C = alpha * op(A) * op(B) + beta * C with gemm
+        template <typename T, hipblasOperation_t OpA, hipblasOperation_t OpB, typename C>
+        hipblasStatus_t
+            evaluate(const matrix_view<T>&                                             target,
+                     const linear<product<op_view<T, OpA>, op_view<T, OpB>>, C, T>& expr)
+        {
+            const matrix_view<T>& A = expr.prod.lhs.A;
+            const matrix_view<T>& B = expr.prod.rhs.A;
+
+            int k = op_rows(A.cols, A.rows, OpA);
+            if(op_rows(A.rows, A.cols, OpA) != target.rows
+               || op_rows(B.cols, B.rows, OpB) != target.cols
+               || op_rows(B.rows, B.cols, OpB) != k || !same_view(target, expr.addend))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            return routines<T>::gemm(target.handle,
+                                     OpA,
+                                     OpB,
+                                     target.rows,
+                                     target.cols,
+                                     k,
+                                     &expr.alpha,
+                                     A.data,
+                                     A.ld,
+                                     B.data,
+                                     B.ld,
+                                     &expr.beta,
+                                     target.data,
+                                     target.ld);
+        }
+
+        // tri(C) = alpha * A * op(A) + beta * C or alpha * op(A) * A + beta * C with syrk, or
+        // herk when op is the conjugate transpose. Only the triangle of C is computed, with half
+        // the work of gemm.
+        template <typename T, hipblasOperation_t OpA, hipblasOperation_t OpB, typename C>
+        hipblasStatus_t
+            evaluate(const triangular_view<T>&                                         target,
+                     const linear<product<op_view<T, OpA>, op_view<T, OpB>>, C, T>& expr)
+        {
+            constexpr bool right = OpA == HIPBLAS_OP_N && OpB != HIPBLAS_OP_N;
+            constexpr bool left  = OpA != HIPBLAS_OP_N && OpB == HIPBLAS_OP_N;
+            static_assert(right || left,
+                          "only a matrix times its own transpose or adjoint gives a triangle");
+
+            constexpr hipblasOperation_t op = right ? OpB : OpA;
+
+            const matrix_view<T>& A = expr.prod.lhs.A;
+            const matrix_view<T>& D = target.A;
+
+            int n = D.rows;
+            int k = right ? A.cols : A.rows;
+            if(!same_view(A, expr.prod.rhs.A) || D.cols != n || op_rows(A.rows, A.cols, OpA) != n
+               || !same_view(D, expr.addend))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            if constexpr(op == HIPBLAS_OP_C && routines<T>::is_complex)
+            {
+                if(!is_real(expr.alpha) || !is_real(expr.beta))
+                    return HIPBLAS_STATUS_INVALID_VALUE;
+
+                typename routines<T>::real_type alpha = real_part(expr.alpha);
+                typename routines<T>::real_type beta  = real_part(expr.beta);
+                return routines<T>::herk(D.handle,
+                                         target.uplo,
+                                         right ? HIPBLAS_OP_N : HIPBLAS_OP_C,
+                                         n,
+                                         k,
+                                         &alpha,
+                                         A.data,
+                                         A.ld,
+                                         &beta,
+                                         D.data,
+                                         D.ld);
+            }
+            else
+            {
+                return routines<T>::syrk(D.handle,
+                                         target.uplo,
+                                         right ? HIPBLAS_OP_N : HIPBLAS_OP_T,
+                                         n,
+                                         k,
+                                         &expr.alpha,
+                                         A.data,
+                                         A.ld,
+                                         &expr.beta,
+                                         D.data,
+                                         D.ld);
+            }
+        }
+
+        // C = alpha * op(tri(A)) * B with trmm. C may be B.
+        template <typename T>
+        hipblasStatus_t
+            evaluate(const matrix_view<T>&                                                target,
+                     const linear<product<triangular_view<T>, op_view<T, HIPBLAS_OP_N>>, none, T>&
+                         expr)
+        {
+            const triangular_view<T>& A = expr.prod.lhs;
+            const matrix_view<T>&     B = expr.prod.rhs.A;
+
+            if(A.A.rows != target.rows || A.A.cols != target.rows || B.rows != target.rows
+               || B.cols != target.cols)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            return routines<T>::trmm(target.handle,
+                                     HIPBLAS_SIDE_LEFT,
+                                     A.uplo,
+                                     A.trans,
+                                     A.diag,
+                                     target.rows,
+                                     target.cols,
+                                     &expr.alpha,
+                                     A.A.data,
+                                     A.A.ld,
+                                     B.data,
+                                     B.ld,
+                                     target.data,
+                                     target.ld);
+        }
+
+        // C = alpha * B * op(tri(A)) with trmm. C may be B.
+        template <typename T>
+        hipblasStatus_t
+            evaluate(const matrix_view<T>&                                                target,
+                     const linear<product<op_view<T, HIPBLAS_OP_N>, triangular_view<T>>, none, T>&
+                         expr)
+        {
+            const matrix_view<T>&     B = expr.prod.lhs.A;
+            const triangular_view<T>& A = expr.prod.rhs;
+
+            if(A.A.rows != target.cols || A.A.cols != target.cols || B.rows != target.rows
+               || B.cols != target.cols)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            return routines<T>::trmm(target.handle,
+                                     HIPBLAS_SIDE_RIGHT,
+                                     A.uplo,
+                                     A.trans,
+                                     A.diag,
+                                     target.rows,
+                                     target.cols,
+                                     &expr.alpha,
+                                     A.A.data,
+                                     A.A.ld,
+                                     B.data,
+                                     B.ld,
+                                     target.data,
+                                     target.ld);
+        }
+
+        template <typename T, bool Hermitian>
+        hipblasStatus_t symm(const matrix_view<T>&               target,
+                             hipblasSideMode_t                   side,
+                             const symmetric_view<T, Hermitian>& A,
+                             const matrix_view<T>&               B,
+                             const T&                            alpha,
+                             const T&                            beta)
+        {
+            int n = side == HIPBLAS_SIDE_LEFT ? target.rows : target.cols;
+            if(A.A.rows != n || A.A.cols != n || B.rows != target.rows || B.cols != target.cols)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            constexpr auto routine = Hermitian ? routines<T>::hemm : routines<T>::symm;
+            return routine(target.handle,
+                           side,
+                           A.uplo,
+                           target.rows,
+                           target.cols,
+                           &alpha,
+                           A.A.data,
+                           A.A.ld,
+                           B.data,
+                           B.ld,
+                           &beta,
+                           target.data,
+                           target.ld);
+        }
+
+        // C = alpha * sym(A) * B + beta * C with symm or hemm
+        template <typename T, bool Hermitian, typename C>
+        hipblasStatus_t evaluate(
+            const matrix_view<T>&                                                         target,
+            const linear<product<symmetric_view<T, Hermitian>, op_view<T, HIPBLAS_OP_N>>, C, T>&
+                expr)
+        {
+            if(!same_view(target, expr.addend))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            return symm(
+                target, HIPBLAS_SIDE_LEFT, expr.prod.lhs, expr.prod.rhs.A, expr.alpha, expr.beta);
+        }
+
+        // C = alpha * B * sym(A) + beta * C with symm or hemm
+        template <typename T, bool Hermitian, typename C>
+        hipblasStatus_t evaluate(
+            const matrix_view<T>&                                                         target,
+            const linear<product<op_view<T, HIPBLAS_OP_N>, symmetric_view<T, Hermitian>>, C, T>&
+                expr)
+        {
+            if(!same_view(target, expr.addend))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            return symm(
+                target, HIPBLAS_SIDE_RIGHT, expr.prod.rhs, expr.prod.lhs.A, expr.alpha, expr.beta);
+        }
+
+        // y = alpha * op(A) * x + beta * y with gemv
+        template <typename T, hipblasOperation_t Op, typename C>
+        hipblasStatus_t
+            evaluate(const vector_view<T>&                                          target,
+                     const linear<product<op_view<T, Op>, vector_view<T>>, C, T>& expr)
+        {
+            const matrix_view<T>& A = expr.prod.lhs.A;
+            const vector_view<T>& x = expr.prod.rhs;
+
+            if(op_rows(A.rows, A.cols, Op) != target.n || op_rows(A.cols, A.rows, Op) != x.n
+               || !same_view(target, expr.addend))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            return routines<T>::gemv(target.handle,
+                                     Op,
+                                     A.rows,
+                                     A.cols,
+                                     &expr.alpha,
+                                     A.data,
+                                     A.ld,
+                                     x.data,
+                                     x.inc,
+                                     &expr.beta,
+                                     target.data,
+                                     target.inc);
+        }
+
+        // y = alpha * sym(A) * x + beta * y with symv or hemv
+        template <typename T, bool Hermitian, typename C>
+        hipblasStatus_t
+            evaluate(const vector_view<T>&                                                 target,
+                     const linear<product<symmetric_view<T, Hermitian>, vector_view<T>>, C, T>&
+                         expr)
+        {
+            const symmetric_view<T, Hermitian>& A = expr.prod.lhs;
+            const vector_view<T>&               x = expr.prod.rhs;
+
+            if(A.A.rows != target.n || A.A.cols != target.n || x.n != target.n
+               || !same_view(target, expr.addend))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            constexpr auto routine = Hermitian ? routines<T>::hemv : routines<T>::symv;
+            return routine(target.handle,
+                           A.uplo,
+                           target.n,
+                           &expr.alpha,
+                           A.A.data,
+                           A.A.ld,
+                           x.data,
+                           x.inc,
+                           &expr.beta,
+                           target.data,
+                           target.inc);
+        }
+
+        // y = alpha * op(tri(A)) * x with trmv, copying x to y first unless y is x
+        template <typename T>
+        hipblasStatus_t
+            evaluate(const vector_view<T>&                                                target,
+                     const linear<product<triangular_view<T>, vector_view<T>>, none, T>& expr)
+        {
+            const triangular_view<T>& A = expr.prod.lhs;
+            const vector_view<T>&     x = expr.prod.rhs;
+
+            int n = target.n;
+            if(A.A.rows != n || A.A.cols != n || x.n != n)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+
+            hipblasStatus_t status;
+            if(!same_view(target, x))
+            {
+                status = routines<T>::copy(
+                    target.handle, n, x.data, x.inc, target.data, target.inc);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+            }
+
+            status = routines<T>::trmv(target.handle,
+                                       A.uplo,
+                                       A.trans,
+                                       A.diag,
+                                       n,
+                                       A.A.data,
+                                       A.A.ld,
+                                       target.data,
+                                       target.inc);
+            if(status != HIPBLAS_STATUS_SUCCESS || is_one(expr.alpha))
+                return status;
+
+            return routines<T>::scal(target.handle, n, &expr.alpha, target.data, target.inc);
+        }
+    } // namespace detail
+
+    // Evaluates expr into target with the routine matching the expression, with scalars passed
+    // from the host
+    template <typename Target, typename E>
+    hipblasStatus_t assign(const Target& target, const E& expr)
+    {
+        hipblasHandle_t      handle = detail::handle_of(target);
+        hipblasPointerMode_t mode;
+
+        hipblasStatus_t status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(mode != HIPBLAS_POINTER_MODE_HOST)
+        {
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        status = detail::evaluate(target, expr);
+
+        if(mode != HIPBLAS_POINTER_MODE_HOST)
+        {
+            hipblasStatus_t restored = hipblasSetPointerMode(handle, mode);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = restored;
+        }
+        return status;
+    }
+} // namespace hipblas
+
+#endif // HIPBLAS_EXPR_HPP
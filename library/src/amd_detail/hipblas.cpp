@@ -29,9 +29,24 @@
 #include "rocsolver/rocsolver.h"
 #endif
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <functional>
 #include <hip/library_types.h>
+#include <limits>
 #include <math.h>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
 
 extern "C" hipblasStatus_t hipblasConvertStatus(rocblas_status_ error);
 
@@ -272,6 +287,8 @@ rocblas_gemm_algo hipblasConvertGemmAlgo(hipblasGemmAlgo_t algo)
     switch(algo)
     {
     case HIPBLAS_GEMM_DEFAULT:
+    case HIPBLAS_GEMM_SPLIT_K:
+    case HIPBLAS_GEMM_STRASSEN:
         return rocblas_gemm_algo_standard;
     }
     throw HIPBLAS_STATUS_INVALID_ENUM;
@@ -357,6 +374,1553 @@ hipblasStatus_t hipblasConvertStatus(rocblas_status_ error)
     }
 }
 
+} // extern "C"
+
+/*******************************************************************************
+ * hipBLAS handle state
+ *
+ * The rocBLAS handle is used directly as the hipBLAS handle, so any state which
+ * belongs to hipBLAS itself is kept in a table keyed by the handle. The table is
+ * only consulted by features which are switched on per handle.
+ ******************************************************************************/
+namespace
+{
+    // A single queued ger/geru/gerc or trsv call
+    struct hipblasDeferredCall
+    {
+        const void*            x;
+        int                    incx;
+        const void*            y;
+        int                    incy;
+        rocblas_double_complex alpha; // large enough for any alpha type
+    };
+
+    enum hipblasDeferredKind
+    {
+        HIPBLAS_DEFERRED_KIND_NONE,
+        HIPBLAS_DEFERRED_KIND_GER,
+        HIPBLAS_DEFERRED_KIND_GERC,
+        HIPBLAS_DEFERRED_KIND_TRSV,
+    };
+
+    // Consecutive queued calls which share the same matrix and can be fused
+    struct hipblasDeferredBatch
+    {
+        hipblasDeferredKind              kind = HIPBLAS_DEFERRED_KIND_NONE;
+        rocblas_datatype                 type;
+        int                              m;
+        int                              n;
+        const void*                      A;
+        int                              lda;
+        rocblas_fill                     uplo;
+        rocblas_operation                trans;
+        rocblas_diagonal                 diag;
+        std::vector<hipblasDeferredCall> calls;
+    };
+
+    // Length of the vectors of ones in hipblasHandleConstants
+    constexpr int c_handle_ones_length = 65;
+
+    // Constants kept at the start of the workspace of a handle, as the factors of the products
+    // one * X which some operations are composed of. Uploaded again after the workspace is
+    // reallocated, so they stay valid while the workspace pointer is unchanged.
+    struct hipblasHandleConstants
+    {
+        float                  ones_f32[c_handle_ones_length];
+        double                 ones_f64[c_handle_ones_length];
+        rocblas_float_complex  ones_c32[c_handle_ones_length];
+        rocblas_double_complex ones_c64[c_handle_ones_length];
+        uint16_t               one_f16;
+        uint16_t               one_bf16;
+    };
+
+    // The workspace returned to callers follows the constants, aligned for any type
+    constexpr size_t c_handle_constants_bytes
+        = (sizeof(hipblasHandleConstants) + 255) / 256 * 256;
+
+    struct hipblasHandleState
+    {
+        // set between hipblasDeferredBegin and hipblasDeferredEnd
+        bool                 deferred_active = false;
+        hipblasDeferredBatch deferred;
+
+        // split factor forced with hipblasSetGemmSplitK, 0 to choose per call
+        int gemm_split_k = 0;
+
+        // slices set with hipblasSetGemmEmulationSlices, 0 for the default
+        int gemm_emulation_slices = 0;
+
+        // levels set with hipblasSetGemmStrassenLevels, 0 for the standard algorithm
+        int gemm_strassen_levels = 0;
+
+        // set with hipblasSetGemmOrderMode
+        hipblasGemmOrderMode_t gemm_order_mode = HIPBLAS_GEMM_ORDER_DEFAULT;
+
+        // set with hipblasSetQrAlgo
+        hipblasQrAlgo_t qr_algo = HIPBLAS_QR_ALGO_DEFAULT;
+
+        // device memory owned by hipBLAS, grown on demand and released in hipblasDestroy
+        void*  workspace      = nullptr;
+        size_t workspace_size = 0;
+
+        // set once hipblasHandleConstants are uploaded to the start of the workspace
+        bool constants_uploaded = false;
+
+        // pinned host memory of hipblasGetHandleStaging, with an event recorded after its last use
+        void*      upload_staging      = nullptr;
+        size_t     upload_staging_size = 0;
+        hipEvent_t upload_event        = nullptr;
+    };
+
+    // Upper bound on the number of calls fused into a single Level 3 call
+    constexpr size_t c_deferred_max_calls = 256;
+
+    std::mutex                                                        handle_state_mutex;
+    std::unordered_map<void*, std::unique_ptr<hipblasHandleState>> handle_states;
+
+    // Number of handles between hipblasDeferredBegin and hipblasDeferredEnd.
+    // Lets the Level 2 entry points skip the table lookup in the common case.
+    std::atomic<int> deferred_handle_count{0};
+
+    // Number of handles with Strassen-Winograd levels set, for the same purpose in dgemm and zgemm
+    std::atomic<int> strassen_handle_count{0};
+
+    // Number of handles with an order mode other than HIPBLAS_GEMM_ORDER_DEFAULT
+    std::atomic<int> order_handle_count{0};
+
+    // Number of handles with the QR algorithm set to HIPBLAS_QR_ALGO_TSQR
+    std::atomic<int> tsqr_handle_count{0};
+
+    hipblasHandleState* hipblasGetHandleState(hipblasHandle_t handle, bool create)
+    {
+        std::lock_guard<std::mutex> lock(handle_state_mutex);
+        auto                        it = handle_states.find(handle);
+        if(it != handle_states.end())
+            return it->second.get();
+        if(!create)
+            return nullptr;
+        return (handle_states[handle] = std::make_unique<hipblasHandleState>()).get();
+    }
+
+    // Whether the workspace of the handle can provide size bytes. It can't be grown while the
+    // stream of the handle is being captured, as growing it synchronizes the stream.
+    bool hipblasHandleWorkspaceFits(hipblasHandle_t handle, hipblasHandleState* state, size_t size)
+    {
+        if(size + c_handle_constants_bytes <= state->workspace_size)
+            return true;
+
+        hipStream_t            stream;
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+        return hipStreamIsCapturing(stream, &capture) == hipSuccess
+               && capture == hipStreamCaptureStatusNone;
+    }
+
+    // Returns device memory of at least size bytes owned by the handle.
+    // Memory returned by an earlier call may be released, so callers must not hold on to it.
+    void* hipblasGetHandleWorkspace(hipblasHandle_t handle, hipblasHandleState* state, size_t size)
+    {
+        if(!hipblasHandleWorkspaceFits(handle, state, size))
+            throw HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        size += c_handle_constants_bytes;
+        if(size <= state->workspace_size)
+            return (char*)state->workspace + c_handle_constants_bytes;
+
+        if(state->workspace)
+        {
+            // work queued on the stream may still reference the old buffer
+            hipStream_t stream;
+            rocblas_get_stream((rocblas_handle)handle, &stream);
+            if(hipStreamSynchronize(stream) != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+            (void)hipFree(state->workspace);
+            state->workspace          = nullptr;
+            state->workspace_size     = 0;
+            state->constants_uploaded = false;
+        }
+
+        if(hipMalloc(&state->workspace, size) != hipSuccess)
+        {
+            state->workspace = nullptr;
+            throw HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        state->workspace_size = size;
+        return (char*)state->workspace + c_handle_constants_bytes;
+    }
+
+    // Returns pinned host memory of at least size bytes owned by the handle, once the transfers
+    // queued on it by earlier calls have finished. Callers record upload_event on the stream of the
+    // handle after the last transfer they queue.
+    void* hipblasGetHandleStaging(hipblasHandle_t handle, hipblasHandleState* state, size_t size)
+    {
+        // a captured transfer would use the buffer when the graph is launched, after later calls
+        hipStream_t            stream;
+        hipStreamCaptureStatus capture = hipStreamCaptureStatusNone;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+        if(hipStreamIsCapturing(stream, &capture) != hipSuccess)
+            throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(capture != hipStreamCaptureStatusNone)
+            throw HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        if(state->upload_event && hipEventSynchronize(state->upload_event) != hipSuccess)
+            throw HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        if(size > state->upload_staging_size)
+        {
+            if(state->upload_staging)
+            {
+                (void)hipHostFree(state->upload_staging);
+                state->upload_staging      = nullptr;
+                state->upload_staging_size = 0;
+            }
+            else if(hipEventCreateWithFlags(&state->upload_event, hipEventDisableTiming)
+                    != hipSuccess)
+            {
+                state->upload_event = nullptr;
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+            }
+
+            if(hipHostMalloc(&state->upload_staging, size) != hipSuccess)
+            {
+                state->upload_staging = nullptr;
+                throw HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+            state->upload_staging_size = size;
+        }
+        return state->upload_staging;
+    }
+
+    // Copies size bytes from host memory to dst on the stream of the handle through pinned memory
+    // owned by the handle, so src can be released on return and the stream is not synchronized.
+    // Used for arrays of device pointers computed on the host, such as pointers into the workspace.
+    void hipblasUploadAsync(hipblasHandle_t     handle,
+                            hipblasHandleState* state,
+                            void*               dst,
+                            const void*         src,
+                            size_t              size)
+    {
+        if(!size)
+            return;
+
+        void* staging = hipblasGetHandleStaging(handle, state, size);
+        memcpy(staging, src, size);
+
+        hipStream_t stream;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+        if(hipMemcpyAsync(dst, staging, size, hipMemcpyHostToDevice, stream) != hipSuccess
+           || hipEventRecord(state->upload_event, stream) != hipSuccess)
+            throw HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // Returns the constants at the start of the workspace of the handle, uploading them if the
+    // workspace was allocated since. Later calls of hipblasGetHandleWorkspace may move them, so
+    // callers get the workspace first.
+    const hipblasHandleConstants* hipblasGetHandleConstants(hipblasHandle_t     handle,
+                                                            hipblasHandleState* state)
+    {
+        hipblasGetHandleWorkspace(handle, state, 0);
+        if(!state->constants_uploaded)
+        {
+            hipblasHandleConstants constants;
+            for(int i = 0; i < c_handle_ones_length; i++)
+            {
+                constants.ones_f32[i] = 1.0f;
+                constants.ones_f64[i] = 1.0;
+                constants.ones_c32[i] = rocblas_float_complex(1.0f, 0.0f);
+                constants.ones_c64[i] = rocblas_double_complex(1.0, 0.0);
+            }
+            constants.one_f16  = 0x3c00;
+            constants.one_bf16 = 0x3f80;
+            hipblasUploadAsync(handle, state, state->workspace, &constants, sizeof(constants));
+            state->constants_uploaded = true;
+        }
+        return (const hipblasHandleConstants*)state->workspace;
+    }
+
+    // Copies the array of device pointers array to host_array, which has one element per
+    // matrix of the batch
+    template <typename T>
+    bool hipblasGetPointerArray(hipblasHandle_t  handle,
+                                T* const*        array,
+                                std::vector<T*>& host_array)
+    {
+        hipStream_t stream;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+
+        return hipMemcpyAsync(host_array.data(),
+                              array,
+                              sizeof(T*) * host_array.size(),
+                              hipMemcpyDeviceToHost,
+                              stream)
+                   == hipSuccess
+               && hipStreamSynchronize(stream) == hipSuccess;
+    }
+
+    // Typed rocBLAS entry points used to build fused and composed operations
+    rocblas_status hipblasRocCopy(
+        rocblas_handle handle, int n, const float* x, int incx, float* y, int incy)
+    {
+        return rocblas_scopy(handle, n, x, incx, y, incy);
+    }
+    rocblas_status hipblasRocCopy(
+        rocblas_handle handle, int n, const double* x, int incx, double* y, int incy)
+    {
+        return rocblas_dcopy(handle, n, x, incx, y, incy);
+    }
+    rocblas_status hipblasRocCopy(rocblas_handle               handle,
+                                  int                          n,
+                                  const rocblas_float_complex* x,
+                                  int                          incx,
+                                  rocblas_float_complex*       y,
+                                  int                          incy)
+    {
+        return rocblas_ccopy(handle, n, x, incx, y, incy);
+    }
+    rocblas_status hipblasRocCopy(rocblas_handle                handle,
+                                  int                           n,
+                                  const rocblas_double_complex* x,
+                                  int                           incx,
+                                  rocblas_double_complex*       y,
+                                  int                           incy)
+    {
+        return rocblas_zcopy(handle, n, x, incx, y, incy);
+    }
+
+    rocblas_status hipblasRocAxpy(rocblas_handle handle,
+                                  int            n,
+                                  const float*   alpha,
+                                  const float*   x,
+                                  int            incx,
+                                  float*         y,
+                                  int            incy)
+    {
+        return rocblas_saxpy(handle, n, alpha, x, incx, y, incy);
+    }
+    rocblas_status hipblasRocAxpy(rocblas_handle handle,
+                                  int            n,
+                                  const double*  alpha,
+                                  const double*  x,
+                                  int            incx,
+                                  double*        y,
+                                  int            incy)
+    {
+        return rocblas_daxpy(handle, n, alpha, x, incx, y, incy);
+    }
+    rocblas_status hipblasRocAxpy(rocblas_handle               handle,
+                                  int                          n,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* x,
+                                  int                          incx,
+                                  rocblas_float_complex*       y,
+                                  int                          incy)
+    {
+        return rocblas_caxpy(handle, n, alpha, x, incx, y, incy);
+    }
+    rocblas_status hipblasRocAxpy(rocblas_handle                handle,
+                                  int                           n,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* x,
+                                  int                           incx,
+                                  rocblas_double_complex*       y,
+                                  int                           incy)
+    {
+        return rocblas_zaxpy(handle, n, alpha, x, incx, y, incy);
+    }
+
+    rocblas_status hipblasRocGemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  const float*      alpha,
+                                  const float*      A,
+                                  int               lda,
+                                  const float*      B,
+                                  int               ldb,
+                                  const float*      beta,
+                                  float*            C,
+                                  int               ldc)
+    {
+        return rocblas_sgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+    rocblas_status hipblasRocGemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  int               m,
+                                  int               n,
+                                  int               k,
+                                  const double*     alpha,
+                                  const double*     A,
+                                  int               lda,
+                                  const double*     B,
+                                  int               ldb,
+                                  const double*     beta,
+                                  double*           C,
+                                  int               ldc)
+    {
+        return rocblas_dgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+    rocblas_status hipblasRocGemm(rocblas_handle               handle,
+                                  rocblas_operation            transA,
+                                  rocblas_operation            transB,
+                                  int                          m,
+                                  int                          n,
+                                  int                          k,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* A,
+                                  int                          lda,
+                                  const rocblas_float_complex* B,
+                                  int                          ldb,
+                                  const rocblas_float_complex* beta,
+                                  rocblas_float_complex*       C,
+                                  int                          ldc)
+    {
+        return rocblas_cgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+    rocblas_status hipblasRocGemm(rocblas_handle                handle,
+                                  rocblas_operation             transA,
+                                  rocblas_operation             transB,
+                                  int                           m,
+                                  int                           n,
+                                  int                           k,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  int                           lda,
+                                  const rocblas_double_complex* B,
+                                  int                           ldb,
+                                  const rocblas_double_complex* beta,
+                                  rocblas_double_complex*       C,
+                                  int                           ldc)
+    {
+        return rocblas_zgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    rocblas_status hipblasRocGeam(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  int               m,
+                                  int               n,
+                                  const float*      alpha,
+                                  const float*      A,
+                                  int               lda,
+                                  const float*      beta,
+                                  const float*      B,
+                                  int               ldb,
+                                  float*            C,
+                                  int               ldc)
+    {
+        return rocblas_sgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    }
+    rocblas_status hipblasRocGeam(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  int               m,
+                                  int               n,
+                                  const double*     alpha,
+                                  const double*     A,
+                                  int               lda,
+                                  const double*     beta,
+                                  const double*     B,
+                                  int               ldb,
+                                  double*           C,
+                                  int               ldc)
+    {
+        return rocblas_dgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    }
+    rocblas_status hipblasRocGeam(rocblas_handle               handle,
+                                  rocblas_operation            transA,
+                                  rocblas_operation            transB,
+                                  int                          m,
+                                  int                          n,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* A,
+                                  int                          lda,
+                                  const rocblas_float_complex* beta,
+                                  const rocblas_float_complex* B,
+                                  int                          ldb,
+                                  rocblas_float_complex*       C,
+                                  int                          ldc)
+    {
+        return rocblas_cgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    }
+    rocblas_status hipblasRocGeam(rocblas_handle                handle,
+                                  rocblas_operation             transA,
+                                  rocblas_operation             transB,
+                                  int                           m,
+                                  int                           n,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  int                           lda,
+                                  const rocblas_double_complex* beta,
+                                  const rocblas_double_complex* B,
+                                  int                           ldb,
+                                  rocblas_double_complex*       C,
+                                  int                           ldc)
+    {
+        return rocblas_zgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+    }
+
+    rocblas_status hipblasRocGeamBatched(rocblas_handle     handle,
+                                         rocblas_operation  transA,
+                                         rocblas_operation  transB,
+                                         int                m,
+                                         int                n,
+                                         const float*       alpha,
+                                         const float* const A[],
+                                         int                lda,
+                                         const float*       beta,
+                                         const float* const B[],
+                                         int                ldb,
+                                         float* const       C[],
+                                         int                ldc,
+                                         int                batch_count)
+    {
+        return rocblas_sgeam_batched(
+            handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+    }
+    rocblas_status hipblasRocGeamBatched(rocblas_handle      handle,
+                                         rocblas_operation   transA,
+                                         rocblas_operation   transB,
+                                         int                 m,
+                                         int                 n,
+                                         const double*       alpha,
+                                         const double* const A[],
+                                         int                 lda,
+                                         const double*       beta,
+                                         const double* const B[],
+                                         int                 ldb,
+                                         double* const       C[],
+                                         int                 ldc,
+                                         int                 batch_count)
+    {
+        return rocblas_dgeam_batched(
+            handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+    }
+    rocblas_status hipblasRocGeamBatched(rocblas_handle                     handle,
+                                         rocblas_operation                  transA,
+                                         rocblas_operation                  transB,
+                                         int                                m,
+                                         int                                n,
+                                         const rocblas_float_complex*       alpha,
+                                         const rocblas_float_complex* const A[],
+                                         int                                lda,
+                                         const rocblas_float_complex*       beta,
+                                         const rocblas_float_complex* const B[],
+                                         int                                ldb,
+                                         rocblas_float_complex* const       C[],
+                                         int                                ldc,
+                                         int                                batch_count)
+    {
+        return rocblas_cgeam_batched(
+            handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+    }
+    rocblas_status hipblasRocGeamBatched(rocblas_handle                      handle,
+                                         rocblas_operation                   transA,
+                                         rocblas_operation                   transB,
+                                         int                                 m,
+                                         int                                 n,
+                                         const rocblas_double_complex*       alpha,
+                                         const rocblas_double_complex* const A[],
+                                         int                                 lda,
+                                         const rocblas_double_complex*       beta,
+                                         const rocblas_double_complex* const B[],
+                                         int                                 ldb,
+                                         rocblas_double_complex* const       C[],
+                                         int                                 ldc,
+                                         int                                 batch_count)
+    {
+        return rocblas_zgeam_batched(
+            handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batch_count);
+    }
+
+    rocblas_status hipblasRocGer(rocblas_handle handle,
+                                 bool           conj,
+                                 int            m,
+                                 int            n,
+                                 const float*   alpha,
+                                 const float*   x,
+                                 int            incx,
+                                 const float*   y,
+                                 int            incy,
+                                 float*         A,
+                                 int            lda)
+    {
+        return rocblas_sger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+    rocblas_status hipblasRocGer(rocblas_handle handle,
+                                 bool           conj,
+                                 int            m,
+                                 int            n,
+                                 const double*  alpha,
+                                 const double*  x,
+                                 int            incx,
+                                 const double*  y,
+                                 int            incy,
+                                 double*        A,
+                                 int            lda)
+    {
+        return rocblas_dger(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+    rocblas_status hipblasRocGer(rocblas_handle               handle,
+                                 bool                         conj,
+                                 int                          m,
+                                 int                          n,
+                                 const rocblas_float_complex* alpha,
+                                 const rocblas_float_complex* x,
+                                 int                          incx,
+                                 const rocblas_float_complex* y,
+                                 int                          incy,
+                                 rocblas_float_complex*       A,
+                                 int                          lda)
+    {
+        return conj ? rocblas_cgerc(handle, m, n, alpha, x, incx, y, incy, A, lda)
+                    : rocblas_cgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+    rocblas_status hipblasRocGer(rocblas_handle                handle,
+                                 bool                          conj,
+                                 int                           m,
+                                 int                           n,
+                                 const rocblas_double_complex* alpha,
+                                 const rocblas_double_complex* x,
+                                 int                           incx,
+                                 const rocblas_double_complex* y,
+                                 int                           incy,
+                                 rocblas_double_complex*       A,
+                                 int                           lda)
+    {
+        return conj ? rocblas_zgerc(handle, m, n, alpha, x, incx, y, incy, A, lda)
+                    : rocblas_zgeru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    rocblas_status hipblasRocTrsv(rocblas_handle    handle,
+                                  rocblas_fill      uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal  diag,
+                                  int               n,
+                                  const float*      A,
+                                  int               lda,
+                                  float*            x,
+                                  int               incx)
+    {
+        return rocblas_strsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+    }
+    rocblas_status hipblasRocTrsv(rocblas_handle    handle,
+                                  rocblas_fill      uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal  diag,
+                                  int               n,
+                                  const double*     A,
+                                  int               lda,
+                                  double*           x,
+                                  int               incx)
+    {
+        return rocblas_dtrsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+    }
+    rocblas_status hipblasRocTrsv(rocblas_handle               handle,
+                                  rocblas_fill                 uplo,
+                                  rocblas_operation            transA,
+                                  rocblas_diagonal             diag,
+                                  int                          n,
+                                  const rocblas_float_complex* A,
+                                  int                          lda,
+                                  rocblas_float_complex*       x,
+                                  int                          incx)
+    {
+        return rocblas_ctrsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+    }
+    rocblas_status hipblasRocTrsv(rocblas_handle                handle,
+                                  rocblas_fill                  uplo,
+                                  rocblas_operation             transA,
+                                  rocblas_diagonal              diag,
+                                  int                           n,
+                                  const rocblas_double_complex* A,
+                                  int                           lda,
+                                  rocblas_double_complex*       x,
+                                  int                           incx)
+    {
+        return rocblas_ztrsv(handle, uplo, transA, diag, n, A, lda, x, incx);
+    }
+
+    rocblas_status hipblasRocTrsm(rocblas_handle    handle,
+                                  rocblas_side      side,
+                                  rocblas_fill      uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal  diag,
+                                  int               m,
+                                  int               n,
+                                  const float*      alpha,
+                                  const float*      A,
+                                  int               lda,
+                                  float*            B,
+                                  int               ldb)
+    {
+        return rocblas_strsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    }
+    rocblas_status hipblasRocTrsm(rocblas_handle    handle,
+                                  rocblas_side      side,
+                                  rocblas_fill      uplo,
+                                  rocblas_operation transA,
+                                  rocblas_diagonal  diag,
+                                  int               m,
+                                  int               n,
+                                  const double*     alpha,
+                                  const double*     A,
+                                  int               lda,
+                                  double*           B,
+                                  int               ldb)
+    {
+        return rocblas_dtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    }
+    rocblas_status hipblasRocTrsm(rocblas_handle               handle,
+                                  rocblas_side                 side,
+                                  rocblas_fill                 uplo,
+                                  rocblas_operation            transA,
+                                  rocblas_diagonal             diag,
+                                  int                          m,
+                                  int                          n,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* A,
+                                  int                          lda,
+                                  rocblas_float_complex*       B,
+                                  int                          ldb)
+    {
+        return rocblas_ctrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    }
+    rocblas_status hipblasRocTrsm(rocblas_handle                handle,
+                                  rocblas_side                  side,
+                                  rocblas_fill                  uplo,
+                                  rocblas_operation             transA,
+                                  rocblas_diagonal              diag,
+                                  int                           m,
+                                  int                           n,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  int                           lda,
+                                  rocblas_double_complex*       B,
+                                  int                           ldb)
+    {
+        return rocblas_ztrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    }
+
+    rocblas_status hipblasRocTrmmStridedBatched(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                int               m,
+                                                int               n,
+                                                const float*      alpha,
+                                                const float*      A,
+                                                int               lda,
+                                                hipblasStride     stride_A,
+                                                const float*      B,
+                                                int               ldb,
+                                                hipblasStride     stride_B,
+                                                float*            C,
+                                                int               ldc,
+                                                hipblasStride     stride_C,
+                                                int               batch_count)
+    {
+        return rocblas_strmm_strided_batched(handle,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             ldb,
+                                             stride_B,
+                                             C,
+                                             ldc,
+                                             stride_C,
+                                             batch_count);
+    }
+    rocblas_status hipblasRocTrmmStridedBatched(rocblas_handle    handle,
+                                                rocblas_side      side,
+                                                rocblas_fill      uplo,
+                                                rocblas_operation transA,
+                                                rocblas_diagonal  diag,
+                                                int               m,
+                                                int               n,
+                                                const double*     alpha,
+                                                const double*     A,
+                                                int               lda,
+                                                hipblasStride     stride_A,
+                                                const double*     B,
+                                                int               ldb,
+                                                hipblasStride     stride_B,
+                                                double*           C,
+                                                int               ldc,
+                                                hipblasStride     stride_C,
+                                                int               batch_count)
+    {
+        return rocblas_dtrmm_strided_batched(handle,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             ldb,
+                                             stride_B,
+                                             C,
+                                             ldc,
+                                             stride_C,
+                                             batch_count);
+    }
+    rocblas_status hipblasRocTrmmStridedBatched(rocblas_handle               handle,
+                                                rocblas_side                 side,
+                                                rocblas_fill                 uplo,
+                                                rocblas_operation            transA,
+                                                rocblas_diagonal             diag,
+                                                int                          m,
+                                                int                          n,
+                                                const rocblas_float_complex* alpha,
+                                                const rocblas_float_complex* A,
+                                                int                          lda,
+                                                hipblasStride                stride_A,
+                                                const rocblas_float_complex* B,
+                                                int                          ldb,
+                                                hipblasStride                stride_B,
+                                                rocblas_float_complex*       C,
+                                                int                          ldc,
+                                                hipblasStride                stride_C,
+                                                int                          batch_count)
+    {
+        return rocblas_ctrmm_strided_batched(handle,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             ldb,
+                                             stride_B,
+                                             C,
+                                             ldc,
+                                             stride_C,
+                                             batch_count);
+    }
+    rocblas_status hipblasRocTrmmStridedBatched(rocblas_handle                handle,
+                                                rocblas_side                  side,
+                                                rocblas_fill                  uplo,
+                                                rocblas_operation             transA,
+                                                rocblas_diagonal              diag,
+                                                int                           m,
+                                                int                           n,
+                                                const rocblas_double_complex* alpha,
+                                                const rocblas_double_complex* A,
+                                                int                           lda,
+                                                hipblasStride                 stride_A,
+                                                const rocblas_double_complex* B,
+                                                int                           ldb,
+                                                hipblasStride                 stride_B,
+                                                rocblas_double_complex*       C,
+                                                int                           ldc,
+                                                hipblasStride                 stride_C,
+                                                int                           batch_count)
+    {
+        return rocblas_ztrmm_strided_batched(handle,
+                                             side,
+                                             uplo,
+                                             transA,
+                                             diag,
+                                             m,
+                                             n,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_A,
+                                             B,
+                                             ldb,
+                                             stride_B,
+                                             C,
+                                             ldc,
+                                             stride_C,
+                                             batch_count);
+    }
+
+    rocblas_status hipblasRocTrmmBatched(rocblas_handle     handle,
+                                         rocblas_side       side,
+                                         rocblas_fill       uplo,
+                                         rocblas_operation  transA,
+                                         rocblas_diagonal   diag,
+                                         int                m,
+                                         int                n,
+                                         const float*       alpha,
+                                         const float* const A[],
+                                         int                lda,
+                                         const float* const B[],
+                                         int                ldb,
+                                         float* const       C[],
+                                         int                ldc,
+                                         int                batch_count)
+    {
+        return rocblas_strmm_batched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc, batch_count);
+    }
+    rocblas_status hipblasRocTrmmBatched(rocblas_handle      handle,
+                                         rocblas_side        side,
+                                         rocblas_fill        uplo,
+                                         rocblas_operation   transA,
+                                         rocblas_diagonal    diag,
+                                         int                 m,
+                                         int                 n,
+                                         const double*       alpha,
+                                         const double* const A[],
+                                         int                 lda,
+                                         const double* const B[],
+                                         int                 ldb,
+                                         double* const       C[],
+                                         int                 ldc,
+                                         int                 batch_count)
+    {
+        return rocblas_dtrmm_batched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc, batch_count);
+    }
+    rocblas_status hipblasRocTrmmBatched(rocblas_handle                     handle,
+                                         rocblas_side                       side,
+                                         rocblas_fill                       uplo,
+                                         rocblas_operation                  transA,
+                                         rocblas_diagonal                   diag,
+                                         int                                m,
+                                         int                                n,
+                                         const rocblas_float_complex*       alpha,
+                                         const rocblas_float_complex* const A[],
+                                         int                                lda,
+                                         const rocblas_float_complex* const B[],
+                                         int                                ldb,
+                                         rocblas_float_complex* const       C[],
+                                         int                                ldc,
+                                         int                                batch_count)
+    {
+        return rocblas_ctrmm_batched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc, batch_count);
+    }
+    rocblas_status hipblasRocTrmmBatched(rocblas_handle                      handle,
+                                         rocblas_side                        side,
+                                         rocblas_fill                        uplo,
+                                         rocblas_operation                   transA,
+                                         rocblas_diagonal                    diag,
+                                         int                                 m,
+                                         int                                 n,
+                                         const rocblas_double_complex*       alpha,
+                                         const rocblas_double_complex* const A[],
+                                         int                                 lda,
+                                         const rocblas_double_complex* const B[],
+                                         int                                 ldb,
+                                         rocblas_double_complex* const       C[],
+                                         int                                 ldc,
+                                         int                                 batch_count)
+    {
+        return rocblas_ztrmm_batched(
+            handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, C, ldc, batch_count);
+    }
+
+    rocblas_status hipblasRocNrm2StridedBatched(rocblas_handle handle,
+                                                int            n,
+                                                const float*   x,
+                                                int            incx,
+                                                hipblasStride  stride_x,
+                                                int            batch_count,
+                                                float*         results)
+    {
+        return rocblas_snrm2_strided_batched(handle, n, x, incx, stride_x, batch_count, results);
+    }
+    rocblas_status hipblasRocNrm2StridedBatched(rocblas_handle handle,
+                                                int            n,
+                                                const double*  x,
+                                                int            incx,
+                                                hipblasStride  stride_x,
+                                                int            batch_count,
+                                                double*        results)
+    {
+        return rocblas_dnrm2_strided_batched(handle, n, x, incx, stride_x, batch_count, results);
+    }
+    rocblas_status hipblasRocNrm2StridedBatched(rocblas_handle               handle,
+                                                int                          n,
+                                                const rocblas_float_complex* x,
+                                                int                          incx,
+                                                hipblasStride                stride_x,
+                                                int                          batch_count,
+                                                float*                       results)
+    {
+        return rocblas_scnrm2_strided_batched(handle, n, x, incx, stride_x, batch_count, results);
+    }
+    rocblas_status hipblasRocNrm2StridedBatched(rocblas_handle                handle,
+                                                int                           n,
+                                                const rocblas_double_complex* x,
+                                                int                           incx,
+                                                hipblasStride                 stride_x,
+                                                int                           batch_count,
+                                                double*                       results)
+    {
+        return rocblas_dznrm2_strided_batched(handle, n, x, incx, stride_x, batch_count, results);
+    }
+
+    template <typename T>
+    constexpr rocblas_datatype hipblasRocDatatype();
+    template <>
+    constexpr rocblas_datatype hipblasRocDatatype<float>()
+    {
+        return rocblas_datatype_f32_r;
+    }
+    template <>
+    constexpr rocblas_datatype hipblasRocDatatype<double>()
+    {
+        return rocblas_datatype_f64_r;
+    }
+    template <>
+    constexpr rocblas_datatype hipblasRocDatatype<rocblas_float_complex>()
+    {
+        return rocblas_datatype_f32_c;
+    }
+    template <>
+    constexpr rocblas_datatype hipblasRocDatatype<rocblas_double_complex>()
+    {
+        return rocblas_datatype_f64_c;
+    }
+
+    // A set of k equally sized vectors which can be addressed as a single column-major matrix.
+    // If transposed is set, the matrix which can be addressed is the transpose of the
+    // n-by-k matrix whose columns are the vectors.
+    struct hipblasVectorSetView
+    {
+        bool        valid = false;
+        bool        transposed;
+        const void* ptr;
+        int         ld;
+    };
+
+    // Vectors x_i of length n with increment inc form a column-major n-by-k matrix when x_i are
+    // columns (inc == 1, constant pointer step >= n), or its transpose when x_i are rows (constant
+    // pointer step of one element, inc >= k).
+    template <typename T>
+    hipblasVectorSetView hipblasGetVectorSetView(const std::vector<hipblasDeferredCall>& calls,
+                                                 bool                                    use_y,
+                                                 int                                     n)
+    {
+        auto ptr = [&](size_t i) { return (const T*)(use_y ? calls[i].y : calls[i].x); };
+        auto inc = [&](size_t i) { return use_y ? calls[i].incy : calls[i].incx; };
+
+        hipblasVectorSetView view;
+        const size_t         k    = calls.size();
+        const int            inc0 = inc(0);
+        // a single vector is a column if it is contiguous and a row otherwise
+        const ptrdiff_t step = k > 1 ? ptr(1) - ptr(0) : inc0 == 1 ? std::max(1, n) : 1;
+
+        for(size_t i = 1; i < k; i++)
+            if(inc(i) != inc0 || ptr(i) - ptr(0) != ptrdiff_t(i) * step)
+                return view;
+
+        if(inc0 == 1 && step >= std::max(1, n) && step <= INT_MAX)
+        {
+            view.valid      = true;
+            view.transposed = false;
+            view.ptr        = ptr(0);
+            view.ld         = int(step);
+        }
+        else if(step == 1 && inc0 >= int(k))
+        {
+            view.valid      = true;
+            view.transposed = true;
+            view.ptr        = ptr(0);
+            view.ld         = inc0;
+        }
+        return view;
+    }
+
+    // A += sum_i alpha_i * x_i * op(y_i), issued as a single gemm
+    template <typename T>
+    hipblasStatus_t hipblasFlushDeferredGer(hipblasHandle_t             handle,
+                                            hipblasHandleState*         state,
+                                            const hipblasDeferredBatch& batch)
+    {
+        const auto& calls      = batch.calls;
+        const int   k          = int(calls.size());
+        const int   m          = batch.m;
+        const int   n          = batch.n;
+        const bool  conj       = batch.kind == HIPBLAS_DEFERRED_KIND_GERC;
+        const T     one        = T(1);
+        const T     alpha      = *(const T*)&calls[0].alpha;
+        bool        same_alpha = true;
+        for(int i = 1; i < k; i++)
+            same_alpha = same_alpha && !memcmp(&calls[i].alpha, &calls[0].alpha, sizeof(T));
+
+        hipblasVectorSetView x_view = hipblasGetVectorSetView<T>(calls, false, m);
+        hipblasVectorSetView y_view = hipblasGetVectorSetView<T>(calls, true, n);
+        // conj(y_i^T) can only be expressed when y_i are the columns of the matrix
+        if(conj && y_view.transposed)
+            y_view.valid = false;
+
+        size_t x_size  = (same_alpha && x_view.valid) ? 0 : size_t(m) * k;
+        size_t y_size  = y_view.valid ? 0 : size_t(n) * k;
+        size_t ws_size = (x_size + y_size) * sizeof(T);
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+
+        // without room to gather the vectors, the calls are issued one by one
+        if(!hipblasHandleWorkspaceFits(handle, state, ws_size))
+        {
+            rocblas_status status = rocblas_status_success;
+            for(int i = 0; i < k && status == rocblas_status_success; i++)
+                status = hipblasRocGer(rhandle,
+                                       conj,
+                                       m,
+                                       n,
+                                       (const T*)&calls[i].alpha,
+                                       (const T*)calls[i].x,
+                                       calls[i].incx,
+                                       (const T*)calls[i].y,
+                                       calls[i].incy,
+                                       (T*)batch.A,
+                                       batch.lda);
+            return hipblasConvertStatus(status);
+        }
+
+        T* x_ws = (T*)(ws_size ? hipblasGetHandleWorkspace(handle, state, ws_size) : nullptr);
+        T* y_ws = x_ws + x_size;
+
+        const T*          X       = (const T*)x_view.ptr;
+        int               ldx     = x_view.ld;
+        rocblas_operation transX
+            = x_view.transposed ? rocblas_operation_transpose : rocblas_operation_none;
+        const T*       gemm_alpha = &alpha;
+        rocblas_status status     = rocblas_status_success;
+
+        if(x_size)
+        {
+            if(same_alpha)
+            {
+                for(int i = 0; i < k && status == rocblas_status_success; i++)
+                    status = hipblasRocCopy(
+                        rhandle, m, (const T*)calls[i].x, calls[i].incx, x_ws + size_t(i) * m, 1);
+            }
+            else
+            {
+                // fold alpha_i into column i so that a single gemm can be used
+                hipStream_t stream;
+                rocblas_get_stream(rhandle, &stream);
+                if(hipMemsetAsync(x_ws, 0, x_size * sizeof(T), stream) != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+                for(int i = 0; i < k && status == rocblas_status_success; i++)
+                    status = hipblasRocAxpy(rhandle,
+                                            m,
+                                            (const T*)&calls[i].alpha,
+                                            (const T*)calls[i].x,
+                                            calls[i].incx,
+                                            x_ws + size_t(i) * m,
+                                            1);
+                gemm_alpha = &one;
+            }
+            X      = x_ws;
+            ldx    = std::max(1, m);
+            transX = rocblas_operation_none;
+        }
+
+        const T*          Y      = (const T*)y_view.ptr;
+        int               ldy    = y_view.ld;
+        rocblas_operation transY = y_view.transposed ? rocblas_operation_none
+                                   : conj            ? rocblas_operation_conjugate_transpose
+                                                     : rocblas_operation_transpose;
+        if(y_size)
+        {
+            for(int i = 0; i < k && status == rocblas_status_success; i++)
+                status = hipblasRocCopy(
+                    rhandle, n, (const T*)calls[i].y, calls[i].incy, y_ws + size_t(i) * n, 1);
+            Y      = y_ws;
+            ldy    = std::max(1, n);
+            transY = conj ? rocblas_operation_conjugate_transpose : rocblas_operation_transpose;
+        }
+
+        if(status != rocblas_status_success)
+            return hipblasConvertStatus(status);
+
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(hipblasRocGemm(rhandle,
+                                                                        transX,
+                                                                        transY,
+                                                                        m,
+                                                                        n,
+                                                                        k,
+                                                                        gemm_alpha,
+                                                                        X,
+                                                                        ldx,
+                                                                        Y,
+                                                                        ldy,
+                                                                        &one,
+                                                                        (T*)batch.A,
+                                                                        batch.lda)));
+    }
+
+    // x_i := op(A)^-1 x_i for all i, issued as a single trsm
+    template <typename T>
+    hipblasStatus_t hipblasFlushDeferredTrsv(hipblasHandle_t             handle,
+                                             hipblasHandleState*         state,
+                                             const hipblasDeferredBatch& batch)
+    {
+        const auto&    calls   = batch.calls;
+        const int      k       = int(calls.size());
+        const int      n       = batch.n;
+        const T        one     = T(1);
+        rocblas_handle rhandle = (rocblas_handle)handle;
+
+        hipblasVectorSetView x_view = hipblasGetVectorSetView<T>(calls, false, n);
+        // X^T op(A)^T = B^T can't be expressed with trsm for op(A) = A^H
+        if(x_view.transposed && batch.trans == rocblas_operation_conjugate_transpose
+           && hipblasRocDatatype<T>() != rocblas_datatype_f32_r
+           && hipblasRocDatatype<T>() != rocblas_datatype_f64_r)
+            x_view.valid = false;
+
+        if(x_view.valid && !x_view.transposed)
+        {
+            return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(hipblasRocTrsm(rhandle,
+                                                                            rocblas_side_left,
+                                                                            batch.uplo,
+                                                                            batch.trans,
+                                                                            batch.diag,
+                                                                            n,
+                                                                            k,
+                                                                            &one,
+                                                                            (const T*)batch.A,
+                                                                            batch.lda,
+                                                                            (T*)x_view.ptr,
+                                                                            x_view.ld)));
+        }
+        else if(x_view.valid)
+        {
+            // op(A) X = B  <=>  X^T op(A)^T = B^T
+            rocblas_operation trans = batch.trans == rocblas_operation_none
+                                          ? rocblas_operation_transpose
+                                          : rocblas_operation_none;
+            return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(hipblasRocTrsm(rhandle,
+                                                                            rocblas_side_right,
+                                                                            batch.uplo,
+                                                                            trans,
+                                                                            batch.diag,
+                                                                            k,
+                                                                            n,
+                                                                            &one,
+                                                                            (const T*)batch.A,
+                                                                            batch.lda,
+                                                                            (T*)x_view.ptr,
+                                                                            x_view.ld)));
+        }
+
+        // gather the right-hand sides, solve, and scatter the solutions back, or issue the
+        // solves one by one without room to gather them
+        rocblas_status status  = rocblas_status_success;
+        size_t         ws_size = size_t(n) * k * sizeof(T);
+        if(!hipblasHandleWorkspaceFits(handle, state, ws_size))
+        {
+            for(int i = 0; i < k && status == rocblas_status_success; i++)
+                status = hipblasRocTrsv(rhandle,
+                                        batch.uplo,
+                                        batch.trans,
+                                        batch.diag,
+                                        n,
+                                        (const T*)batch.A,
+                                        batch.lda,
+                                        (T*)calls[i].x,
+                                        calls[i].incx);
+            return hipblasConvertStatus(status);
+        }
+
+        T* x_ws = (T*)hipblasGetHandleWorkspace(handle, state, ws_size);
+
+        for(int i = 0; i < k && status == rocblas_status_success; i++)
+            status = hipblasRocCopy(
+                rhandle, n, (const T*)calls[i].x, calls[i].incx, x_ws + size_t(i) * n, 1);
+        if(status != rocblas_status_success)
+            return hipblasConvertStatus(status);
+
+        hipblasStatus_t hstatus
+            = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(hipblasRocTrsm(rhandle,
+                                                                       rocblas_side_left,
+                                                                       batch.uplo,
+                                                                       batch.trans,
+                                                                       batch.diag,
+                                                                       n,
+                                                                       k,
+                                                                       &one,
+                                                                       (const T*)batch.A,
+                                                                       batch.lda,
+                                                                       x_ws,
+                                                                       n)));
+        if(hstatus != HIPBLAS_STATUS_SUCCESS)
+            return hstatus;
+
+        for(int i = 0; i < k && status == rocblas_status_success; i++)
+            status = hipblasRocCopy(
+                rhandle, n, x_ws + size_t(i) * n, 1, (T*)calls[i].x, calls[i].incx);
+        return hipblasConvertStatus(status);
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasFlushDeferredBatch(hipblasHandle_t             handle,
+                                              hipblasHandleState*         state,
+                                              const hipblasDeferredBatch& batch)
+    {
+        return batch.kind == HIPBLAS_DEFERRED_KIND_TRSV
+                   ? hipblasFlushDeferredTrsv<T>(handle, state, batch)
+                   : hipblasFlushDeferredGer<T>(handle, state, batch);
+    }
+
+    hipblasStatus_t hipblasFlushDeferredState(hipblasHandle_t handle, hipblasHandleState* state)
+    {
+        hipblasDeferredBatch batch;
+        std::swap(batch, state->deferred);
+        state->deferred.kind = HIPBLAS_DEFERRED_KIND_NONE;
+
+        if(batch.kind == HIPBLAS_DEFERRED_KIND_NONE || batch.calls.empty())
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // the queue only holds calls made in host pointer mode
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode((rocblas_handle)handle, &mode);
+        rocblas_set_pointer_mode((rocblas_handle)handle, rocblas_pointer_mode_host);
+
+        hipblasStatus_t status;
+        switch(batch.type)
+        {
+        case rocblas_datatype_f32_r:
+            status = hipblasFlushDeferredBatch<float>(handle, state, batch);
+            break;
+        case rocblas_datatype_f64_r:
+            status = hipblasFlushDeferredBatch<double>(handle, state, batch);
+            break;
+        case rocblas_datatype_f32_c:
+            status = hipblasFlushDeferredBatch<rocblas_float_complex>(handle, state, batch);
+            break;
+        case rocblas_datatype_f64_c:
+            status = hipblasFlushDeferredBatch<rocblas_double_complex>(handle, state, batch);
+            break;
+        default:
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        rocblas_set_pointer_mode((rocblas_handle)handle, mode);
+        return status;
+    }
+
+    // Flushes any queued calls; used by functions which must not run ahead of the queue
+    hipblasStatus_t hipblasFlushDeferredIfAny(hipblasHandle_t handle)
+    {
+        if(!deferred_handle_count.load(std::memory_order_relaxed))
+            return HIPBLAS_STATUS_SUCCESS;
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        return state ? hipblasFlushDeferredState(handle, state) : HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Returns the handle state if calls on this handle may be queued
+    hipblasHandleState* hipblasGetDeferredState(hipblasHandle_t handle)
+    {
+        if(!handle || !deferred_handle_count.load(std::memory_order_relaxed))
+            return nullptr;
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        return state && state->deferred_active ? state : nullptr;
+    }
+
+    bool hipblasRangesOverlap(const void* a, size_t a_size, const void* b, size_t b_size)
+    {
+        return (const char*)a < (const char*)b + b_size && (const char*)b < (const char*)a + a_size;
+    }
+
+    // Queues a ger/geru/gerc call. Returns false if the call must be executed directly; any
+    // queued calls have been flushed in that case, and a flush error is returned in status.
+    template <typename T>
+    bool hipblasDeferGer(hipblasHandle_t     handle,
+                         hipblasDeferredKind kind,
+                         int                 m,
+                         int                 n,
+                         const T*            alpha,
+                         const T*            x,
+                         int                 incx,
+                         const T*            y,
+                         int                 incy,
+                         T*                  A,
+                         int                 lda,
+                         hipblasStatus_t*    status)
+    {
+        hipblasHandleState* state = hipblasGetDeferredState(handle);
+        if(!state)
+            return false;
+
+        auto& batch = state->deferred;
+
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode((rocblas_handle)handle, &mode);
+
+        bool queueable = mode == rocblas_pointer_mode_host && m > 0 && n > 0 && incx > 0
+                         && incy > 0 && lda >= m && alpha && x && y && A;
+        if(queueable)
+        {
+            // the fused update reads every x_i and y_i after A has been written
+            size_t A_size = (size_t(lda) * (n - 1) + m) * sizeof(T);
+            size_t x_size = (size_t(incx) * (m - 1) + 1) * sizeof(T);
+            size_t y_size = (size_t(incy) * (n - 1) + 1) * sizeof(T);
+            queueable     = !hipblasRangesOverlap(x, x_size, A, A_size)
+                        && !hipblasRangesOverlap(y, y_size, A, A_size);
+        }
+
+        bool same_batch = queueable && batch.kind == kind && batch.type == hipblasRocDatatype<T>()
+                          && batch.A == A && batch.m == m && batch.n == n && batch.lda == lda
+                          && batch.calls.size() < c_deferred_max_calls;
+
+        if(!same_batch && batch.kind != HIPBLAS_DEFERRED_KIND_NONE)
+        {
+            *status = hipblasFlushDeferredState(handle, state);
+            if(*status != HIPBLAS_STATUS_SUCCESS)
+                return true;
+        }
+        if(!queueable)
+            return false;
+
+        if(!same_batch)
+        {
+            batch.kind = kind;
+            batch.type = hipblasRocDatatype<T>();
+            batch.m    = m;
+            batch.n    = n;
+            batch.A    = A;
+            batch.lda  = lda;
+        }
+
+        hipblasDeferredCall call{x, incx, y, incy};
+        memcpy(&call.alpha, alpha, sizeof(T));
+        batch.calls.push_back(call);
+
+        *status = HIPBLAS_STATUS_SUCCESS;
+        return true;
+    }
+
+    // Queues a trsv call, see hipblasDeferGer
+    template <typename T>
+    bool hipblasDeferTrsv(hipblasHandle_t    handle,
+                          hipblasFillMode_t  uplo,
+                          hipblasOperation_t transA,
+                          hipblasDiagType_t  diag,
+                          int                n,
+                          const T*           A,
+                          int                lda,
+                          T*                 x,
+                          int                incx,
+                          hipblasStatus_t*   status)
+    {
+        hipblasHandleState* state = hipblasGetDeferredState(handle);
+        if(!state)
+            return false;
+
+        auto& batch = state->deferred;
+
+        bool queueable = (uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER)
+                         && (transA == HIPBLAS_OP_N || transA == HIPBLAS_OP_T
+                             || transA == HIPBLAS_OP_C)
+                         && (diag == HIPBLAS_DIAG_UNIT || diag == HIPBLAS_DIAG_NON_UNIT) && n > 0
+                         && incx > 0 && lda >= n && A && x;
+
+        size_t x_size     = (size_t(incx) * (n - 1) + 1) * sizeof(T);
+        bool   same_batch = queueable && batch.kind == HIPBLAS_DEFERRED_KIND_TRSV
+                          && batch.type == hipblasRocDatatype<T>() && batch.A == A && batch.n == n
+                          && batch.lda == lda && batch.uplo == hipblasConvertFill(uplo)
+                          && batch.trans == hipblasConvertOperation(transA)
+                          && batch.diag == hipblasConvertDiag(diag)
+                          && batch.calls.size() < c_deferred_max_calls;
+
+        // the solves are only independent if no right-hand side is used twice
+        for(size_t i = 0; same_batch && i < batch.calls.size(); i++)
+        {
+            const auto& call = batch.calls[i];
+            if(hipblasRangesOverlap(
+                   call.x, (size_t(call.incx) * (n - 1) + 1) * sizeof(T), x, x_size))
+                same_batch = false;
+        }
+
+        if(!same_batch && batch.kind != HIPBLAS_DEFERRED_KIND_NONE)
+        {
+            *status = hipblasFlushDeferredState(handle, state);
+            if(*status != HIPBLAS_STATUS_SUCCESS)
+                return true;
+        }
+        if(!queueable)
+            return false;
+
+        if(!same_batch)
+        {
+            batch.kind  = HIPBLAS_DEFERRED_KIND_TRSV;
+            batch.type  = hipblasRocDatatype<T>();
+            batch.m     = n;
+            batch.n     = n;
+            batch.A     = A;
+            batch.lda   = lda;
+            batch.uplo  = hipblasConvertFill(uplo);
+            batch.trans = hipblasConvertOperation(transA);
+            batch.diag  = hipblasConvertDiag(diag);
+        }
+
+        batch.calls.push_back(hipblasDeferredCall{x, incx, nullptr, 0});
+
+        *status = HIPBLAS_STATUS_SUCCESS;
+        return true;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasDeferredBegin(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, true);
+    if(!state->deferred_active)
+    {
+        state->deferred_active = true;
+        deferred_handle_count++;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDeferredEnd(hipblasHandle_t handle)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, false);
+    if(!state || !state->deferred_active)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    state->deferred_active = false;
+    deferred_handle_count--;
+    return hipblasFlushDeferredState(handle, state);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
 hipblasStatus_t hipblasCreate(hipblasHandle_t* handle)
 try
 {
@@ -374,6 +1938,44 @@ catch(...)
 hipblasStatus_t hipblasDestroy(hipblasHandle_t handle)
 try
 {
+    if(handle)
+    {
+        std::unique_ptr<hipblasHandleState> state;
+        {
+            std::lock_guard<std::mutex> lock(handle_state_mutex);
+            auto                        it = handle_states.find(handle);
+            if(it != handle_states.end())
+            {
+                state = std::move(it->second);
+                handle_states.erase(it);
+            }
+        }
+        if(state)
+        {
+            hipblasFlushDeferredState(handle, state.get());
+            if(state->deferred_active)
+                deferred_handle_count--;
+            if(state->gemm_strassen_levels != 0)
+                strassen_handle_count--;
+            if(state->gemm_order_mode != HIPBLAS_GEMM_ORDER_DEFAULT)
+                order_handle_count--;
+            if(state->qr_algo != HIPBLAS_QR_ALGO_DEFAULT)
+                tsqr_handle_count--;
+            if(state->workspace)
+            {
+                hipStream_t stream;
+                rocblas_get_stream((rocblas_handle)handle, &stream);
+                (void)hipStreamSynchronize(stream);
+                (void)hipFree(state->workspace);
+            }
+            if(state->upload_staging)
+            {
+                (void)hipEventSynchronize(state->upload_event);
+                (void)hipEventDestroy(state->upload_event);
+                (void)hipHostFree(state->upload_staging);
+            }
+        }
+    }
     return hipblasConvertStatus(rocblas_destroy_handle((rocblas_handle)handle));
 }
 catch(...)
@@ -388,6 +1990,10 @@ try
     {
         return HIPBLAS_STATUS_NOT_INITIALIZED;
     }
+    // queued calls run on the stream they were issued on
+    hipblasStatus_t status = hipblasFlushDeferredIfAny(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
     return hipblasConvertStatus(rocblas_set_stream((rocblas_handle)handle, streamId));
 }
 catch(...)
@@ -545,220 +2151,807 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
-// atomics mode
-hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
+} // extern "C"
+
+/*******************************************************************************
+ * Pack and unpack batched
+ ******************************************************************************/
+namespace
+{
+    // Size in bytes of the elements of type, 0 if the type isn't supported
+    size_t hipblasDatatypeSize(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+        case HIP_C_8U:
+            return 2;
+        case HIP_R_32F:
+        case HIP_R_32I:
+        case HIP_R_32U:
+        case HIP_C_16F:
+        case HIP_C_16BF:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+        case HIP_C_32I:
+        case HIP_C_32U:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // Copies the m by n matrices src[i] into dst[i] with a single geam_batched, C = 1 * A + 0 * B
+    template <typename T>
+    rocblas_status hipblasGeamCopyBatched(rocblas_handle     handle,
+                                          int                m,
+                                          int                n,
+                                          const void* const* src,
+                                          int                ld_src,
+                                          void* const*       dst,
+                                          int                ld_dst,
+                                          int                batch_count)
+    {
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(handle, &mode);
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+
+        // with beta = 0 the B matrices are not read
+        const T        one = T(1), zero = T(0);
+        rocblas_status status = hipblasRocGeamBatched(handle,
+                                                      rocblas_operation_none,
+                                                      rocblas_operation_none,
+                                                      m,
+                                                      n,
+                                                      &one,
+                                                      (const T* const*)src,
+                                                      ld_src,
+                                                      &zero,
+                                                      (const T* const*)nullptr,
+                                                      ld_dst,
+                                                      (T* const*)dst,
+                                                      ld_dst,
+                                                      batch_count);
+        rocblas_set_pointer_mode(handle, mode);
+        return status;
+    }
+
+    // Copies the m by n matrices A[i] into B + i * stride_B if pack, or back otherwise. The types
+    // of geam are copied by a single geam_batched with an array of pointers into B, computed on
+    // the host and uploaded, so A is never read on the host. For the other types the pointers
+    // are read back and matrices which follow each other in A as in B are copied together as a
+    // single matrix of n * count columns, so a batch which is already strided in A takes one copy.
+    hipblasStatus_t hipblasPackBatched(hipblasHandle_t    handle,
+                                       bool               pack,
+                                       int                m,
+                                       int                n,
+                                       hipDataType        type,
+                                       const void* const* A,
+                                       int                lda,
+                                       char*              B,
+                                       int                ldb,
+                                       hipblasStride      stride_B,
+                                       int                batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        size_t size = hipblasDatatypeSize(type);
+        if(!size)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || lda < std::max(m, 1) || ldb < std::max(m, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        size_t         step    = stride_B * size;
+
+        if(type == HIP_R_32F || type == HIP_R_64F || type == HIP_C_32F || type == HIP_C_64F)
+        {
+            hipblasHandleState* state = hipblasGetHandleState(handle, true);
+            void**              B_array
+                = (void**)hipblasGetHandleWorkspace(handle, state, sizeof(void*) * batch_count);
+            std::vector<void*> B_host(batch_count);
+            for(int i = 0; i < batch_count; i++)
+                B_host[i] = B + i * step;
+            hipblasUploadAsync(handle, state, B_array, B_host.data(), sizeof(void*) * batch_count);
+
+            const void* const* src    = pack ? A : (const void* const*)B_array;
+            void* const*       dst    = pack ? B_array : (void* const*)A;
+            int                ld_src = pack ? lda : ldb;
+            int                ld_dst = pack ? ldb : lda;
+            rocblas_status     status
+                = type == HIP_R_32F
+                      ? hipblasGeamCopyBatched<float>(
+                          rhandle, m, n, src, ld_src, dst, ld_dst, batch_count)
+                  : type == HIP_R_64F
+                      ? hipblasGeamCopyBatched<double>(
+                          rhandle, m, n, src, ld_src, dst, ld_dst, batch_count)
+                  : type == HIP_C_32F
+                      ? hipblasGeamCopyBatched<rocblas_float_complex>(
+                          rhandle, m, n, src, ld_src, dst, ld_dst, batch_count)
+                      : hipblasGeamCopyBatched<rocblas_double_complex>(
+                          rhandle, m, n, src, ld_src, dst, ld_dst, batch_count);
+            return hipblasConvertStatus(status);
+        }
+
+        hipStream_t stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        // the pointers are needed on the host to find the matrices which can be copied together
+        std::vector<char*> A_host(batch_count);
+        hipError_t         hip_status = hipMemcpyAsync(
+            A_host.data(), A, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream);
+        if(hip_status == hipSuccess)
+            hip_status = hipStreamSynchronize(stream);
+        if(hip_status != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        size_t pitch_A = size_t(lda) * size;
+        size_t pitch_B = size_t(ldb) * size;
+        bool   chain   = lda == ldb && stride_B == hipblasStride(ldb) * n;
+        for(int i = 0, count; i < batch_count; i += count)
+        {
+            for(count = 1; chain && i + count < batch_count; count++)
+                if(A_host[i + count] != A_host[i] + count * step)
+                    break;
+
+            char* a    = A_host[i];
+            char* b    = B + i * step;
+            hip_status = hipMemcpy2DAsync(pack ? b : a,
+                                          pack ? pitch_B : pitch_A,
+                                          pack ? a : b,
+                                          pack ? pitch_A : pitch_B,
+                                          m * size,
+                                          size_t(n) * count,
+                                          hipMemcpyDeviceToDevice,
+                                          stream);
+            if(hip_status != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasPackBatched(hipblasHandle_t   handle,
+                                   int               m,
+                                   int               n,
+                                   hipDataType       type,
+                                   const void* const A[],
+                                   int               lda,
+                                   void*             B,
+                                   int               ldb,
+                                   hipblasStride     strideB,
+                                   int               batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_set_atomics_mode((rocblas_handle)handle, hipblasConvertAtomicsMode(atomics_mode)));
+    return hipblasPackBatched(
+        handle, true, m, n, type, A, lda, (char*)B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t* atomics_mode)
+hipblasStatus_t hipblasUnpackBatched(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     hipDataType     type,
+                                     const void*     B,
+                                     int             ldb,
+                                     hipblasStride   strideB,
+                                     void* const     A[],
+                                     int             lda,
+                                     int             batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_get_atomics_mode((rocblas_handle)handle, (rocblas_atomics_mode*)atomics_mode));
+    return hipblasPackBatched(
+        handle, false, m, n, type, (const void* const*)A, lda, (char*)B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-// amax
-hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+hipblasStatus_t hipblasSpackBatched(hipblasHandle_t    handle,
+                                    int                m,
+                                    int                n,
+                                    const float* const A[],
+                                    int                lda,
+                                    float*             B,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    int                batchCount)
 try
 {
-    return hipblasConvertStatus(rocblas_isamax((rocblas_handle)handle, n, x, incx, result));
+    return hipblasPackBatched(
+        handle, m, n, HIP_R_32F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+hipblasStatus_t hipblasDpackBatched(hipblasHandle_t     handle,
+                                    int                 m,
+                                    int                 n,
+                                    const double* const A[],
+                                    int                 lda,
+                                    double*             B,
+                                    int                 ldb,
+                                    hipblasStride       strideB,
+                                    int                 batchCount)
 try
 {
-    return hipblasConvertStatus(rocblas_idamax((rocblas_handle)handle, n, x, incx, result));
+    return hipblasPackBatched(
+        handle, m, n, HIP_R_64F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t
-    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+hipblasStatus_t hipblasCpackBatched(hipblasHandle_t             handle,
+                                    int                         m,
+                                    int                         n,
+                                    const hipblasComplex* const A[],
+                                    int                         lda,
+                                    hipblasComplex*             B,
+                                    int                         ldb,
+                                    hipblasStride               strideB,
+                                    int                         batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_32F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIzamax(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+hipblasStatus_t hipblasZpackBatched(hipblasHandle_t                   handle,
+                                    int                               m,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const A[],
+                                    int                               lda,
+                                    hipblasDoubleComplex*             B,
+                                    int                               ldb,
+                                    hipblasStride                     strideB,
+                                    int                               batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_64F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t
-    hipblasIcamax_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result)
+hipblasStatus_t hipblasCpackBatched_v2(hipblasHandle_t         handle,
+                                       int                     m,
+                                       int                     n,
+                                       const hipComplex* const A[],
+                                       int                     lda,
+                                       hipComplex*             B,
+                                       int                     ldb,
+                                       hipblasStride           strideB,
+                                       int                     batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_32F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIzamax_v2(
-    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result)
+hipblasStatus_t hipblasZpackBatched_v2(hipblasHandle_t               handle,
+                                       int                           m,
+                                       int                           n,
+                                       const hipDoubleComplex* const A[],
+                                       int                           lda,
+                                       hipDoubleComplex*             B,
+                                       int                           ldb,
+                                       hipblasStride                 strideB,
+                                       int                           batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_64F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-// amax_64
-hipblasStatus_t hipblasIsamax_64(
-    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+hipblasStatus_t hipblasSunpackBatched(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const float*    B,
+                                      int             ldb,
+                                      hipblasStride   strideB,
+                                      float* const    A[],
+                                      int             lda,
+                                      int             batchCount)
 try
 {
-    return hipblasConvertStatus(rocblas_isamax_64((rocblas_handle)handle, n, x, incx, result));
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_R_32F, B, ldb, strideB, (void* const*)A, lda, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIdamax_64(
-    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+hipblasStatus_t hipblasDunpackBatched(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const double*   B,
+                                      int             ldb,
+                                      hipblasStride   strideB,
+                                      double* const   A[],
+                                      int             lda,
+                                      int             batchCount)
 try
 {
-    return hipblasConvertStatus(rocblas_idamax_64((rocblas_handle)handle, n, x, incx, result));
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_R_64F, B, ldb, strideB, (void* const*)A, lda, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIcamax_64(
-    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+hipblasStatus_t hipblasCunpackBatched(hipblasHandle_t       handle,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      hipblasStride         strideB,
+                                      hipblasComplex* const A[],
+                                      int                   lda,
+                                      int                   batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_icamax_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_32F, B, ldb, strideB, (void* const*)A, lda, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIzamax_64(
-    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+hipblasStatus_t hipblasZunpackBatched(hipblasHandle_t             handle,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      hipblasStride               strideB,
+                                      hipblasDoubleComplex* const A[],
+                                      int                         lda,
+                                      int                         batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_izamax_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_64F, B, ldb, strideB, (void* const*)A, lda, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIcamax_v2_64(
-    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result)
+hipblasStatus_t hipblasCunpackBatched_v2(hipblasHandle_t   handle,
+                                         int               m,
+                                         int               n,
+                                         const hipComplex* B,
+                                         int               ldb,
+                                         hipblasStride     strideB,
+                                         hipComplex* const A[],
+                                         int               lda,
+                                         int               batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_icamax_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_32F, B, ldb, strideB, (void* const*)A, lda, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIzamax_v2_64(
-    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result)
+hipblasStatus_t hipblasZunpackBatched_v2(hipblasHandle_t         handle,
+                                         int                     m,
+                                         int                     n,
+                                         const hipDoubleComplex* B,
+                                         int                     ldb,
+                                         hipblasStride           strideB,
+                                         hipDoubleComplex* const A[],
+                                         int                     lda,
+                                         int                     batchCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_izamax_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_64F, B, ldb, strideB, (void* const*)A, lda, batchCount);
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-// amax_batched
-hipblasStatus_t hipblasIsamaxBatched(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+} // extern "C"
+
+/*******************************************************************************
+ * Info summary
+ *
+ * The info array is copied into the pinned staging memory of the handle, and a
+ * host function queued on the stream after the copy scans it. In device pointer
+ * mode the two results are then copied from the staging memory to the device.
+ ******************************************************************************/
+namespace
+{
+    // Start of the staging memory of hipblasInfoSummary, followed by the info values
+    struct hipblasInfoSummaryData
+    {
+        int  batch_count;
+        int* first_failure; // host memory of the caller, or results below in device pointer mode
+        int* failure_count;
+        int  results[2];
+    };
+
+    void hipblasInfoSummaryScan(void* user_data)
+    {
+        auto*      data  = (hipblasInfoSummaryData*)user_data;
+        const int* info  = (const int*)(data + 1);
+        int        first = -1, count = 0;
+        for(int i = 0; i < data->batch_count; i++)
+        {
+            if(info[i])
+            {
+                if(first < 0)
+                    first = i;
+                count++;
+            }
+        }
+        *data->first_failure = first;
+        *data->failure_count = count;
+    }
+
+    // Writes the summary of info, with batch_count > 0, to device or host memory
+    void hipblasInfoSummaryReduce(hipblasHandle_t handle,
+                                  const int*      info,
+                                  int             batch_count,
+                                  int*            first_failure,
+                                  int*            failure_count,
+                                  bool            device)
+    {
+        hipStream_t stream;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+
+        auto check = [](hipError_t status) {
+            if(status != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+
+        size_t              info_size = sizeof(int) * size_t(batch_count);
+        hipblasHandleState* state     = hipblasGetHandleState(handle, true);
+        auto*               data      = (hipblasInfoSummaryData*)hipblasGetHandleStaging(
+            handle, state, sizeof(hipblasInfoSummaryData) + info_size);
+        data->batch_count   = batch_count;
+        data->first_failure = device ? &data->results[0] : first_failure;
+        data->failure_count = device ? &data->results[1] : failure_count;
+
+        check(hipMemcpyAsync(data + 1, info, info_size, hipMemcpyDeviceToHost, stream));
+        check(hipLaunchHostFunc(stream, hipblasInfoSummaryScan, data));
+        if(device)
+        {
+            check(hipMemcpyAsync(
+                first_failure, &data->results[0], sizeof(int), hipMemcpyHostToDevice, stream));
+            check(hipMemcpyAsync(
+                failure_count, &data->results[1], sizeof(int), hipMemcpyHostToDevice, stream));
+        }
+        check(hipEventRecord(state->upload_event, stream));
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasInfoSummary(
+    hipblasHandle_t handle, const int* info, int batchCount, int* firstFailure, int* failureCount)
 try
 {
-    return hipblasConvertStatus(
-        rocblas_isamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batchCount < 0 || (info == NULL && batchCount) || firstFailure == NULL
+       || failureCount == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t          stream;
+    rocblas_pointer_mode mode;
+    rocblas_get_stream((rocblas_handle)handle, &stream);
+    rocblas_get_pointer_mode((rocblas_handle)handle, &mode);
+    bool device = mode == rocblas_pointer_mode_device;
+
+    if(!batchCount)
+    {
+        if(!device)
+        {
+            *firstFailure = -1;
+            *failureCount = 0;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        return hipMemsetAsync(firstFailure, 0xff, sizeof(int), stream) == hipSuccess
+                       && hipMemsetAsync(failureCount, 0, sizeof(int), stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    hipblasInfoSummaryReduce(handle, info, batchCount, firstFailure, failureCount, device);
+    return HIPBLAS_STATUS_SUCCESS;
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIdamaxBatched(
-    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+// atomics mode
+hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
 try
 {
     return hipblasConvertStatus(
-        rocblas_idamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+        rocblas_set_atomics_mode((rocblas_handle)handle, hipblasConvertAtomicsMode(atomics_mode)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
-                                     int                         n,
-                                     const hipblasComplex* const x[],
-                                     int                         incx,
-                                     int                         batchCount,
-                                     int*                        result)
+hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t* atomics_mode)
 try
 {
-    return hipblasConvertStatus(rocblas_icamax_batched((rocblas_handle)handle,
-                                                       n,
-                                                       (const rocblas_float_complex* const*)x,
-                                                       incx,
-                                                       batchCount,
-                                                       result));
+    return hipblasConvertStatus(
+        rocblas_get_atomics_mode((rocblas_handle)handle, (rocblas_atomics_mode*)atomics_mode));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
-                                     int                               n,
-                                     const hipblasDoubleComplex* const x[],
-                                     int                               incx,
-                                     int                               batchCount,
-                                     int*                              result)
+// backend version
+hipblasStatus_t hipblasGetBackendVersionString(char* buf, size_t len)
+try
+{
+    if(!buf)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    size_t version_len;
+    rocblas_status status = rocblas_get_version_string_size(&version_len);
+    if(status != rocblas_status_success)
+        return hipblasConvertStatus(status);
+
+    std::string version(version_len, '\0');
+    status = rocblas_get_version_string(&version[0], version_len);
+    if(status != rocblas_status_success)
+        return hipblasConvertStatus(status);
+
+    version = "rocBLAS " + std::string(version.c_str());
+    if(version.size() >= len)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::memcpy(buf, version.c_str(), version.size() + 1);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax
+hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
+try
+{
+    return hipblasConvertStatus(rocblas_isamax((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result)
+try
+{
+    return hipblasConvertStatus(rocblas_idamax((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t
+    hipblasIcamax_v2(hipblasHandle_t handle, int n, const hipComplex* x, int incx, int* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_icamax((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_v2(
+    hipblasHandle_t handle, int n, const hipDoubleComplex* x, int incx, int* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_izamax((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_64
+hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+try
+{
+    return hipblasConvertStatus(rocblas_isamax_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+try
+{
+    return hipblasConvertStatus(rocblas_idamax_64((rocblas_handle)handle, n, x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_icamax_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_izamax_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_icamax_64((rocblas_handle)handle, n, (rocblas_float_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamax_v2_64(
+    hipblasHandle_t handle, int64_t n, const hipDoubleComplex* x, int64_t incx, int64_t* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_izamax_64((rocblas_handle)handle, n, (rocblas_double_complex*)x, incx, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// amax_batched
+hipblasStatus_t hipblasIsamaxBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, int* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_isamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIdamaxBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batchCount, int* result)
+try
+{
+    return hipblasConvertStatus(
+        rocblas_idamax_batched((rocblas_handle)handle, n, x, incx, batchCount, result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     int                         batchCount,
+                                     int*                        result)
+try
+{
+    return hipblasConvertStatus(rocblas_icamax_batched((rocblas_handle)handle,
+                                                       n,
+                                                       (const rocblas_float_complex* const*)x,
+                                                       incx,
+                                                       batchCount,
+                                                       result));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasIzamaxBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     int                               batchCount,
+                                     int*                              result)
 try
 {
     return hipblasConvertStatus(rocblas_izamax_batched((rocblas_handle)handle,
@@ -13271,6 +15464,21 @@ hipblasStatus_t hipblasSger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GER,
+                       m,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(
         rocblas_sger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -13291,6 +15499,21 @@ hipblasStatus_t hipblasDger(hipblasHandle_t handle,
                             int             lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GER,
+                       m,
+                       n,
+                       alpha,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(
         rocblas_dger((rocblas_handle)handle, m, n, alpha, x, incx, y, incy, A, lda));
 }
@@ -13311,6 +15534,21 @@ hipblasStatus_t hipblasCgeru(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GER,
+                       m,
+                       n,
+                       (const rocblas_float_complex*)alpha,
+                       (const rocblas_float_complex*)x,
+                       incx,
+                       (const rocblas_float_complex*)y,
+                       incy,
+                       (rocblas_float_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_cgeru((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13339,6 +15577,21 @@ hipblasStatus_t hipblasCgerc(hipblasHandle_t       handle,
                              int                   lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GERC,
+                       m,
+                       n,
+                       (const rocblas_float_complex*)alpha,
+                       (const rocblas_float_complex*)x,
+                       incx,
+                       (const rocblas_float_complex*)y,
+                       incy,
+                       (rocblas_float_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_cgerc((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13367,6 +15620,21 @@ hipblasStatus_t hipblasZgeru(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GER,
+                       m,
+                       n,
+                       (const rocblas_double_complex*)alpha,
+                       (const rocblas_double_complex*)x,
+                       incx,
+                       (const rocblas_double_complex*)y,
+                       incy,
+                       (rocblas_double_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_zgeru((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13395,6 +15663,21 @@ hipblasStatus_t hipblasZgerc(hipblasHandle_t             handle,
                              int                         lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GERC,
+                       m,
+                       n,
+                       (const rocblas_double_complex*)alpha,
+                       (const rocblas_double_complex*)x,
+                       incx,
+                       (const rocblas_double_complex*)y,
+                       incy,
+                       (rocblas_double_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_zgerc((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13423,6 +15706,21 @@ hipblasStatus_t hipblasCgeru_v2(hipblasHandle_t   handle,
                                 int               lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GER,
+                       m,
+                       n,
+                       (const rocblas_float_complex*)alpha,
+                       (const rocblas_float_complex*)x,
+                       incx,
+                       (const rocblas_float_complex*)y,
+                       incy,
+                       (rocblas_float_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_cgeru((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13451,6 +15749,21 @@ hipblasStatus_t hipblasCgerc_v2(hipblasHandle_t   handle,
                                 int               lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GERC,
+                       m,
+                       n,
+                       (const rocblas_float_complex*)alpha,
+                       (const rocblas_float_complex*)x,
+                       incx,
+                       (const rocblas_float_complex*)y,
+                       incy,
+                       (rocblas_float_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_cgerc((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13479,6 +15792,21 @@ hipblasStatus_t hipblasZgeru_v2(hipblasHandle_t         handle,
                                 int                     lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GER,
+                       m,
+                       n,
+                       (const rocblas_double_complex*)alpha,
+                       (const rocblas_double_complex*)x,
+                       incx,
+                       (const rocblas_double_complex*)y,
+                       incy,
+                       (rocblas_double_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_zgeru((rocblas_handle)handle,
                                               m,
                                               n,
@@ -13507,6 +15835,21 @@ hipblasStatus_t hipblasZgerc_v2(hipblasHandle_t         handle,
                                 int                     lda)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferGer(handle,
+                       HIPBLAS_DEFERRED_KIND_GERC,
+                       m,
+                       n,
+                       (const rocblas_double_complex*)alpha,
+                       (const rocblas_double_complex*)x,
+                       incx,
+                       (const rocblas_double_complex*)y,
+                       incy,
+                       (rocblas_double_complex*)A,
+                       lda,
+                       &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_zgerc((rocblas_handle)handle,
                                               m,
                                               n,
@@ -30590,6 +32933,10 @@ hipblasStatus_t hipblasStrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferTrsv(handle, uplo, transA, diag, n, A, lda, x, incx, &status))
+        return status;
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_strsv((rocblas_handle)handle,
                                                                    hipblasConvertFill(uplo),
                                                                    hipblasConvertOperation(transA),
@@ -30616,6 +32963,10 @@ hipblasStatus_t hipblasDtrsv(hipblasHandle_t    handle,
                              int                incx)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferTrsv(handle, uplo, transA, diag, n, A, lda, x, incx, &status))
+        return status;
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_dtrsv((rocblas_handle)handle,
                                                                    hipblasConvertFill(uplo),
                                                                    hipblasConvertOperation(transA),
@@ -30642,6 +32993,19 @@ hipblasStatus_t hipblasCtrsv(hipblasHandle_t       handle,
                              int                   incx)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferTrsv(handle,
+                        uplo,
+                        transA,
+                        diag,
+                        n,
+                        (const rocblas_float_complex*)A,
+                        lda,
+                        (rocblas_float_complex*)x,
+                        incx,
+                        &status))
+        return status;
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_ctrsv((rocblas_handle)handle,
                                                                    hipblasConvertFill(uplo),
                                                                    hipblasConvertOperation(transA),
@@ -30668,6 +33032,19 @@ hipblasStatus_t hipblasZtrsv(hipblasHandle_t             handle,
                              int                         incx)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferTrsv(handle,
+                        uplo,
+                        transA,
+                        diag,
+                        n,
+                        (const rocblas_double_complex*)A,
+                        lda,
+                        (rocblas_double_complex*)x,
+                        incx,
+                        &status))
+        return status;
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_ztrsv((rocblas_handle)handle,
                                                                    hipblasConvertFill(uplo),
                                                                    hipblasConvertOperation(transA),
@@ -30694,6 +33071,19 @@ hipblasStatus_t hipblasCtrsv_v2(hipblasHandle_t    handle,
                                 int                incx)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferTrsv(handle,
+                        uplo,
+                        transA,
+                        diag,
+                        n,
+                        (const rocblas_float_complex*)A,
+                        lda,
+                        (rocblas_float_complex*)x,
+                        incx,
+                        &status))
+        return status;
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_ctrsv((rocblas_handle)handle,
                                                                    hipblasConvertFill(uplo),
                                                                    hipblasConvertOperation(transA),
@@ -30720,6 +33110,19 @@ hipblasStatus_t hipblasZtrsv_v2(hipblasHandle_t         handle,
                                 int                     incx)
 try
 {
+    hipblasStatus_t status;
+    if(hipblasDeferTrsv(handle,
+                        uplo,
+                        transA,
+                        diag,
+                        n,
+                        (const rocblas_double_complex*)A,
+                        lda,
+                        (rocblas_double_complex*)x,
+                        incx,
+                        &status))
+        return status;
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_ztrsv((rocblas_handle)handle,
                                                                    hipblasConvertFill(uplo),
                                                                    hipblasConvertOperation(transA),
@@ -46029,6 +48432,47 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+hipblasStatus_t hipblasSetQrAlgo(hipblasHandle_t handle, hipblasQrAlgo_t algo)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(algo != HIPBLAS_QR_ALGO_DEFAULT && algo != HIPBLAS_QR_ALGO_TSQR)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, algo != HIPBLAS_QR_ALGO_DEFAULT);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(state->qr_algo == HIPBLAS_QR_ALGO_DEFAULT && algo != HIPBLAS_QR_ALGO_DEFAULT)
+        tsqr_handle_count++;
+    else if(state->qr_algo != HIPBLAS_QR_ALGO_DEFAULT && algo == HIPBLAS_QR_ALGO_DEFAULT)
+        tsqr_handle_count--;
+    state->qr_algo = algo;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetQrAlgo(hipblasHandle_t handle, hipblasQrAlgo_t* algo)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(algo == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, false);
+    *algo                     = state ? state->qr_algo : HIPBLAS_QR_ALGO_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
 #ifdef __HIP_PLATFORM_SOLVER__
 
 //--------------------------------------------------------------------------------------
@@ -47702,6 +50146,666 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+} // extern "C"
+
+/*******************************************************************************
+ * Typed rocSOLVER entry points
+ ******************************************************************************/
+namespace
+{
+    rocblas_status hipblasRocsolverGeqrf(
+        rocblas_handle handle, int m, int n, float* A, int lda, float* ipiv)
+    {
+        return rocsolver_sgeqrf(handle, m, n, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverGeqrf(
+        rocblas_handle handle, int m, int n, double* A, int lda, double* ipiv)
+    {
+        return rocsolver_dgeqrf(handle, m, n, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverGeqrf(rocblas_handle         handle,
+                                         int                    m,
+                                         int                    n,
+                                         rocblas_float_complex* A,
+                                         int                    lda,
+                                         rocblas_float_complex* ipiv)
+    {
+        return rocsolver_cgeqrf(handle, m, n, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverGeqrf(rocblas_handle          handle,
+                                         int                     m,
+                                         int                     n,
+                                         rocblas_double_complex* A,
+                                         int                     lda,
+                                         rocblas_double_complex* ipiv)
+    {
+        return rocsolver_zgeqrf(handle, m, n, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverGeqrfStridedBatched(rocblas_handle handle,
+                                                       int            m,
+                                                       int            n,
+                                                       float*         A,
+                                                       int            lda,
+                                                       hipblasStride  strideA,
+                                                       float*         ipiv,
+                                                       hipblasStride  strideP,
+                                                       int            batch_count)
+    {
+        return rocsolver_sgeqrf_strided_batched(
+            handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGeqrfStridedBatched(rocblas_handle handle,
+                                                       int            m,
+                                                       int            n,
+                                                       double*        A,
+                                                       int            lda,
+                                                       hipblasStride  strideA,
+                                                       double*        ipiv,
+                                                       hipblasStride  strideP,
+                                                       int            batch_count)
+    {
+        return rocsolver_dgeqrf_strided_batched(
+            handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGeqrfStridedBatched(rocblas_handle         handle,
+                                                       int                    m,
+                                                       int                    n,
+                                                       rocblas_float_complex* A,
+                                                       int                    lda,
+                                                       hipblasStride          strideA,
+                                                       rocblas_float_complex* ipiv,
+                                                       hipblasStride          strideP,
+                                                       int                    batch_count)
+    {
+        return rocsolver_cgeqrf_strided_batched(
+            handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGeqrfStridedBatched(rocblas_handle          handle,
+                                                       int                     m,
+                                                       int                     n,
+                                                       rocblas_double_complex* A,
+                                                       int                     lda,
+                                                       hipblasStride           strideA,
+                                                       rocblas_double_complex* ipiv,
+                                                       hipblasStride           strideP,
+                                                       int                     batch_count)
+    {
+        return rocsolver_zgeqrf_strided_batched(
+            handle, m, n, A, lda, strideA, ipiv, strideP, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverOrgqr(
+        rocblas_handle handle, int m, int n, int k, float* A, int lda, float* ipiv)
+    {
+        return rocsolver_sorgqr(handle, m, n, k, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverOrgqr(
+        rocblas_handle handle, int m, int n, int k, double* A, int lda, double* ipiv)
+    {
+        return rocsolver_dorgqr(handle, m, n, k, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverOrgqr(rocblas_handle         handle,
+                                         int                    m,
+                                         int                    n,
+                                         int                    k,
+                                         rocblas_float_complex* A,
+                                         int                    lda,
+                                         rocblas_float_complex* ipiv)
+    {
+        return rocsolver_cungqr(handle, m, n, k, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverOrgqr(rocblas_handle          handle,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         rocblas_double_complex* A,
+                                         int                     lda,
+                                         rocblas_double_complex* ipiv)
+    {
+        return rocsolver_zungqr(handle, m, n, k, A, lda, ipiv);
+    }
+
+    rocblas_status hipblasRocsolverOrmqr(rocblas_handle    handle,
+                                         rocblas_side      side,
+                                         rocblas_operation trans,
+                                         int               m,
+                                         int               n,
+                                         int               k,
+                                         float*            A,
+                                         int               lda,
+                                         float*            ipiv,
+                                         float*            C,
+                                         int               ldc)
+    {
+        return rocsolver_sormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+    }
+
+    rocblas_status hipblasRocsolverOrmqr(rocblas_handle    handle,
+                                         rocblas_side      side,
+                                         rocblas_operation trans,
+                                         int               m,
+                                         int               n,
+                                         int               k,
+                                         double*           A,
+                                         int               lda,
+                                         double*           ipiv,
+                                         double*           C,
+                                         int               ldc)
+    {
+        return rocsolver_dormqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+    }
+
+    rocblas_status hipblasRocsolverOrmqr(rocblas_handle         handle,
+                                         rocblas_side           side,
+                                         rocblas_operation      trans,
+                                         int                    m,
+                                         int                    n,
+                                         int                    k,
+                                         rocblas_float_complex* A,
+                                         int                    lda,
+                                         rocblas_float_complex* ipiv,
+                                         rocblas_float_complex* C,
+                                         int                    ldc)
+    {
+        return rocsolver_cunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+    }
+
+    rocblas_status hipblasRocsolverOrmqr(rocblas_handle          handle,
+                                         rocblas_side            side,
+                                         rocblas_operation       trans,
+                                         int                     m,
+                                         int                     n,
+                                         int                     k,
+                                         rocblas_double_complex* A,
+                                         int                     lda,
+                                         rocblas_double_complex* ipiv,
+                                         rocblas_double_complex* C,
+                                         int                     ldc)
+    {
+        return rocsolver_zunmqr(handle, side, trans, m, n, k, A, lda, ipiv, C, ldc);
+    }
+} // namespace
+
+/*******************************************************************************
+ * Matrix copies
+ ******************************************************************************/
+namespace
+{
+    // Copies the n-by-cols matrix src with leading dimension ld_src
+    template <typename T>
+    hipError_t hipblasCopyMatrixAsync(T*            dst,
+                                      int           ld_dst,
+                                      const T*      src,
+                                      int           ld_src,
+                                      int           n,
+                                      int           cols,
+                                      hipMemcpyKind kind,
+                                      hipStream_t   stream)
+    {
+        return hipMemcpy2DAsync(dst,
+                                sizeof(T) * ld_dst,
+                                src,
+                                sizeof(T) * ld_src,
+                                sizeof(T) * n,
+                                cols,
+                                kind,
+                                stream);
+    }
+} // namespace
+
+/*******************************************************************************
+ * TSQR
+ *
+ * Tall-skinny QR for m much larger than n, used by geqrf and gels when the
+ * algorithm of the handle is HIPBLAS_QR_ALGO_TSQR. The rows of A are split into
+ * blocks which are factored with one strided batched geqrf. Their R factors are
+ * stacked and factored in the same way until a single block is left.
+ *
+ * gels factors [A B] this way, so Q^H is applied to B level by level and the
+ * root holds R and the first n rows of Q^H B. geqrf has to return Householder
+ * vectors: the explicit Q is formed going down the tree with ormqr, and the
+ * Householder vectors of A are recovered from it with an LU factorization of
+ * its top n-by-n block on the host, so the output is the one of geqrf up to
+ * rounding.
+ ******************************************************************************/
+namespace
+{
+    // A level is split into blocks of at least this many times n rows
+    constexpr int c_tsqr_block_factor = 8;
+
+    // Upper bound on the number of blocks of a level
+    constexpr int c_tsqr_max_blocks = 256;
+
+    template <typename T>
+    struct hipblasHostType
+    {
+        using type = T;
+    };
+
+    template <>
+    struct hipblasHostType<rocblas_float_complex>
+    {
+        using type = std::complex<float>;
+    };
+
+    template <>
+    struct hipblasHostType<rocblas_double_complex>
+    {
+        using type = std::complex<double>;
+    };
+
+    int hipblasTsqrBlocks(int m, int n)
+    {
+        int64_t blocks = m / (int64_t(c_tsqr_block_factor) * n);
+        return int(std::max(int64_t(1), std::min(int64_t(c_tsqr_max_blocks), blocks)));
+    }
+
+    bool hipblasUseTsqr(hipblasHandle_t handle, int m, int n)
+    {
+        if(!tsqr_handle_count.load(std::memory_order_relaxed) || !n || hipblasTsqrBlocks(m, n) < 2)
+            return false;
+
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        return state && state->qr_algo == HIPBLAS_QR_ALGO_TSQR;
+    }
+
+    // A level of the reduction tree. Blocks 0 to p - 2 have mb rows and the last one the rest.
+    template <typename T>
+    struct hipblasTsqrLevel
+    {
+        T*  A;
+        int lda;
+        int m;
+        int mb;
+        int p;
+        T*  tau;
+    };
+
+    // Lays out the levels in work, starting with A itself, and returns the number of elements
+    // they use. The matrices have cols columns, of which the first n are factored; gels appends
+    // its right hand sides as the other columns. Only the size is computed if levels is null.
+    template <typename T>
+    size_t hipblasTsqrPlan(int                               m,
+                           int                               n,
+                           int                               cols,
+                           T*                                A,
+                           int                               lda,
+                           T*                                work,
+                           std::vector<hipblasTsqrLevel<T>>* levels)
+    {
+        size_t size = 0;
+        for(int rows = m;;)
+        {
+            int p  = hipblasTsqrBlocks(rows, n);
+            int mb = rows / p;
+
+            if(levels)
+                levels->push_back({A, lda, rows, mb, p, work + size});
+            size += size_t(p) * cols;
+            if(p == 1)
+                return size;
+
+            // the next level holds the stacked R factors
+            rows = p * n;
+            lda  = rows;
+            if(levels)
+                A = work + size;
+            size += size_t(rows) * cols;
+        }
+    }
+
+    // Factors the blocks of each level with geqrf and stacks the first n rows of their R factors
+    // in the next level, so the first n rows of the root hold the R factor of the first level.
+    // Throws the status of a failed call.
+    template <typename T>
+    void hipblasTsqrFactor(hipblasHandle_t                         handle,
+                           const std::vector<hipblasTsqrLevel<T>>& levels,
+                           int                                     n,
+                           int                                     cols)
+    {
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        hipStream_t    stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        auto check = [](hipError_t err) {
+            if(err != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+        auto roc = [&](const std::function<rocblas_status()>& call) {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(call()));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw status;
+        };
+
+        for(size_t l = 0; l < levels.size(); l++)
+        {
+            const hipblasTsqrLevel<T>& level = levels[l];
+            int                        last  = level.p - 1;
+            if(last)
+                roc([&] {
+                    return hipblasRocsolverGeqrfStridedBatched(rhandle,
+                                                               level.mb,
+                                                               cols,
+                                                               level.A,
+                                                               level.lda,
+                                                               level.mb,
+                                                               level.tau,
+                                                               cols,
+                                                               last);
+                });
+            roc([&] {
+                return hipblasRocsolverGeqrf(rhandle,
+                                             level.m - last * level.mb,
+                                             cols,
+                                             level.A + size_t(last) * level.mb,
+                                             level.lda,
+                                             level.tau + size_t(last) * cols);
+            });
+            if(!last)
+                break;
+
+            // column j of the stacked factors is min(j + 1, n) elements of each block
+            const hipblasTsqrLevel<T>& next = levels[l + 1];
+            check(hipMemsetAsync(next.A, 0, sizeof(T) * next.lda * cols, stream));
+            for(int j = 0; j < cols; j++)
+                check(hipMemcpy2DAsync(next.A + size_t(j) * next.lda,
+                                       sizeof(T) * n,
+                                       level.A + size_t(j) * level.lda,
+                                       sizeof(T) * level.mb,
+                                       sizeof(T) * std::min(j + 1, n),
+                                       level.p,
+                                       hipMemcpyDeviceToDevice,
+                                       stream));
+        }
+    }
+
+    template <typename T>
+    size_t hipblasTsqrWorkspaceSize(int m, int n)
+    {
+        // the levels, the Q of a level, then U, R and tau of the reconstruction
+        size_t size = hipblasTsqrPlan<T>(m, n, n, nullptr, m, nullptr, nullptr);
+        return sizeof(T) * (size + size_t(m) * n + 2 * size_t(n) * n + n);
+    }
+
+    // Overwrites A and tau with the output of geqrf. work holds hipblasTsqrWorkspaceSize<T>(m, n)
+    // bytes. Throws the status of a failed call.
+    template <typename T>
+    void hipblasTsqr(hipblasHandle_t     handle,
+                     hipblasHandleState* state,
+                     int                 m,
+                     int                 n,
+                     T*                  A,
+                     int                 lda,
+                     T*                  tau,
+                     T*                  work)
+    {
+        using H = typename hipblasHostType<T>::type;
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        hipStream_t    stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        auto check = [](hipError_t err) {
+            if(err != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+        auto roc = [&](const std::function<rocblas_status()>& call) {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(call()));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw status;
+        };
+
+        std::vector<hipblasTsqrLevel<T>> levels;
+
+        size_t size  = hipblasTsqrPlan(m, n, n, A, lda, work, &levels);
+        T*     C     = work + size;
+        T*     U     = C + size_t(m) * n;
+        T*     R     = U + size_t(n) * n;
+        T*     tau_R = R + size_t(n) * n;
+
+        hipblasTsqrFactor(handle, levels, n, n);
+
+        // R of A is the R of the root. U, S R and tau are computed on the host in h_U, h_R and
+        // h_tau, and uploaded together.
+        const hipblasTsqrLevel<T>& root = levels.back();
+        std::vector<H>             h_work(2 * size_t(n) * n + n), h_R0(size_t(n) * n);
+        H*                         h_U   = h_work.data();
+        H*                         h_R   = h_U + size_t(n) * n;
+        H*                         h_tau = h_R + size_t(n) * n;
+        check(hipblasCopyMatrixAsync(
+            (T*)h_R0.data(), n, root.A, root.lda, n, n, hipMemcpyDeviceToHost, stream));
+
+        // explicit Q of the root, then of each level below. The Q of block b of a level is the Q
+        // of its factorization applied to rows b * n to b * n + n - 1 of the Q of the level above,
+        // which are copied to the top of block b of C.
+        roc([&] {
+            return hipblasRocsolverOrgqr(rhandle, root.m, n, n, root.A, root.lda, root.tau);
+        });
+        for(size_t l = levels.size() - 1; l-- > 0;)
+        {
+            const hipblasTsqrLevel<T>& level = levels[l];
+            const hipblasTsqrLevel<T>& up    = levels[l + 1];
+
+            check(hipMemsetAsync(C, 0, sizeof(T) * level.m * n, stream));
+            if(n <= level.p)
+            {
+                for(int j = 0; j < n; j++)
+                    check(hipMemcpy2DAsync(C + size_t(j) * level.m,
+                                           sizeof(T) * level.mb,
+                                           up.A + size_t(j) * up.lda,
+                                           sizeof(T) * n,
+                                           sizeof(T) * n,
+                                           level.p,
+                                           hipMemcpyDeviceToDevice,
+                                           stream));
+            }
+            else
+            {
+                for(int b = 0; b < level.p; b++)
+                    check(hipblasCopyMatrixAsync(C + size_t(b) * level.mb,
+                                                 level.m,
+                                                 up.A + size_t(b) * n,
+                                                 up.lda,
+                                                 n,
+                                                 n,
+                                                 hipMemcpyDeviceToDevice,
+                                                 stream));
+            }
+
+            for(int b = 0; b < level.p; b++)
+            {
+                int rows = b < level.p - 1 ? level.mb : level.m - (level.p - 1) * level.mb;
+                roc([&] {
+                    return hipblasRocsolverOrmqr(rhandle,
+                                                 rocblas_side_left,
+                                                 rocblas_operation_none,
+                                                 rows,
+                                                 n,
+                                                 n,
+                                                 level.A + size_t(b) * level.mb,
+                                                 level.lda,
+                                                 level.tau + size_t(b) * n,
+                                                 C + size_t(b) * level.mb,
+                                                 level.m);
+                });
+            }
+            check(hipblasCopyMatrixAsync(
+                level.A, level.lda, C, level.m, level.m, n, hipMemcpyDeviceToDevice, stream));
+        }
+
+        // LU factorization of the top block W of Q, with a sign s_i subtracted from each pivot
+        // a_i as in the Householder reflection of LAPACK. Then Q - [S; 0] = Y U where Y holds
+        // the Householder vectors of Q, which are those of A, tau_i = 1 - s_i a_i and the R of
+        // geqrf is S R.
+        check(hipblasCopyMatrixAsync((T*)h_U, n, A, lda, n, n, hipMemcpyDeviceToHost, stream));
+        check(hipStreamSynchronize(stream));
+
+        std::vector<H> h_S(n);
+        for(int i = 0; i < n; i++)
+        {
+            H& a     = h_U[i + size_t(i) * n];
+            h_S[i]   = std::real(a) >= 0 ? H(-1) : H(1);
+            h_tau[i] = H(1) - h_S[i] * a;
+            a -= h_S[i];
+            for(int r = i + 1; r < n; r++)
+                h_U[r + size_t(i) * n] /= a;
+            for(int k = i + 1; k < n; k++)
+                for(int r = i + 1; r < n; r++)
+                    h_U[r + size_t(k) * n] -= h_U[r + size_t(i) * n] * h_U[i + size_t(k) * n];
+        }
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i <= j; i++)
+                h_R[i + size_t(j) * n] = h_S[i] * h_R0[i + size_t(j) * n];
+
+        // the stream is not synchronized again, the upload goes through pinned memory
+        hipblasUploadAsync(handle, state, U, h_work.data(), sizeof(T) * h_work.size());
+
+        // rows n to m - 1 of Y solve Y U = Q
+        if(m > n)
+        {
+            rocblas_pointer_mode mode;
+            rocblas_get_pointer_mode(rhandle, &mode);
+            const T one = T(1);
+            roc([&] {
+                rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+                rocblas_status status = hipblasRocTrsm(rhandle,
+                                                       rocblas_side_right,
+                                                       rocblas_fill_upper,
+                                                       rocblas_operation_none,
+                                                       rocblas_diagonal_non_unit,
+                                                       m - n,
+                                                       n,
+                                                       &one,
+                                                       U,
+                                                       n,
+                                                       A + n,
+                                                       lda);
+                rocblas_set_pointer_mode(rhandle, mode);
+                return status;
+            });
+        }
+
+        check(hipblasCopyMatrixAsync(A, lda, R, n, n, n, hipMemcpyDeviceToDevice, stream));
+        check(hipMemcpyAsync(tau, tau_R, sizeof(T) * n, hipMemcpyDeviceToDevice, stream));
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGeqrfTsqr(hipblasHandle_t handle, int m, int n, T* A, int lda, T* tau)
+    {
+        hipblasHandleState* state = hipblasGetHandleState(handle, true);
+        T*                  work
+            = (T*)hipblasGetHandleWorkspace(handle, state, hipblasTsqrWorkspaceSize<T>(m, n));
+
+        hipblasTsqr(handle, state, m, n, A, lda, tau, work);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Least squares solution of A X = B for m >= n, as gels with HIPBLAS_OP_N. [A B] is factored
+    // in the workspace, so the Householder reflections of every level are applied to B as part of
+    // its geqrf, and the root holds R and the first n rows of Q^H B. Neither Q nor the Householder
+    // vectors of A are formed, A is left unchanged and only the first n rows of B are written.
+    template <typename T>
+    hipblasStatus_t hipblasGelsTsqr(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    int             nrhs,
+                                    T*              A,
+                                    int             lda,
+                                    T*              B,
+                                    int             ldb,
+                                    int*            deviceInfo)
+    {
+        using H = typename hipblasHostType<T>::type;
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        hipStream_t    stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        auto check = [](hipError_t err) {
+            if(err != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+
+        int                 cols  = n + nrhs;
+        hipblasHandleState* state = hipblasGetHandleState(handle, true);
+        size_t              size  = hipblasTsqrPlan<T>(m, n, cols, nullptr, m, nullptr, nullptr);
+        T*                  W     = (T*)hipblasGetHandleWorkspace(
+            handle, state, sizeof(T) * (size_t(m) * cols + size));
+
+        check(hipblasCopyMatrixAsync(W, m, A, lda, m, n, hipMemcpyDeviceToDevice, stream));
+        if(nrhs)
+            check(hipblasCopyMatrixAsync(
+                W + size_t(m) * n, m, B, ldb, m, nrhs, hipMemcpyDeviceToDevice, stream));
+
+        std::vector<hipblasTsqrLevel<T>> levels;
+        hipblasTsqrPlan(m, n, cols, W, m, W + size_t(m) * cols, &levels);
+        hipblasTsqrFactor(handle, levels, n, cols);
+
+        // info is the index of the first zero on the diagonal of R, counted from 1, or 0
+        const hipblasTsqrLevel<T>& root = levels.back();
+        std::vector<H>             h_diag(n);
+        check(hipMemcpy2DAsync(h_diag.data(),
+                               sizeof(T),
+                               root.A,
+                               sizeof(T) * (size_t(root.lda) + 1),
+                               sizeof(T),
+                               n,
+                               hipMemcpyDeviceToHost,
+                               stream));
+        check(hipStreamSynchronize(stream));
+
+        int singular = 0;
+        for(int i = 0; i < n && !singular; i++)
+            if(h_diag[i] == H(0))
+                singular = i + 1;
+
+        // the first n rows of B are the solution of R X = Q^H B
+        if(!singular && nrhs)
+        {
+            T* X = root.A + size_t(n) * root.lda;
+
+            rocblas_pointer_mode mode;
+            rocblas_get_pointer_mode(rhandle, &mode);
+            rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+            const T         one    = T(1);
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocTrsm(rhandle,
+                                                    rocblas_side_left,
+                                                    rocblas_fill_upper,
+                                                    rocblas_operation_none,
+                                                    rocblas_diagonal_non_unit,
+                                                    n,
+                                                    nrhs,
+                                                    &one,
+                                                    root.A,
+                                                    root.lda,
+                                                    X,
+                                                    root.lda)));
+            rocblas_set_pointer_mode(rhandle, mode);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            check(hipblasCopyMatrixAsync(
+                B, ldb, X, root.lda, n, nrhs, hipMemcpyDeviceToDevice, stream));
+        }
+
+        hipblasUploadAsync(handle, state, deviceInfo, &singular, sizeof(int));
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
 // geqrf
 hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
                               const int       m,
@@ -47727,6 +50831,9 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && hipblasUseTsqr(handle, m, n))
+        return hipblasGeqrfTsqr(handle, m, n, A, lda, tau);
+
     return HIPBLAS_DEMAND_ALLOC(
         hipblasConvertStatus(rocsolver_sgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
 }
@@ -47759,6 +50866,9 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && hipblasUseTsqr(handle, m, n))
+        return hipblasGeqrfTsqr(handle, m, n, A, lda, tau);
+
     return HIPBLAS_DEMAND_ALLOC(
         hipblasConvertStatus(rocsolver_dgeqrf((rocblas_handle)handle, m, n, A, lda, tau)));
 }
@@ -47791,6 +50901,10 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && hipblasUseTsqr(handle, m, n))
+        return hipblasGeqrfTsqr(
+            handle, m, n, (rocblas_float_complex*)A, lda, (rocblas_float_complex*)tau);
+
     return HIPBLAS_DEMAND_ALLOC(
         hipblasConvertStatus(rocsolver_cgeqrf((rocblas_handle)handle,
                                               m,
@@ -47828,6 +50942,10 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && hipblasUseTsqr(handle, m, n))
+        return hipblasGeqrfTsqr(
+            handle, m, n, (rocblas_double_complex*)A, lda, (rocblas_double_complex*)tau);
+
     return HIPBLAS_DEMAND_ALLOC(
         hipblasConvertStatus(rocsolver_zgeqrf((rocblas_handle)handle,
                                               m,
@@ -47865,6 +50983,10 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && hipblasUseTsqr(handle, m, n))
+        return hipblasGeqrfTsqr(
+            handle, m, n, (rocblas_float_complex*)A, lda, (rocblas_float_complex*)tau);
+
     return HIPBLAS_DEMAND_ALLOC(
         hipblasConvertStatus(rocsolver_cgeqrf((rocblas_handle)handle,
                                               m,
@@ -47902,6 +51024,10 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && hipblasUseTsqr(handle, m, n))
+        return hipblasGeqrfTsqr(
+            handle, m, n, (rocblas_double_complex*)A, lda, (rocblas_double_complex*)tau);
+
     return HIPBLAS_DEMAND_ALLOC(
         hipblasConvertStatus(rocsolver_zgeqrf((rocblas_handle)handle,
                                               m,
@@ -48442,6 +51568,9 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && trans == HIPBLAS_OP_N && hipblasUseTsqr(handle, m, n))
+        return hipblasGelsTsqr(handle, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgels((rocblas_handle)handle,
                                                                      hipblasConvertOperation(trans),
                                                                      m,
@@ -48494,6 +51623,9 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && trans == HIPBLAS_OP_N && hipblasUseTsqr(handle, m, n))
+        return hipblasGelsTsqr(handle, m, n, nrhs, A, lda, B, ldb, deviceInfo);
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgels((rocblas_handle)handle,
                                                                      hipblasConvertOperation(trans),
                                                                      m,
@@ -48546,6 +51678,17 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && trans == HIPBLAS_OP_N && hipblasUseTsqr(handle, m, n))
+        return hipblasGelsTsqr(handle,
+                               m,
+                               n,
+                               nrhs,
+                               (rocblas_float_complex*)A,
+                               lda,
+                               (rocblas_float_complex*)B,
+                               ldb,
+                               deviceInfo);
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgels((rocblas_handle)handle,
                                                                      hipblasConvertOperation(trans),
                                                                      m,
@@ -48598,6 +51741,17 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && trans == HIPBLAS_OP_N && hipblasUseTsqr(handle, m, n))
+        return hipblasGelsTsqr(handle,
+                               m,
+                               n,
+                               nrhs,
+                               (rocblas_double_complex*)A,
+                               lda,
+                               (rocblas_double_complex*)B,
+                               ldb,
+                               deviceInfo);
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgels((rocblas_handle)handle,
                                                                      hipblasConvertOperation(trans),
                                                                      m,
@@ -48650,6 +51804,17 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && trans == HIPBLAS_OP_N && hipblasUseTsqr(handle, m, n))
+        return hipblasGelsTsqr(handle,
+                               m,
+                               n,
+                               nrhs,
+                               (rocblas_float_complex*)A,
+                               lda,
+                               (rocblas_float_complex*)B,
+                               ldb,
+                               deviceInfo);
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_cgels((rocblas_handle)handle,
                                                                      hipblasConvertOperation(trans),
                                                                      m,
@@ -48702,6 +51867,17 @@ try
     else
         *info = 0;
 
+    if(*info == 0 && trans == HIPBLAS_OP_N && hipblasUseTsqr(handle, m, n))
+        return hipblasGelsTsqr(handle,
+                               m,
+                               n,
+                               nrhs,
+                               (rocblas_double_complex*)A,
+                               lda,
+                               (rocblas_double_complex*)B,
+                               ldb,
+                               deviceInfo);
+
     return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_zgels((rocblas_handle)handle,
                                                                      hipblasConvertOperation(trans),
                                                                      m,
@@ -49428,241 +52604,4567 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
-#endif
+} // extern "C"
 
-// gemm
-hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
-                             hipblasOperation_t transa,
-                             hipblasOperation_t transb,
-                             int                m,
-                             int                n,
-                             int                k,
-                             const hipblasHalf* alpha,
-                             const hipblasHalf* A,
-                             int                lda,
-                             const hipblasHalf* B,
-                             int                ldb,
-                             const hipblasHalf* beta,
-                             hipblasHalf*       C,
-                             int                ldc)
+/*******************************************************************************
+ * orgqr and ormqr
+ *
+ * rocSOLVER has no batched orgqr and ormqr, so the batched functions apply the
+ * non-batched ones to each matrix of the batch in turn on the stream of the
+ * handle. The arrays of pointers are copied to the host first.
+ ******************************************************************************/
+namespace
+{
+    template <typename T>
+    hipblasStatus_t hipblasOrgqrStridedBatched(hipblasHandle_t handle,
+                                               int             m,
+                                               int             n,
+                                               int             k,
+                                               T*              A,
+                                               int             lda,
+                                               hipblasStride   stride_A,
+                                               T*              ipiv,
+                                               hipblasStride   stride_P,
+                                               int             batch_count)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocsolverOrgqr((rocblas_handle)handle,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           A + b * stride_A,
+                                                           lda,
+                                                           ipiv + b * stride_P)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasOrgqrBatched(hipblasHandle_t handle,
+                                        int             m,
+                                        int             n,
+                                        int             k,
+                                        T* const        A[],
+                                        int             lda,
+                                        T* const        ipiv[],
+                                        int             batch_count)
+    {
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // ipiv isn't read without reflectors
+        std::vector<T*> A_host(batch_count), ipiv_host(batch_count);
+        if(!hipblasGetPointerArray(handle, A, A_host)
+           || (k && !hipblasGetPointerArray(handle, ipiv, ipiv_host)))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocsolverOrgqr(
+                    (rocblas_handle)handle, m, n, k, A_host[b], lda, ipiv_host[b])));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasOrmqrStridedBatched(hipblasHandle_t   handle,
+                                               rocblas_side      side,
+                                               rocblas_operation trans,
+                                               int               m,
+                                               int               n,
+                                               int               k,
+                                               T*                A,
+                                               int               lda,
+                                               hipblasStride     stride_A,
+                                               T*                ipiv,
+                                               hipblasStride     stride_P,
+                                               T*                C,
+                                               int               ldc,
+                                               hipblasStride     stride_C,
+                                               int               batch_count)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocsolverOrmqr((rocblas_handle)handle,
+                                                           side,
+                                                           trans,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           A + b * stride_A,
+                                                           lda,
+                                                           ipiv + b * stride_P,
+                                                           C + b * stride_C,
+                                                           ldc)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasOrmqrBatched(hipblasHandle_t   handle,
+                                        rocblas_side      side,
+                                        rocblas_operation trans,
+                                        int               m,
+                                        int               n,
+                                        int               k,
+                                        T* const          A[],
+                                        int               lda,
+                                        T* const          ipiv[],
+                                        T* const          C[],
+                                        int               ldc,
+                                        int               batch_count)
+    {
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // A and ipiv aren't read without reflectors
+        std::vector<T*> A_host(batch_count), ipiv_host(batch_count), C_host(batch_count);
+        if(!hipblasGetPointerArray(handle, C, C_host)
+           || (k
+               && (!hipblasGetPointerArray(handle, A, A_host)
+                   || !hipblasGetPointerArray(handle, ipiv, ipiv_host))))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocsolverOrmqr((rocblas_handle)handle,
+                                                           side,
+                                                           trans,
+                                                           m,
+                                                           n,
+                                                           k,
+                                                           A_host[b],
+                                                           lda,
+                                                           ipiv_host[b],
+                                                           C_host[b],
+                                                           ldc)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
+// orgqr
+hipblasStatus_t hipblasSorgqr(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       k,
+                              float*          A,
+                              const int       lda,
+                              float*          ipiv,
+                              int*            info)
 try
 {
-    return hipblasConvertStatus(rocblas_hgemm((rocblas_handle)handle,
-                                              hipblasConvertOperation(transa),
-                                              hipblasConvertOperation(transb),
-                                              m,
-                                              n,
-                                              k,
-                                              (rocblas_half*)alpha,
-                                              (rocblas_half*)A,
-                                              lda,
-                                              (rocblas_half*)B,
-                                              ldb,
-                                              (rocblas_half*)beta,
-                                              (rocblas_half*)C,
-                                              ldc));
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sorgqr((rocblas_handle)handle, m, n, k, A, lda, ipiv)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
-                             hipblasOperation_t transa,
-                             hipblasOperation_t transb,
-                             int                m,
-                             int                n,
-                             int                k,
-                             const float*       alpha,
-                             const float*       A,
-                             int                lda,
-                             const float*       B,
-                             int                ldb,
-                             const float*       beta,
-                             float*             C,
-                             int                ldc)
+hipblasStatus_t hipblasDorgqr(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       k,
+                              double*         A,
+                              const int       lda,
+                              double*         ipiv,
+                              int*            info)
 try
 {
-    return hipblasConvertStatus(rocblas_sgemm((rocblas_handle)handle,
-                                              hipblasConvertOperation(transa),
-                                              hipblasConvertOperation(transb),
-                                              m,
-                                              n,
-                                              k,
-                                              alpha,
-                                              A,
-                                              lda,
-                                              B,
-                                              ldb,
-                                              beta,
-                                              C,
-                                              ldc));
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dorgqr((rocblas_handle)handle, m, n, k, A, lda, ipiv)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
-                             hipblasOperation_t transa,
-                             hipblasOperation_t transb,
-                             int                m,
-                             int                n,
-                             int                k,
-                             const double*      alpha,
-                             const double*      A,
-                             int                lda,
-                             const double*      B,
-                             int                ldb,
-                             const double*      beta,
-                             double*            C,
-                             int                ldc)
+hipblasStatus_t hipblasCungqr(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       k,
+                              hipblasComplex* A,
+                              const int       lda,
+                              hipblasComplex* ipiv,
+                              int*            info)
 try
 {
-    return hipblasConvertStatus(rocblas_dgemm((rocblas_handle)handle,
-                                              hipblasConvertOperation(transa),
-                                              hipblasConvertOperation(transb),
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cungqr((rocblas_handle)handle,
                                               m,
                                               n,
                                               k,
-                                              alpha,
-                                              A,
+                                              (rocblas_float_complex*)A,
                                               lda,
-                                              B,
-                                              ldb,
-                                              beta,
-                                              C,
-                                              ldc));
+                                              (rocblas_float_complex*)ipiv)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
-                             hipblasOperation_t    transa,
-                             hipblasOperation_t    transb,
-                             int                   m,
-                             int                   n,
-                             int                   k,
-                             const hipblasComplex* alpha,
-                             const hipblasComplex* A,
-                             int                   lda,
-                             const hipblasComplex* B,
-                             int                   ldb,
-                             const hipblasComplex* beta,
-                             hipblasComplex*       C,
-                             int                   ldc)
+hipblasStatus_t hipblasZungqr(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              const int             k,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* ipiv,
+                              int*                  info)
 try
 {
-    return hipblasConvertStatus(rocblas_cgemm((rocblas_handle)handle,
-                                              hipblasConvertOperation(transa),
-                                              hipblasConvertOperation(transb),
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zungqr((rocblas_handle)handle,
                                               m,
                                               n,
                                               k,
-                                              (rocblas_float_complex*)alpha,
-                                              (rocblas_float_complex*)A,
+                                              (rocblas_double_complex*)A,
                                               lda,
-                                              (rocblas_float_complex*)B,
-                                              ldb,
-                                              (rocblas_float_complex*)beta,
-                                              (rocblas_float_complex*)C,
-                                              ldc));
+                                              (rocblas_double_complex*)ipiv)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
-                             hipblasOperation_t          transa,
-                             hipblasOperation_t          transb,
-                             int                         m,
-                             int                         n,
-                             int                         k,
-                             const hipblasDoubleComplex* alpha,
-                             const hipblasDoubleComplex* A,
-                             int                         lda,
-                             const hipblasDoubleComplex* B,
-                             int                         ldb,
-                             const hipblasDoubleComplex* beta,
-                             hipblasDoubleComplex*       C,
-                             int                         ldc)
+hipblasStatus_t hipblasCungqr_v2(hipblasHandle_t handle,
+                                 const int       m,
+                                 const int       n,
+                                 const int       k,
+                                 hipComplex*     A,
+                                 const int       lda,
+                                 hipComplex*     ipiv,
+                                 int*            info)
 try
 {
-    return hipblasConvertStatus(rocblas_zgemm((rocblas_handle)handle,
-                                              hipblasConvertOperation(transa),
-                                              hipblasConvertOperation(transb),
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cungqr((rocblas_handle)handle,
                                               m,
                                               n,
                                               k,
-                                              (rocblas_double_complex*)alpha,
-                                              (rocblas_double_complex*)A,
+                                              (rocblas_float_complex*)A,
                                               lda,
-                                              (rocblas_double_complex*)B,
-                                              ldb,
-                                              (rocblas_double_complex*)beta,
-                                              (rocblas_double_complex*)C,
-                                              ldc));
+                                              (rocblas_float_complex*)ipiv)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasCgemm_v2(hipblasHandle_t    handle,
-                                hipblasOperation_t transa,
-                                hipblasOperation_t transb,
-                                int                m,
-                                int                n,
-                                int                k,
-                                const hipComplex*  alpha,
-                                const hipComplex*  A,
-                                int                lda,
-                                const hipComplex*  B,
-                                int                ldb,
-                                const hipComplex*  beta,
-                                hipComplex*        C,
-                                int                ldc)
+hipblasStatus_t hipblasZungqr_v2(hipblasHandle_t   handle,
+                                 const int         m,
+                                 const int         n,
+                                 const int         k,
+                                 hipDoubleComplex* A,
+                                 const int         lda,
+                                 hipDoubleComplex* ipiv,
+                                 int*              info)
 try
 {
-    return hipblasConvertStatus(rocblas_cgemm((rocblas_handle)handle,
-                                              hipblasConvertOperation(transa),
-                                              hipblasConvertOperation(transb),
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zungqr((rocblas_handle)handle,
                                               m,
                                               n,
                                               k,
-                                              (rocblas_float_complex*)alpha,
-                                              (rocblas_float_complex*)A,
+                                              (rocblas_double_complex*)A,
                                               lda,
-                                              (rocblas_float_complex*)B,
-                                              ldb,
-                                              (rocblas_float_complex*)beta,
-                                              (rocblas_float_complex*)C,
-                                              ldc));
+                                              (rocblas_double_complex*)ipiv)));
 }
 catch(...)
 {
     return hipblas_exception_to_status();
 }
 
-hipblasStatus_t hipblasZgemm_v2(hipblasHandle_t         handle,
-                                hipblasOperation_t      transa,
-                                hipblasOperation_t      transb,
-                                int                     m,
-                                int                     n,
-                                int                     k,
-                                const hipDoubleComplex* alpha,
-                                const hipDoubleComplex* A,
-                                int                     lda,
-                                const hipDoubleComplex* B,
-                                int                     ldb,
-                                const hipDoubleComplex* beta,
-                                hipDoubleComplex*       C,
-                                int                     ldc)
+// orgqr_batched
+hipblasStatus_t hipblasSorgqrBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const int       k,
+                                     float* const    A[],
+                                     const int       lda,
+                                     float* const    ipiv[],
+                                     int*            info,
+                                     const int       batchCount)
 try
 {
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else if(batchCount < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrBatched(handle, m, n, k, A, lda, ipiv, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDorgqrBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const int       k,
+                                     double* const   A[],
+                                     const int       lda,
+                                     double* const   ipiv[],
+                                     int*            info,
+                                     const int       batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else if(batchCount < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrBatched(handle, m, n, k, A, lda, ipiv, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCungqrBatched(hipblasHandle_t       handle,
+                                     const int             m,
+                                     const int             n,
+                                     const int             k,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const ipiv[],
+                                     int*                  info,
+                                     const int             batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else if(batchCount < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrBatched(handle,
+                               m,
+                               n,
+                               k,
+                               (rocblas_float_complex* const*)A,
+                               lda,
+                               (rocblas_float_complex* const*)ipiv,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZungqrBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     const int                   k,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const ipiv[],
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else if(batchCount < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrBatched(handle,
+                               m,
+                               n,
+                               k,
+                               (rocblas_double_complex* const*)A,
+                               lda,
+                               (rocblas_double_complex* const*)ipiv,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCungqrBatched_v2(hipblasHandle_t   handle,
+                                        const int         m,
+                                        const int         n,
+                                        const int         k,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        hipComplex* const ipiv[],
+                                        int*              info,
+                                        const int         batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else if(batchCount < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrBatched(handle,
+                               m,
+                               n,
+                               k,
+                               (rocblas_float_complex* const*)A,
+                               lda,
+                               (rocblas_float_complex* const*)ipiv,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZungqrBatched_v2(hipblasHandle_t         handle,
+                                        const int               m,
+                                        const int               n,
+                                        const int               k,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const ipiv[],
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -6;
+    else if(batchCount < 0)
+        *info = -8;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrBatched(handle,
+                               m,
+                               n,
+                               k,
+                               (rocblas_double_complex* const*)A,
+                               lda,
+                               (rocblas_double_complex* const*)ipiv,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// orgqr_strided_batched
+hipblasStatus_t hipblasSorgqrStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrStridedBatched(handle, m, n, k, A, lda, strideA, ipiv, strideP, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDorgqrStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrStridedBatched(handle, m, n, k, A, lda, strideA, ipiv, strideP, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCungqrStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrStridedBatched(handle,
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_float_complex*)ipiv,
+                                      strideP,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZungqrStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            const int             k,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* ipiv,
+                                            const hipblasStride   strideP,
+                                            int*                  info,
+                                            const int             batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrStridedBatched(handle,
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_double_complex*)ipiv,
+                                      strideP,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCungqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipComplex*         ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrStridedBatched(handle,
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_float_complex*)ipiv,
+                                      strideP,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZungqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipDoubleComplex*   ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m < 0)
+        *info = -1;
+    else if(n < 0 || n > m)
+        *info = -2;
+    else if(k < 0 || k > n)
+        *info = -3;
+    else if(A == NULL && m * n)
+        *info = -4;
+    else if(lda < std::max(1, m))
+        *info = -5;
+    else if(ipiv == NULL && k)
+        *info = -7;
+    else if(batchCount < 0)
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrgqrStridedBatched(handle,
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_double_complex*)ipiv,
+                                      strideP,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// ormqr
+hipblasStatus_t hipblasSormqr(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasOperation_t trans,
+                              const int          m,
+                              const int          n,
+                              const int          k,
+                              float*             A,
+                              const int          lda,
+                              float*             ipiv,
+                              float*             C,
+                              const int          ldc,
+                              int*               info)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_sormqr((rocblas_handle)handle,
+                                              hipblasConvertSide(side),
+                                              hipblasConvertOperation(trans),
+                                              m,
+                                              n,
+                                              k,
+                                              A,
+                                              lda,
+                                              ipiv,
+                                              C,
+                                              ldc)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDormqr(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasOperation_t trans,
+                              const int          m,
+                              const int          n,
+                              const int          k,
+                              double*            A,
+                              const int          lda,
+                              double*            ipiv,
+                              double*            C,
+                              const int          ldc,
+                              int*               info)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_dormqr((rocblas_handle)handle,
+                                              hipblasConvertSide(side),
+                                              hipblasConvertOperation(trans),
+                                              m,
+                                              n,
+                                              k,
+                                              A,
+                                              lda,
+                                              ipiv,
+                                              C,
+                                              ldc)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunmqr(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasOperation_t trans,
+                              const int          m,
+                              const int          n,
+                              const int          k,
+                              hipblasComplex*    A,
+                              const int          lda,
+                              hipblasComplex*    ipiv,
+                              hipblasComplex*    C,
+                              const int          ldc,
+                              int*               info)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cunmqr((rocblas_handle)handle,
+                                              hipblasConvertSide(side),
+                                              hipblasConvertOperation(trans),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)ipiv,
+                                              (rocblas_float_complex*)C,
+                                              ldc)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunmqr(hipblasHandle_t       handle,
+                              hipblasSideMode_t     side,
+                              hipblasOperation_t    trans,
+                              const int             m,
+                              const int             n,
+                              const int             k,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* ipiv,
+                              hipblasDoubleComplex* C,
+                              const int             ldc,
+                              int*                  info)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zunmqr((rocblas_handle)handle,
+                                              hipblasConvertSide(side),
+                                              hipblasConvertOperation(trans),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)ipiv,
+                                              (rocblas_double_complex*)C,
+                                              ldc)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunmqr_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasOperation_t trans,
+                                 const int          m,
+                                 const int          n,
+                                 const int          k,
+                                 hipComplex*        A,
+                                 const int          lda,
+                                 hipComplex*        ipiv,
+                                 hipComplex*        C,
+                                 const int          ldc,
+                                 int*               info)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_cunmqr((rocblas_handle)handle,
+                                              hipblasConvertSide(side),
+                                              hipblasConvertOperation(trans),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)ipiv,
+                                              (rocblas_float_complex*)C,
+                                              ldc)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunmqr_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasOperation_t trans,
+                                 const int          m,
+                                 const int          n,
+                                 const int          k,
+                                 hipDoubleComplex*  A,
+                                 const int          lda,
+                                 hipDoubleComplex*  ipiv,
+                                 hipDoubleComplex*  C,
+                                 const int          ldc,
+                                 int*               info)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_DEMAND_ALLOC(
+        hipblasConvertStatus(rocsolver_zunmqr((rocblas_handle)handle,
+                                              hipblasConvertSide(side),
+                                              hipblasConvertOperation(trans),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)ipiv,
+                                              (rocblas_double_complex*)C,
+                                              ldc)));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// ormqr_batched
+hipblasStatus_t hipblasSormqrBatched(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     float* const       A[],
+                                     const int          lda,
+                                     float* const       ipiv[],
+                                     float* const       C[],
+                                     const int          ldc,
+                                     int*               info,
+                                     const int          batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrBatched(handle,
+                               hipblasConvertSide(side),
+                               hipblasConvertOperation(trans),
+                               m,
+                               n,
+                               k,
+                               A,
+                               lda,
+                               ipiv,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDormqrBatched(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     double* const      A[],
+                                     const int          lda,
+                                     double* const      ipiv[],
+                                     double* const      C[],
+                                     const int          ldc,
+                                     int*               info,
+                                     const int          batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrBatched(handle,
+                               hipblasConvertSide(side),
+                               hipblasConvertOperation(trans),
+                               m,
+                               n,
+                               k,
+                               A,
+                               lda,
+                               ipiv,
+                               C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunmqrBatched(hipblasHandle_t       handle,
+                                     hipblasSideMode_t     side,
+                                     hipblasOperation_t    trans,
+                                     const int             m,
+                                     const int             n,
+                                     const int             k,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const ipiv[],
+                                     hipblasComplex* const C[],
+                                     const int             ldc,
+                                     int*                  info,
+                                     const int             batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrBatched(handle,
+                               hipblasConvertSide(side),
+                               hipblasConvertOperation(trans),
+                               m,
+                               n,
+                               k,
+                               (rocblas_float_complex* const*)A,
+                               lda,
+                               (rocblas_float_complex* const*)ipiv,
+                               (rocblas_float_complex* const*)C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunmqrBatched(hipblasHandle_t             handle,
+                                     hipblasSideMode_t           side,
+                                     hipblasOperation_t          trans,
+                                     const int                   m,
+                                     const int                   n,
+                                     const int                   k,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const ipiv[],
+                                     hipblasDoubleComplex* const C[],
+                                     const int                   ldc,
+                                     int*                        info,
+                                     const int                   batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrBatched(handle,
+                               hipblasConvertSide(side),
+                               hipblasConvertOperation(trans),
+                               m,
+                               n,
+                               k,
+                               (rocblas_double_complex* const*)A,
+                               lda,
+                               (rocblas_double_complex* const*)ipiv,
+                               (rocblas_double_complex* const*)C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunmqrBatched_v2(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasOperation_t trans,
+                                        const int          m,
+                                        const int          n,
+                                        const int          k,
+                                        hipComplex* const  A[],
+                                        const int          lda,
+                                        hipComplex* const  ipiv[],
+                                        hipComplex* const  C[],
+                                        const int          ldc,
+                                        int*               info,
+                                        const int          batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrBatched(handle,
+                               hipblasConvertSide(side),
+                               hipblasConvertOperation(trans),
+                               m,
+                               n,
+                               k,
+                               (rocblas_float_complex* const*)A,
+                               lda,
+                               (rocblas_float_complex* const*)ipiv,
+                               (rocblas_float_complex* const*)C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunmqrBatched_v2(hipblasHandle_t         handle,
+                                        hipblasSideMode_t       side,
+                                        hipblasOperation_t      trans,
+                                        const int               m,
+                                        const int               n,
+                                        const int               k,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const ipiv[],
+                                        hipDoubleComplex* const C[],
+                                        const int               ldc,
+                                        int*                    info,
+                                        const int               batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -8;
+    else if(C == NULL && m * n)
+        *info = -9;
+    else if(ldc < std::max(1, m))
+        *info = -10;
+    else if(batchCount < 0)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrBatched(handle,
+                               hipblasConvertSide(side),
+                               hipblasConvertOperation(trans),
+                               m,
+                               n,
+                               k,
+                               (rocblas_double_complex* const*)A,
+                               lda,
+                               (rocblas_double_complex* const*)ipiv,
+                               (rocblas_double_complex* const*)C,
+                               ldc,
+                               batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// ormqr_strided_batched
+hipblasStatus_t hipblasSormqrStridedBatched(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasOperation_t  trans,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              ipiv,
+                                            const hipblasStride strideP,
+                                            float*              C,
+                                            const int           ldc,
+                                            const hipblasStride strideC,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -9;
+    else if(C == NULL && m * n)
+        *info = -11;
+    else if(ldc < std::max(1, m))
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -15;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrStridedBatched(handle,
+                                      hipblasConvertSide(side),
+                                      hipblasConvertOperation(trans),
+                                      m,
+                                      n,
+                                      k,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDormqrStridedBatched(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasOperation_t  trans,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             ipiv,
+                                            const hipblasStride strideP,
+                                            double*             C,
+                                            const int           ldc,
+                                            const hipblasStride strideC,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -9;
+    else if(C == NULL && m * n)
+        *info = -11;
+    else if(ldc < std::max(1, m))
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -15;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrStridedBatched(handle,
+                                      hipblasConvertSide(side),
+                                      hipblasConvertOperation(trans),
+                                      m,
+                                      n,
+                                      k,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      ipiv,
+                                      strideP,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunmqrStridedBatched(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasOperation_t  trans,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     ipiv,
+                                            const hipblasStride strideP,
+                                            hipblasComplex*     C,
+                                            const int           ldc,
+                                            const hipblasStride strideC,
+                                            int*                info,
+                                            const int           batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -9;
+    else if(C == NULL && m * n)
+        *info = -11;
+    else if(ldc < std::max(1, m))
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -15;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrStridedBatched(handle,
+                                      hipblasConvertSide(side),
+                                      hipblasConvertOperation(trans),
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_float_complex*)ipiv,
+                                      strideP,
+                                      (rocblas_float_complex*)C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunmqrStridedBatched(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasOperation_t    trans,
+                                            const int             m,
+                                            const int             n,
+                                            const int             k,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* ipiv,
+                                            const hipblasStride   strideP,
+                                            hipblasDoubleComplex* C,
+                                            const int             ldc,
+                                            const hipblasStride   strideC,
+                                            int*                  info,
+                                            const int             batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -9;
+    else if(C == NULL && m * n)
+        *info = -11;
+    else if(ldc < std::max(1, m))
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -15;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrStridedBatched(handle,
+                                      hipblasConvertSide(side),
+                                      hipblasConvertOperation(trans),
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_double_complex*)ipiv,
+                                      strideP,
+                                      (rocblas_double_complex*)C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunmqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               hipblasSideMode_t   side,
+                                               hipblasOperation_t  trans,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipComplex*         ipiv,
+                                               const hipblasStride strideP,
+                                               hipComplex*         C,
+                                               const int           ldc,
+                                               const hipblasStride strideC,
+                                               int*                info,
+                                               const int           batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -9;
+    else if(C == NULL && m * n)
+        *info = -11;
+    else if(ldc < std::max(1, m))
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -15;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrStridedBatched(handle,
+                                      hipblasConvertSide(side),
+                                      hipblasConvertOperation(trans),
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_float_complex*)ipiv,
+                                      strideP,
+                                      (rocblas_float_complex*)C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunmqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               hipblasSideMode_t   side,
+                                               hipblasOperation_t  trans,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipDoubleComplex*   ipiv,
+                                               const hipblasStride strideP,
+                                               hipDoubleComplex*   C,
+                                               const int           ldc,
+                                               const hipblasStride strideC,
+                                               int*                info,
+                                               const int           batchCount)
+try
+{
+    int nq = side == HIPBLAS_SIDE_LEFT ? m : n;
+
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+        *info = -1;
+    else if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_C)
+        *info = -2;
+    else if(m < 0)
+        *info = -3;
+    else if(n < 0)
+        *info = -4;
+    else if(k < 0 || k > nq)
+        *info = -5;
+    else if(A == NULL && nq * k)
+        *info = -6;
+    else if(lda < std::max(1, nq))
+        *info = -7;
+    else if(ipiv == NULL && k)
+        *info = -9;
+    else if(C == NULL && m * n)
+        *info = -11;
+    else if(ldc < std::max(1, m))
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -15;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasOrmqrStridedBatched(handle,
+                                      hipblasConvertSide(side),
+                                      hipblasConvertOperation(trans),
+                                      m,
+                                      n,
+                                      k,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      strideA,
+                                      (rocblas_double_complex*)ipiv,
+                                      strideP,
+                                      (rocblas_double_complex*)C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * gesvIR
+ *
+ * Mixed precision iterative refinement as in LAPACK dsgesv. The library has no
+ * device code, so the conversions between double and float are done on the
+ * host. The refinement keeps the double precision solution on the host and
+ * uploads it for each residual, which is a dgemm on the device.
+ ******************************************************************************/
+namespace
+{
+    // Refinement steps before the solve falls back to double precision, as in dsgesv
+    constexpr int c_gesv_ir_max_iter = 30;
+
+    // Converts src to float, returns false if an element overflows
+    bool hipblasDemoteToFloat(const std::vector<double>& src, std::vector<float>& dst)
+    {
+        const double max_float = std::numeric_limits<float>::max();
+        for(size_t i = 0; i < src.size(); i++)
+        {
+            if(std::abs(src[i]) > max_float)
+                return false;
+            dst[i] = float(src[i]);
+        }
+        return true;
+    }
+
+    // Solves a single system
+    hipblasStatus_t hipblasGesvIR(hipblasHandle_t handle,
+                                  int             n,
+                                  int             nrhs,
+                                  double*         A,
+                                  int             lda,
+                                  int*            ipiv,
+                                  double*         B,
+                                  int             ldb,
+                                  double*         X,
+                                  int             ldx,
+                                  int*            iter,
+                                  int*            deviceInfo)
+    {
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        hipStream_t    stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        if(!n || !nrhs)
+        {
+            *iter = 0;
+            return hipMemsetAsync(deviceInfo, 0, sizeof(int), stream) == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        hipblasStatus_t status;
+        int             h_info;
+        auto            check = [](hipError_t err) {
+            if(err != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+
+        // Solves in double precision, overwriting A with its factors
+        auto fallback = [&](int reason) -> hipblasStatus_t {
+            *iter = reason;
+            check(hipblasCopyMatrixAsync(X, ldx, B, ldb, n, nrhs, hipMemcpyDeviceToDevice, stream));
+            status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocsolver_dgetrf(rhandle, n, n, A, lda, ipiv, deviceInfo)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            check(hipMemcpyAsync(&h_info, deviceInfo, sizeof(int), hipMemcpyDeviceToHost, stream));
+            check(hipStreamSynchronize(stream));
+            if(h_info > 0)
+                return HIPBLAS_STATUS_SUCCESS;
+            return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_dgetrs(
+                rhandle, rocblas_operation_none, n, nrhs, A, lda, ipiv, X, ldx)));
+        };
+
+        size_t              a_size = size_t(n) * n;
+        size_t              b_size = size_t(n) * nrhs;
+        std::vector<double> h_A(a_size), h_B(b_size), h_X(b_size), h_R(b_size);
+        std::vector<float>  h_As(a_size), h_S(b_size);
+
+        check(hipblasCopyMatrixAsync(h_A.data(), n, A, lda, n, n, hipMemcpyDeviceToHost, stream));
+        check(hipblasCopyMatrixAsync(
+            h_B.data(), n, B, ldb, n, nrhs, hipMemcpyDeviceToHost, stream));
+        check(hipStreamSynchronize(stream));
+
+        if(!hipblasDemoteToFloat(h_A, h_As) || !hipblasDemoteToFloat(h_B, h_S))
+            return fallback(-2);
+
+        // infinity norm of A for the stopping criterion
+        double anorm = 0;
+        for(int i = 0; i < n; i++)
+        {
+            double row = 0;
+            for(int j = 0; j < n; j++)
+                row += std::abs(h_A[i + size_t(j) * n]);
+            anorm = std::max(anorm, row);
+        }
+        double cte = anorm * std::numeric_limits<double>::epsilon() * std::sqrt(double(n));
+
+        // workspace holds the double residual, then the float A and right-hand sides
+        hipblasHandleState* state     = hipblasGetHandleState(handle, true);
+        char*               workspace = (char*)hipblasGetHandleWorkspace(
+            handle, state, sizeof(double) * b_size + sizeof(float) * (a_size + b_size));
+        double* d_R  = (double*)workspace;
+        float*  d_As = (float*)(d_R + b_size);
+        float*  d_S  = d_As + a_size;
+
+        check(hipMemcpyAsync(
+            d_As, h_As.data(), sizeof(float) * a_size, hipMemcpyHostToDevice, stream));
+        status = HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocsolver_sgetrf(rhandle, n, n, d_As, n, ipiv, deviceInfo)));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        check(hipMemcpyAsync(&h_info, deviceInfo, sizeof(int), hipMemcpyDeviceToHost, stream));
+        check(hipStreamSynchronize(stream));
+        if(h_info > 0)
+            return fallback(-3);
+
+        // solves with the float factors in place of h_S
+        auto solve_float = [&]() -> hipblasStatus_t {
+            check(hipMemcpyAsync(
+                d_S, h_S.data(), sizeof(float) * b_size, hipMemcpyHostToDevice, stream));
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocsolver_sgetrs(
+                rhandle, rocblas_operation_none, n, nrhs, d_As, n, ipiv, d_S, n)));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            check(hipMemcpyAsync(
+                h_S.data(), d_S, sizeof(float) * b_size, hipMemcpyDeviceToHost, stream));
+            check(hipStreamSynchronize(stream));
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        status = solve_float();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        for(size_t i = 0; i < b_size; i++)
+            h_X[i] = h_S[i];
+
+        const double one = 1, minus_one = -1;
+        for(int it = 0;; it++)
+        {
+            // R = B - A X
+            check(hipblasCopyMatrixAsync(
+                X, ldx, h_X.data(), n, n, nrhs, hipMemcpyHostToDevice, stream));
+            check(hipblasCopyMatrixAsync(d_R, n, B, ldb, n, nrhs, hipMemcpyDeviceToDevice, stream));
+
+            rocblas_pointer_mode mode;
+            rocblas_get_pointer_mode(rhandle, &mode);
+            rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+            rocblas_status rstatus = rocblas_dgemm(rhandle,
+                                                   rocblas_operation_none,
+                                                   rocblas_operation_none,
+                                                   n,
+                                                   nrhs,
+                                                   n,
+                                                   &minus_one,
+                                                   A,
+                                                   lda,
+                                                   X,
+                                                   ldx,
+                                                   &one,
+                                                   d_R,
+                                                   n);
+            rocblas_set_pointer_mode(rhandle, mode);
+            status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rstatus));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            check(hipMemcpyAsync(
+                h_R.data(), d_R, sizeof(double) * b_size, hipMemcpyDeviceToHost, stream));
+            check(hipStreamSynchronize(stream));
+
+            bool converged = true;
+            for(int j = 0; j < nrhs && converged; j++)
+            {
+                double xnorm = 0, rnorm = 0;
+                for(int i = 0; i < n; i++)
+                {
+                    xnorm = std::max(xnorm, std::abs(h_X[i + size_t(j) * n]));
+                    rnorm = std::max(rnorm, std::abs(h_R[i + size_t(j) * n]));
+                }
+                converged = rnorm <= xnorm * cte;
+            }
+            if(converged)
+            {
+                *iter = it;
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+
+            if(it == c_gesv_ir_max_iter)
+                return fallback(-c_gesv_ir_max_iter - 1);
+            if(!hipblasDemoteToFloat(h_R, h_S))
+                return fallback(-2);
+
+            // X += A^-1 R with the float factors
+            status = solve_float();
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            for(size_t i = 0; i < b_size; i++)
+                h_X[i] += h_S[i];
+        }
+    }
+
+    hipblasStatus_t hipblasGesvIRStridedBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                int             nrhs,
+                                                double*         A,
+                                                int             lda,
+                                                hipblasStride   stride_A,
+                                                int*            ipiv,
+                                                hipblasStride   stride_P,
+                                                double*         B,
+                                                int             ldb,
+                                                hipblasStride   stride_B,
+                                                double*         X,
+                                                int             ldx,
+                                                hipblasStride   stride_X,
+                                                int*            iter,
+                                                int*            deviceInfo,
+                                                int             batch_count)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = hipblasGesvIR(handle,
+                                                   n,
+                                                   nrhs,
+                                                   A + b * stride_A,
+                                                   lda,
+                                                   ipiv + b * stride_P,
+                                                   B + b * stride_B,
+                                                   ldb,
+                                                   X + b * stride_X,
+                                                   ldx,
+                                                   iter + b,
+                                                   deviceInfo + b);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t hipblasGesvIRBatched(hipblasHandle_t handle,
+                                         int             n,
+                                         int             nrhs,
+                                         double* const   A[],
+                                         int             lda,
+                                         int*            ipiv,
+                                         double* const   B[],
+                                         int             ldb,
+                                         double* const   X[],
+                                         int             ldx,
+                                         int*            iter,
+                                         int*            deviceInfo,
+                                         int             batch_count)
+    {
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        std::vector<double*> A_host(batch_count), B_host(batch_count), X_host(batch_count);
+        if(n && nrhs
+           && (!hipblasGetPointerArray(handle, A, A_host)
+               || !hipblasGetPointerArray(handle, B, B_host)
+               || !hipblasGetPointerArray(handle, X, X_host)))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            hipblasStatus_t status = hipblasGesvIR(handle,
+                                                   n,
+                                                   nrhs,
+                                                   A_host[b],
+                                                   lda,
+                                                   ipiv + size_t(b) * n,
+                                                   B_host[b],
+                                                   ldb,
+                                                   X_host[b],
+                                                   ldx,
+                                                   iter + b,
+                                                   deviceInfo + b);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasDgesvIR(hipblasHandle_t handle,
+                               const int       n,
+                               const int       nrhs,
+                               double*         A,
+                               const int       lda,
+                               int*            ipiv,
+                               double*         B,
+                               const int       ldb,
+                               double*         X,
+                               const int       ldx,
+                               int*            iter,
+                               int*            info,
+                               int*            deviceInfo)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n)
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(X == NULL && n * nrhs)
+        *info = -8;
+    else if(ldx < std::max(1, n))
+        *info = -9;
+    else if(iter == NULL)
+        *info = -10;
+    else if(deviceInfo == NULL)
+        *info = -12;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvIR(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, deviceInfo);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvIRBatched(hipblasHandle_t handle,
+                                      const int       n,
+                                      const int       nrhs,
+                                      double* const   A[],
+                                      const int       lda,
+                                      int*            ipiv,
+                                      double* const   B[],
+                                      const int       ldb,
+                                      double* const   X[],
+                                      const int       ldx,
+                                      int*            iter,
+                                      int*            info,
+                                      int*            deviceInfo,
+                                      const int       batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n)
+        *info = -5;
+    else if(B == NULL && n * nrhs)
+        *info = -6;
+    else if(ldb < std::max(1, n))
+        *info = -7;
+    else if(X == NULL && n * nrhs)
+        *info = -8;
+    else if(ldx < std::max(1, n))
+        *info = -9;
+    else if(iter == NULL && batchCount)
+        *info = -10;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -12;
+    else if(batchCount < 0)
+        *info = -13;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvIRBatched(
+        handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, deviceInfo, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgesvIRStridedBatched(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const int           nrhs,
+                                             double*             A,
+                                             const int           lda,
+                                             const hipblasStride strideA,
+                                             int*                ipiv,
+                                             const hipblasStride strideP,
+                                             double*             B,
+                                             const int           ldb,
+                                             const hipblasStride strideB,
+                                             double*             X,
+                                             const int           ldx,
+                                             const hipblasStride strideX,
+                                             int*                iter,
+                                             int*                info,
+                                             int*                deviceInfo,
+                                             const int           batchCount)
+try
+{
+    if(info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    else if(n < 0)
+        *info = -1;
+    else if(nrhs < 0)
+        *info = -2;
+    else if(A == NULL && n)
+        *info = -3;
+    else if(lda < std::max(1, n))
+        *info = -4;
+    else if(ipiv == NULL && n)
+        *info = -6;
+    else if(B == NULL && n * nrhs)
+        *info = -8;
+    else if(ldb < std::max(1, n))
+        *info = -9;
+    else if(X == NULL && n * nrhs)
+        *info = -11;
+    else if(ldx < std::max(1, n))
+        *info = -12;
+    else if(iter == NULL && batchCount)
+        *info = -14;
+    else if(deviceInfo == NULL && batchCount)
+        *info = -16;
+    else if(batchCount < 0)
+        *info = -17;
+    else
+        *info = 0;
+
+    if(*info != 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGesvIRStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       deviceInfo,
+                                       batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * getrfRefactor
+ *
+ * The stored row interchanges are applied with laswp, which rocSOLVER only has
+ * for single matrices, and the permuted matrices are factorized with
+ * getrf_npvt. The pivot growth is estimated from the norms of U X and L U X for
+ * a fixed probe matrix X, computed on the device for all the matrices together
+ * with batched trmm and nrm2 calls, and is checked on the host.
+ ******************************************************************************/
+namespace
+{
+    // Columns of the probe matrix of the pivot growth estimate
+    constexpr int c_refactor_probes = 8;
+    // Bytes of the products of the probe matrix computed by each call of the estimate
+    constexpr size_t c_refactor_chunk_bytes = size_t(1) << 26;
+
+    rocblas_status hipblasRocsolverLaswp(rocblas_handle handle,
+                                         int            n,
+                                         float*         A,
+                                         int            lda,
+                                         int            k1,
+                                         int            k2,
+                                         const int*     ipiv,
+                                         int            incx)
+    {
+        return rocsolver_slaswp(handle, n, A, lda, k1, k2, ipiv, incx);
+    }
+
+    rocblas_status hipblasRocsolverLaswp(rocblas_handle handle,
+                                         int            n,
+                                         double*        A,
+                                         int            lda,
+                                         int            k1,
+                                         int            k2,
+                                         const int*     ipiv,
+                                         int            incx)
+    {
+        return rocsolver_dlaswp(handle, n, A, lda, k1, k2, ipiv, incx);
+    }
+
+    rocblas_status hipblasRocsolverLaswp(rocblas_handle         handle,
+                                         int                    n,
+                                         rocblas_float_complex* A,
+                                         int                    lda,
+                                         int                    k1,
+                                         int                    k2,
+                                         const int*             ipiv,
+                                         int                    incx)
+    {
+        return rocsolver_claswp(handle, n, A, lda, k1, k2, ipiv, incx);
+    }
+
+    rocblas_status hipblasRocsolverLaswp(rocblas_handle          handle,
+                                         int                     n,
+                                         rocblas_double_complex* A,
+                                         int                     lda,
+                                         int                     k1,
+                                         int                     k2,
+                                         const int*              ipiv,
+                                         int                     incx)
+    {
+        return rocsolver_zlaswp(handle, n, A, lda, k1, k2, ipiv, incx);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvt(rocblas_handle handle,
+                                             int            n,
+                                             float*         A,
+                                             int            lda,
+                                             int*           info)
+    {
+        return rocsolver_sgetrf_npvt(handle, n, n, A, lda, info);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvt(rocblas_handle handle,
+                                             int            n,
+                                             double*        A,
+                                             int            lda,
+                                             int*           info)
+    {
+        return rocsolver_dgetrf_npvt(handle, n, n, A, lda, info);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvt(rocblas_handle         handle,
+                                             int                    n,
+                                             rocblas_float_complex* A,
+                                             int                    lda,
+                                             int*                   info)
+    {
+        return rocsolver_cgetrf_npvt(handle, n, n, A, lda, info);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvt(rocblas_handle          handle,
+                                             int                     n,
+                                             rocblas_double_complex* A,
+                                             int                     lda,
+                                             int*                    info)
+    {
+        return rocsolver_zgetrf_npvt(handle, n, n, A, lda, info);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtBatched(rocblas_handle handle,
+                                                    int            n,
+                                                    float* const   A[],
+                                                    int            lda,
+                                                    int*           info,
+                                                    int            batch_count)
+    {
+        return rocsolver_sgetrf_npvt_batched(handle, n, n, A, lda, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtBatched(rocblas_handle handle,
+                                                    int            n,
+                                                    double* const  A[],
+                                                    int            lda,
+                                                    int*           info,
+                                                    int            batch_count)
+    {
+        return rocsolver_dgetrf_npvt_batched(handle, n, n, A, lda, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtBatched(rocblas_handle               handle,
+                                                    int                          n,
+                                                    rocblas_float_complex* const A[],
+                                                    int                          lda,
+                                                    int*                         info,
+                                                    int                          batch_count)
+    {
+        return rocsolver_cgetrf_npvt_batched(handle, n, n, A, lda, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtBatched(rocblas_handle                handle,
+                                                    int                           n,
+                                                    rocblas_double_complex* const A[],
+                                                    int                           lda,
+                                                    int*                          info,
+                                                    int                           batch_count)
+    {
+        return rocsolver_zgetrf_npvt_batched(handle, n, n, A, lda, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtStridedBatched(rocblas_handle handle,
+                                                           int            n,
+                                                           float*         A,
+                                                           int            lda,
+                                                           hipblasStride  strideA,
+                                                           int*           info,
+                                                           int            batch_count)
+    {
+        return rocsolver_sgetrf_npvt_strided_batched(
+            handle, n, n, A, lda, strideA, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtStridedBatched(rocblas_handle handle,
+                                                           int            n,
+                                                           double*        A,
+                                                           int            lda,
+                                                           hipblasStride  strideA,
+                                                           int*           info,
+                                                           int            batch_count)
+    {
+        return rocsolver_dgetrf_npvt_strided_batched(
+            handle, n, n, A, lda, strideA, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtStridedBatched(rocblas_handle         handle,
+                                                           int                    n,
+                                                           rocblas_float_complex* A,
+                                                           int                    lda,
+                                                           hipblasStride          strideA,
+                                                           int*                   info,
+                                                           int                    batch_count)
+    {
+        return rocsolver_cgetrf_npvt_strided_batched(
+            handle, n, n, A, lda, strideA, info, batch_count);
+    }
+
+    rocblas_status hipblasRocsolverGetrfNpvtStridedBatched(rocblas_handle          handle,
+                                                           int                     n,
+                                                           rocblas_double_complex* A,
+                                                           int                     lda,
+                                                           hipblasStride           strideA,
+                                                           int*                    info,
+                                                           int                     batch_count)
+    {
+        return rocsolver_zgetrf_npvt_strided_batched(
+            handle, n, n, A, lda, strideA, info, batch_count);
+    }
+
+    // Applies the row interchanges in ipiv to the matrices A[b] and factorizes them with factor,
+    // which calls getrf_npvt. A_array is the device array of the pointers in A for the batched
+    // functions, and nullptr when A[b] = A[0] + b * stride_A. If max_growth isn't 0, info[b] is
+    // set to n + 1 when the pivot growth of A[b], estimated as ||U X|| / ||L U X|| for the probe
+    // matrix X, exceeds it.
+    template <typename T>
+    hipblasStatus_t hipblasGetrfRefactor(hipblasHandle_t                        handle,
+                                         int                                    n,
+                                         const std::vector<T*>&                 A,
+                                         T* const                               A_array[],
+                                         hipblasStride                          stride_A,
+                                         int                                    lda,
+                                         const int*                             ipiv,
+                                         hipblasStride                          stride_P,
+                                         double                                 max_growth,
+                                         int*                                   info,
+                                         const std::function<rocblas_status()>& factor)
+    {
+        using H = typename hipblasHostType<T>::type;
+        using R = decltype(std::abs(H()));
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        hipStream_t    stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        int batch_count = int(A.size());
+        if(!n)
+            return hipMemsetAsync(info, 0, sizeof(int) * batch_count, stream) == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        auto check = [](hipError_t err) {
+            if(err != hipSuccess)
+                throw HIPBLAS_STATUS_INTERNAL_ERROR;
+        };
+        auto roc = [&](const std::function<rocblas_status()>& call) {
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(call()));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                throw status;
+        };
+
+        for(int b = 0; b < batch_count; b++)
+            roc([&] {
+                return hipblasRocsolverLaswp(rhandle, n, A[b], lda, 1, n, ipiv + b * stride_P, 1);
+            });
+        roc(factor);
+        if(max_growth == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // the products of chunk matrices are computed by each call
+        int           k      = std::min(n, c_refactor_probes);
+        hipblasStride x_size = hipblasStride(n) * k;
+        int           chunk  = int(std::min<size_t>(
+            batch_count, std::max<size_t>(1, c_refactor_chunk_bytes / (sizeof(T) * x_size))));
+
+        // workspace holds the arrays of the pointers to X and to the products Y of a chunk for
+        // the batched functions, the scalar one, the probe matrix X, Y and the norms of U X and
+        // L U X of each matrix
+        size_t ptr_bytes = A_array ? (sizeof(void*) * 2 * chunk + 255) / 256 * 256 : 0;
+        size_t up_bytes  = ptr_bytes + sizeof(T) * (1 + x_size);
+        hipblasHandleState* state = hipblasGetHandleState(handle, true);
+        char*               ws    = (char*)hipblasGetHandleWorkspace(
+            handle, state, up_bytes + sizeof(T) * x_size * chunk + sizeof(R) * 2 * batch_count);
+        T** X_array = (T**)ws;
+        T** Y_array = X_array + chunk;
+        T*  one     = (T*)(ws + ptr_bytes);
+        T*  X       = one + 1;
+        T*  Y       = X + x_size;
+        R*  norms   = (R*)(Y + x_size * chunk);
+
+        // the entries of X are 1 or -1 from a fixed linear congruential sequence
+        std::vector<H> h_X(1 + x_size);
+        uint32_t       seed = 1;
+        h_X[0]              = H(1);
+        for(hipblasStride i = 1; i <= x_size; i++)
+        {
+            seed   = seed * 1664525u + 1013904223u;
+            h_X[i] = H(seed >> 31 ? 1 : -1);
+        }
+        std::vector<T*>   h_ptrs(2 * chunk);
+        std::vector<char> h_up(up_bytes);
+        for(int c = 0; c < chunk; c++)
+        {
+            h_ptrs[c]         = X;
+            h_ptrs[chunk + c] = Y + c * x_size;
+        }
+        if(A_array)
+            memcpy(h_up.data(), h_ptrs.data(), sizeof(T*) * 2 * chunk);
+        memcpy(h_up.data() + ptr_bytes, h_X.data(), sizeof(T) * (1 + x_size));
+        hipblasUploadAsync(handle, state, ws, h_up.data(), up_bytes);
+
+        // the norms stay on the device until all the matrices are done
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        auto roc_device = [&](const std::function<rocblas_status()>& call) {
+            roc([&] {
+                rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_device);
+                rocblas_status status = call();
+                rocblas_set_pointer_mode(rhandle, mode);
+                return status;
+            });
+        };
+
+        for(int c0 = 0; c0 < batch_count; c0 += chunk)
+        {
+            int nb = std::min(chunk, batch_count - c0);
+
+            // Y = tri(A) B, with B = X shared by the matrices or B = Y in place
+            auto trmm = [&](rocblas_fill uplo, rocblas_diagonal diag, bool probe) {
+                roc_device([&] {
+                    if(A_array)
+                        return hipblasRocTrmmBatched(rhandle,
+                                                     rocblas_side_left,
+                                                     uplo,
+                                                     rocblas_operation_none,
+                                                     diag,
+                                                     n,
+                                                     k,
+                                                     one,
+                                                     A_array + c0,
+                                                     lda,
+                                                     probe ? X_array : Y_array,
+                                                     n,
+                                                     Y_array,
+                                                     n,
+                                                     nb);
+                    return hipblasRocTrmmStridedBatched(rhandle,
+                                                        rocblas_side_left,
+                                                        uplo,
+                                                        rocblas_operation_none,
+                                                        diag,
+                                                        n,
+                                                        k,
+                                                        one,
+                                                        A[c0],
+                                                        lda,
+                                                        stride_A,
+                                                        probe ? X : Y,
+                                                        n,
+                                                        probe ? 0 : x_size,
+                                                        Y,
+                                                        n,
+                                                        x_size,
+                                                        nb);
+                });
+            };
+            auto nrm2 = [&](R* results) {
+                roc_device([&] {
+                    return hipblasRocNrm2StridedBatched(
+                        rhandle, int(x_size), Y, 1, x_size, nb, results);
+                });
+            };
+
+            // Y = U X, then Y = L Y = P A X in place
+            trmm(rocblas_fill_upper, rocblas_diagonal_non_unit, true);
+            nrm2(norms + c0);
+            trmm(rocblas_fill_lower, rocblas_diagonal_unit, false);
+            nrm2(norms + batch_count + c0);
+        }
+
+        std::vector<R>   h_norms(2 * batch_count);
+        std::vector<int> h_info(batch_count);
+        check(hipMemcpyAsync(
+            h_norms.data(), norms, sizeof(R) * 2 * batch_count, hipMemcpyDeviceToHost, stream));
+        check(hipMemcpyAsync(
+            h_info.data(), info, sizeof(int) * batch_count, hipMemcpyDeviceToHost, stream));
+        check(hipStreamSynchronize(stream));
+
+        // a NaN growth exceeds max_growth as well
+        bool exceeded = false;
+        for(int b = 0; b < batch_count; b++)
+        {
+            if(h_info[b] == 0 && !(h_norms[b] <= max_growth * h_norms[batch_count + b]))
+            {
+                h_info[b] = n + 1;
+                exceeded  = true;
+            }
+        }
+        if(exceeded)
+            hipblasUploadAsync(handle, state, info, h_info.data(), sizeof(int) * batch_count);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrfRefactor(hipblasHandle_t handle,
+                                         int             n,
+                                         T*              A,
+                                         int             lda,
+                                         const int*      ipiv,
+                                         double          max_growth,
+                                         int*            info)
+    {
+        return hipblasGetrfRefactor<T>(
+            handle, n, std::vector<T*>{A}, nullptr, 0, lda, ipiv, 0, max_growth, info, [&] {
+                return hipblasRocsolverGetrfNpvt((rocblas_handle)handle, n, A, lda, info);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrfRefactorStridedBatched(hipblasHandle_t handle,
+                                                       int             n,
+                                                       T*              A,
+                                                       int             lda,
+                                                       hipblasStride   stride_A,
+                                                       const int*      ipiv,
+                                                       hipblasStride   stride_P,
+                                                       double          max_growth,
+                                                       int*            info,
+                                                       int             batch_count)
+    {
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        std::vector<T*> A_host(batch_count);
+        for(int b = 0; b < batch_count; b++)
+            A_host[b] = A + b * stride_A;
+
+        return hipblasGetrfRefactor<T>(
+            handle, n, A_host, nullptr, stride_A, lda, ipiv, stride_P, max_growth, info, [&] {
+                return hipblasRocsolverGetrfNpvtStridedBatched(
+                    (rocblas_handle)handle, n, A, lda, stride_A, info, batch_count);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t hipblasGetrfRefactorBatched(hipblasHandle_t handle,
+                                                int             n,
+                                                T* const        A[],
+                                                int             lda,
+                                                const int*      ipiv,
+                                                double          max_growth,
+                                                int*            info,
+                                                int             batch_count)
+    {
+        if(!batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // laswp takes single matrices, so the pointers are read for the row interchanges only
+        std::vector<T*> A_host(batch_count);
+        if(n && !hipblasGetPointerArray(handle, A, A_host))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // the pivot vectors follow each other as in getrfBatched
+        return hipblasGetrfRefactor(handle, n, A_host, A, 0, lda, ipiv, n, max_growth, info, [&] {
+            return hipblasRocsolverGetrfNpvtBatched(
+                (rocblas_handle)handle, n, A, lda, info, batch_count);
+        });
+    }
+} // namespace
+
+extern "C" {
+
+// getrf_refactor
+hipblasStatus_t hipblasSgetrfRefactor(hipblasHandle_t handle,
+                                      const int       n,
+                                      float*          A,
+                                      const int       lda,
+                                      const int*      ipiv,
+                                      const float     maxGrowth,
+                                      int*            info)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactor(handle, n, A, lda, ipiv, maxGrowth, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfRefactor(hipblasHandle_t handle,
+                                      const int       n,
+                                      double*         A,
+                                      const int       lda,
+                                      const int*      ipiv,
+                                      const double    maxGrowth,
+                                      int*            info)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactor(handle, n, A, lda, ipiv, maxGrowth, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfRefactor(hipblasHandle_t handle,
+                                      const int       n,
+                                      hipblasComplex* A,
+                                      const int       lda,
+                                      const int*      ipiv,
+                                      const float     maxGrowth,
+                                      int*            info)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactor(handle, n, (rocblas_float_complex*)A, lda, ipiv, maxGrowth, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfRefactor(hipblasHandle_t       handle,
+                                      const int             n,
+                                      hipblasDoubleComplex* A,
+                                      const int             lda,
+                                      const int*            ipiv,
+                                      const double          maxGrowth,
+                                      int*                  info)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactor(handle, n, (rocblas_double_complex*)A, lda, ipiv, maxGrowth, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfRefactor_v2(hipblasHandle_t handle,
+                                         const int       n,
+                                         hipComplex*     A,
+                                         const int       lda,
+                                         const int*      ipiv,
+                                         const float     maxGrowth,
+                                         int*            info)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactor(handle, n, (rocblas_float_complex*)A, lda, ipiv, maxGrowth, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfRefactor_v2(hipblasHandle_t   handle,
+                                         const int         n,
+                                         hipDoubleComplex* A,
+                                         const int         lda,
+                                         const int*        ipiv,
+                                         const double      maxGrowth,
+                                         int*              info)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || info == NULL)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactor(handle, n, (rocblas_double_complex*)A, lda, ipiv, maxGrowth, info);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrf_refactor_batched
+hipblasStatus_t hipblasSgetrfRefactorBatched(hipblasHandle_t handle,
+                                             const int       n,
+                                             float* const    A[],
+                                             const int       lda,
+                                             const int*      ipiv,
+                                             const float     maxGrowth,
+                                             int*            info,
+                                             const int       batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorBatched(handle, n, A, lda, ipiv, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfRefactorBatched(hipblasHandle_t handle,
+                                             const int       n,
+                                             double* const   A[],
+                                             const int       lda,
+                                             const int*      ipiv,
+                                             const double    maxGrowth,
+                                             int*            info,
+                                             const int       batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorBatched(handle, n, A, lda, ipiv, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfRefactorBatched(hipblasHandle_t       handle,
+                                             const int             n,
+                                             hipblasComplex* const A[],
+                                             const int             lda,
+                                             const int*            ipiv,
+                                             const float           maxGrowth,
+                                             int*                  info,
+                                             const int             batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorBatched(
+        handle, n, (rocblas_float_complex* const*)A, lda, ipiv, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfRefactorBatched(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             hipblasDoubleComplex* const A[],
+                                             const int                   lda,
+                                             const int*                  ipiv,
+                                             const double                maxGrowth,
+                                             int*                        info,
+                                             const int                   batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorBatched(
+        handle, n, (rocblas_double_complex* const*)A, lda, ipiv, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfRefactorBatched_v2(hipblasHandle_t   handle,
+                                                const int         n,
+                                                hipComplex* const A[],
+                                                const int         lda,
+                                                const int*        ipiv,
+                                                const float       maxGrowth,
+                                                int*              info,
+                                                const int         batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorBatched(
+        handle, n, (rocblas_float_complex* const*)A, lda, ipiv, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfRefactorBatched_v2(hipblasHandle_t         handle,
+                                                const int               n,
+                                                hipDoubleComplex* const A[],
+                                                const int               lda,
+                                                const int*              ipiv,
+                                                const double            maxGrowth,
+                                                int*                    info,
+                                                const int               batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorBatched(
+        handle, n, (rocblas_double_complex* const*)A, lda, ipiv, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// getrf_refactor_strided_batched
+hipblasStatus_t hipblasSgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    float*              A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    const int*          ipiv,
+                                                    const hipblasStride strideP,
+                                                    const float         maxGrowth,
+                                                    int*                info,
+                                                    const int           batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    double*             A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    const int*          ipiv,
+                                                    const hipblasStride strideP,
+                                                    const double        maxGrowth,
+                                                    int*                info,
+                                                    const int           batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, maxGrowth, info, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    hipblasComplex*     A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    const int*          ipiv,
+                                                    const hipblasStride strideP,
+                                                    const float         maxGrowth,
+                                                    int*                info,
+                                                    const int           batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorStridedBatched(handle,
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              strideA,
+                                              ipiv,
+                                              strideP,
+                                              maxGrowth,
+                                              info,
+                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfRefactorStridedBatched(hipblasHandle_t       handle,
+                                                    const int             n,
+                                                    hipblasDoubleComplex* A,
+                                                    const int             lda,
+                                                    const hipblasStride   strideA,
+                                                    const int*            ipiv,
+                                                    const hipblasStride   strideP,
+                                                    const double          maxGrowth,
+                                                    int*                  info,
+                                                    const int             batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorStridedBatched(handle,
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              strideA,
+                                              ipiv,
+                                              strideP,
+                                              maxGrowth,
+                                              info,
+                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgetrfRefactorStridedBatched_v2(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       hipComplex*         A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       const int*          ipiv,
+                                                       const hipblasStride strideP,
+                                                       const float         maxGrowth,
+                                                       int*                info,
+                                                       const int           batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorStridedBatched(handle,
+                                              n,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              strideA,
+                                              ipiv,
+                                              strideP,
+                                              maxGrowth,
+                                              info,
+                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgetrfRefactorStridedBatched_v2(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       hipDoubleComplex*   A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       const int*          ipiv,
+                                                       const hipblasStride strideP,
+                                                       const double        maxGrowth,
+                                                       int*                info,
+                                                       const int           batchCount)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(n < 0 || lda < std::max(1, n) || (n && (A == NULL || ipiv == NULL))
+       || !(maxGrowth >= 0) || (info == NULL && batchCount) || batchCount < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return hipblasGetrfRefactorStridedBatched(handle,
+                                              n,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              strideA,
+                                              ipiv,
+                                              strideP,
+                                              maxGrowth,
+                                              info,
+                                              batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+#endif
+
+} // extern "C"
+
+/*******************************************************************************
+ * Strassen-Winograd gemm
+ *
+ * One level splits op(A), op(B) and C into 2 x 2 blocks and computes C from 7
+ * block products and 16 block additions instead of 8 block products. A second
+ * level applies the same to each of the 7 products. The block additions are
+ * geam calls on sub-blocks and temporaries in the handle workspace.
+ ******************************************************************************/
+namespace
+{
+    constexpr int c_strassen_max_levels = 2;
+
+    // The automatic choice keeps the blocks multiplied by the backend gemm at least this large
+    constexpr int c_strassen_min_block = 8192;
+
+    // Element (row, col) of op(A)
+    template <typename T>
+    T* hipblasOpElement(T* A, rocblas_operation trans, int lda, int row, int col)
+    {
+        return trans == rocblas_operation_none ? A + row + size_t(col) * lda
+                                               : A + col + size_t(row) * lda;
+    }
+
+    // Elements of workspace used by hipblasStrassen for an m x n x k product
+    size_t hipblasStrassenWorkspace(int m, int n, int k, int levels)
+    {
+        size_t size = 0;
+        for(int level = 0; level < levels; level++)
+        {
+            m /= 2;
+            n /= 2;
+            k /= 2;
+            size += size_t(m) * k + size_t(k) * n + 2 * size_t(m) * n;
+        }
+        return size;
+    }
+
+    // Number of levels for an m x n x k product, 0 for the standard algorithm. levels is the
+    // value set with hipblasSetGemmStrassenLevels, where -1 chooses by size.
+    int hipblasStrassenLevels(int levels, int m, int n, int k)
+    {
+        int min_dim = std::min(std::min(m, n), k);
+        if(levels < 0)
+        {
+            levels = 0;
+            while(levels < c_strassen_max_levels
+                  && (min_dim >> (levels + 1)) >= c_strassen_min_block)
+                levels++;
+        }
+
+        // every level halves the blocks, which must not become empty
+        while(levels > 0 && (min_dim >> levels) == 0)
+            levels--;
+        return levels;
+    }
+
+    // C = alpha * op(A) * op(B) + beta * C with host scalars for m, n and k divisible by
+    // 2^levels. work holds hipblasStrassenWorkspace(m, n, k, levels) elements.
+    template <typename T>
+    rocblas_status hipblasStrassen(rocblas_handle    handle,
+                                   rocblas_operation transa,
+                                   rocblas_operation transb,
+                                   int               m,
+                                   int               n,
+                                   int               k,
+                                   T                 alpha,
+                                   const T*          A,
+                                   int               lda,
+                                   const T*          B,
+                                   int               ldb,
+                                   T                 beta,
+                                   T*                C,
+                                   int               ldc,
+                                   T*                work,
+                                   int               levels)
+    {
+        if(levels == 0)
+            return hipblasRocGemm(
+                handle, transa, transb, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+
+        const rocblas_operation none = rocblas_operation_none;
+        const T                 one(1), minus_one(-1), zero(0);
+        const T                 minus_alpha = -alpha;
+
+        int mh = m / 2, nh = n / 2, kh = k / 2;
+
+        const T* A11 = hipblasOpElement(A, transa, lda, 0, 0);
+        const T* A12 = hipblasOpElement(A, transa, lda, 0, kh);
+        const T* A21 = hipblasOpElement(A, transa, lda, mh, 0);
+        const T* A22 = hipblasOpElement(A, transa, lda, mh, kh);
+        const T* B11 = hipblasOpElement(B, transb, ldb, 0, 0);
+        const T* B12 = hipblasOpElement(B, transb, ldb, 0, nh);
+        const T* B21 = hipblasOpElement(B, transb, ldb, kh, 0);
+        const T* B22 = hipblasOpElement(B, transb, ldb, kh, nh);
+        T*       C11 = C;
+        T*       C12 = C + size_t(nh) * ldc;
+        T*       C21 = C + mh;
+        T*       C22 = C + mh + size_t(nh) * ldc;
+
+        // X holds sums of blocks of op(A), Y sums of blocks of op(B), Z and V block products.
+        // The next level uses the workspace behind them.
+        T* X    = work;
+        T* Y    = X + size_t(mh) * kh;
+        T* Z    = Y + size_t(kh) * nh;
+        T* V    = Z + size_t(mh) * nh;
+        T* next = V + size_t(mh) * nh;
+
+        // R = a * op(P) + b * op(Q) for blocks of size rows x cols
+        auto add = [&](rocblas_operation tp,
+                       const T*          P,
+                       int               ldp,
+                       const T&          b,
+                       rocblas_operation tq,
+                       const T*          Q,
+                       int               ldq,
+                       T*                R,
+                       int               ldr,
+                       int               rows,
+                       int               cols,
+                       const T&          a = T(1)) {
+            return hipblasRocGeam(handle, tp, tq, rows, cols, &a, P, ldp, &b, Q, ldq, R, ldr);
+        };
+        auto mul = [&](rocblas_operation tp,
+                       const T*          P,
+                       int               ldp,
+                       rocblas_operation tq,
+                       const T*          Q,
+                       int               ldq,
+                       const T&          a,
+                       const T&          b,
+                       T*                R,
+                       int               ldr) {
+            return hipblasStrassen(
+                handle, tp, tq, mh, nh, kh, a, P, ldp, Q, ldq, b, R, ldr, next, levels - 1);
+        };
+
+        // With S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2,
+        //      T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21,
+        //      P1 = A11 B11, P2 = A12 B21, P3 = S4 B22, P4 = A22 T4,
+        //      P5 = S1 T1, P6 = S2 T2, P7 = S3 T3:
+        // C11 = P1 + P2, C12 = P1 + P6 + P5 + P3, C21 = P1 + P6 + P7 - P4, C22 = P1 + P6 + P7 + P5,
+        // each scaled by alpha and added to beta * C.
+        const std::function<rocblas_status()> steps[] = {
+            // Z = alpha P1, C11 = beta C11 + Z + alpha P2
+            [&] { return mul(transa, A11, lda, transb, B11, ldb, alpha, zero, Z, mh); },
+            [&] { return add(none, Z, mh, beta, none, C11, ldc, C11, ldc, mh, nh); },
+            [&] { return mul(transa, A12, lda, transb, B21, ldb, alpha, one, C11, ldc); },
+            // V = alpha P5
+            [&] { return add(transa, A21, lda, one, transa, A22, lda, X, mh, mh, kh); },
+            [&] { return add(transb, B12, ldb, minus_one, transb, B11, ldb, Y, kh, kh, nh); },
+            [&] { return mul(none, X, mh, none, Y, kh, alpha, zero, V, mh); },
+            // Z = alpha (P1 + P6)
+            [&] { return add(none, X, mh, minus_one, transa, A11, lda, X, mh, mh, kh); },
+            [&] { return add(transb, B22, ldb, minus_one, none, Y, kh, Y, kh, kh, nh); },
+            [&] { return mul(none, X, mh, none, Y, kh, alpha, one, Z, mh); },
+            // C12 = beta C12 + Z + V + alpha P3
+            [&] { return add(transa, A12, lda, minus_one, none, X, mh, X, mh, mh, kh); },
+            [&] { return add(none, Z, mh, beta, none, C12, ldc, C12, ldc, mh, nh); },
+            [&] { return add(none, V, mh, one, none, C12, ldc, C12, ldc, mh, nh); },
+            [&] { return mul(none, X, mh, transb, B22, ldb, alpha, one, C12, ldc); },
+            // C22 = beta C22 + Z + V
+            [&] { return add(none, Z, mh, beta, none, C22, ldc, C22, ldc, mh, nh); },
+            [&] { return add(none, V, mh, one, none, C22, ldc, C22, ldc, mh, nh); },
+            // C21 = beta C21 + Z - alpha P4
+            [&] { return add(none, Y, kh, minus_one, transb, B21, ldb, Y, kh, kh, nh); },
+            [&] { return add(none, Z, mh, beta, none, C21, ldc, C21, ldc, mh, nh); },
+            [&] { return mul(transa, A22, lda, none, Y, kh, minus_alpha, one, C21, ldc); },
+            // V = alpha P7, added to C21 and C22
+            [&] { return add(transa, A11, lda, minus_one, transa, A21, lda, X, mh, mh, kh); },
+            [&] { return add(transb, B22, ldb, minus_one, transb, B12, ldb, Y, kh, kh, nh); },
+            [&] { return mul(none, X, mh, none, Y, kh, alpha, zero, V, mh); },
+            [&] { return add(none, V, mh, one, none, C21, ldc, C21, ldc, mh, nh); },
+            [&] { return add(none, V, mh, one, none, C22, ldc, C22, ldc, mh, nh); },
+        };
+
+        for(const auto& step : steps)
+        {
+            rocblas_status status = step();
+            if(status != rocblas_status_success)
+                return status;
+        }
+        return rocblas_status_success;
+    }
+
+    // Computes C = alpha * op(A) * op(B) + beta * C with the Strassen-Winograd algorithm. Returns
+    // false if the standard algorithm should be used, which is the case for invalid arguments too.
+    template <typename T>
+    bool hipblasGemmStrassen(hipblasHandle_t   handle,
+                             rocblas_operation transa,
+                             rocblas_operation transb,
+                             int               m,
+                             int               n,
+                             int               k,
+                             const T*          alpha,
+                             const T*          A,
+                             int               lda,
+                             const T*          B,
+                             int               ldb,
+                             const T*          beta,
+                             T*                C,
+                             int               ldc,
+                             int               levels,
+                             hipblasStatus_t*  status)
+    {
+        if(!handle || m <= 0 || n <= 0 || k <= 0 || !alpha || !beta || !A || !B || !C || ldc < m
+           || lda < (transa == rocblas_operation_none ? m : k)
+           || ldb < (transb == rocblas_operation_none ? k : n))
+            return false;
+
+        levels = hipblasStrassenLevels(levels, m, n, k);
+        if(levels == 0)
+            return false;
+
+        // the block sums need alpha and beta on the host, reading them from device memory would
+        // synchronize the stream, so device pointer mode takes the standard algorithm
+        rocblas_handle       rhandle = (rocblas_handle)handle;
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        if(mode != rocblas_pointer_mode_host)
+            return false;
+
+        const T h_alpha = *alpha;
+        const T h_beta  = *beta;
+        if(h_alpha == T(0))
+            return false;
+
+        // the largest leading part which divides evenly into blocks
+        int mask = ~((1 << levels) - 1);
+        int me = m & mask, ne = n & mask, ke = k & mask;
+
+        hipblasHandleState* state = hipblasGetHandleState(handle, true);
+        T*                  work  = (T*)hipblasGetHandleWorkspace(
+            handle, state, hipblasStrassenWorkspace(me, ne, ke, levels) * sizeof(T));
+
+        const T        one(1);
+        rocblas_status rstatus = hipblasStrassen(rhandle,
+                                                 transa,
+                                                 transb,
+                                                 me,
+                                                 ne,
+                                                 ke,
+                                                 h_alpha,
+                                                 A,
+                                                 lda,
+                                                 B,
+                                                 ldb,
+                                                 h_beta,
+                                                 C,
+                                                 ldc,
+                                                 work,
+                                                 levels);
+
+        // the rest of k is added to the leading part, the remaining rows and columns of C are
+        // computed on their own
+        if(rstatus == rocblas_status_success && ke < k)
+            rstatus = hipblasRocGemm(rhandle,
+                                     transa,
+                                     transb,
+                                     me,
+                                     ne,
+                                     k - ke,
+                                     &h_alpha,
+                                     hipblasOpElement(A, transa, lda, 0, ke),
+                                     lda,
+                                     hipblasOpElement(B, transb, ldb, ke, 0),
+                                     ldb,
+                                     &one,
+                                     C,
+                                     ldc);
+        if(rstatus == rocblas_status_success && me < m)
+            rstatus = hipblasRocGemm(rhandle,
+                                     transa,
+                                     transb,
+                                     m - me,
+                                     n,
+                                     k,
+                                     &h_alpha,
+                                     hipblasOpElement(A, transa, lda, me, 0),
+                                     lda,
+                                     B,
+                                     ldb,
+                                     &h_beta,
+                                     C + me,
+                                     ldc);
+        if(rstatus == rocblas_status_success && ne < n)
+            rstatus = hipblasRocGemm(rhandle,
+                                     transa,
+                                     transb,
+                                     me,
+                                     n - ne,
+                                     k,
+                                     &h_alpha,
+                                     A,
+                                     lda,
+                                     hipblasOpElement(B, transb, ldb, 0, ne),
+                                     ldb,
+                                     &h_beta,
+                                     C + size_t(ne) * ldc,
+                                     ldc);
+
+        *status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rstatus));
+        return true;
+    }
+
+    // Levels set for hipblasDgemm and hipblasZgemm, skipping the table lookup if no handle has any
+    int hipblasGetStrassenLevels(hipblasHandle_t handle)
+    {
+        if(!handle || !strassen_handle_count.load(std::memory_order_relaxed))
+            return 0;
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        return state ? state->gemm_strassen_levels : 0;
+    }
+
+    // gemmEx with HIPBLAS_GEMM_STRASSEN, for double and double complex only
+    bool hipblasGemmExStrassen(hipblasHandle_t   handle,
+                               rocblas_operation transa,
+                               rocblas_operation transb,
+                               int               m,
+                               int               n,
+                               int               k,
+                               const void*       alpha,
+                               const void*       A,
+                               rocblas_datatype  a_type,
+                               int               lda,
+                               const void*       B,
+                               rocblas_datatype  b_type,
+                               int               ldb,
+                               const void*       beta,
+                               void*             C,
+                               rocblas_datatype  c_type,
+                               int               ldc,
+                               rocblas_datatype  compute_type,
+                               hipblasStatus_t*  status)
+    {
+        if(a_type != compute_type || b_type != compute_type || c_type != compute_type)
+            return false;
+
+        hipblasHandleState* state  = handle ? hipblasGetHandleState(handle, false) : nullptr;
+        int                 levels = state ? state->gemm_strassen_levels : 0;
+        if(levels == 0)
+            levels = -1;
+
+        if(compute_type == rocblas_datatype_f64_r)
+            return hipblasGemmStrassen(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       (const double*)alpha,
+                                       (const double*)A,
+                                       lda,
+                                       (const double*)B,
+                                       ldb,
+                                       (const double*)beta,
+                                       (double*)C,
+                                       ldc,
+                                       levels,
+                                       status);
+        if(compute_type == rocblas_datatype_f64_c)
+            return hipblasGemmStrassen(handle,
+                                       transa,
+                                       transb,
+                                       m,
+                                       n,
+                                       k,
+                                       (const rocblas_double_complex*)alpha,
+                                       (const rocblas_double_complex*)A,
+                                       lda,
+                                       (const rocblas_double_complex*)B,
+                                       ldb,
+                                       (const rocblas_double_complex*)beta,
+                                       (rocblas_double_complex*)C,
+                                       ldc,
+                                       levels,
+                                       status);
+        return false;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasSetGemmStrassenLevels(hipblasHandle_t handle, int levels)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(levels < -1 || levels > c_strassen_max_levels)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, levels != 0);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(state->gemm_strassen_levels == 0 && levels != 0)
+        strassen_handle_count++;
+    else if(state->gemm_strassen_levels != 0 && levels == 0)
+        strassen_handle_count--;
+    state->gemm_strassen_levels = levels;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmStrassenLevels(hipblasHandle_t handle, int* levels)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(levels == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, false);
+    *levels                   = state ? state->gemm_strassen_levels : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * Operand order of gemm
+ *
+ * C = op(A) op(B) is the same product as C^T = op(B)^T op(A)^T. A handle in
+ * HIPBLAS_GEMM_ORDER_TRANSPOSED_C mode takes C stored transposed and computes
+ * the swapped product with one backend gemm. The order table tells callers
+ * for which problems the swapped product is faster on the device.
+ ******************************************************************************/
+namespace
+{
+    struct hipblasGemmOrderEntry
+    {
+        std::string arch;
+        char        precision, transa, transb;
+        int         m_log2, n_log2, k_log2;
+    };
+
+    // floor(log2(x)) for x > 0
+    int hipblasLog2(int64_t x)
+    {
+        int log2 = 0;
+        while(x >>= 1)
+            log2++;
+        return log2;
+    }
+
+    const std::vector<hipblasGemmOrderEntry>& hipblasGemmOrderTable()
+    {
+        static std::vector<hipblasGemmOrderEntry> entries;
+        static std::once_flag                     once;
+        std::call_once(once, [] {
+            const char* path = getenv("HIPBLAS_GEMM_ORDER_TABLE_FILE");
+            if(!path || !*path)
+                return;
+            std::ifstream file(path);
+            std::string   line;
+            while(std::getline(file, line))
+            {
+                std::istringstream    is(line);
+                hipblasGemmOrderEntry entry;
+                int64_t               m, n, k;
+                if(line.empty() || line[0] == '#'
+                   || !(is >> entry.arch >> entry.precision >> entry.transa >> entry.transb
+                        >> m >> n >> k)
+                   || m <= 0 || n <= 0 || k <= 0)
+                    continue;
+                entry.m_log2 = hipblasLog2(m);
+                entry.n_log2 = hipblasLog2(n);
+                entry.k_log2 = hipblasLog2(k);
+                entries.push_back(entry);
+            }
+        });
+        return entries;
+    }
+
+    // Architecture of the current device without target features, such as gfx90a
+    std::string hipblasDeviceArch()
+    {
+        static std::mutex                           mutex;
+        static std::unordered_map<int, std::string> archs;
+
+        int device = 0;
+        if(hipGetDevice(&device) != hipSuccess)
+            return "";
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = archs.find(device);
+        if(it != archs.end())
+            return it->second;
+
+        hipDeviceProp_t props;
+        if(hipGetDeviceProperties(&props, device) != hipSuccess)
+            return "";
+        std::string arch(props.gcnArchName);
+        return archs[device] = arch.substr(0, arch.find(':'));
+    }
+
+    char hipblasOperationChar(rocblas_operation trans)
+    {
+        return trans == rocblas_operation_none        ? 'N'
+               : trans == rocblas_operation_transpose ? 'T'
+                                                      : 'C';
+    }
+
+    bool hipblasGemmOrderTableSwaps(
+        char precision, rocblas_operation transa, rocblas_operation transb, int m, int n, int k)
+    {
+        const auto& table = hipblasGemmOrderTable();
+        if(table.empty())
+            return false;
+
+        std::string arch = hipblasDeviceArch();
+        char        ta = hipblasOperationChar(transa), tb = hipblasOperationChar(transb);
+        int         m_log2 = hipblasLog2(m), n_log2 = hipblasLog2(n), k_log2 = hipblasLog2(k);
+        for(const auto& entry : table)
+            if(entry.precision == precision && entry.transa == ta && entry.transb == tb
+               && entry.m_log2 == m_log2 && entry.n_log2 == n_log2 && entry.k_log2 == k_log2
+               && entry.arch == arch)
+                return true;
+        return false;
+    }
+
+    // Order mode set for gemm, skipping the handle state lookup if no handle has any
+    hipblasGemmOrderMode_t hipblasGetGemmOrder(hipblasHandle_t handle)
+    {
+        if(!handle || !order_handle_count.load(std::memory_order_relaxed))
+            return HIPBLAS_GEMM_ORDER_DEFAULT;
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        return state ? state->gemm_order_mode : HIPBLAS_GEMM_ORDER_DEFAULT;
+    }
+
+    bool hipblasIsComplexDatatype(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f16_c:
+        case rocblas_datatype_bf16_c:
+        case rocblas_datatype_f32_c:
+        case rocblas_datatype_f64_c:
+        case rocblas_datatype_i8_c:
+        case rocblas_datatype_u8_c:
+        case rocblas_datatype_i32_c:
+        case rocblas_datatype_u32_c:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // With HIPBLAS_GEMM_ORDER_TRANSPOSED_C the caller stores C transposed, and the call computes
+    // C^T = op(B)^T * op(A)^T. Swaps the operands of the call in place, so that the backend gemm
+    // writes C^T directly.
+    template <typename T>
+    hipblasStatus_t hipblasGemmApplyOrder(hipblasHandle_t     handle,
+                                          bool                is_complex,
+                                          hipblasOperation_t& transa,
+                                          hipblasOperation_t& transb,
+                                          int&                m,
+                                          int&                n,
+                                          T&                  A,
+                                          int&                lda,
+                                          T&                  B,
+                                          int&                ldb)
+    {
+        if(hipblasGetGemmOrder(handle) != HIPBLAS_GEMM_ORDER_TRANSPOSED_C)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // op(A)^T of a conjugate transposed matrix isn't a gemm operation
+        if(is_complex && (transa == HIPBLAS_OP_C || transb == HIPBLAS_OP_C))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // invalid operations are passed on for the backend to reject
+        auto transpose = [](hipblasOperation_t trans) {
+            return trans == HIPBLAS_OP_N                          ? HIPBLAS_OP_T
+                   : trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C ? HIPBLAS_OP_N
+                                                                    : trans;
+        };
+
+        hipblasOperation_t op_a = transa;
+        transa                  = transpose(transb);
+        transb                  = transpose(op_a);
+        std::swap(m, n);
+        std::swap(A, B);
+        std::swap(lda, ldb);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // hipblasGemmApplyOrder for gemmEx, which swaps the types of A and B as well
+    template <typename D>
+    hipblasStatus_t hipblasGemmExApplyOrder(hipblasHandle_t     handle,
+                                            bool                is_complex,
+                                            hipblasOperation_t& transa,
+                                            hipblasOperation_t& transb,
+                                            int&                m,
+                                            int&                n,
+                                            const void*&        A,
+                                            D&                  a_type,
+                                            int&                lda,
+                                            const void*&        B,
+                                            D&                  b_type,
+                                            int&                ldb)
+    {
+        if(hipblasGetGemmOrder(handle) != HIPBLAS_GEMM_ORDER_TRANSPOSED_C)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        std::swap(a_type, b_type);
+        return hipblasGemmApplyOrder(handle, is_complex, transa, transb, m, n, A, lda, B, ldb);
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasSetGemmOrderMode(hipblasHandle_t handle, hipblasGemmOrderMode_t mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GEMM_ORDER_DEFAULT && mode != HIPBLAS_GEMM_ORDER_TRANSPOSED_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, mode != HIPBLAS_GEMM_ORDER_DEFAULT);
+    if(!state)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(state->gemm_order_mode == HIPBLAS_GEMM_ORDER_DEFAULT && mode != HIPBLAS_GEMM_ORDER_DEFAULT)
+        order_handle_count++;
+    else if(state->gemm_order_mode != HIPBLAS_GEMM_ORDER_DEFAULT
+            && mode == HIPBLAS_GEMM_ORDER_DEFAULT)
+        order_handle_count--;
+    state->gemm_order_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmOrderMode(hipblasHandle_t handle, hipblasGemmOrderMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, false);
+    *mode                     = state ? state->gemm_order_mode : HIPBLAS_GEMM_ORDER_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmOrderHint(hipblasHandle_t         handle,
+                                        hipDataType             type,
+                                        hipblasOperation_t      transa,
+                                        hipblasOperation_t      transb,
+                                        int                     m,
+                                        int                     n,
+                                        int                     k,
+                                        hipblasGemmOrderMode_t* mode)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr || m < 0 || n < 0 || k < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    char precision = type == HIP_R_32F   ? 's'
+                     : type == HIP_R_64F ? 'd'
+                     : type == HIP_C_32F ? 'c'
+                     : type == HIP_C_64F ? 'z'
+                                         : 0;
+
+    rocblas_operation op_a = hipblasConvertOperation(transa);
+    rocblas_operation op_b = hipblasConvertOperation(transb);
+
+    // the transposed-equivalent problem of a conjugate transposed operand isn't a gemm
+    bool conjugate = (precision == 'c' || precision == 'z')
+                     && (transa == HIPBLAS_OP_C || transb == HIPBLAS_OP_C);
+
+    *mode = precision && !conjugate && m && n && k
+                    && hipblasGemmOrderTableSwaps(precision, op_a, op_b, m, n, k)
+                ? HIPBLAS_GEMM_ORDER_TRANSPOSED_C
+                : HIPBLAS_GEMM_ORDER_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+// gemm
+hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const hipblasHalf* alpha,
+                             const hipblasHalf* A,
+                             int                lda,
+                             const hipblasHalf* B,
+                             int                ldb,
+                             const hipblasHalf* beta,
+                             hipblasHalf*       C,
+                             int                ldc)
+try
+{
+    return hipblasConvertStatus(rocblas_hgemm((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_half*)alpha,
+                                              (rocblas_half*)A,
+                                              lda,
+                                              (rocblas_half*)B,
+                                              ldb,
+                                              (rocblas_half*)beta,
+                                              (rocblas_half*)C,
+                                              ldc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const float*       alpha,
+                             const float*       A,
+                             int                lda,
+                             const float*       B,
+                             int                ldb,
+                             const float*       beta,
+                             float*             C,
+                             int                ldc)
+try
+{
+    hipblasStatus_t status
+        = hipblasGemmApplyOrder(handle, false, transa, transb, m, n, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasConvertStatus(rocblas_sgemm((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              B,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              ldc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
+                             hipblasOperation_t transa,
+                             hipblasOperation_t transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const double*      alpha,
+                             const double*      A,
+                             int                lda,
+                             const double*      B,
+                             int                ldb,
+                             const double*      beta,
+                             double*            C,
+                             int                ldc)
+try
+{
+    hipblasStatus_t status
+        = hipblasGemmApplyOrder(handle, false, transa, transb, m, n, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int levels = hipblasGetStrassenLevels(handle);
+    if(levels != 0
+       && hipblasGemmStrassen(handle,
+                              hipblasConvertOperation(transa),
+                              hipblasConvertOperation(transb),
+                              m,
+                              n,
+                              k,
+                              alpha,
+                              A,
+                              lda,
+                              B,
+                              ldb,
+                              beta,
+                              C,
+                              ldc,
+                              levels,
+                              &status))
+        return status;
+
+    return hipblasConvertStatus(rocblas_dgemm((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              alpha,
+                                              A,
+                                              lda,
+                                              B,
+                                              ldb,
+                                              beta,
+                                              C,
+                                              ldc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
+                             hipblasOperation_t    transa,
+                             hipblasOperation_t    transb,
+                             int                   m,
+                             int                   n,
+                             int                   k,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* A,
+                             int                   lda,
+                             const hipblasComplex* B,
+                             int                   ldb,
+                             const hipblasComplex* beta,
+                             hipblasComplex*       C,
+                             int                   ldc)
+try
+{
+    hipblasStatus_t status
+        = hipblasGemmApplyOrder(handle, true, transa, transb, m, n, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasConvertStatus(rocblas_cgemm((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_float_complex*)alpha,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)B,
+                                              ldb,
+                                              (rocblas_float_complex*)beta,
+                                              (rocblas_float_complex*)C,
+                                              ldc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
+                             hipblasOperation_t          transa,
+                             hipblasOperation_t          transb,
+                             int                         m,
+                             int                         n,
+                             int                         k,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* A,
+                             int                         lda,
+                             const hipblasDoubleComplex* B,
+                             int                         ldb,
+                             const hipblasDoubleComplex* beta,
+                             hipblasDoubleComplex*       C,
+                             int                         ldc)
+try
+{
+    hipblasStatus_t status
+        = hipblasGemmApplyOrder(handle, true, transa, transb, m, n, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int levels = hipblasGetStrassenLevels(handle);
+    if(levels != 0
+       && hipblasGemmStrassen(handle,
+                              hipblasConvertOperation(transa),
+                              hipblasConvertOperation(transb),
+                              m,
+                              n,
+                              k,
+                              (const rocblas_double_complex*)alpha,
+                              (const rocblas_double_complex*)A,
+                              lda,
+                              (const rocblas_double_complex*)B,
+                              ldb,
+                              (const rocblas_double_complex*)beta,
+                              (rocblas_double_complex*)C,
+                              ldc,
+                              levels,
+                              &status))
+        return status;
+
+    return hipblasConvertStatus(rocblas_zgemm((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_double_complex*)alpha,
+                                              (rocblas_double_complex*)A,
+                                              lda,
+                                              (rocblas_double_complex*)B,
+                                              ldb,
+                                              (rocblas_double_complex*)beta,
+                                              (rocblas_double_complex*)C,
+                                              ldc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemm_v2(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const hipComplex*  alpha,
+                                const hipComplex*  A,
+                                int                lda,
+                                const hipComplex*  B,
+                                int                ldb,
+                                const hipComplex*  beta,
+                                hipComplex*        C,
+                                int                ldc)
+try
+{
+    hipblasStatus_t status
+        = hipblasGemmApplyOrder(handle, true, transa, transb, m, n, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasConvertStatus(rocblas_cgemm((rocblas_handle)handle,
+                                              hipblasConvertOperation(transa),
+                                              hipblasConvertOperation(transb),
+                                              m,
+                                              n,
+                                              k,
+                                              (rocblas_float_complex*)alpha,
+                                              (rocblas_float_complex*)A,
+                                              lda,
+                                              (rocblas_float_complex*)B,
+                                              ldb,
+                                              (rocblas_float_complex*)beta,
+                                              (rocblas_float_complex*)C,
+                                              ldc));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemm_v2(hipblasHandle_t         handle,
+                                hipblasOperation_t      transa,
+                                hipblasOperation_t      transb,
+                                int                     m,
+                                int                     n,
+                                int                     k,
+                                const hipDoubleComplex* alpha,
+                                const hipDoubleComplex* A,
+                                int                     lda,
+                                const hipDoubleComplex* B,
+                                int                     ldb,
+                                const hipDoubleComplex* beta,
+                                hipDoubleComplex*       C,
+                                int                     ldc)
+try
+{
+    hipblasStatus_t status
+        = hipblasGemmApplyOrder(handle, true, transa, transb, m, n, A, lda, B, ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int levels = hipblasGetStrassenLevels(handle);
+    if(levels != 0
+       && hipblasGemmStrassen(handle,
+                              hipblasConvertOperation(transa),
+                              hipblasConvertOperation(transb),
+                              m,
+                              n,
+                              k,
+                              (const rocblas_double_complex*)alpha,
+                              (const rocblas_double_complex*)A,
+                              lda,
+                              (const rocblas_double_complex*)B,
+                              ldb,
+                              (const rocblas_double_complex*)beta,
+                              (rocblas_double_complex*)C,
+                              ldc,
+                              levels,
+                              &status))
+        return status;
+
     return hipblasConvertStatus(rocblas_zgemm((rocblas_handle)handle,
                                               hipblasConvertOperation(transa),
                                               hipblasConvertOperation(transb),
@@ -51232,6 +58734,2516 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+} // extern "C"
+
+/*******************************************************************************
+ * Complex times real gemm
+ *
+ * An interleaved complex m x n matrix with leading dimension ld is also a real
+ * 2m x n matrix with leading dimension 2 * ld, so a complex matrix times a real
+ * matrix is a real gemm with twice the rows and half the flops of a complex gemm.
+ ******************************************************************************/
+namespace
+{
+    template <typename R>
+    using hipblasComplexOf = std::conditional_t<std::is_same<R, float>{},
+                                                rocblas_float_complex,
+                                                rocblas_double_complex>;
+
+    rocblas_status hipblasRocCopyStridedBatched(rocblas_handle handle,
+                                                int            n,
+                                                const float*   x,
+                                                int            incx,
+                                                hipblasStride  stridex,
+                                                float*         y,
+                                                int            incy,
+                                                hipblasStride  stridey,
+                                                int            batch_count)
+    {
+        return rocblas_scopy_strided_batched(
+            handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    }
+    rocblas_status hipblasRocCopyStridedBatched(rocblas_handle handle,
+                                                int            n,
+                                                const double*  x,
+                                                int            incx,
+                                                hipblasStride  stridex,
+                                                double*        y,
+                                                int            incy,
+                                                hipblasStride  stridey,
+                                                int            batch_count)
+    {
+        return rocblas_dcopy_strided_batched(
+            handle, n, x, incx, stridex, y, incy, stridey, batch_count);
+    }
+
+    rocblas_status hipblasRocCopyBatched(rocblas_handle     handle,
+                                         int64_t            n,
+                                         const float* const x[],
+                                         int64_t            incx,
+                                         float* const       y[],
+                                         int64_t            incy,
+                                         int64_t            batch_count)
+    {
+        return rocblas_scopy_batched_64(handle, n, x, incx, y, incy, batch_count);
+    }
+    rocblas_status hipblasRocCopyBatched(rocblas_handle      handle,
+                                         int64_t             n,
+                                         const double* const x[],
+                                         int64_t             incx,
+                                         double* const       y[],
+                                         int64_t             incy,
+                                         int64_t             batch_count)
+    {
+        return rocblas_dcopy_batched_64(handle, n, x, incx, y, incy, batch_count);
+    }
+
+    rocblas_status hipblasRocGeamStridedBatched(rocblas_handle               handle,
+                                                rocblas_operation            transA,
+                                                rocblas_operation            transB,
+                                                int                          m,
+                                                int                          n,
+                                                const rocblas_float_complex* alpha,
+                                                const rocblas_float_complex* A,
+                                                int                          lda,
+                                                hipblasStride                stride_a,
+                                                const rocblas_float_complex* beta,
+                                                const rocblas_float_complex* B,
+                                                int                          ldb,
+                                                hipblasStride                stride_b,
+                                                rocblas_float_complex*       C,
+                                                int                          ldc,
+                                                hipblasStride                stride_c,
+                                                int                          batch_count)
+    {
+        return rocblas_cgeam_strided_batched(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             n,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_a,
+                                             beta,
+                                             B,
+                                             ldb,
+                                             stride_b,
+                                             C,
+                                             ldc,
+                                             stride_c,
+                                             batch_count);
+    }
+    rocblas_status hipblasRocGeamStridedBatched(rocblas_handle                handle,
+                                                rocblas_operation             transA,
+                                                rocblas_operation             transB,
+                                                int                           m,
+                                                int                           n,
+                                                const rocblas_double_complex* alpha,
+                                                const rocblas_double_complex* A,
+                                                int                           lda,
+                                                hipblasStride                 stride_a,
+                                                const rocblas_double_complex* beta,
+                                                const rocblas_double_complex* B,
+                                                int                           ldb,
+                                                hipblasStride                 stride_b,
+                                                rocblas_double_complex*       C,
+                                                int                           ldc,
+                                                hipblasStride                 stride_c,
+                                                int                           batch_count)
+    {
+        return rocblas_zgeam_strided_batched(handle,
+                                             transA,
+                                             transB,
+                                             m,
+                                             n,
+                                             alpha,
+                                             A,
+                                             lda,
+                                             stride_a,
+                                             beta,
+                                             B,
+                                             ldb,
+                                             stride_b,
+                                             C,
+                                             ldc,
+                                             stride_c,
+                                             batch_count);
+    }
+
+    hipblasStatus_t hipblasGemmRealCheck(hipblasHandle_t    handle,
+                                         hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         int                lda,
+                                         int                ldb,
+                                         const void*        beta,
+                                         int                ldc,
+                                         int                batch_count)
+    {
+        if(!handle)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        hipblasConvertOperation(transa);
+        hipblasConvertOperation(transb);
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || ldc < std::max(1, m)
+           || lda < std::max(1, transa == HIPBLAS_OP_N ? m : k)
+           || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m && n && batch_count && (!alpha || !beta))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Computes C_i = alpha * op(A_i) * op(B_i) + beta * C_i for batch_count strided problems.
+    // B is real if real_b is set and A is real otherwise; alpha, beta and C are complex.
+    template <typename R>
+    hipblasStatus_t hipblasGemmRealStrided(hipblasHandle_t            handle,
+                                           bool                       real_b,
+                                           hipblasOperation_t         transa,
+                                           hipblasOperation_t         transb,
+                                           int                        m,
+                                           int                        n,
+                                           int                        k,
+                                           const hipblasComplexOf<R>* alpha,
+                                           const void*                A,
+                                           int                        lda,
+                                           hipblasStride              stride_a,
+                                           const void*                B,
+                                           int                        ldb,
+                                           hipblasStride              stride_b,
+                                           const hipblasComplexOf<R>* beta,
+                                           hipblasComplexOf<R>*       C,
+                                           int                        ldc,
+                                           hipblasStride              stride_c,
+                                           int                        batch_count)
+    {
+        using Cx = hipblasComplexOf<R>;
+
+        hipblasStatus_t status = hipblasGemmRealCheck(
+            handle, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+            return status;
+        if(!C || (k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblas_handle    rhandle      = (rocblas_handle)handle;
+        rocblas_operation op_a         = hipblasConvertOperation(transa);
+        rocblas_operation op_b         = hipblasConvertOperation(transb);
+        rocblas_datatype  real_type    = hipblasRocDatatype<R>();
+        rocblas_datatype  complex_type = hipblasRocDatatype<Cx>();
+
+        // the complex and the real operand
+        const void*   X        = real_b ? A : B;
+        int           ldx      = real_b ? lda : ldb;
+        hipblasStride stride_x = real_b ? stride_a : stride_b;
+        const R*      Y        = (const R*)(real_b ? B : A);
+        int           ldy      = real_b ? ldb : lda;
+        hipblasStride stride_y = real_b ? stride_b : stride_a;
+
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+
+        // The complex operand has to be untransposed on the left of either C = op(A) * B or
+        // C^T = B * op(A)^T, and the doubled dimensions have to fit in an int
+        int  rows   = real_b ? m : n;
+        bool fits   = 2 * int64_t(std::max(std::max(rows, ldx), ldc)) <= INT_MAX;
+        bool direct = k && fits && (real_b ? transa == HIPBLAS_OP_N : transb != HIPBLAS_OP_N);
+
+        if(direct && real_b && mode == rocblas_pointer_mode_host && alpha->imag() == 0
+           && beta->imag() == 0)
+        {
+            // C_r = alpha * A_r * op(B) + beta * C_r, reading the real parts of alpha and beta
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_strided_batched_ex(rhandle,
+                                                                     rocblas_operation_none,
+                                                                     op_b,
+                                                                     2 * m,
+                                                                     n,
+                                                                     k,
+                                                                     alpha,
+                                                                     X,
+                                                                     real_type,
+                                                                     2 * ldx,
+                                                                     2 * stride_x,
+                                                                     Y,
+                                                                     real_type,
+                                                                     ldy,
+                                                                     stride_y,
+                                                                     beta,
+                                                                     C,
+                                                                     real_type,
+                                                                     2 * ldc,
+                                                                     2 * stride_c,
+                                                                     C,
+                                                                     real_type,
+                                                                     2 * ldc,
+                                                                     2 * stride_c,
+                                                                     batch_count,
+                                                                     real_type,
+                                                                     rocblas_gemm_algo_standard,
+                                                                     0,
+                                                                     0)));
+        }
+
+        hipblasHandleState* state = hipblasGetHandleState(handle, true);
+        const R             one = 1, zero = 0;
+
+        if(direct)
+        {
+            // P = A_r * op(B) (m x n) or P_r = B_r * op(A)^T (n x m) in the workspace, then
+            // C = alpha * op(P) + beta * C
+            int           p_cols   = real_b ? n : m;
+            hipblasStride stride_p = hipblasStride(rows) * p_cols;
+            Cx*           P        = (Cx*)hipblasGetHandleWorkspace(
+                handle, state, size_t(stride_p) * batch_count * sizeof(Cx));
+
+            // A is real, so op(A)^T is A unless op(A) = A
+            rocblas_operation trans_y
+                = real_b ? op_b
+                         : (transa == HIPBLAS_OP_N ? rocblas_operation_transpose
+                                                   : rocblas_operation_none);
+
+            rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+            status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_strided_batched_ex(rhandle,
+                                                                     rocblas_operation_none,
+                                                                     trans_y,
+                                                                     2 * rows,
+                                                                     p_cols,
+                                                                     k,
+                                                                     &one,
+                                                                     X,
+                                                                     real_type,
+                                                                     2 * ldx,
+                                                                     2 * stride_x,
+                                                                     Y,
+                                                                     real_type,
+                                                                     ldy,
+                                                                     stride_y,
+                                                                     &zero,
+                                                                     P,
+                                                                     real_type,
+                                                                     2 * rows,
+                                                                     2 * stride_p,
+                                                                     P,
+                                                                     real_type,
+                                                                     2 * rows,
+                                                                     2 * stride_p,
+                                                                     batch_count,
+                                                                     real_type,
+                                                                     rocblas_gemm_algo_standard,
+                                                                     0,
+                                                                     0)));
+            rocblas_set_pointer_mode(rhandle, mode);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            // with real A, C^T = op(B)^T * op(A)^T gives C = P^T, or C = P^H when B is conjugated
+            rocblas_operation trans_p = real_b ? rocblas_operation_none
+                                        : transb == HIPBLAS_OP_C
+                                            ? rocblas_operation_conjugate_transpose
+                                            : rocblas_operation_transpose;
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocGeamStridedBatched(rhandle,
+                                                                  trans_p,
+                                                                  rocblas_operation_none,
+                                                                  m,
+                                                                  n,
+                                                                  alpha,
+                                                                  P,
+                                                                  rows,
+                                                                  stride_p,
+                                                                  beta,
+                                                                  C,
+                                                                  ldc,
+                                                                  stride_c,
+                                                                  C,
+                                                                  ldc,
+                                                                  stride_c,
+                                                                  batch_count)));
+        }
+
+        // Otherwise the real operand is promoted to complex in the workspace for a complex gemm
+        hipblasOperation_t trans_y  = real_b ? transb : transa;
+        int                y_rows   = trans_y == HIPBLAS_OP_N ? (real_b ? k : m) : (real_b ? n : k);
+        int                y_cols   = trans_y == HIPBLAS_OP_N ? (real_b ? n : k) : (real_b ? k : m);
+        int                ldw      = std::max(y_rows, 1);
+        hipblasStride      stride_w = hipblasStride(y_rows) * y_cols;
+        size_t             w_size   = size_t(stride_w) * batch_count * sizeof(Cx);
+        Cx*                W        = nullptr;
+
+        if(w_size)
+        {
+            W = (Cx*)hipblasGetHandleWorkspace(handle, state, w_size);
+
+            hipStream_t stream;
+            rocblas_get_stream(rhandle, &stream);
+            if(hipMemsetAsync(W, 0, w_size, stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            // each column of Y_i goes to the real parts of a column of W_i. When the matrices of
+            // Y follow each other, as those of W do, all of their columns are one batch of copies;
+            // otherwise column j of every Y_i is copied by one batch of copies.
+            bool packed_y = stride_y == hipblasStride(ldy) * y_cols;
+            if(packed_y && int64_t(y_cols) * batch_count <= INT_MAX)
+                status = hipblasConvertStatus(hipblasRocCopyStridedBatched(
+                    rhandle, y_rows, Y, 1, ldy, (R*)W, 2, 2 * ldw, y_cols * batch_count));
+            else
+                for(int j = 0; j < y_cols && status == HIPBLAS_STATUS_SUCCESS; j++)
+                    status = hipblasConvertStatus(hipblasRocCopyStridedBatched(rhandle,
+                                                                               y_rows,
+                                                                               Y + size_t(j) * ldy,
+                                                                               1,
+                                                                               stride_y,
+                                                                               (R*)(W + j * ldw),
+                                                                               2,
+                                                                               2 * stride_w,
+                                                                               batch_count));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocblas_gemm_strided_batched_ex(rhandle,
+                                                                 op_a,
+                                                                 op_b,
+                                                                 m,
+                                                                 n,
+                                                                 k,
+                                                                 alpha,
+                                                                 real_b ? X : W,
+                                                                 complex_type,
+                                                                 real_b ? ldx : ldw,
+                                                                 real_b ? stride_x : stride_w,
+                                                                 real_b ? W : X,
+                                                                 complex_type,
+                                                                 real_b ? ldw : ldx,
+                                                                 real_b ? stride_w : stride_x,
+                                                                 beta,
+                                                                 C,
+                                                                 complex_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 C,
+                                                                 complex_type,
+                                                                 ldc,
+                                                                 stride_c,
+                                                                 batch_count,
+                                                                 complex_type,
+                                                                 rocblas_gemm_algo_standard,
+                                                                 0,
+                                                                 0)));
+    }
+
+    // Batched version of hipblasGemmRealStrided with arrays of device pointers. The pointer
+    // arrays of the caller are never read on the host: they are reinterpreted as arrays of real
+    // pointers, and the arrays pointing into the workspace are computed on the host and uploaded.
+    template <typename R>
+    hipblasStatus_t hipblasGemmRealBatched(hipblasHandle_t            handle,
+                                           bool                       real_b,
+                                           hipblasOperation_t         transa,
+                                           hipblasOperation_t         transb,
+                                           int                        m,
+                                           int                        n,
+                                           int                        k,
+                                           const hipblasComplexOf<R>* alpha,
+                                           const void* const          A[],
+                                           int                        lda,
+                                           const void* const          B[],
+                                           int                        ldb,
+                                           const hipblasComplexOf<R>* beta,
+                                           hipblasComplexOf<R>* const C[],
+                                           int                        ldc,
+                                           int                        batch_count)
+    {
+        using Cx = hipblasComplexOf<R>;
+
+        hipblasStatus_t status = hipblasGemmRealCheck(
+            handle, transa, transb, m, n, k, alpha, lda, ldb, beta, ldc, batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS || !m || !n || !batch_count)
+            return status;
+        if(!C || (k && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        rocblas_handle    rhandle      = (rocblas_handle)handle;
+        rocblas_operation op_a         = hipblasConvertOperation(transa);
+        rocblas_operation op_b         = hipblasConvertOperation(transb);
+        rocblas_datatype  real_type    = hipblasRocDatatype<R>();
+        rocblas_datatype  complex_type = hipblasRocDatatype<Cx>();
+
+        // the complex and the real operand
+        const void* const* X   = real_b ? A : B;
+        int                ldx = real_b ? lda : ldb;
+        const void* const* Y   = real_b ? B : A;
+        int                ldy = real_b ? ldb : lda;
+
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+
+        int  rows   = real_b ? m : n;
+        bool fits   = 2 * int64_t(std::max(std::max(rows, ldx), ldc)) <= INT_MAX;
+        bool direct = k && fits && (real_b ? transa == HIPBLAS_OP_N : transb != HIPBLAS_OP_N);
+
+        if(direct && real_b && mode == rocblas_pointer_mode_host && alpha->imag() == 0
+           && beta->imag() == 0)
+        {
+            // the pointer arrays are reinterpreted in the same way as the matrices they point to
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_batched_ex(rhandle,
+                                                             rocblas_operation_none,
+                                                             op_b,
+                                                             2 * m,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             X,
+                                                             real_type,
+                                                             2 * ldx,
+                                                             Y,
+                                                             real_type,
+                                                             ldy,
+                                                             beta,
+                                                             C,
+                                                             real_type,
+                                                             2 * ldc,
+                                                             (void*)C,
+                                                             real_type,
+                                                             2 * ldc,
+                                                             batch_count,
+                                                             real_type,
+                                                             rocblas_gemm_algo_standard,
+                                                             0,
+                                                             0)));
+        }
+
+        // The workspace holds an array of pointers to the matrices which follow it
+        hipblasHandleState* state     = hipblasGetHandleState(handle, true);
+        size_t              ptr_bytes = (sizeof(void*) * batch_count + 255) / 256 * 256;
+        const R             one = 1, zero = 0;
+
+        if(direct)
+        {
+            // as in hipblasGemmRealStrided, P_i = A_i,r * op(B_i) or P_i,r = B_i,r * op(A_i)^T
+            // followed by C_i = alpha * op(P_i) + beta * C_i
+            int           p_cols   = real_b ? n : m;
+            hipblasStride stride_p = hipblasStride(rows) * p_cols;
+            char*         ws       = (char*)hipblasGetHandleWorkspace(
+                handle, state, ptr_bytes + size_t(stride_p) * batch_count * sizeof(Cx));
+            Cx**             P = (Cx**)ws;
+            std::vector<Cx*> hP(batch_count);
+            for(int b = 0; b < batch_count; b++)
+                hP[b] = (Cx*)(ws + ptr_bytes) + b * stride_p;
+            hipblasUploadAsync(handle, state, P, hP.data(), sizeof(Cx*) * batch_count);
+
+            rocblas_operation trans_y
+                = real_b ? op_b
+                         : (transa == HIPBLAS_OP_N ? rocblas_operation_transpose
+                                                   : rocblas_operation_none);
+
+            rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+            status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_batched_ex(rhandle,
+                                                             rocblas_operation_none,
+                                                             trans_y,
+                                                             2 * rows,
+                                                             p_cols,
+                                                             k,
+                                                             &one,
+                                                             X,
+                                                             real_type,
+                                                             2 * ldx,
+                                                             Y,
+                                                             real_type,
+                                                             ldy,
+                                                             &zero,
+                                                             P,
+                                                             real_type,
+                                                             2 * rows,
+                                                             P,
+                                                             real_type,
+                                                             2 * rows,
+                                                             batch_count,
+                                                             real_type,
+                                                             rocblas_gemm_algo_standard,
+                                                             0,
+                                                             0)));
+            rocblas_set_pointer_mode(rhandle, mode);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            rocblas_operation trans_p = real_b ? rocblas_operation_none
+                                        : transb == HIPBLAS_OP_C
+                                            ? rocblas_operation_conjugate_transpose
+                                            : rocblas_operation_transpose;
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(hipblasRocGeamBatched(rhandle,
+                                                           trans_p,
+                                                           rocblas_operation_none,
+                                                           m,
+                                                           n,
+                                                           alpha,
+                                                           P,
+                                                           rows,
+                                                           beta,
+                                                           C,
+                                                           ldc,
+                                                           C,
+                                                           ldc,
+                                                           batch_count)));
+        }
+
+        // Otherwise the real operand is promoted to complex in the workspace for a complex gemm.
+        // W_i keeps the leading dimension of Y_i, so Y_i is copied to the real parts of W_i as a
+        // single vector which spans its columns and the rows between them.
+        hipblasOperation_t trans_y  = real_b ? transb : transa;
+        int                y_rows   = trans_y == HIPBLAS_OP_N ? (real_b ? k : m) : (real_b ? n : k);
+        int                y_cols   = trans_y == HIPBLAS_OP_N ? (real_b ? n : k) : (real_b ? k : m);
+        hipblasStride      stride_w = hipblasStride(ldy) * y_cols;
+        Cx**               W        = nullptr;
+
+        if(k)
+        {
+            char* ws = (char*)hipblasGetHandleWorkspace(
+                handle, state, ptr_bytes + size_t(stride_w) * batch_count * sizeof(Cx));
+            W = (Cx**)ws;
+            std::vector<Cx*> hW(batch_count);
+            for(int b = 0; b < batch_count; b++)
+                hW[b] = (Cx*)(ws + ptr_bytes) + b * stride_w;
+            hipblasUploadAsync(handle, state, W, hW.data(), sizeof(Cx*) * batch_count);
+
+            hipStream_t stream;
+            rocblas_get_stream(rhandle, &stream);
+            size_t w_size = size_t(stride_w) * batch_count * sizeof(Cx);
+            if(hipMemsetAsync(ws + ptr_bytes, 0, w_size, stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            status = hipblasConvertStatus(hipblasRocCopyBatched(rhandle,
+                                                                int64_t(y_cols - 1) * ldy + y_rows,
+                                                                (const R* const*)Y,
+                                                                1,
+                                                                (R* const*)W,
+                                                                2,
+                                                                batch_count));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        return HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocblas_gemm_batched_ex(rhandle,
+                                                         op_a,
+                                                         op_b,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         real_b ? (const void*)X : W,
+                                                         complex_type,
+                                                         real_b ? ldx : ldy,
+                                                         real_b ? (const void*)W : X,
+                                                         complex_type,
+                                                         real_b ? ldy : ldx,
+                                                         beta,
+                                                         C,
+                                                         complex_type,
+                                                         ldc,
+                                                         (void*)C,
+                                                         complex_type,
+                                                         ldc,
+                                                         batch_count,
+                                                         complex_type,
+                                                         rocblas_gemm_algo_standard,
+                                                         0,
+                                                         0)));
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasCgemmRealB(hipblasHandle_t       handle,
+                                  hipblasOperation_t    transa,
+                                  hipblasOperation_t    transb,
+                                  int                   m,
+                                  int                   n,
+                                  int                   k,
+                                  const hipblasComplex* alpha,
+                                  const hipblasComplex* A,
+                                  int                   lda,
+                                  const float*          B,
+                                  int                   ldb,
+                                  const hipblasComplex* beta,
+                                  hipblasComplex*       C,
+                                  int                   ldc)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         true,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         0,
+                                         B,
+                                         ldb,
+                                         0,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealB(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transa,
+                                  hipblasOperation_t          transb,
+                                  int                         m,
+                                  int                         n,
+                                  int                         k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* A,
+                                  int                         lda,
+                                  const double*               B,
+                                  int                         ldb,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       C,
+                                  int                         ldc)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          true,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          0,
+                                          B,
+                                          ldb,
+                                          0,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          0,
+                                          1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealA(hipblasHandle_t       handle,
+                                  hipblasOperation_t    transa,
+                                  hipblasOperation_t    transb,
+                                  int                   m,
+                                  int                   n,
+                                  int                   k,
+                                  const hipblasComplex* alpha,
+                                  const float*          A,
+                                  int                   lda,
+                                  const hipblasComplex* B,
+                                  int                   ldb,
+                                  const hipblasComplex* beta,
+                                  hipblasComplex*       C,
+                                  int                   ldc)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         false,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         0,
+                                         B,
+                                         ldb,
+                                         0,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealA(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transa,
+                                  hipblasOperation_t          transb,
+                                  int                         m,
+                                  int                         n,
+                                  int                         k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const double*               A,
+                                  int                         lda,
+                                  const hipblasDoubleComplex* B,
+                                  int                         ldb,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       C,
+                                  int                         ldc)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          false,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          0,
+                                          B,
+                                          ldb,
+                                          0,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          0,
+                                          1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealB_v2(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const hipComplex*  alpha,
+                                     const hipComplex*  A,
+                                     int                lda,
+                                     const float*       B,
+                                     int                ldb,
+                                     const hipComplex*  beta,
+                                     hipComplex*        C,
+                                     int                ldc)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         true,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         0,
+                                         B,
+                                         ldb,
+                                         0,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealB_v2(hipblasHandle_t         handle,
+                                     hipblasOperation_t      transa,
+                                     hipblasOperation_t      transb,
+                                     int                     m,
+                                     int                     n,
+                                     int                     k,
+                                     const hipDoubleComplex* alpha,
+                                     const hipDoubleComplex* A,
+                                     int                     lda,
+                                     const double*           B,
+                                     int                     ldb,
+                                     const hipDoubleComplex* beta,
+                                     hipDoubleComplex*       C,
+                                     int                     ldc)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          true,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          0,
+                                          B,
+                                          ldb,
+                                          0,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          0,
+                                          1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealA_v2(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const hipComplex*  alpha,
+                                     const float*       A,
+                                     int                lda,
+                                     const hipComplex*  B,
+                                     int                ldb,
+                                     const hipComplex*  beta,
+                                     hipComplex*        C,
+                                     int                ldc)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         false,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         0,
+                                         B,
+                                         ldb,
+                                         0,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         0,
+                                         1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealA_v2(hipblasHandle_t         handle,
+                                     hipblasOperation_t      transa,
+                                     hipblasOperation_t      transb,
+                                     int                     m,
+                                     int                     n,
+                                     int                     k,
+                                     const hipDoubleComplex* alpha,
+                                     const double*           A,
+                                     int                     lda,
+                                     const hipDoubleComplex* B,
+                                     int                     ldb,
+                                     const hipDoubleComplex* beta,
+                                     hipDoubleComplex*       C,
+                                     int                     ldc)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          false,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          0,
+                                          B,
+                                          ldb,
+                                          0,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          0,
+                                          1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealBBatched(hipblasHandle_t             handle,
+                                         hipblasOperation_t          transa,
+                                         hipblasOperation_t          transb,
+                                         int                         m,
+                                         int                         n,
+                                         int                         k,
+                                         const hipblasComplex*       alpha,
+                                         const hipblasComplex* const A[],
+                                         int                         lda,
+                                         const float* const          B[],
+                                         int                         ldb,
+                                         const hipblasComplex*       beta,
+                                         hipblasComplex* const       C[],
+                                         int                         ldc,
+                                         int                         batchCount)
+try
+{
+    return hipblasGemmRealBatched<float>(handle,
+                                         true,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         (const void* const*)A,
+                                         lda,
+                                         (const void* const*)B,
+                                         ldb,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex* const*)C,
+                                         ldc,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealBBatched(hipblasHandle_t                   handle,
+                                         hipblasOperation_t                transa,
+                                         hipblasOperation_t                transb,
+                                         int                               m,
+                                         int                               n,
+                                         int                               k,
+                                         const hipblasDoubleComplex*       alpha,
+                                         const hipblasDoubleComplex* const A[],
+                                         int                               lda,
+                                         const double* const               B[],
+                                         int                               ldb,
+                                         const hipblasDoubleComplex*       beta,
+                                         hipblasDoubleComplex* const       C[],
+                                         int                               ldc,
+                                         int                               batchCount)
+try
+{
+    return hipblasGemmRealBatched<double>(handle,
+                                          true,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          (const void* const*)A,
+                                          lda,
+                                          (const void* const*)B,
+                                          ldb,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex* const*)C,
+                                          ldc,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealABatched(hipblasHandle_t             handle,
+                                         hipblasOperation_t          transa,
+                                         hipblasOperation_t          transb,
+                                         int                         m,
+                                         int                         n,
+                                         int                         k,
+                                         const hipblasComplex*       alpha,
+                                         const float* const          A[],
+                                         int                         lda,
+                                         const hipblasComplex* const B[],
+                                         int                         ldb,
+                                         const hipblasComplex*       beta,
+                                         hipblasComplex* const       C[],
+                                         int                         ldc,
+                                         int                         batchCount)
+try
+{
+    return hipblasGemmRealBatched<float>(handle,
+                                         false,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         (const void* const*)A,
+                                         lda,
+                                         (const void* const*)B,
+                                         ldb,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex* const*)C,
+                                         ldc,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealABatched(hipblasHandle_t                   handle,
+                                         hipblasOperation_t                transa,
+                                         hipblasOperation_t                transb,
+                                         int                               m,
+                                         int                               n,
+                                         int                               k,
+                                         const hipblasDoubleComplex*       alpha,
+                                         const double* const               A[],
+                                         int                               lda,
+                                         const hipblasDoubleComplex* const B[],
+                                         int                               ldb,
+                                         const hipblasDoubleComplex*       beta,
+                                         hipblasDoubleComplex* const       C[],
+                                         int                               ldc,
+                                         int                               batchCount)
+try
+{
+    return hipblasGemmRealBatched<double>(handle,
+                                          false,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          (const void* const*)A,
+                                          lda,
+                                          (const void* const*)B,
+                                          ldb,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex* const*)C,
+                                          ldc,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealBBatched_v2(hipblasHandle_t         handle,
+                                            hipblasOperation_t      transa,
+                                            hipblasOperation_t      transb,
+                                            int                     m,
+                                            int                     n,
+                                            int                     k,
+                                            const hipComplex*       alpha,
+                                            const hipComplex* const A[],
+                                            int                     lda,
+                                            const float* const      B[],
+                                            int                     ldb,
+                                            const hipComplex*       beta,
+                                            hipComplex* const       C[],
+                                            int                     ldc,
+                                            int                     batchCount)
+try
+{
+    return hipblasGemmRealBatched<float>(handle,
+                                         true,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         (const void* const*)A,
+                                         lda,
+                                         (const void* const*)B,
+                                         ldb,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex* const*)C,
+                                         ldc,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealBBatched_v2(hipblasHandle_t               handle,
+                                            hipblasOperation_t            transa,
+                                            hipblasOperation_t            transb,
+                                            int                           m,
+                                            int                           n,
+                                            int                           k,
+                                            const hipDoubleComplex*       alpha,
+                                            const hipDoubleComplex* const A[],
+                                            int                           lda,
+                                            const double* const           B[],
+                                            int                           ldb,
+                                            const hipDoubleComplex*       beta,
+                                            hipDoubleComplex* const       C[],
+                                            int                           ldc,
+                                            int                           batchCount)
+try
+{
+    return hipblasGemmRealBatched<double>(handle,
+                                          true,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          (const void* const*)A,
+                                          lda,
+                                          (const void* const*)B,
+                                          ldb,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex* const*)C,
+                                          ldc,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealABatched_v2(hipblasHandle_t         handle,
+                                            hipblasOperation_t      transa,
+                                            hipblasOperation_t      transb,
+                                            int                     m,
+                                            int                     n,
+                                            int                     k,
+                                            const hipComplex*       alpha,
+                                            const float* const      A[],
+                                            int                     lda,
+                                            const hipComplex* const B[],
+                                            int                     ldb,
+                                            const hipComplex*       beta,
+                                            hipComplex* const       C[],
+                                            int                     ldc,
+                                            int                     batchCount)
+try
+{
+    return hipblasGemmRealBatched<float>(handle,
+                                         false,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         (const void* const*)A,
+                                         lda,
+                                         (const void* const*)B,
+                                         ldb,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex* const*)C,
+                                         ldc,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealABatched_v2(hipblasHandle_t               handle,
+                                            hipblasOperation_t            transa,
+                                            hipblasOperation_t            transb,
+                                            int                           m,
+                                            int                           n,
+                                            int                           k,
+                                            const hipDoubleComplex*       alpha,
+                                            const double* const           A[],
+                                            int                           lda,
+                                            const hipDoubleComplex* const B[],
+                                            int                           ldb,
+                                            const hipDoubleComplex*       beta,
+                                            hipDoubleComplex* const       C[],
+                                            int                           ldc,
+                                            int                           batchCount)
+try
+{
+    return hipblasGemmRealBatched<double>(handle,
+                                          false,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          (const void* const*)A,
+                                          lda,
+                                          (const void* const*)B,
+                                          ldb,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex* const*)C,
+                                          ldc,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealBStridedBatched(hipblasHandle_t       handle,
+                                                hipblasOperation_t    transa,
+                                                hipblasOperation_t    transb,
+                                                int                   m,
+                                                int                   n,
+                                                int                   k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* A,
+                                                int                   lda,
+                                                hipblasStride         strideA,
+                                                const float*          B,
+                                                int                   ldb,
+                                                hipblasStride         strideB,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       C,
+                                                int                   ldc,
+                                                hipblasStride         strideC,
+                                                int                   batchCount)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         true,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealBStridedBatched(hipblasHandle_t             handle,
+                                                hipblasOperation_t          transa,
+                                                hipblasOperation_t          transb,
+                                                int                         m,
+                                                int                         n,
+                                                int                         k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* A,
+                                                int                         lda,
+                                                hipblasStride               strideA,
+                                                const double*               B,
+                                                int                         ldb,
+                                                hipblasStride               strideB,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       C,
+                                                int                         ldc,
+                                                hipblasStride               strideC,
+                                                int                         batchCount)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          true,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealAStridedBatched(hipblasHandle_t       handle,
+                                                hipblasOperation_t    transa,
+                                                hipblasOperation_t    transb,
+                                                int                   m,
+                                                int                   n,
+                                                int                   k,
+                                                const hipblasComplex* alpha,
+                                                const float*          A,
+                                                int                   lda,
+                                                hipblasStride         strideA,
+                                                const hipblasComplex* B,
+                                                int                   ldb,
+                                                hipblasStride         strideB,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       C,
+                                                int                   ldc,
+                                                hipblasStride         strideC,
+                                                int                   batchCount)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         false,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealAStridedBatched(hipblasHandle_t             handle,
+                                                hipblasOperation_t          transa,
+                                                hipblasOperation_t          transb,
+                                                int                         m,
+                                                int                         n,
+                                                int                         k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const double*               A,
+                                                int                         lda,
+                                                hipblasStride               strideA,
+                                                const hipblasDoubleComplex* B,
+                                                int                         ldb,
+                                                hipblasStride               strideB,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       C,
+                                                int                         ldc,
+                                                hipblasStride               strideC,
+                                                int                         batchCount)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          false,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealBStridedBatched_v2(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const hipComplex*  alpha,
+                                                   const hipComplex*  A,
+                                                   int                lda,
+                                                   hipblasStride      strideA,
+                                                   const float*       B,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   const hipComplex*  beta,
+                                                   hipComplex*        C,
+                                                   int                ldc,
+                                                   hipblasStride      strideC,
+                                                   int                batchCount)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         true,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealBStridedBatched_v2(hipblasHandle_t         handle,
+                                                   hipblasOperation_t      transa,
+                                                   hipblasOperation_t      transb,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     k,
+                                                   const hipDoubleComplex* alpha,
+                                                   const hipDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipblasStride           strideA,
+                                                   const double*           B,
+                                                   int                     ldb,
+                                                   hipblasStride           strideB,
+                                                   const hipDoubleComplex* beta,
+                                                   hipDoubleComplex*       C,
+                                                   int                     ldc,
+                                                   hipblasStride           strideC,
+                                                   int                     batchCount)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          true,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCgemmRealAStridedBatched_v2(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const hipComplex*  alpha,
+                                                   const float*       A,
+                                                   int                lda,
+                                                   hipblasStride      strideA,
+                                                   const hipComplex*  B,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   const hipComplex*  beta,
+                                                   hipComplex*        C,
+                                                   int                ldc,
+                                                   hipblasStride      strideC,
+                                                   int                batchCount)
+try
+{
+    return hipblasGemmRealStrided<float>(handle,
+                                         false,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         (const rocblas_float_complex*)alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         (const rocblas_float_complex*)beta,
+                                         (rocblas_float_complex*)C,
+                                         ldc,
+                                         strideC,
+                                         batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZgemmRealAStridedBatched_v2(hipblasHandle_t         handle,
+                                                   hipblasOperation_t      transa,
+                                                   hipblasOperation_t      transb,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     k,
+                                                   const hipDoubleComplex* alpha,
+                                                   const double*           A,
+                                                   int                     lda,
+                                                   hipblasStride           strideA,
+                                                   const hipDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipblasStride           strideB,
+                                                   const hipDoubleComplex* beta,
+                                                   hipDoubleComplex*       C,
+                                                   int                     ldc,
+                                                   hipblasStride           strideC,
+                                                   int                     batchCount)
+try
+{
+    return hipblasGemmRealStrided<double>(handle,
+                                          false,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          (const rocblas_double_complex*)alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          (const rocblas_double_complex*)beta,
+                                          (rocblas_double_complex*)C,
+                                          ldc,
+                                          strideC,
+                                          batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * Split-K gemm_ex
+ ******************************************************************************/
+namespace
+{
+    // Upper bound on the split factor. A remainder of k adds one more partial result, so the
+    // ones vectors of the handle constants are one longer.
+    constexpr int c_split_k_max = c_handle_ones_length - 1;
+
+    // The heuristic keeps at least this much of k in every chunk
+    constexpr int c_split_k_min_chunk = 1024;
+
+    // The heuristic doesn't use more workspace than this for the partial results
+    constexpr size_t c_split_k_max_workspace = size_t(256) << 20;
+
+    size_t hipblasRocDatatypeSize(rocblas_datatype type)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+        case rocblas_datatype_bf16_r:
+            return 2;
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_i32_r:
+            return 4;
+        case rocblas_datatype_f64_r:
+        case rocblas_datatype_f32_c:
+            return 8;
+        case rocblas_datatype_f64_c:
+            return 16;
+        case rocblas_datatype_i8_r:
+            return 1;
+        default:
+            return 0;
+        }
+    }
+
+    // Stores the value v in the compute type, for scalars passed to rocblas_gemm_ex
+    void hipblasSetScalar(rocblas_datatype type, double v, rocblas_double_complex* scalar)
+    {
+        switch(type)
+        {
+        case rocblas_datatype_f32_r:
+            *(float*)scalar = float(v);
+            break;
+        case rocblas_datatype_f64_r:
+            *(double*)scalar = v;
+            break;
+        case rocblas_datatype_f32_c:
+            *(rocblas_float_complex*)scalar = rocblas_float_complex(float(v), 0);
+            break;
+        default:
+            *scalar = rocblas_double_complex(v, 0);
+            break;
+        }
+    }
+
+    struct hipblasSplitKEntry
+    {
+        int64_t m, n, k;
+        int     split_k;
+    };
+
+    const std::vector<hipblasSplitKEntry>& hipblasSplitKTuning()
+    {
+        static std::vector<hipblasSplitKEntry> entries;
+        static std::once_flag                  once;
+        std::call_once(once, [] {
+            const char* path = getenv("HIPBLAS_SPLIT_K_TUNING_FILE");
+            if(!path || !*path)
+                return;
+            std::ifstream file(path);
+            std::string   line;
+            while(std::getline(file, line))
+            {
+                std::istringstream is(line);
+                hipblasSplitKEntry entry;
+                if(line.empty() || line[0] == '#'
+                   || !(is >> entry.m >> entry.n >> entry.k >> entry.split_k))
+                    continue;
+                entries.push_back(entry);
+            }
+        });
+        return entries;
+    }
+
+    int hipblasChooseSplitK(hipblasHandle_t handle, int m, int n, int k, size_t compute_size)
+    {
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        if(state && state->gemm_split_k > 0)
+            return std::min(state->gemm_split_k, k);
+
+        const hipblasSplitKEntry* best = nullptr;
+        for(const auto& entry : hipblasSplitKTuning())
+            if(entry.m == m && entry.n == n && entry.k <= k && (!best || entry.k > best->k))
+                best = &entry;
+        if(best)
+            return std::max(1, std::min(best->split_k, k));
+
+        // enough chunks to give every compute unit a macro tile
+        int device = 0, cu_count = 0;
+        if(hipGetDevice(&device) != hipSuccess
+           || hipDeviceGetAttribute(&cu_count, hipDeviceAttributeMultiprocessorCount, device)
+                  != hipSuccess)
+            return 1;
+
+        constexpr int64_t tile  = 128;
+        int64_t           tiles = ((m + tile - 1) / tile) * ((n + tile - 1) / tile);
+        int64_t           split = cu_count / tiles;
+        split = std::min<int64_t>(split, k / c_split_k_min_chunk);
+        split = std::min<int64_t>(split, c_split_k_max_workspace / (size_t(m) * n * compute_size));
+        return int(std::max<int64_t>(split, 1));
+    }
+
+    // ones vector of the compute type in the handle constants, used to sum the partial results
+    const void* hipblasSplitKOnes(const hipblasHandleConstants* constants,
+                                  rocblas_datatype              compute_type)
+    {
+        switch(compute_type)
+        {
+        case rocblas_datatype_f32_r:
+            return constants->ones_f32;
+        case rocblas_datatype_f64_r:
+            return constants->ones_f64;
+        case rocblas_datatype_f32_c:
+            return constants->ones_c32;
+        default:
+            return constants->ones_c64;
+        }
+    }
+
+    // Computes C = alpha * op(A) * op(B) + beta * C with k split into chunks. Returns false if
+    // the standard algorithm should be used, which is the case for invalid arguments too.
+    bool hipblasGemmExSplitK(hipblasHandle_t    handle,
+                             rocblas_operation  transa,
+                             rocblas_operation  transb,
+                             int                m,
+                             int                n,
+                             int                k,
+                             const void*        alpha,
+                             const void*        A,
+                             rocblas_datatype   a_type,
+                             int                lda,
+                             const void*        B,
+                             rocblas_datatype   b_type,
+                             int                ldb,
+                             const void*        beta,
+                             void*              C,
+                             rocblas_datatype   c_type,
+                             int                ldc,
+                             rocblas_datatype   compute_type,
+                             rocblas_gemm_flags flags,
+                             hipblasStatus_t*   status)
+    {
+        // partial results are summed in the compute precision directly into C
+        if(!handle || c_type != compute_type
+           || (compute_type != rocblas_datatype_f32_r && compute_type != rocblas_datatype_f64_r
+               && compute_type != rocblas_datatype_f32_c && compute_type != rocblas_datatype_f64_c))
+            return false;
+        if(m <= 0 || n <= 0 || k <= 1 || !alpha || !beta || !A || !B || !C || ldc < m
+           || lda < (transa == rocblas_operation_none ? m : k)
+           || ldb < (transb == rocblas_operation_none ? k : n) || size_t(m) * n > INT_MAX)
+            return false;
+
+        size_t compute_size = hipblasRocDatatypeSize(compute_type);
+        int    split_k
+            = std::min(hipblasChooseSplitK(handle, m, n, k, compute_size), c_split_k_max);
+        if(split_k < 2)
+            return false;
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        int            chunk   = k / split_k;
+        int            rem     = k - chunk * split_k;
+        int            parts   = split_k + (rem ? 1 : 0);
+        int            mn      = m * n;
+
+        // k advances along columns of A for op(A) = A and along rows otherwise
+        hipblasStride stride_a
+            = transa == rocblas_operation_none ? hipblasStride(chunk) * lda : chunk;
+        hipblasStride stride_b
+            = transb == rocblas_operation_none ? chunk : hipblasStride(chunk) * ldb;
+
+        hipblasHandleState* state        = hipblasGetHandleState(handle, true);
+        size_t              partial_size = size_t(parts) * mn * compute_size;
+
+        // the constants are taken after the workspace, which may move them
+        void*       partial   = hipblasGetHandleWorkspace(handle, state, partial_size);
+        const auto* constants = hipblasGetHandleConstants(handle, state);
+        const void* ones      = hipblasSplitKOnes(constants, compute_type);
+
+        rocblas_double_complex one, zero;
+        hipblasSetScalar(compute_type, 1.0, &one);
+        hipblasSetScalar(compute_type, 0.0, &zero);
+
+        // the partial products use host scalars, the reduction uses the caller's alpha and beta
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+
+        *status = HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocblas_gemm_strided_batched_ex(rhandle,
+                                                                 transa,
+                                                                 transb,
+                                                                 m,
+                                                                 n,
+                                                                 chunk,
+                                                                 &one,
+                                                                 A,
+                                                                 a_type,
+                                                                 lda,
+                                                                 stride_a,
+                                                                 B,
+                                                                 b_type,
+                                                                 ldb,
+                                                                 stride_b,
+                                                                 &zero,
+                                                                 partial,
+                                                                 compute_type,
+                                                                 m,
+                                                                 mn,
+                                                                 partial,
+                                                                 compute_type,
+                                                                 m,
+                                                                 mn,
+                                                                 split_k,
+                                                                 compute_type,
+                                                                 rocblas_gemm_algo_standard,
+                                                                 0,
+                                                                 flags)));
+
+        // the remainder of k which doesn't divide evenly goes into its own partial result
+        if(*status == HIPBLAS_STATUS_SUCCESS && rem)
+        {
+            const char* A_rem = (const char*)A
+                                + split_k * stride_a * hipblasRocDatatypeSize(a_type);
+            const char* B_rem = (const char*)B
+                                + split_k * stride_b * hipblasRocDatatypeSize(b_type);
+            *status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_ex(rhandle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     rem,
+                                                     &one,
+                                                     A_rem,
+                                                     a_type,
+                                                     lda,
+                                                     B_rem,
+                                                     b_type,
+                                                     ldb,
+                                                     &zero,
+                                                     (char*)partial + size_t(split_k) * mn * compute_size,
+                                                     compute_type,
+                                                     m,
+                                                     (char*)partial + size_t(split_k) * mn * compute_size,
+                                                     compute_type,
+                                                     m,
+                                                     compute_type,
+                                                     rocblas_gemm_algo_standard,
+                                                     0,
+                                                     flags)));
+        }
+
+        rocblas_set_pointer_mode(rhandle, mode);
+        if(*status != HIPBLAS_STATUS_SUCCESS)
+            return true;
+
+        // C = alpha * [P_0 ... P_parts-1] * ones + beta * C, with P_i viewed as vectors of length m * n
+        if(ldc == m)
+        {
+            *status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_ex(rhandle,
+                                                     rocblas_operation_none,
+                                                     rocblas_operation_none,
+                                                     mn,
+                                                     1,
+                                                     parts,
+                                                     alpha,
+                                                     partial,
+                                                     compute_type,
+                                                     mn,
+                                                     ones,
+                                                     compute_type,
+                                                     parts,
+                                                     beta,
+                                                     C,
+                                                     c_type,
+                                                     mn,
+                                                     C,
+                                                     c_type,
+                                                     mn,
+                                                     compute_type,
+                                                     rocblas_gemm_algo_standard,
+                                                     0,
+                                                     flags)));
+        }
+        else
+        {
+            // one column of C per batch
+            *status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_strided_batched_ex(rhandle,
+                                                                     rocblas_operation_none,
+                                                                     rocblas_operation_none,
+                                                                     m,
+                                                                     1,
+                                                                     parts,
+                                                                     alpha,
+                                                                     partial,
+                                                                     compute_type,
+                                                                     mn,
+                                                                     m,
+                                                                     ones,
+                                                                     compute_type,
+                                                                     parts,
+                                                                     0,
+                                                                     beta,
+                                                                     C,
+                                                                     c_type,
+                                                                     ldc,
+                                                                     ldc,
+                                                                     C,
+                                                                     c_type,
+                                                                     ldc,
+                                                                     ldc,
+                                                                     n,
+                                                                     compute_type,
+                                                                     rocblas_gemm_algo_standard,
+                                                                     0,
+                                                                     flags)));
+        }
+        return true;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasSetGemmSplitK(hipblasHandle_t handle, int splitK)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(splitK < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, splitK != 0);
+    if(state)
+        state->gemm_split_k = splitK;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmSplitK(hipblasHandle_t handle, int* splitK)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(splitK == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, false);
+    *splitK                   = state ? state->gemm_split_k : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * Emulated gemm_ex
+ *
+ * HIPBLAS_COMPUTE_32F_EMULATED_16BF splits op(A) and op(B) into bfloat16 slices
+ * on the device and accumulates the bfloat16 gemm_ex products of the slices
+ * into C. A bfloat16 is the upper half of a float, so a float matrix read as
+ * bfloat16 elements two apart is the matrix truncated to bfloat16. Every slice
+ * is such a read, packed by a gemm_ex product one * X with k = 1, and is then
+ * subtracted from the float remainder by a second product. Both are exact, and
+ * three slices hold all 24 bits of the mantissa.
+ ******************************************************************************/
+namespace
+{
+    constexpr int c_emulation_default_slices = 2;
+    constexpr int c_emulation_max_slices     = 3;
+
+    bool hipblasIsEmulatedComputeType(hipblasComputeType_t compute_type)
+    {
+        return compute_type == HIPBLAS_COMPUTE_32F_EMULATED_16BF;
+    }
+
+    // Compute type used for the calls the emulation leaves to the native gemm
+    hipblasComputeType_t hipblasNativeComputeType(hipblasComputeType_t compute_type)
+    {
+        return hipblasIsEmulatedComputeType(compute_type) ? HIPBLAS_COMPUTE_32F : compute_type;
+    }
+
+    int hipblasGetEmulationSlices(hipblasHandle_t handle)
+    {
+        hipblasHandleState* state = hipblasGetHandleState(handle, false);
+        return state && state->gemm_emulation_slices ? state->gemm_emulation_slices
+                                                     : c_emulation_default_slices;
+    }
+
+    // Y = alpha * one * X + beta * Y for the 1 by len rows X and Y, with elements inc_x apart in X,
+    // computed in float. The caller sets the host pointer mode.
+    rocblas_status hipblasEmulationRowGemm(rocblas_handle   handle,
+                                           const void*      one_bf16,
+                                           int              len,
+                                           float            alpha,
+                                           const void*      X,
+                                           int              inc_x,
+                                           float            beta,
+                                           void*            Y,
+                                           rocblas_datatype y_type)
+    {
+        return rocblas_gemm_ex(handle,
+                               rocblas_operation_none,
+                               rocblas_operation_none,
+                               1,
+                               len,
+                               1,
+                               &alpha,
+                               one_bf16,
+                               rocblas_datatype_bf16_r,
+                               1,
+                               X,
+                               rocblas_datatype_bf16_r,
+                               inc_x,
+                               &beta,
+                               Y,
+                               y_type,
+                               1,
+                               Y,
+                               y_type,
+                               1,
+                               rocblas_datatype_f32_r,
+                               rocblas_gemm_algo_standard,
+                               0,
+                               rocblas_gemm_flags_none);
+    }
+
+    // Splits the size floats of R into the bfloat16 slices S_0 ... S_{slices-1}, stored one after
+    // the other, such that R = S_0 + ... + S_{slices-1} up to the remainder left in R. The caller
+    // sets the host pointer mode.
+    hipblasStatus_t hipblasSlice16bf(hipblasHandle_t handle,
+                                     const void*     one_bf16,
+                                     float*          R,
+                                     int             size,
+                                     int             slices,
+                                     uint16_t*       S)
+    {
+        rocblas_handle rhandle = (rocblas_handle)handle;
+
+        // the upper half of every float of R, on the little-endian device
+        const uint16_t* R_high = (const uint16_t*)R + 1;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int t = 0; t < slices && status == HIPBLAS_STATUS_SUCCESS; t++)
+        {
+            uint16_t* S_t = S + size_t(t) * size;
+            status        = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(hipblasEmulationRowGemm(
+                rhandle, one_bf16, size, 1.0f, R_high, 2, 0.0f, S_t, rocblas_datatype_bf16_r)));
+            if(status == HIPBLAS_STATUS_SUCCESS && t + 1 < slices)
+                status = HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(hipblasEmulationRowGemm(
+                    rhandle, one_bf16, size, -1.0f, S_t, 1, 1.0f, R, rocblas_datatype_f32_r)));
+        }
+        return status;
+    }
+
+    // R = op(X) for the rows by cols matrix op(X), packed. The caller sets the host pointer mode.
+    hipblasStatus_t hipblasEmulationPackOp(hipblasHandle_t   handle,
+                                           rocblas_operation trans,
+                                           int               rows,
+                                           int               cols,
+                                           const float*      X,
+                                           int               ldx,
+                                           float*            R)
+    {
+        static const float one = 1.0f, zero = 0.0f;
+
+        // beta is zero, so X is passed again for B
+        return HIPBLAS_DEMAND_ALLOC(hipblasConvertStatus(rocblas_sgeam((rocblas_handle)handle,
+                                                                       trans,
+                                                                       trans,
+                                                                       rows,
+                                                                       cols,
+                                                                       &one,
+                                                                       X,
+                                                                       ldx,
+                                                                       &zero,
+                                                                       X,
+                                                                       ldx,
+                                                                       R,
+                                                                       rows)));
+    }
+
+    // Computes C = alpha * op(A) * op(B) + beta * C with an emulated compute type. Returns false if
+    // the native gemm should be used, which is the case for invalid arguments too.
+    bool hipblasGemmExEmulated(hipblasHandle_t   handle,
+                               rocblas_operation transa,
+                               rocblas_operation transb,
+                               int               m,
+                               int               n,
+                               int               k,
+                               const void*       alpha,
+                               const void*       A,
+                               hipDataType       a_type,
+                               int               lda,
+                               const void*       B,
+                               hipDataType       b_type,
+                               int               ldb,
+                               const void*       beta,
+                               void*             C,
+                               hipDataType       c_type,
+                               int               ldc,
+                               hipblasStatus_t*  status)
+    {
+        if(!handle || a_type != HIP_R_32F || b_type != HIP_R_32F || c_type != HIP_R_32F)
+            return false;
+        if(m <= 0 || n <= 0 || k <= 0 || !alpha || !beta || !A || !B || !C || ldc < m
+           || lda < (transa == rocblas_operation_none ? m : k)
+           || ldb < (transb == rocblas_operation_none ? k : n) || int64_t(m) * k > INT_MAX
+           || int64_t(k) * n > INT_MAX)
+            return false;
+
+        rocblas_handle       rhandle = (rocblas_handle)handle;
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        if(mode == rocblas_pointer_mode_host && *(const float*)alpha == 0)
+            return false;
+
+        int    slices = hipblasGetEmulationSlices(handle);
+        size_t a_size = size_t(m) * k;
+        size_t b_size = size_t(k) * n;
+        size_t bytes  = (sizeof(float) + sizeof(uint16_t) * slices) * (a_size + b_size);
+
+        // the remainders of op(A) and op(B) in float, followed by their slices. The constants are
+        // taken after the workspace, which may move them.
+        hipblasHandleState* state     = hipblasGetHandleState(handle, true);
+        float*              R_a       = (float*)hipblasGetHandleWorkspace(handle, state, bytes);
+        float*              R_b       = R_a + a_size;
+        uint16_t*           S_a       = (uint16_t*)(R_b + b_size);
+        uint16_t*           S_b       = S_a + a_size * slices;
+        const auto*         constants = hipblasGetHandleConstants(handle, state);
+
+        rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+        *status = hipblasEmulationPackOp(handle, transa, m, k, (const float*)A, lda, R_a);
+        if(*status == HIPBLAS_STATUS_SUCCESS)
+            *status = hipblasEmulationPackOp(handle, transb, k, n, (const float*)B, ldb, R_b);
+        if(*status == HIPBLAS_STATUS_SUCCESS)
+            *status = hipblasSlice16bf(handle, &constants->one_bf16, R_a, int(a_size), slices, S_a);
+        if(*status == HIPBLAS_STATUS_SUCCESS)
+            *status = hipblasSlice16bf(handle, &constants->one_bf16, R_b, int(b_size), slices, S_b);
+        rocblas_set_pointer_mode(rhandle, mode);
+
+        // the products of slices t and u with t + u < slices, smallest first. The first applies
+        // beta and the others add to C, with one in the pointer mode of the caller.
+        static const float one_host = 1.0f;
+        const float* one   = mode == rocblas_pointer_mode_host ? &one_host : constants->ones_f32;
+        bool         first = true;
+        for(int d = slices - 1; d >= 0 && *status == HIPBLAS_STATUS_SUCCESS; d--)
+        {
+            for(int t = 0; t <= d && *status == HIPBLAS_STATUS_SUCCESS; t++)
+            {
+                *status = HIPBLAS_DEMAND_ALLOC(
+                    hipblasConvertStatus(rocblas_gemm_ex(rhandle,
+                                                         rocblas_operation_none,
+                                                         rocblas_operation_none,
+                                                         m,
+                                                         n,
+                                                         k,
+                                                         alpha,
+                                                         S_a + a_size * t,
+                                                         rocblas_datatype_bf16_r,
+                                                         m,
+                                                         S_b + b_size * (d - t),
+                                                         rocblas_datatype_bf16_r,
+                                                         k,
+                                                         first ? beta : one,
+                                                         C,
+                                                         rocblas_datatype_f32_r,
+                                                         ldc,
+                                                         C,
+                                                         rocblas_datatype_f32_r,
+                                                         ldc,
+                                                         rocblas_datatype_f32_r,
+                                                         rocblas_gemm_algo_standard,
+                                                         0,
+                                                         rocblas_gemm_flags_none)));
+                first = false;
+            }
+        }
+        return true;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasSetGemmEmulationSlices(hipblasHandle_t handle, int slices)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(slices < 0 || slices > c_emulation_max_slices)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, slices != 0);
+    if(state)
+        state->gemm_emulation_slices = slices;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGetGemmEmulationSlices(hipblasHandle_t handle, int* slices)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(slices == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandleState* state = hipblasGetHandleState(handle, false);
+    *slices                   = state ? state->gemm_emulation_slices : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * Warm-up
+ ******************************************************************************/
+namespace
+{
+    // Leading dimensions, strides and sizes in bytes of the matrices of a warm-up problem
+    struct hipblasWarmupShape
+    {
+        int           lda, ldb, ldc;
+        hipblasStride stride_A, stride_B, stride_C;
+        int           batch_count;
+        size_t        bytes_A, bytes_B, bytes_C;
+    };
+
+    // keeps the matrices of a problem at the alignment of hipMalloc
+    constexpr size_t c_warmup_alignment = 256;
+
+    size_t hipblasWarmupAlign(size_t bytes)
+    {
+        return (bytes + c_warmup_alignment - 1) / c_warmup_alignment * c_warmup_alignment;
+    }
+
+    bool hipblasIsWarmupOperation(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    hipblasStatus_t hipblasWarmupShapeOf(const hipblasWarmupDescriptor_t& desc,
+                                         hipblasWarmupShape&              shape)
+    {
+        bool batched = desc.routine == HIPBLAS_WARMUP_GEMM_STRIDED_BATCHED;
+        if((!batched && desc.routine != HIPBLAS_WARMUP_GEMM)
+           || !hipblasIsWarmupOperation(desc.transA) || !hipblasIsWarmupOperation(desc.transB))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(desc.m < 0 || desc.n < 0 || desc.k < 0 || (batched && desc.batchCount < 0))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        size_t a_size = hipblasDatatypeSize(desc.aType);
+        size_t b_size = hipblasDatatypeSize(desc.bType);
+        size_t c_size = hipblasDatatypeSize(desc.cType);
+        if(!a_size || !b_size || !c_size)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        bool a_none = desc.transA == HIPBLAS_OP_N;
+        bool b_none = desc.transB == HIPBLAS_OP_N;
+
+        shape.lda         = std::max(1, a_none ? desc.m : desc.k);
+        shape.ldb         = std::max(1, b_none ? desc.k : desc.n);
+        // C fits the problem in HIPBLAS_GEMM_ORDER_TRANSPOSED_C mode too, where gemm stores C^T
+        shape.ldc         = std::max({1, desc.m, desc.n});
+        shape.stride_A    = hipblasStride(shape.lda) * (a_none ? desc.k : desc.m);
+        shape.stride_B    = hipblasStride(shape.ldb) * (b_none ? desc.n : desc.k);
+        shape.stride_C    = hipblasStride(shape.ldc) * std::max(desc.m, desc.n);
+        shape.batch_count = batched ? desc.batchCount : 1;
+        shape.bytes_A     = hipblasWarmupAlign(size_t(shape.stride_A) * shape.batch_count * a_size);
+        shape.bytes_B     = hipblasWarmupAlign(size_t(shape.stride_B) * shape.batch_count * b_size);
+        shape.bytes_C     = hipblasWarmupAlign(size_t(shape.stride_C) * shape.batch_count * c_size);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Host scalar 1 of the compute type, with a zero imaginary part for complex gemms
+    void hipblasWarmupOne(hipblasComputeType_t compute_type, double (&one)[2])
+    {
+        one[0] = one[1] = 0;
+        switch(hipblasNativeComputeType(compute_type))
+        {
+        case HIPBLAS_COMPUTE_16F:
+        {
+            uint16_t half_one = 0x3C00;
+            std::memcpy(one, &half_one, sizeof(half_one));
+            break;
+        }
+        case HIPBLAS_COMPUTE_32I:
+        {
+            int32_t int_one = 1;
+            std::memcpy(one, &int_one, sizeof(int_one));
+            break;
+        }
+        case HIPBLAS_COMPUTE_64F:
+            one[0] = 1;
+            break;
+        default:
+        {
+            float float_one = 1;
+            std::memcpy(one, &float_one, sizeof(float_one));
+            break;
+        }
+        }
+    }
+
+    // Runs the problem of desc on the zero filled matrices at workspace, with alpha = 1 and beta = 0
+    hipblasStatus_t hipblasWarmupRun(hipblasHandle_t                  handle,
+                                     const hipblasWarmupDescriptor_t& desc,
+                                     const hipblasWarmupShape&        shape,
+                                     char*                            workspace)
+    {
+        double one[2], zero[2] = {0, 0};
+        hipblasWarmupOne(desc.computeType, one);
+
+        void* A = workspace;
+        void* B = workspace + shape.bytes_A;
+        void* C = workspace + shape.bytes_A + shape.bytes_B;
+
+        if(desc.routine == HIPBLAS_WARMUP_GEMM)
+            return hipblasGemmEx_v2(handle,
+                                    desc.transA,
+                                    desc.transB,
+                                    desc.m,
+                                    desc.n,
+                                    desc.k,
+                                    one,
+                                    A,
+                                    desc.aType,
+                                    shape.lda,
+                                    B,
+                                    desc.bType,
+                                    shape.ldb,
+                                    zero,
+                                    C,
+                                    desc.cType,
+                                    shape.ldc,
+                                    desc.computeType,
+                                    HIPBLAS_GEMM_DEFAULT);
+
+        return hipblasGemmStridedBatchedEx_v2(handle,
+                                              desc.transA,
+                                              desc.transB,
+                                              desc.m,
+                                              desc.n,
+                                              desc.k,
+                                              one,
+                                              A,
+                                              desc.aType,
+                                              shape.lda,
+                                              shape.stride_A,
+                                              B,
+                                              desc.bType,
+                                              shape.ldb,
+                                              shape.stride_B,
+                                              zero,
+                                              C,
+                                              desc.cType,
+                                              shape.ldc,
+                                              shape.stride_C,
+                                              shape.batch_count,
+                                              desc.computeType,
+                                              HIPBLAS_GEMM_DEFAULT);
+    }
+
+    // Device memory of a call of hipblasWarmup. It isn't taken from the workspace of the handle,
+    // which the emulated compute type uses for its slices.
+    struct hipblasWarmupBuffer
+    {
+        void* ptr = nullptr;
+
+        ~hipblasWarmupBuffer()
+        {
+            if(ptr)
+                (void)hipFree(ptr);
+        }
+    };
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t
+    hipblasWarmup(hipblasHandle_t handle, hipblasWarmupDescriptor_t* descriptors, int count)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(count < 0 || (count > 0 && descriptors == nullptr))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // loads the code objects of rocBLAS, which the first call of the process would load otherwise
+    static std::once_flag once;
+    std::call_once(once, rocblas_initialize);
+
+    std::vector<hipblasWarmupShape> shapes(count);
+    size_t                          bytes = 0;
+    for(int i = 0; i < count; i++)
+    {
+        hipblasWarmupDescriptor_t& desc = descriptors[i];
+
+        desc.time_us = 0;
+        desc.status  = hipblasWarmupShapeOf(desc, shapes[i]);
+        if(desc.status == HIPBLAS_STATUS_SUCCESS)
+            bytes = std::max(bytes, shapes[i].bytes_A + shapes[i].bytes_B + shapes[i].bytes_C);
+    }
+
+    hipStream_t stream;
+    rocblas_get_stream((rocblas_handle)handle, &stream);
+
+    hipblasWarmupBuffer workspace;
+    hipblasStatus_t     status = HIPBLAS_STATUS_SUCCESS;
+    if(bytes && hipMalloc(&workspace.ptr, bytes) != hipSuccess)
+    {
+        workspace.ptr = nullptr;
+        status        = HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    else if((bytes && hipMemsetAsync(workspace.ptr, 0, bytes, stream) != hipSuccess)
+            || hipStreamSynchronize(stream) != hipSuccess)
+    {
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    rocblas_pointer_mode mode;
+    rocblas_get_pointer_mode((rocblas_handle)handle, &mode);
+    rocblas_set_pointer_mode((rocblas_handle)handle, rocblas_pointer_mode_host);
+
+    hipblasStatus_t first_failure = HIPBLAS_STATUS_SUCCESS;
+    for(int i = 0; i < count; i++)
+    {
+        hipblasWarmupDescriptor_t& desc = descriptors[i];
+        if(desc.status == HIPBLAS_STATUS_SUCCESS && status != HIPBLAS_STATUS_SUCCESS)
+            desc.status = status;
+
+        if(desc.status == HIPBLAS_STATUS_SUCCESS)
+        {
+            auto start  = std::chrono::steady_clock::now();
+            desc.status = hipblasWarmupRun(handle, desc, shapes[i], (char*)workspace.ptr);
+            if(hipStreamSynchronize(stream) != hipSuccess && desc.status == HIPBLAS_STATUS_SUCCESS)
+                desc.status = HIPBLAS_STATUS_EXECUTION_FAILED;
+            desc.time_us = std::chrono::duration<double, std::micro>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+        }
+
+        if(first_failure == HIPBLAS_STATUS_SUCCESS)
+            first_failure = desc.status;
+    }
+
+    rocblas_set_pointer_mode((rocblas_handle)handle, mode);
+    return first_failure;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
 // gemm_ex
 hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasOperation_t transa,
@@ -51254,9 +61266,76 @@ hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasGemmAlgo_t  algo)
 try
 {
+    hipblasStatus_t status
+        = hipblasGemmExApplyOrder(handle,
+                                  hipblasIsComplexDatatype(hipblasConvertDatatype(a_type)),
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  A,
+                                  a_type,
+                                  lda,
+                                  B,
+                                  b_type,
+                                  ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
     int32_t            solution_index = 0;
     rocblas_gemm_flags flags          = rocblas_gemm_flags_none;
 
+    if(algo == HIPBLAS_GEMM_SPLIT_K)
+    {
+        hipblasStatus_t status;
+        if(hipblasGemmExSplitK(handle,
+                               hipblasConvertOperation(transa),
+                               hipblasConvertOperation(transb),
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               hipblasConvertDatatype(a_type),
+                               lda,
+                               B,
+                               hipblasConvertDatatype(b_type),
+                               ldb,
+                               beta,
+                               C,
+                               hipblasConvertDatatype(c_type),
+                               ldc,
+                               hipblasConvertDatatype(compute_type),
+                               flags,
+                               &status))
+            return status;
+    }
+
+    if(algo == HIPBLAS_GEMM_STRASSEN)
+    {
+        hipblasStatus_t status;
+        if(hipblasGemmExStrassen(handle,
+                                 hipblasConvertOperation(transa),
+                                 hipblasConvertOperation(transb),
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 hipblasConvertDatatype(a_type),
+                                 lda,
+                                 B,
+                                 hipblasConvertDatatype(b_type),
+                                 ldb,
+                                 beta,
+                                 C,
+                                 hipblasConvertDatatype(c_type),
+                                 ldc,
+                                 hipblasConvertDatatype(compute_type),
+                                 &status))
+            return status;
+    }
+
     return hipblasConvertStatus(rocblas_gemm_ex((rocblas_handle)handle,
                                                 hipblasConvertOperation(transa),
                                                 hipblasConvertOperation(transb),
@@ -51386,6 +61465,31 @@ hipblasStatus_t hipblasGemmEx_v2(hipblasHandle_t      handle,
                                  hipblasGemmAlgo_t    algo)
 try
 {
+    if(hipblasIsEmulatedComputeType(compute_type))
+    {
+        hipblasStatus_t status;
+        if(hipblasGemmExEmulated(handle,
+                                 hipblasConvertOperation(transa),
+                                 hipblasConvertOperation(transb),
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 a_type,
+                                 lda,
+                                 B,
+                                 b_type,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 c_type,
+                                 ldc,
+                                 &status))
+            return status;
+        compute_type = hipblasNativeComputeType(compute_type);
+    }
+
     // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
     // individually, can be changed with rocBLAS if/when related changes happen there.
 
@@ -51399,6 +61503,70 @@ try
     if(status != HIPBLAS_STATUS_SUCCESS)
         return status;
 
+    status = hipblasGemmExApplyOrder(handle,
+                                     hipblasIsComplexDatatype(a_type_roc),
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     A,
+                                     a_type_roc,
+                                     lda,
+                                     B,
+                                     b_type_roc,
+                                     ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(algo == HIPBLAS_GEMM_SPLIT_K)
+    {
+        if(hipblasGemmExSplitK(handle,
+                               hipblasConvertOperation(transa),
+                               hipblasConvertOperation(transb),
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               a_type_roc,
+                               lda,
+                               B,
+                               b_type_roc,
+                               ldb,
+                               beta,
+                               C,
+                               c_type_roc,
+                               ldc,
+                               compute_type_roc,
+                               flags,
+                               &status))
+            return status;
+    }
+
+    if(algo == HIPBLAS_GEMM_STRASSEN)
+    {
+        if(hipblasGemmExStrassen(handle,
+                                 hipblasConvertOperation(transa),
+                                 hipblasConvertOperation(transb),
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 a_type_roc,
+                                 lda,
+                                 B,
+                                 b_type_roc,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 c_type_roc,
+                                 ldc,
+                                 compute_type_roc,
+                                 &status))
+            return status;
+    }
+
     return hipblasConvertStatus(rocblas_gemm_ex((rocblas_handle)handle,
                                                 hipblasConvertOperation(transa),
                                                 hipblasConvertOperation(transb),
@@ -51451,8 +61619,75 @@ hipblasStatus_t hipblasGemmExWithFlags(hipblasHandle_t    handle,
                                        hipblasGemmFlags_t flags)
 try
 {
+    hipblasStatus_t status
+        = hipblasGemmExApplyOrder(handle,
+                                  hipblasIsComplexDatatype(hipblasConvertDatatype(a_type)),
+                                  transa,
+                                  transb,
+                                  m,
+                                  n,
+                                  A,
+                                  a_type,
+                                  lda,
+                                  B,
+                                  b_type,
+                                  ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
     int32_t solution_index = 0;
 
+    if(algo == HIPBLAS_GEMM_SPLIT_K)
+    {
+        hipblasStatus_t status;
+        if(hipblasGemmExSplitK(handle,
+                               hipblasConvertOperation(transa),
+                               hipblasConvertOperation(transb),
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               hipblasConvertDatatype(a_type),
+                               lda,
+                               B,
+                               hipblasConvertDatatype(b_type),
+                               ldb,
+                               beta,
+                               C,
+                               hipblasConvertDatatype(c_type),
+                               ldc,
+                               hipblasConvertDatatype(compute_type),
+                               hipblasConvertGemmFlags(flags),
+                               &status))
+            return status;
+    }
+
+    if(algo == HIPBLAS_GEMM_STRASSEN)
+    {
+        hipblasStatus_t status;
+        if(hipblasGemmExStrassen(handle,
+                                 hipblasConvertOperation(transa),
+                                 hipblasConvertOperation(transb),
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 hipblasConvertDatatype(a_type),
+                                 lda,
+                                 B,
+                                 hipblasConvertDatatype(b_type),
+                                 ldb,
+                                 beta,
+                                 C,
+                                 hipblasConvertDatatype(c_type),
+                                 ldc,
+                                 hipblasConvertDatatype(compute_type),
+                                 &status))
+            return status;
+    }
+
     return hipblasConvertStatus(rocblas_gemm_ex((rocblas_handle)handle,
                                                 hipblasConvertOperation(transa),
                                                 hipblasConvertOperation(transb),
@@ -51505,6 +61740,31 @@ hipblasStatus_t hipblasGemmExWithFlags_v2(hipblasHandle_t      handle,
                                           hipblasGemmFlags_t   flags)
 try
 {
+    if(hipblasIsEmulatedComputeType(compute_type))
+    {
+        hipblasStatus_t status;
+        if(hipblasGemmExEmulated(handle,
+                                 hipblasConvertOperation(transa),
+                                 hipblasConvertOperation(transb),
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 a_type,
+                                 lda,
+                                 B,
+                                 b_type,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 c_type,
+                                 ldc,
+                                 &status))
+            return status;
+        compute_type = hipblasNativeComputeType(compute_type);
+    }
+
     // Not necessarily a 1-to-1 mapping between hipblasComputeType_t and rocblas_datatype, so handling supported cases
     // individually, can be changed with rocBLAS if/when related changes happen there.
 
@@ -51516,6 +61776,70 @@ try
     if(status != HIPBLAS_STATUS_SUCCESS)
         return status;
 
+    status = hipblasGemmExApplyOrder(handle,
+                                     hipblasIsComplexDatatype(a_type_roc),
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     A,
+                                     a_type_roc,
+                                     lda,
+                                     B,
+                                     b_type_roc,
+                                     ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(algo == HIPBLAS_GEMM_SPLIT_K)
+    {
+        if(hipblasGemmExSplitK(handle,
+                               hipblasConvertOperation(transa),
+                               hipblasConvertOperation(transb),
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               a_type_roc,
+                               lda,
+                               B,
+                               b_type_roc,
+                               ldb,
+                               beta,
+                               C,
+                               c_type_roc,
+                               ldc,
+                               compute_type_roc,
+                               hipblasConvertGemmFlags(flags),
+                               &status))
+            return status;
+    }
+
+    if(algo == HIPBLAS_GEMM_STRASSEN)
+    {
+        if(hipblasGemmExStrassen(handle,
+                                 hipblasConvertOperation(transa),
+                                 hipblasConvertOperation(transb),
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 A,
+                                 a_type_roc,
+                                 lda,
+                                 B,
+                                 b_type_roc,
+                                 ldb,
+                                 beta,
+                                 C,
+                                 c_type_roc,
+                                 ldc,
+                                 compute_type_roc,
+                                 &status))
+            return status;
+    }
+
     return hipblasConvertStatus(rocblas_gemm_ex((rocblas_handle)handle,
                                                 hipblasConvertOperation(transa),
                                                 hipblasConvertOperation(transb),
@@ -52814,6 +63138,1145 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+} // extern "C"
+
+/*******************************************************************************
+ * Batched-reduce gemm_ex
+ ******************************************************************************/
+namespace
+{
+    // One in the compute type. Kept in static storage as it's the source of an asynchronous
+    // copy when the pointer mode is device.
+    const void* hipblasReduceOne(rocblas_datatype type)
+    {
+        static const float    one_f32[2] = {1.0f, 0.0f};
+        static const double   one_f64[2] = {1.0, 0.0};
+        static const int32_t  one_i32    = 1;
+        static const uint16_t one_f16    = 0x3c00;
+
+        switch(type)
+        {
+        case rocblas_datatype_f16_r:
+            return &one_f16;
+        case rocblas_datatype_i32_r:
+            return &one_i32;
+        case rocblas_datatype_f32_r:
+        case rocblas_datatype_f32_c:
+            return one_f32;
+        default:
+            return one_f64;
+        }
+    }
+
+    // True if the A_i placed one after the other form an m by k * batch_count matrix op(A)
+    // with leading dimension lda, and the B_i a k * batch_count by n matrix op(B) with ldb
+    bool hipblasReduceConcatenates(rocblas_operation transa,
+                                   rocblas_operation transb,
+                                   int               k,
+                                   int               lda,
+                                   hipblasStride     stride_a,
+                                   int               ldb,
+                                   hipblasStride     stride_b,
+                                   int               batch_count)
+    {
+        int64_t k_total = int64_t(k) * batch_count;
+        if(k_total > INT_MAX)
+            return false;
+
+        // k advances along columns of A for op(A) = A and along rows otherwise
+        bool a_concat = transa == rocblas_operation_none ? stride_a == hipblasStride(k) * lda
+                                                         : stride_a == k && lda >= k_total;
+        bool b_concat = transb == rocblas_operation_none ? stride_b == k && ldb >= k_total
+                                                         : stride_b == hipblasStride(k) * ldb;
+        return a_concat && b_concat;
+    }
+
+    // C = alpha * sum_i op(A_i) * op(B_i) + beta * C, as one gemm_ex with the concatenated k if
+    // possible and otherwise as a chain of gemm_ex calls accumulating into C. A and B are host
+    // arrays of device pointers, stride_a and stride_b are their spacing in elements, or -1 if
+    // they are not evenly spaced.
+    hipblasStatus_t hipblasGemmReduceEx(hipblasHandle_t    handle,
+                                        rocblas_operation  transa,
+                                        rocblas_operation  transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void* const* A,
+                                        rocblas_datatype   a_type,
+                                        int                lda,
+                                        hipblasStride      stride_a,
+                                        const void* const* B,
+                                        rocblas_datatype   b_type,
+                                        int                ldb,
+                                        hipblasStride      stride_b,
+                                        const void*        beta,
+                                        void*              C,
+                                        rocblas_datatype   c_type,
+                                        int                ldc,
+                                        int                batch_count,
+                                        rocblas_datatype   compute_type,
+                                        rocblas_gemm_algo  algo)
+    {
+        rocblas_handle rhandle = (rocblas_handle)handle;
+
+        auto gemm = [&](int k_i, const void* A_i, const void* B_i, const void* beta_i) {
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_ex(rhandle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k_i,
+                                                     alpha,
+                                                     A_i,
+                                                     a_type,
+                                                     lda,
+                                                     B_i,
+                                                     b_type,
+                                                     ldb,
+                                                     beta_i,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     C,
+                                                     c_type,
+                                                     ldc,
+                                                     compute_type,
+                                                     algo,
+                                                     0,
+                                                     rocblas_gemm_flags_none)));
+        };
+
+        // an empty sum only scales C
+        if(batch_count == 0 || k == 0)
+            return gemm(0, batch_count ? A[0] : nullptr, batch_count ? B[0] : nullptr, beta);
+
+        if(batch_count == 1
+           || hipblasReduceConcatenates(
+               transa, transb, k, lda, stride_a, ldb, stride_b, batch_count))
+            return gemm(k * batch_count, A[0], B[0], beta);
+
+        // the products after the first one are added to C with beta = 1
+        const void* one = hipblasReduceOne(compute_type);
+
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        if(mode == rocblas_pointer_mode_device)
+        {
+            hipblasHandleState* state = hipblasGetHandleState(handle, true);
+            size_t              size  = hipblasRocDatatypeSize(compute_type);
+            void*               d_one = hipblasGetHandleWorkspace(handle, state, size);
+
+            hipStream_t stream;
+            rocblas_get_stream(rhandle, &stream);
+            if(hipMemcpyAsync(d_one, one, size, hipMemcpyHostToDevice, stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            one = d_one;
+        }
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(int i = 0; i < batch_count && status == HIPBLAS_STATUS_SUCCESS; i++)
+            status = gemm(k, A[i], B[i], i ? one : beta);
+        return status;
+    }
+
+    // Spacing of the device pointers in ptrs in elements of the given size, -1 if they are not
+    // evenly spaced
+    hipblasStride hipblasPointerStride(const void* const* ptrs, int count, size_t size)
+    {
+        if(count < 2 || !size)
+            return -1;
+
+        ptrdiff_t diff = (const char*)ptrs[1] - (const char*)ptrs[0];
+        if(diff < 0 || diff % size)
+            return -1;
+        for(int i = 2; i < count; i++)
+            if((const char*)ptrs[i] - (const char*)ptrs[i - 1] != diff)
+                return -1;
+        return diff / size;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmBatchedReduceEx(hipblasHandle_t      handle,
+                                           hipblasOperation_t   transa,
+                                           hipblasOperation_t   transb,
+                                           int                  m,
+                                           int                  n,
+                                           int                  k,
+                                           const void*          alpha,
+                                           const void* const    A[],
+                                           hipDataType          a_type,
+                                           int                  lda,
+                                           const void* const    B[],
+                                           hipDataType          b_type,
+                                           int                  ldb,
+                                           const void*          beta,
+                                           void*                C,
+                                           hipDataType          c_type,
+                                           int                  ldc,
+                                           int                  batch_count,
+                                           hipblasComputeType_t compute_type,
+                                           hipblasGemmAlgo_t    algo)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // the pointers are needed on the host to find the concatenated layout and for the chain
+    std::vector<const void*> A_host(batch_count), B_host(batch_count);
+    if(batch_count > 0 && m > 0 && n > 0 && k > 0)
+    {
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+
+        size_t     size = sizeof(void*) * batch_count;
+        hipError_t hip_status
+            = hipMemcpyAsync(A_host.data(), A, size, hipMemcpyDeviceToHost, stream);
+        if(hip_status == hipSuccess)
+            hip_status = hipMemcpyAsync(B_host.data(), B, size, hipMemcpyDeviceToHost, stream);
+        if(hip_status == hipSuccess)
+            hip_status = hipStreamSynchronize(stream);
+        if(hip_status != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    return hipblasGemmReduceEx(
+        handle,
+        hipblasConvertOperation(transa),
+        hipblasConvertOperation(transb),
+        m,
+        n,
+        k,
+        alpha,
+        A_host.data(),
+        a_type_roc,
+        lda,
+        hipblasPointerStride(A_host.data(), batch_count, hipblasRocDatatypeSize(a_type_roc)),
+        B_host.data(),
+        b_type_roc,
+        ldb,
+        hipblasPointerStride(B_host.data(), batch_count, hipblasRocDatatypeSize(b_type_roc)),
+        beta,
+        C,
+        c_type_roc,
+        ldc,
+        batch_count,
+        compute_type_roc,
+        hipblasConvertGemmAlgo(algo));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedReduceEx(hipblasHandle_t      handle,
+                                                  hipblasOperation_t   transa,
+                                                  hipblasOperation_t   transb,
+                                                  int                  m,
+                                                  int                  n,
+                                                  int                  k,
+                                                  const void*          alpha,
+                                                  const void*          A,
+                                                  hipDataType          a_type,
+                                                  int                  lda,
+                                                  hipblasStride        stride_A,
+                                                  const void*          B,
+                                                  hipDataType          b_type,
+                                                  int                  ldb,
+                                                  hipblasStride        stride_B,
+                                                  const void*          beta,
+                                                  void*                C,
+                                                  hipDataType          c_type,
+                                                  int                  ldc,
+                                                  int                  batch_count,
+                                                  hipblasComputeType_t compute_type,
+                                                  hipblasGemmAlgo_t    algo)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    size_t                   a_size = hipblasRocDatatypeSize(a_type_roc);
+    size_t                   b_size = hipblasRocDatatypeSize(b_type_roc);
+    std::vector<const void*> A_i(batch_count), B_i(batch_count);
+    for(int i = 0; i < batch_count; i++)
+    {
+        A_i[i] = A ? (const char*)A + i * stride_A * a_size : nullptr;
+        B_i[i] = B ? (const char*)B + i * stride_B * b_size : nullptr;
+    }
+
+    return hipblasGemmReduceEx(handle,
+                               hipblasConvertOperation(transa),
+                               hipblasConvertOperation(transb),
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A_i.data(),
+                               a_type_roc,
+                               lda,
+                               stride_A,
+                               B_i.data(),
+                               b_type_roc,
+                               ldb,
+                               stride_B,
+                               beta,
+                               C,
+                               c_type_roc,
+                               ldc,
+                               batch_count,
+                               compute_type_roc,
+                               hipblasConvertGemmAlgo(algo));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * Indexed gemm_ex
+ *
+ * Every indexed row is a product of its own, so a group is a single
+ * gemm_batched_ex with m = 1 on pointers to the rows of A and C, whose
+ * leading dimensions are the strides between the elements of a row. The
+ * indices are host arrays, so the pointer arrays are built on the host and
+ * uploaded into the workspace without synchronizing the stream, and the rows
+ * are read and written in place.
+ ******************************************************************************/
+namespace
+{
+    // Whether the indices, or 0, ..., count - 1 if there are none, are rows in [0, rows)
+    bool hipblasIndicesInRange(const int* index, int count, int rows)
+    {
+        if(!index)
+            return count <= rows;
+        return std::all_of(
+            index, index + count, [rows](int row) { return row >= 0 && row < rows; });
+    }
+
+    // For every group g, the rows rowIndexC[offset_g + i] of C are updated with the product of
+    // the rows rowIndexA[offset_g + i] of op(A) and op(B_g), i < group_rows[g]. Row i of a
+    // group is batch entry i of a gemm_batched_ex with m = 1.
+    hipblasStatus_t hipblasGemmIndexedEx(hipblasHandle_t   handle,
+                                         rocblas_operation transa,
+                                         rocblas_operation transb,
+                                         int               group_count,
+                                         const int*        group_rows,
+                                         int               n,
+                                         int               k,
+                                         const void*       alpha,
+                                         const void*       A,
+                                         rocblas_datatype  a_type,
+                                         int               lda,
+                                         const int*        row_index_A,
+                                         const void*       B,
+                                         rocblas_datatype  b_type,
+                                         int               ldb,
+                                         hipblasStride     stride_B,
+                                         const void*       beta,
+                                         void*             C,
+                                         rocblas_datatype  c_type,
+                                         int               ldc,
+                                         const int*        row_index_C,
+                                         rocblas_datatype  compute_type,
+                                         rocblas_gemm_algo algo)
+    {
+        if(group_count < 0 || (group_count && !group_rows) || n < 0 || k < 0 || ldc < 1
+           || lda < (transa == rocblas_operation_none ? 1 : std::max(k, 1)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t total_rows = 0;
+        for(int g = 0; g < group_count; g++)
+        {
+            if(group_rows[g] < 0)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            total_rows += group_rows[g];
+        }
+        if(total_rows > INT_MAX)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!total_rows || !n)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // the rows of C, and of A unless it is transposed, are bounded by the leading dimension
+        bool transposed = transa != rocblas_operation_none;
+        int  a_rows     = transposed ? INT_MAX : lda;
+        if(!hipblasIndicesInRange(row_index_C, int(total_rows), ldc)
+           || (k && !hipblasIndicesInRange(row_index_A, int(total_rows), a_rows)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // The workspace holds the pointers to the rows of A, the matrices B_g and the rows of C,
+        // total_rows of each. Row r of op(A) starts at A + r, with its elements lda apart, or at
+        // A + r * lda if A is transposed; row r of C starts at C + r, with its elements ldc apart.
+        size_t                   rows = size_t(total_rows);
+        std::vector<const void*> pointers(3 * rows);
+        size_t                   a_size = hipblasRocDatatypeSize(a_type);
+        size_t                   b_size = hipblasRocDatatypeSize(b_type);
+        size_t                   c_size = hipblasRocDatatypeSize(c_type);
+        for(int g = 0, offset = 0; g < group_count; offset += group_rows[g++])
+        {
+            const char* B_g = (const char*)B + g * stride_B * b_size;
+            for(int i = offset; i < offset + group_rows[g]; i++)
+            {
+                size_t row_A = row_index_A ? row_index_A[i] : i;
+                size_t row_C = row_index_C ? row_index_C[i] : i;
+                size_t A_off = transposed ? row_A * lda : row_A;
+
+                pointers[i]            = (const char*)A + A_off * a_size;
+                pointers[rows + i]     = B_g;
+                pointers[2 * rows + i] = (const char*)C + row_C * c_size;
+            }
+        }
+
+        hipblasHandleState* state = hipblasGetHandleState(handle, true);
+        const void**        ws    = (const void**)hipblasGetHandleWorkspace(
+            handle, state, sizeof(void*) * pointers.size());
+        hipblasUploadAsync(handle, state, ws, pointers.data(), sizeof(void*) * pointers.size());
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        for(int g = 0, offset = 0; g < group_count; offset += group_rows[g++])
+        {
+            if(!group_rows[g])
+                continue;
+
+            void** C_g = (void**)(ws + 2 * rows + offset);
+
+            hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_gemm_batched_ex(rhandle,
+                                                             transa,
+                                                             transb,
+                                                             1,
+                                                             n,
+                                                             k,
+                                                             alpha,
+                                                             ws + offset,
+                                                             a_type,
+                                                             lda,
+                                                             ws + rows + offset,
+                                                             b_type,
+                                                             ldb,
+                                                             beta,
+                                                             C_g,
+                                                             c_type,
+                                                             ldc,
+                                                             C_g,
+                                                             c_type,
+                                                             ldc,
+                                                             group_rows[g],
+                                                             compute_type,
+                                                             algo,
+                                                             0,
+                                                             rocblas_gemm_flags_none)));
+
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasGemmIndexedEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transa,
+                                     hipblasOperation_t   transb,
+                                     int                  m,
+                                     int                  n,
+                                     int                  k,
+                                     const void*          alpha,
+                                     const void*          A,
+                                     hipDataType          a_type,
+                                     int                  lda,
+                                     const int*           row_index_A,
+                                     const void*          B,
+                                     hipDataType          b_type,
+                                     int                  ldb,
+                                     const void*          beta,
+                                     void*                C,
+                                     hipDataType          c_type,
+                                     int                  ldc,
+                                     const int*           row_index_C,
+                                     hipblasComputeType_t compute_type,
+                                     hipblasGemmAlgo_t    algo)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(m < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasGemmIndexedEx(handle,
+                                hipblasConvertOperation(transa),
+                                hipblasConvertOperation(transb),
+                                1,
+                                &m,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                a_type_roc,
+                                lda,
+                                row_index_A,
+                                B,
+                                b_type_roc,
+                                ldb,
+                                0,
+                                beta,
+                                C,
+                                c_type_roc,
+                                ldc,
+                                row_index_C,
+                                compute_type_roc,
+                                hipblasConvertGemmAlgo(algo));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasGemmGroupedIndexedEx(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transa,
+                                            hipblasOperation_t   transb,
+                                            int                  group_count,
+                                            const int*           group_rows,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          a_type,
+                                            int                  lda,
+                                            const int*           row_index_A,
+                                            const void*          B,
+                                            hipDataType          b_type,
+                                            int                  ldb,
+                                            hipblasStride        stride_B,
+                                            const void*          beta,
+                                            void*                C,
+                                            hipDataType          c_type,
+                                            int                  ldc,
+                                            const int*           row_index_C,
+                                            hipblasComputeType_t compute_type,
+                                            hipblasGemmAlgo_t    algo)
+try
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    rocblas_datatype a_type_roc, b_type_roc, c_type_roc, compute_type_roc;
+    hipblasStatus_t  status = hipblasInternalGemmExTypes(
+        a_type, b_type, c_type, compute_type, a_type_roc, b_type_roc, c_type_roc, compute_type_roc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return hipblasGemmIndexedEx(handle,
+                                hipblasConvertOperation(transa),
+                                hipblasConvertOperation(transb),
+                                group_count,
+                                group_rows,
+                                n,
+                                k,
+                                alpha,
+                                A,
+                                a_type_roc,
+                                lda,
+                                row_index_A,
+                                B,
+                                b_type_roc,
+                                ldb,
+                                stride_B,
+                                beta,
+                                C,
+                                c_type_roc,
+                                ldc,
+                                row_index_C,
+                                compute_type_roc,
+                                hipblasConvertGemmAlgo(algo));
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+} // extern "C"
+
+/*******************************************************************************
+ * Copy with type conversion
+ *
+ * Copies between matrices of the same type are hipMemcpy2DAsync calls. The
+ * conversions from f16 and bf16 to f32 are gemm_ex products one * A with k = 1,
+ * which rocBLAS supports with these types. rocBLAS has no other conversions and
+ * the library has no kernels of its own, so the other pairs of types are not
+ * supported. Vectors whose increments have different signs, or are zero, are
+ * copied by rocBLAS copy, or by axpy_ex onto -0 for the 16-bit types, after any
+ * conversion into the workspace.
+ ******************************************************************************/
+namespace
+{
+    // Pairs of types copied on the device, any type to itself and f16 or bf16 to f32
+    bool hipblasIsCopySupported(hipDataType a_type, hipDataType b_type)
+    {
+        if(!hipblasDatatypeSize(a_type))
+            return false;
+        return a_type == b_type
+               || ((a_type == HIP_R_16F || a_type == HIP_R_16BF) && b_type == HIP_R_32F);
+    }
+
+    // One in a_type from the handle constants, as the left factor of the conversion products.
+    // Taken after the workspace, which may move it.
+    const void* hipblasGetCopyOne(hipblasHandle_t handle, hipDataType a_type)
+    {
+        const hipblasHandleConstants* constants
+            = hipblasGetHandleConstants(handle, hipblasGetHandleState(handle, true));
+        return a_type == HIP_R_16F ? &constants->one_f16 : &constants->one_bf16;
+    }
+
+    // B_i = A_i for 1 by len rows A_i and B_i with elements inc_a and inc_b apart, as the
+    // gemm_ex products one * A_i with k = 1 and a float compute type
+    hipblasStatus_t hipblasCopyRowsGemm(hipblasHandle_t  handle,
+                                        const void*      one,
+                                        int              len,
+                                        const char*      A,
+                                        rocblas_datatype a_type,
+                                        int              inc_a,
+                                        hipblasStride    stride_a,
+                                        char*            B,
+                                        rocblas_datatype b_type,
+                                        int              inc_b,
+                                        hipblasStride    stride_b,
+                                        int              batch_count)
+    {
+        static const float alpha = 1.0f, beta = 0.0f;
+
+        rocblas_handle       rhandle = (rocblas_handle)handle;
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+
+        hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocblas_gemm_strided_batched_ex(rhandle,
+                                                                 rocblas_operation_none,
+                                                                 rocblas_operation_none,
+                                                                 1,
+                                                                 len,
+                                                                 1,
+                                                                 &alpha,
+                                                                 one,
+                                                                 a_type,
+                                                                 1,
+                                                                 0,
+                                                                 A,
+                                                                 a_type,
+                                                                 inc_a,
+                                                                 stride_a,
+                                                                 &beta,
+                                                                 B,
+                                                                 b_type,
+                                                                 inc_b,
+                                                                 stride_b,
+                                                                 B,
+                                                                 b_type,
+                                                                 inc_b,
+                                                                 stride_b,
+                                                                 batch_count,
+                                                                 rocblas_datatype_f32_r,
+                                                                 rocblas_gemm_algo_standard,
+                                                                 0,
+                                                                 rocblas_gemm_flags_none)));
+        rocblas_set_pointer_mode(rhandle, mode);
+        return status;
+    }
+
+    // B_i = A_i for the m by n matrices A_i = A + i * stride_A and B_i = B + i * stride_B
+    hipblasStatus_t hipblasCopyMatrixConvert(hipblasHandle_t handle,
+                                             int             m,
+                                             int             n,
+                                             const void*     A,
+                                             hipDataType     a_type,
+                                             int             lda,
+                                             hipblasStride   stride_A,
+                                             void*           B,
+                                             hipDataType     b_type,
+                                             int             ldb,
+                                             hipblasStride   stride_B,
+                                             int             batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblasIsCopySupported(a_type, b_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || lda < std::max(m, 1) || ldb < std::max(m, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        size_t      a_size = hipblasDatatypeSize(a_type);
+        size_t      b_size = hipblasDatatypeSize(b_type);
+        hipStream_t stream;
+        rocblas_get_stream((rocblas_handle)handle, &stream);
+
+        // matrices which follow each other in A as in B form one matrix of n * batch_count columns
+        if(batch_count > 1 && stride_A == hipblasStride(lda) * n
+           && stride_B == hipblasStride(ldb) * n && int64_t(n) * batch_count <= INT_MAX)
+        {
+            n *= batch_count;
+            batch_count = 1;
+        }
+
+        const char* a = (const char*)A;
+        char*       b = (char*)B;
+        if(a_type == b_type)
+        {
+            for(int i = 0; i < batch_count; i++)
+            {
+                if(hipMemcpy2DAsync(b + i * stride_B * b_size,
+                                    ldb * b_size,
+                                    a + i * stride_A * a_size,
+                                    lda * a_size,
+                                    m * a_size,
+                                    n,
+                                    hipMemcpyDeviceToDevice,
+                                    stream)
+                   != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        const void*      one        = hipblasGetCopyOne(handle, a_type);
+        rocblas_datatype a_type_roc = hipblasConvertDatatype_v2(a_type);
+        rocblas_datatype b_type_roc = hipblasConvertDatatype_v2(b_type);
+
+        // rows of a single row, such as vectors
+        if(m == 1)
+            return hipblasCopyRowsGemm(handle,
+                                       one,
+                                       n,
+                                       a,
+                                       a_type_roc,
+                                       lda,
+                                       stride_A,
+                                       b,
+                                       b_type_roc,
+                                       ldb,
+                                       stride_B,
+                                       batch_count);
+
+        // contiguous matrices
+        if(n == 1 || (lda == m && ldb == m && int64_t(m) * n <= INT_MAX))
+            return hipblasCopyRowsGemm(handle,
+                                       one,
+                                       m * n,
+                                       a,
+                                       a_type_roc,
+                                       1,
+                                       stride_A,
+                                       b,
+                                       b_type_roc,
+                                       1,
+                                       stride_B,
+                                       batch_count);
+
+        // a batch of the columns, or of the rows if there are fewer of them
+        for(int i = 0; i < batch_count; i++)
+        {
+            const char* a_i = a + i * stride_A * a_size;
+            char*       b_i = b + i * stride_B * b_size;
+
+            hipblasStatus_t status;
+            if(m >= n)
+                status = hipblasCopyRowsGemm(
+                    handle, one, m, a_i, a_type_roc, 1, lda, b_i, b_type_roc, 1, ldb, n);
+            else
+                status = hipblasCopyRowsGemm(
+                    handle, one, n, a_i, a_type_roc, lda, 1, b_i, b_type_roc, ldb, 1, m);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // y_i = x_i for the vectors x_i = x + i * stride_x and y_i = y + i * stride_y of n elements
+    // incx and incy apart, which are read backwards if the increment is negative as in BLAS copy
+    hipblasStatus_t hipblasCopyVectorConvert(hipblasHandle_t handle,
+                                             int             n,
+                                             const void*     x,
+                                             hipDataType     x_type,
+                                             int             incx,
+                                             hipblasStride   stride_x,
+                                             void*           y,
+                                             hipDataType     y_type,
+                                             int             incy,
+                                             hipblasStride   stride_y,
+                                             int             batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!hipblasIsCopySupported(x_type, y_type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(n < 0 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // the last element of x is left in y, as by a sequential copy
+        size_t x_size = hipblasDatatypeSize(x_type);
+        if(!incy)
+        {
+            if(incx > 0)
+                x = (const char*)x + hipblasStride(n - 1) * incx * x_size;
+            n    = 1;
+            incx = 1;
+            incy = 1;
+        }
+
+        // increments of the same sign pair the elements in memory order, as in a matrix of one row
+        if(incx && (incx > 0) == (incy > 0))
+            return hipblasCopyMatrixConvert(handle,
+                                            1,
+                                            n,
+                                            x,
+                                            x_type,
+                                            std::abs(incx),
+                                            stride_x,
+                                            y,
+                                            y_type,
+                                            std::abs(incy),
+                                            stride_y,
+                                            batch_count);
+
+        rocblas_handle rhandle = (rocblas_handle)handle;
+        hipStream_t    stream;
+        rocblas_get_stream(rhandle, &stream);
+
+        // x is converted in memory order into the workspace first
+        if(x_type != y_type)
+        {
+            int   len = incx ? n : 1;
+            char* ws  = (char*)hipblasGetHandleWorkspace(handle,
+                                                        hipblasGetHandleState(handle, true),
+                                                        sizeof(float) * len * size_t(batch_count));
+            hipblasStatus_t status = hipblasCopyRowsGemm(handle,
+                                                         hipblasGetCopyOne(handle, x_type),
+                                                         len,
+                                                         (const char*)x,
+                                                         hipblasConvertDatatype_v2(x_type),
+                                                         std::max(std::abs(incx), 1),
+                                                         stride_x,
+                                                         ws,
+                                                         rocblas_datatype_f32_r,
+                                                         1,
+                                                         len,
+                                                         batch_count);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            x        = ws;
+            x_type   = y_type;
+            incx     = incx > 0 ? 1 : incx < 0 ? -1 : 0;
+            stride_x = len;
+        }
+
+        switch(hipblasDatatypeSize(y_type))
+        {
+        case 4:
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_scopy_strided_batched(rhandle,
+                                                                   n,
+                                                                   (const float*)x,
+                                                                   incx,
+                                                                   stride_x,
+                                                                   (float*)y,
+                                                                   incy,
+                                                                   stride_y,
+                                                                   batch_count)));
+        case 8:
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_dcopy_strided_batched(rhandle,
+                                                                   n,
+                                                                   (const double*)x,
+                                                                   incx,
+                                                                   stride_x,
+                                                                   (double*)y,
+                                                                   incy,
+                                                                   stride_y,
+                                                                   batch_count)));
+        case 16:
+            return HIPBLAS_DEMAND_ALLOC(
+                hipblasConvertStatus(rocblas_zcopy_strided_batched(rhandle,
+                                                                   n,
+                                                                   (const rocblas_double_complex*)x,
+                                                                   incx,
+                                                                   stride_x,
+                                                                   (rocblas_double_complex*)y,
+                                                                   incy,
+                                                                   stride_y,
+                                                                   batch_count)));
+        }
+        if(y_type != HIP_R_16F && y_type != HIP_R_16BF)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // y = x + y with y = -0, which leaves every x unchanged
+        size_t pitch = std::abs(incy) * sizeof(uint16_t);
+        for(int i = 0; i < batch_count; i++)
+        {
+            char* y_i = (char*)y + i * stride_y * sizeof(uint16_t);
+            if(hipMemset2DAsync(y_i, pitch, 0, 1, n, stream) != hipSuccess
+               || hipMemset2DAsync(y_i + 1, pitch, 0x80, 1, n, stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        static const float   one = 1.0f;
+        rocblas_datatype     type_roc = hipblasConvertDatatype_v2(y_type);
+        rocblas_pointer_mode mode;
+        rocblas_get_pointer_mode(rhandle, &mode);
+        rocblas_set_pointer_mode(rhandle, rocblas_pointer_mode_host);
+        hipblasStatus_t status = HIPBLAS_DEMAND_ALLOC(
+            hipblasConvertStatus(rocblas_axpy_strided_batched_ex(rhandle,
+                                                                 n,
+                                                                 &one,
+                                                                 rocblas_datatype_f32_r,
+                                                                 x,
+                                                                 type_roc,
+                                                                 incx,
+                                                                 stride_x,
+                                                                 y,
+                                                                 type_roc,
+                                                                 incy,
+                                                                 stride_y,
+                                                                 batch_count,
+                                                                 rocblas_datatype_f32_r)));
+        rocblas_set_pointer_mode(rhandle, mode);
+        return status;
+    }
+
+    // B_i = A_i for matrices given by device arrays of pointers, which are copied to the host
+    hipblasStatus_t hipblasCopyMatrixBatchedConvert(hipblasHandle_t    handle,
+                                                    int                m,
+                                                    int                n,
+                                                    const void* const* A,
+                                                    hipDataType        a_type,
+                                                    int                lda,
+                                                    void* const*       B,
+                                                    hipDataType        b_type,
+                                                    int                ldb,
+                                                    int                batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(m < 0 || n < 0 || lda < std::max(m, 1) || ldb < std::max(m, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::vector<const void*> A_host(batch_count);
+        std::vector<void*>       B_host(batch_count);
+        if(!hipblasGetPointerArray(handle, A, A_host) || !hipblasGetPointerArray(handle, B, B_host))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        for(int i = 0; i < batch_count; i++)
+        {
+            hipblasStatus_t status = hipblasCopyMatrixConvert(
+                handle, m, n, A_host[i], a_type, lda, 0, B_host[i], b_type, ldb, 0, 1);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // y_i = x_i for vectors given by device arrays of pointers, which are copied to the host
+    hipblasStatus_t hipblasCopyVectorBatchedConvert(hipblasHandle_t    handle,
+                                                    int                n,
+                                                    const void* const* x,
+                                                    hipDataType        x_type,
+                                                    int                incx,
+                                                    void* const*       y,
+                                                    hipDataType        y_type,
+                                                    int                incy,
+                                                    int                batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        std::vector<const void*> x_host(batch_count);
+        std::vector<void*>       y_host(batch_count);
+        if(!hipblasGetPointerArray(handle, x, x_host) || !hipblasGetPointerArray(handle, y, y_host))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        for(int i = 0; i < batch_count; i++)
+        {
+            hipblasStatus_t status = hipblasCopyVectorConvert(
+                handle, n, x_host[i], x_type, incx, 0, y_host[i], y_type, incy, 0, 1);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasCopyEx(hipblasHandle_t handle,
+                              int             n,
+                              const void*     x,
+                              hipDataType     xType,
+                              int             incx,
+                              void*           y,
+                              hipDataType     yType,
+                              int             incy)
+try
+{
+    return hipblasCopyVectorConvert(handle, n, x, xType, incx, 0, y, yType, incy, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCopyBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void* const x[],
+                                     hipDataType       xType,
+                                     int               incx,
+                                     void* const       y[],
+                                     hipDataType       yType,
+                                     int               incy,
+                                     int               batchCount)
+try
+{
+    return hipblasCopyVectorBatchedConvert(
+        handle, n, x, xType, incx, y, yType, incy, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCopyStridedBatchedEx(hipblasHandle_t handle,
+                                            int             n,
+                                            const void*     x,
+                                            hipDataType     xType,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            void*           y,
+                                            hipDataType     yType,
+                                            int             incy,
+                                            hipblasStride   stridey,
+                                            int             batchCount)
+try
+{
+    return hipblasCopyVectorConvert(
+        handle, n, x, xType, incx, stridex, y, yType, incy, stridey, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCopyMatrixEx(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    const void*     A,
+                                    hipDataType     aType,
+                                    int             lda,
+                                    void*           B,
+                                    hipDataType     bType,
+                                    int             ldb)
+try
+{
+    return hipblasCopyMatrixConvert(handle, m, n, A, aType, lda, 0, B, bType, ldb, 0, 1);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCopyMatrixBatchedEx(hipblasHandle_t   handle,
+                                           int               m,
+                                           int               n,
+                                           const void* const A[],
+                                           hipDataType       aType,
+                                           int               lda,
+                                           void* const       B[],
+                                           hipDataType       bType,
+                                           int               ldb,
+                                           int               batchCount)
+try
+{
+    return hipblasCopyMatrixBatchedConvert(
+        handle, m, n, A, aType, lda, B, bType, ldb, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCopyMatrixStridedBatchedEx(hipblasHandle_t handle,
+                                                  int             m,
+                                                  int             n,
+                                                  const void*     A,
+                                                  hipDataType     aType,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  void*           B,
+                                                  hipDataType     bType,
+                                                  int             ldb,
+                                                  hipblasStride   strideB,
+                                                  int             batchCount)
+try
+{
+    return hipblasCopyMatrixConvert(
+        handle, m, n, A, aType, lda, strideA, B, bType, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
 // trsm_ex
 hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               hipblasSideMode_t  side,
@@ -25,6 +25,7 @@
 #include "exceptions.hpp"
 #include <cublas_v2.h>
 #include <cuda_runtime_api.h>
+#include <cstdio>
 #include <hip/hip_runtime.h>
 
 #ifdef __cplusplus
@@ -224,6 +225,9 @@ cudaDataType_t hipblasConvertDatatype_v2(hipDataType type)
 
 cublasComputeType_t hipblasConvertComputeType(hipblasComputeType_t type)
 {
+    if(type == HIPBLAS_COMPUTE_32F_EMULATED_16BF)
+        throw HIPBLAS_STATUS_NOT_SUPPORTED;
+
     switch(type)
     {
     case HIPBLAS_COMPUTE_16F:
@@ -270,6 +274,9 @@ cublasGemmAlgo_t hipblasConvertGemmAlgo(hipblasGemmAlgo_t algo)
     switch(algo)
     {
     case HIPBLAS_GEMM_DEFAULT:
+    // cuBLAS chooses split-K itself
+    case HIPBLAS_GEMM_SPLIT_K:
+    case HIPBLAS_GEMM_STRASSEN:
         return CUBLAS_GEMM_DEFAULT;
 
     default:
@@ -535,6 +542,387 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+} // extern "C"
+
+/*******************************************************************************
+ * Pack and unpack batched
+ ******************************************************************************/
+namespace
+{
+    // Size in bytes of the elements of type, 0 if the type isn't supported
+    size_t hipblasDatatypeSize(hipDataType type)
+    {
+        switch(type)
+        {
+        case HIP_R_8I:
+        case HIP_R_8U:
+            return 1;
+        case HIP_R_16F:
+        case HIP_R_16BF:
+        case HIP_C_8I:
+        case HIP_C_8U:
+            return 2;
+        case HIP_R_32F:
+        case HIP_R_32I:
+        case HIP_R_32U:
+        case HIP_C_16F:
+        case HIP_C_16BF:
+            return 4;
+        case HIP_R_64F:
+        case HIP_C_32F:
+        case HIP_C_32I:
+        case HIP_C_32U:
+            return 8;
+        case HIP_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    // Copies the m by n matrices A[i] into B + i * stride_B if pack, or back otherwise. Matrices
+    // which follow each other in A as in B are copied together as a single matrix of n * count
+    // columns, so a batch which is already strided in A takes one copy.
+    hipblasStatus_t hipblasPackBatched(hipblasHandle_t    handle,
+                                       bool               pack,
+                                       int                m,
+                                       int                n,
+                                       hipDataType        type,
+                                       const void* const* A,
+                                       int                lda,
+                                       char*              B,
+                                       int                ldb,
+                                       hipblasStride      stride_B,
+                                       int                batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        size_t size = hipblasDatatypeSize(type);
+        if(!size)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || lda < std::max(m, 1) || ldb < std::max(m, 1) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!m || !n || !batch_count)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        cublasGetStream((cublasHandle_t)handle, &stream);
+
+        // the pointers are needed on the host to find the matrices which can be copied together
+        std::vector<char*> A_host(batch_count);
+        hipError_t         hip_status = hipMemcpyAsync(
+            A_host.data(), A, sizeof(void*) * batch_count, hipMemcpyDeviceToHost, stream);
+        if(hip_status == hipSuccess)
+            hip_status = hipStreamSynchronize(stream);
+        if(hip_status != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        size_t pitch_A = size_t(lda) * size;
+        size_t pitch_B = size_t(ldb) * size;
+        size_t step    = stride_B * size;
+        bool   chain   = lda == ldb && stride_B == hipblasStride(ldb) * n;
+        for(int i = 0, count; i < batch_count; i += count)
+        {
+            for(count = 1; chain && i + count < batch_count; count++)
+                if(A_host[i + count] != A_host[i] + count * step)
+                    break;
+
+            char* a    = A_host[i];
+            char* b    = B + i * step;
+            hip_status = hipMemcpy2DAsync(pack ? b : a,
+                                          pack ? pitch_B : pitch_A,
+                                          pack ? a : b,
+                                          pack ? pitch_A : pitch_B,
+                                          m * size,
+                                          size_t(n) * count,
+                                          hipMemcpyDeviceToDevice,
+                                          stream);
+            if(hip_status != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+} // namespace
+
+extern "C" {
+
+hipblasStatus_t hipblasPackBatched(hipblasHandle_t   handle,
+                                   int               m,
+                                   int               n,
+                                   hipDataType       type,
+                                   const void* const A[],
+                                   int               lda,
+                                   void*             B,
+                                   int               ldb,
+                                   hipblasStride     strideB,
+                                   int               batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, true, m, n, type, A, lda, (char*)B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasUnpackBatched(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     hipDataType     type,
+                                     const void*     B,
+                                     int             ldb,
+                                     hipblasStride   strideB,
+                                     void* const     A[],
+                                     int             lda,
+                                     int             batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, false, m, n, type, (const void* const*)A, lda, (char*)B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSpackBatched(hipblasHandle_t    handle,
+                                    int                m,
+                                    int                n,
+                                    const float* const A[],
+                                    int                lda,
+                                    float*             B,
+                                    int                ldb,
+                                    hipblasStride      strideB,
+                                    int                batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, m, n, HIP_R_32F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDpackBatched(hipblasHandle_t     handle,
+                                    int                 m,
+                                    int                 n,
+                                    const double* const A[],
+                                    int                 lda,
+                                    double*             B,
+                                    int                 ldb,
+                                    hipblasStride       strideB,
+                                    int                 batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, m, n, HIP_R_64F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpackBatched(hipblasHandle_t             handle,
+                                    int                         m,
+                                    int                         n,
+                                    const hipblasComplex* const A[],
+                                    int                         lda,
+                                    hipblasComplex*             B,
+                                    int                         ldb,
+                                    hipblasStride               strideB,
+                                    int                         batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_32F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpackBatched(hipblasHandle_t                   handle,
+                                    int                               m,
+                                    int                               n,
+                                    const hipblasDoubleComplex* const A[],
+                                    int                               lda,
+                                    hipblasDoubleComplex*             B,
+                                    int                               ldb,
+                                    hipblasStride                     strideB,
+                                    int                               batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_64F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCpackBatched_v2(hipblasHandle_t         handle,
+                                       int                     m,
+                                       int                     n,
+                                       const hipComplex* const A[],
+                                       int                     lda,
+                                       hipComplex*             B,
+                                       int                     ldb,
+                                       hipblasStride           strideB,
+                                       int                     batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_32F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZpackBatched_v2(hipblasHandle_t               handle,
+                                       int                           m,
+                                       int                           n,
+                                       const hipDoubleComplex* const A[],
+                                       int                           lda,
+                                       hipDoubleComplex*             B,
+                                       int                           ldb,
+                                       hipblasStride                 strideB,
+                                       int                           batchCount)
+try
+{
+    return hipblasPackBatched(
+        handle, m, n, HIP_C_64F, (const void* const*)A, lda, B, ldb, strideB, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasSunpackBatched(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const float*    B,
+                                      int             ldb,
+                                      hipblasStride   strideB,
+                                      float* const    A[],
+                                      int             lda,
+                                      int             batchCount)
+try
+{
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_R_32F, B, ldb, strideB, (void* const*)A, lda, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDunpackBatched(hipblasHandle_t handle,
+                                      int             m,
+                                      int             n,
+                                      const double*   B,
+                                      int             ldb,
+                                      hipblasStride   strideB,
+                                      double* const   A[],
+                                      int             lda,
+                                      int             batchCount)
+try
+{
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_R_64F, B, ldb, strideB, (void* const*)A, lda, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunpackBatched(hipblasHandle_t       handle,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      hipblasStride         strideB,
+                                      hipblasComplex* const A[],
+                                      int                   lda,
+                                      int                   batchCount)
+try
+{
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_32F, B, ldb, strideB, (void* const*)A, lda, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunpackBatched(hipblasHandle_t             handle,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      hipblasStride               strideB,
+                                      hipblasDoubleComplex* const A[],
+                                      int                         lda,
+                                      int                         batchCount)
+try
+{
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_64F, B, ldb, strideB, (void* const*)A, lda, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasCunpackBatched_v2(hipblasHandle_t   handle,
+                                         int               m,
+                                         int               n,
+                                         const hipComplex* B,
+                                         int               ldb,
+                                         hipblasStride     strideB,
+                                         hipComplex* const A[],
+                                         int               lda,
+                                         int               batchCount)
+try
+{
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_32F, B, ldb, strideB, (void* const*)A, lda, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasZunpackBatched_v2(hipblasHandle_t         handle,
+                                         int                     m,
+                                         int                     n,
+                                         const hipDoubleComplex* B,
+                                         int                     ldb,
+                                         hipblasStride           strideB,
+                                         hipDoubleComplex* const A[],
+                                         int                     lda,
+                                         int                     batchCount)
+try
+{
+    return hipblasUnpackBatched(
+        handle, m, n, HIP_C_64F, B, ldb, strideB, (void* const*)A, lda, batchCount);
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasInfoSummary(
+    hipblasHandle_t handle, const int* info, int batchCount, int* firstFailure, int* failureCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
 // atomics mode
 hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t handle, hipblasAtomicsMode_t atomics_mode)
 try
@@ -558,6 +946,164 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+// backend version
+hipblasStatus_t hipblasGetBackendVersionString(char* buf, size_t len)
+try
+{
+    if(!buf)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int major, minor, patch;
+    if(cublasGetProperty(MAJOR_VERSION, &major) != CUBLAS_STATUS_SUCCESS
+       || cublasGetProperty(MINOR_VERSION, &minor) != CUBLAS_STATUS_SUCCESS
+       || cublasGetProperty(PATCH_LEVEL, &patch) != CUBLAS_STATUS_SUCCESS)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    int written = snprintf(buf, len, "cuBLAS %d.%d.%d", major, minor, patch);
+    if(written < 0 || size_t(written) >= len)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipblas_exception_to_status();
+}
+
+hipblasStatus_t hipblasDeferredBegin(hipblasHandle_t handle)
+{
+    return handle == nullptr ? HIPBLAS_STATUS_NOT_INITIALIZED : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDeferredEnd(hipblasHandle_t handle)
+{
+    // no calls are ever queued with cuBLAS backend
+    return handle == nullptr ? HIPBLAS_STATUS_NOT_INITIALIZED : HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmSplitK(hipblasHandle_t handle, int splitK)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(splitK < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return splitK == 0 ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetGemmSplitK(hipblasHandle_t handle, int* splitK)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(splitK == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *splitK = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmEmulationSlices(hipblasHandle_t handle, int slices)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(slices < 0 || slices > 3)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return slices == 0 ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetGemmEmulationSlices(hipblasHandle_t handle, int* slices)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(slices == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *slices = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t
+    hipblasWarmup(hipblasHandle_t handle, hipblasWarmupDescriptor_t* descriptors, int count)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(count < 0 || (count > 0 && descriptors == nullptr))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasSetGemmStrassenLevels(hipblasHandle_t handle, int levels)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(levels < -1 || levels > 2)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return levels == 0 ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetGemmStrassenLevels(hipblasHandle_t handle, int* levels)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(levels == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *levels = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmOrderMode(hipblasHandle_t handle, hipblasGemmOrderMode_t mode)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode != HIPBLAS_GEMM_ORDER_DEFAULT && mode != HIPBLAS_GEMM_ORDER_TRANSPOSED_C)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    return mode == HIPBLAS_GEMM_ORDER_DEFAULT ? HIPBLAS_STATUS_SUCCESS
+                                              : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetGemmOrderMode(hipblasHandle_t handle, hipblasGemmOrderMode_t* mode)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *mode = HIPBLAS_GEMM_ORDER_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetGemmOrderHint(hipblasHandle_t         handle,
+                                        hipDataType             type,
+                                        hipblasOperation_t      transa,
+                                        hipblasOperation_t      transb,
+                                        int                     m,
+                                        int                     n,
+                                        int                     k,
+                                        hipblasGemmOrderMode_t* mode)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(mode == nullptr || m < 0 || n < 0 || k < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *mode = HIPBLAS_GEMM_ORDER_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetQrAlgo(hipblasHandle_t handle, hipblasQrAlgo_t algo)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(algo != HIPBLAS_QR_ALGO_DEFAULT && algo != HIPBLAS_QR_ALGO_TSQR)
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    return algo == HIPBLAS_QR_ALGO_DEFAULT ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGetQrAlgo(hipblasHandle_t handle, hipblasQrAlgo_t* algo)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(algo == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *algo = HIPBLAS_QR_ALGO_DEFAULT;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
 // amax
 hipblasStatus_t hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result)
 try
@@ -32044,6 +32590,231 @@ hipblasStatus_t hipblasZgetrfStridedBatched_v2(hipblasHandle_t     handle,
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
+// getrf_refactor
+hipblasStatus_t hipblasSgetrfRefactor(hipblasHandle_t handle,
+                                      const int       n,
+                                      float*          A,
+                                      const int       lda,
+                                      const int*      ipiv,
+                                      const float     maxGrowth,
+                                      int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgetrfRefactor(hipblasHandle_t handle,
+                                      const int       n,
+                                      double*         A,
+                                      const int       lda,
+                                      const int*      ipiv,
+                                      const double    maxGrowth,
+                                      int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgetrfRefactor(hipblasHandle_t handle,
+                                      const int       n,
+                                      hipblasComplex* A,
+                                      const int       lda,
+                                      const int*      ipiv,
+                                      const float     maxGrowth,
+                                      int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgetrfRefactor(hipblasHandle_t       handle,
+                                      const int             n,
+                                      hipblasDoubleComplex* A,
+                                      const int             lda,
+                                      const int*            ipiv,
+                                      const double          maxGrowth,
+                                      int*                  info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgetrfRefactor_v2(hipblasHandle_t handle,
+                                         const int       n,
+                                         hipComplex*     A,
+                                         const int       lda,
+                                         const int*      ipiv,
+                                         const float     maxGrowth,
+                                         int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgetrfRefactor_v2(hipblasHandle_t   handle,
+                                         const int         n,
+                                         hipDoubleComplex* A,
+                                         const int         lda,
+                                         const int*        ipiv,
+                                         const double      maxGrowth,
+                                         int*              info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// getrf_refactor_batched
+hipblasStatus_t hipblasSgetrfRefactorBatched(hipblasHandle_t handle,
+                                             const int       n,
+                                             float* const    A[],
+                                             const int       lda,
+                                             const int*      ipiv,
+                                             const float     maxGrowth,
+                                             int*            info,
+                                             const int       batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgetrfRefactorBatched(hipblasHandle_t handle,
+                                             const int       n,
+                                             double* const   A[],
+                                             const int       lda,
+                                             const int*      ipiv,
+                                             const double    maxGrowth,
+                                             int*            info,
+                                             const int       batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgetrfRefactorBatched(hipblasHandle_t       handle,
+                                             const int             n,
+                                             hipblasComplex* const A[],
+                                             const int             lda,
+                                             const int*            ipiv,
+                                             const float           maxGrowth,
+                                             int*                  info,
+                                             const int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgetrfRefactorBatched(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             hipblasDoubleComplex* const A[],
+                                             const int                   lda,
+                                             const int*                  ipiv,
+                                             const double                maxGrowth,
+                                             int*                        info,
+                                             const int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgetrfRefactorBatched_v2(hipblasHandle_t   handle,
+                                                const int         n,
+                                                hipComplex* const A[],
+                                                const int         lda,
+                                                const int*        ipiv,
+                                                const float       maxGrowth,
+                                                int*              info,
+                                                const int         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgetrfRefactorBatched_v2(hipblasHandle_t         handle,
+                                                const int               n,
+                                                hipDoubleComplex* const A[],
+                                                const int               lda,
+                                                const int*              ipiv,
+                                                const double            maxGrowth,
+                                                int*                    info,
+                                                const int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// getrf_refactor_strided_batched
+hipblasStatus_t hipblasSgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    float*              A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    const int*          ipiv,
+                                                    const hipblasStride strideP,
+                                                    const float         maxGrowth,
+                                                    int*                info,
+                                                    const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    double*             A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    const int*          ipiv,
+                                                    const hipblasStride strideP,
+                                                    const double        maxGrowth,
+                                                    int*                info,
+                                                    const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgetrfRefactorStridedBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    hipblasComplex*     A,
+                                                    const int           lda,
+                                                    const hipblasStride strideA,
+                                                    const int*          ipiv,
+                                                    const hipblasStride strideP,
+                                                    const float         maxGrowth,
+                                                    int*                info,
+                                                    const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgetrfRefactorStridedBatched(hipblasHandle_t       handle,
+                                                    const int             n,
+                                                    hipblasDoubleComplex* A,
+                                                    const int             lda,
+                                                    const hipblasStride   strideA,
+                                                    const int*            ipiv,
+                                                    const hipblasStride   strideP,
+                                                    const double          maxGrowth,
+                                                    int*                  info,
+                                                    const int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgetrfRefactorStridedBatched_v2(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       hipComplex*         A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       const int*          ipiv,
+                                                       const hipblasStride strideP,
+                                                       const float         maxGrowth,
+                                                       int*                info,
+                                                       const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgetrfRefactorStridedBatched_v2(hipblasHandle_t     handle,
+                                                       const int           n,
+                                                       hipDoubleComplex*   A,
+                                                       const int           lda,
+                                                       const hipblasStride strideA,
+                                                       const int*          ipiv,
+                                                       const hipblasStride strideP,
+                                                       const double        maxGrowth,
+                                                       int*                info,
+                                                       const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
 // getrs
 hipblasStatus_t hipblasSgetrs(hipblasHandle_t          handle,
                               const hipblasOperation_t trans,
@@ -33235,6 +34006,627 @@ hipblasStatus_t hipblasZgelsStridedBatched_v2(hipblasHandle_t     handle,
     return HIPBLAS_STATUS_NOT_SUPPORTED;
 }
 
+// orgqr
+hipblasStatus_t hipblasSorgqr(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       k,
+                              float*          A,
+                              const int       lda,
+                              float*          ipiv,
+                              int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDorgqr(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       k,
+                              double*         A,
+                              const int       lda,
+                              double*         ipiv,
+                              int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCungqr(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       k,
+                              hipblasComplex* A,
+                              const int       lda,
+                              hipblasComplex* ipiv,
+                              int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZungqr(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              const int             k,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* ipiv,
+                              int*                  info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCungqr_v2(hipblasHandle_t handle,
+                                 const int       m,
+                                 const int       n,
+                                 const int       k,
+                                 hipComplex*     A,
+                                 const int       lda,
+                                 hipComplex*     ipiv,
+                                 int*            info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZungqr_v2(hipblasHandle_t   handle,
+                                 const int         m,
+                                 const int         n,
+                                 const int         k,
+                                 hipDoubleComplex* A,
+                                 const int         lda,
+                                 hipDoubleComplex* ipiv,
+                                 int*              info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// orgqr_batched
+hipblasStatus_t hipblasSorgqrBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const int       k,
+                                     float* const    A[],
+                                     const int       lda,
+                                     float* const    ipiv[],
+                                     int*            info,
+                                     const int       batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDorgqrBatched(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const int       k,
+                                     double* const   A[],
+                                     const int       lda,
+                                     double* const   ipiv[],
+                                     int*            info,
+                                     const int       batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCungqrBatched(hipblasHandle_t       handle,
+                                     const int             m,
+                                     const int             n,
+                                     const int             k,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const ipiv[],
+                                     int*                  info,
+                                     const int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZungqrBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     const int                   k,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const ipiv[],
+                                     int*                        info,
+                                     const int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCungqrBatched_v2(hipblasHandle_t   handle,
+                                        const int         m,
+                                        const int         n,
+                                        const int         k,
+                                        hipComplex* const A[],
+                                        const int         lda,
+                                        hipComplex* const ipiv[],
+                                        int*              info,
+                                        const int         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZungqrBatched_v2(hipblasHandle_t         handle,
+                                        const int               m,
+                                        const int               n,
+                                        const int               k,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const ipiv[],
+                                        int*                    info,
+                                        const int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// orgqr_strided_batched
+hipblasStatus_t hipblasSorgqrStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDorgqrStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCungqrStridedBatched(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     ipiv,
+                                            const hipblasStride strideP,
+                                            int*                info,
+                                            const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZungqrStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            const int             k,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* ipiv,
+                                            const hipblasStride   strideP,
+                                            int*                  info,
+                                            const int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCungqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipComplex*         ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZungqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipDoubleComplex*   ipiv,
+                                               const hipblasStride strideP,
+                                               int*                info,
+                                               const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// ormqr
+hipblasStatus_t hipblasSormqr(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasOperation_t trans,
+                              const int          m,
+                              const int          n,
+                              const int          k,
+                              float*             A,
+                              const int          lda,
+                              float*             ipiv,
+                              float*             C,
+                              const int          ldc,
+                              int*               info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDormqr(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasOperation_t trans,
+                              const int          m,
+                              const int          n,
+                              const int          k,
+                              double*            A,
+                              const int          lda,
+                              double*            ipiv,
+                              double*            C,
+                              const int          ldc,
+                              int*               info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCunmqr(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasOperation_t trans,
+                              const int          m,
+                              const int          n,
+                              const int          k,
+                              hipblasComplex*    A,
+                              const int          lda,
+                              hipblasComplex*    ipiv,
+                              hipblasComplex*    C,
+                              const int          ldc,
+                              int*               info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZunmqr(hipblasHandle_t       handle,
+                              hipblasSideMode_t     side,
+                              hipblasOperation_t    trans,
+                              const int             m,
+                              const int             n,
+                              const int             k,
+                              hipblasDoubleComplex* A,
+                              const int             lda,
+                              hipblasDoubleComplex* ipiv,
+                              hipblasDoubleComplex* C,
+                              const int             ldc,
+                              int*                  info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCunmqr_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasOperation_t trans,
+                                 const int          m,
+                                 const int          n,
+                                 const int          k,
+                                 hipComplex*        A,
+                                 const int          lda,
+                                 hipComplex*        ipiv,
+                                 hipComplex*        C,
+                                 const int          ldc,
+                                 int*               info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZunmqr_v2(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasOperation_t trans,
+                                 const int          m,
+                                 const int          n,
+                                 const int          k,
+                                 hipDoubleComplex*  A,
+                                 const int          lda,
+                                 hipDoubleComplex*  ipiv,
+                                 hipDoubleComplex*  C,
+                                 const int          ldc,
+                                 int*               info)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// ormqr_batched
+hipblasStatus_t hipblasSormqrBatched(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     float* const       A[],
+                                     const int          lda,
+                                     float* const       ipiv[],
+                                     float* const       C[],
+                                     const int          ldc,
+                                     int*               info,
+                                     const int          batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDormqrBatched(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasOperation_t trans,
+                                     const int          m,
+                                     const int          n,
+                                     const int          k,
+                                     double* const      A[],
+                                     const int          lda,
+                                     double* const      ipiv[],
+                                     double* const      C[],
+                                     const int          ldc,
+                                     int*               info,
+                                     const int          batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCunmqrBatched(hipblasHandle_t       handle,
+                                     hipblasSideMode_t     side,
+                                     hipblasOperation_t    trans,
+                                     const int             m,
+                                     const int             n,
+                                     const int             k,
+                                     hipblasComplex* const A[],
+                                     const int             lda,
+                                     hipblasComplex* const ipiv[],
+                                     hipblasComplex* const C[],
+                                     const int             ldc,
+                                     int*                  info,
+                                     const int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZunmqrBatched(hipblasHandle_t             handle,
+                                     hipblasSideMode_t           side,
+                                     hipblasOperation_t          trans,
+                                     const int                   m,
+                                     const int                   n,
+                                     const int                   k,
+                                     hipblasDoubleComplex* const A[],
+                                     const int                   lda,
+                                     hipblasDoubleComplex* const ipiv[],
+                                     hipblasDoubleComplex* const C[],
+                                     const int                   ldc,
+                                     int*                        info,
+                                     const int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCunmqrBatched_v2(hipblasHandle_t    handle,
+                                        hipblasSideMode_t  side,
+                                        hipblasOperation_t trans,
+                                        const int          m,
+                                        const int          n,
+                                        const int          k,
+                                        hipComplex* const  A[],
+                                        const int          lda,
+                                        hipComplex* const  ipiv[],
+                                        hipComplex* const  C[],
+                                        const int          ldc,
+                                        int*               info,
+                                        const int          batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZunmqrBatched_v2(hipblasHandle_t         handle,
+                                        hipblasSideMode_t       side,
+                                        hipblasOperation_t      trans,
+                                        const int               m,
+                                        const int               n,
+                                        const int               k,
+                                        hipDoubleComplex* const A[],
+                                        const int               lda,
+                                        hipDoubleComplex* const ipiv[],
+                                        hipDoubleComplex* const C[],
+                                        const int               ldc,
+                                        int*                    info,
+                                        const int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// ormqr_strided_batched
+hipblasStatus_t hipblasSormqrStridedBatched(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasOperation_t  trans,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            float*              A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            float*              ipiv,
+                                            const hipblasStride strideP,
+                                            float*              C,
+                                            const int           ldc,
+                                            const hipblasStride strideC,
+                                            int*                info,
+                                            const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDormqrStridedBatched(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasOperation_t  trans,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            double*             A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            double*             ipiv,
+                                            const hipblasStride strideP,
+                                            double*             C,
+                                            const int           ldc,
+                                            const hipblasStride strideC,
+                                            int*                info,
+                                            const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCunmqrStridedBatched(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasOperation_t  trans,
+                                            const int           m,
+                                            const int           n,
+                                            const int           k,
+                                            hipblasComplex*     A,
+                                            const int           lda,
+                                            const hipblasStride strideA,
+                                            hipblasComplex*     ipiv,
+                                            const hipblasStride strideP,
+                                            hipblasComplex*     C,
+                                            const int           ldc,
+                                            const hipblasStride strideC,
+                                            int*                info,
+                                            const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZunmqrStridedBatched(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasOperation_t    trans,
+                                            const int             m,
+                                            const int             n,
+                                            const int             k,
+                                            hipblasDoubleComplex* A,
+                                            const int             lda,
+                                            const hipblasStride   strideA,
+                                            hipblasDoubleComplex* ipiv,
+                                            const hipblasStride   strideP,
+                                            hipblasDoubleComplex* C,
+                                            const int             ldc,
+                                            const hipblasStride   strideC,
+                                            int*                  info,
+                                            const int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCunmqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               hipblasSideMode_t   side,
+                                               hipblasOperation_t  trans,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipComplex*         A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipComplex*         ipiv,
+                                               const hipblasStride strideP,
+                                               hipComplex*         C,
+                                               const int           ldc,
+                                               const hipblasStride strideC,
+                                               int*                info,
+                                               const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZunmqrStridedBatched_v2(hipblasHandle_t     handle,
+                                               hipblasSideMode_t   side,
+                                               hipblasOperation_t  trans,
+                                               const int           m,
+                                               const int           n,
+                                               const int           k,
+                                               hipDoubleComplex*   A,
+                                               const int           lda,
+                                               const hipblasStride strideA,
+                                               hipDoubleComplex*   ipiv,
+                                               const hipblasStride strideP,
+                                               hipDoubleComplex*   C,
+                                               const int           ldc,
+                                               const hipblasStride strideC,
+                                               int*                info,
+                                               const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgesvIR(hipblasHandle_t handle,
+                               const int       n,
+                               const int       nrhs,
+                               double*         A,
+                               const int       lda,
+                               int*            ipiv,
+                               double*         B,
+                               const int       ldb,
+                               double*         X,
+                               const int       ldx,
+                               int*            iter,
+                               int*            info,
+                               int*            deviceInfo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgesvIRBatched(hipblasHandle_t handle,
+                                      const int       n,
+                                      const int       nrhs,
+                                      double* const   A[],
+                                      const int       lda,
+                                      int*            ipiv,
+                                      double* const   B[],
+                                      const int       ldb,
+                                      double* const   X[],
+                                      const int       ldx,
+                                      int*            iter,
+                                      int*            info,
+                                      int*            deviceInfo,
+                                      const int       batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasDgesvIRStridedBatched(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const int           nrhs,
+                                             double*             A,
+                                             const int           lda,
+                                             const hipblasStride strideA,
+                                             int*                ipiv,
+                                             const hipblasStride strideP,
+                                             double*             B,
+                                             const int           ldb,
+                                             const hipblasStride strideB,
+                                             double*             X,
+                                             const int           ldx,
+                                             const hipblasStride strideX,
+                                             int*                iter,
+                                             int*                info,
+                                             int*                deviceInfo,
+                                             const int           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
 #endif
 
 // gemm
@@ -34979,6 +36371,479 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+// gemm with a real operand
+hipblasStatus_t hipblasCgemmRealB(hipblasHandle_t       handle,
+                                  hipblasOperation_t    transa,
+                                  hipblasOperation_t    transb,
+                                  int                   m,
+                                  int                   n,
+                                  int                   k,
+                                  const hipblasComplex* alpha,
+                                  const hipblasComplex* A,
+                                  int                   lda,
+                                  const float*          B,
+                                  int                   ldb,
+                                  const hipblasComplex* beta,
+                                  hipblasComplex*       C,
+                                  int                   ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealB(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transa,
+                                  hipblasOperation_t          transb,
+                                  int                         m,
+                                  int                         n,
+                                  int                         k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const hipblasDoubleComplex* A,
+                                  int                         lda,
+                                  const double*               B,
+                                  int                         ldb,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       C,
+                                  int                         ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealA(hipblasHandle_t       handle,
+                                  hipblasOperation_t    transa,
+                                  hipblasOperation_t    transb,
+                                  int                   m,
+                                  int                   n,
+                                  int                   k,
+                                  const hipblasComplex* alpha,
+                                  const float*          A,
+                                  int                   lda,
+                                  const hipblasComplex* B,
+                                  int                   ldb,
+                                  const hipblasComplex* beta,
+                                  hipblasComplex*       C,
+                                  int                   ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealA(hipblasHandle_t             handle,
+                                  hipblasOperation_t          transa,
+                                  hipblasOperation_t          transb,
+                                  int                         m,
+                                  int                         n,
+                                  int                         k,
+                                  const hipblasDoubleComplex* alpha,
+                                  const double*               A,
+                                  int                         lda,
+                                  const hipblasDoubleComplex* B,
+                                  int                         ldb,
+                                  const hipblasDoubleComplex* beta,
+                                  hipblasDoubleComplex*       C,
+                                  int                         ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealB_v2(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const hipComplex*  alpha,
+                                     const hipComplex*  A,
+                                     int                lda,
+                                     const float*       B,
+                                     int                ldb,
+                                     const hipComplex*  beta,
+                                     hipComplex*        C,
+                                     int                ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealB_v2(hipblasHandle_t         handle,
+                                     hipblasOperation_t      transa,
+                                     hipblasOperation_t      transb,
+                                     int                     m,
+                                     int                     n,
+                                     int                     k,
+                                     const hipDoubleComplex* alpha,
+                                     const hipDoubleComplex* A,
+                                     int                     lda,
+                                     const double*           B,
+                                     int                     ldb,
+                                     const hipDoubleComplex* beta,
+                                     hipDoubleComplex*       C,
+                                     int                     ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealA_v2(hipblasHandle_t    handle,
+                                     hipblasOperation_t transa,
+                                     hipblasOperation_t transb,
+                                     int                m,
+                                     int                n,
+                                     int                k,
+                                     const hipComplex*  alpha,
+                                     const float*       A,
+                                     int                lda,
+                                     const hipComplex*  B,
+                                     int                ldb,
+                                     const hipComplex*  beta,
+                                     hipComplex*        C,
+                                     int                ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealA_v2(hipblasHandle_t         handle,
+                                     hipblasOperation_t      transa,
+                                     hipblasOperation_t      transb,
+                                     int                     m,
+                                     int                     n,
+                                     int                     k,
+                                     const hipDoubleComplex* alpha,
+                                     const double*           A,
+                                     int                     lda,
+                                     const hipDoubleComplex* B,
+                                     int                     ldb,
+                                     const hipDoubleComplex* beta,
+                                     hipDoubleComplex*       C,
+                                     int                     ldc)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealBBatched(hipblasHandle_t             handle,
+                                         hipblasOperation_t          transa,
+                                         hipblasOperation_t          transb,
+                                         int                         m,
+                                         int                         n,
+                                         int                         k,
+                                         const hipblasComplex*       alpha,
+                                         const hipblasComplex* const A[],
+                                         int                         lda,
+                                         const float* const          B[],
+                                         int                         ldb,
+                                         const hipblasComplex*       beta,
+                                         hipblasComplex* const       C[],
+                                         int                         ldc,
+                                         int                         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealBBatched(hipblasHandle_t                   handle,
+                                         hipblasOperation_t                transa,
+                                         hipblasOperation_t                transb,
+                                         int                               m,
+                                         int                               n,
+                                         int                               k,
+                                         const hipblasDoubleComplex*       alpha,
+                                         const hipblasDoubleComplex* const A[],
+                                         int                               lda,
+                                         const double* const               B[],
+                                         int                               ldb,
+                                         const hipblasDoubleComplex*       beta,
+                                         hipblasDoubleComplex* const       C[],
+                                         int                               ldc,
+                                         int                               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealABatched(hipblasHandle_t             handle,
+                                         hipblasOperation_t          transa,
+                                         hipblasOperation_t          transb,
+                                         int                         m,
+                                         int                         n,
+                                         int                         k,
+                                         const hipblasComplex*       alpha,
+                                         const float* const          A[],
+                                         int                         lda,
+                                         const hipblasComplex* const B[],
+                                         int                         ldb,
+                                         const hipblasComplex*       beta,
+                                         hipblasComplex* const       C[],
+                                         int                         ldc,
+                                         int                         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealABatched(hipblasHandle_t                   handle,
+                                         hipblasOperation_t                transa,
+                                         hipblasOperation_t                transb,
+                                         int                               m,
+                                         int                               n,
+                                         int                               k,
+                                         const hipblasDoubleComplex*       alpha,
+                                         const double* const               A[],
+                                         int                               lda,
+                                         const hipblasDoubleComplex* const B[],
+                                         int                               ldb,
+                                         const hipblasDoubleComplex*       beta,
+                                         hipblasDoubleComplex* const       C[],
+                                         int                               ldc,
+                                         int                               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealBBatched_v2(hipblasHandle_t         handle,
+                                            hipblasOperation_t      transa,
+                                            hipblasOperation_t      transb,
+                                            int                     m,
+                                            int                     n,
+                                            int                     k,
+                                            const hipComplex*       alpha,
+                                            const hipComplex* const A[],
+                                            int                     lda,
+                                            const float* const      B[],
+                                            int                     ldb,
+                                            const hipComplex*       beta,
+                                            hipComplex* const       C[],
+                                            int                     ldc,
+                                            int                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealBBatched_v2(hipblasHandle_t               handle,
+                                            hipblasOperation_t            transa,
+                                            hipblasOperation_t            transb,
+                                            int                           m,
+                                            int                           n,
+                                            int                           k,
+                                            const hipDoubleComplex*       alpha,
+                                            const hipDoubleComplex* const A[],
+                                            int                           lda,
+                                            const double* const           B[],
+                                            int                           ldb,
+                                            const hipDoubleComplex*       beta,
+                                            hipDoubleComplex* const       C[],
+                                            int                           ldc,
+                                            int                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealABatched_v2(hipblasHandle_t         handle,
+                                            hipblasOperation_t      transa,
+                                            hipblasOperation_t      transb,
+                                            int                     m,
+                                            int                     n,
+                                            int                     k,
+                                            const hipComplex*       alpha,
+                                            const float* const      A[],
+                                            int                     lda,
+                                            const hipComplex* const B[],
+                                            int                     ldb,
+                                            const hipComplex*       beta,
+                                            hipComplex* const       C[],
+                                            int                     ldc,
+                                            int                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealABatched_v2(hipblasHandle_t               handle,
+                                            hipblasOperation_t            transa,
+                                            hipblasOperation_t            transb,
+                                            int                           m,
+                                            int                           n,
+                                            int                           k,
+                                            const hipDoubleComplex*       alpha,
+                                            const double* const           A[],
+                                            int                           lda,
+                                            const hipDoubleComplex* const B[],
+                                            int                           ldb,
+                                            const hipDoubleComplex*       beta,
+                                            hipDoubleComplex* const       C[],
+                                            int                           ldc,
+                                            int                           batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealBStridedBatched(hipblasHandle_t       handle,
+                                                hipblasOperation_t    transa,
+                                                hipblasOperation_t    transb,
+                                                int                   m,
+                                                int                   n,
+                                                int                   k,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* A,
+                                                int                   lda,
+                                                hipblasStride         strideA,
+                                                const float*          B,
+                                                int                   ldb,
+                                                hipblasStride         strideB,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       C,
+                                                int                   ldc,
+                                                hipblasStride         strideC,
+                                                int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealBStridedBatched(hipblasHandle_t             handle,
+                                                hipblasOperation_t          transa,
+                                                hipblasOperation_t          transb,
+                                                int                         m,
+                                                int                         n,
+                                                int                         k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* A,
+                                                int                         lda,
+                                                hipblasStride               strideA,
+                                                const double*               B,
+                                                int                         ldb,
+                                                hipblasStride               strideB,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       C,
+                                                int                         ldc,
+                                                hipblasStride               strideC,
+                                                int                         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealAStridedBatched(hipblasHandle_t       handle,
+                                                hipblasOperation_t    transa,
+                                                hipblasOperation_t    transb,
+                                                int                   m,
+                                                int                   n,
+                                                int                   k,
+                                                const hipblasComplex* alpha,
+                                                const float*          A,
+                                                int                   lda,
+                                                hipblasStride         strideA,
+                                                const hipblasComplex* B,
+                                                int                   ldb,
+                                                hipblasStride         strideB,
+                                                const hipblasComplex* beta,
+                                                hipblasComplex*       C,
+                                                int                   ldc,
+                                                hipblasStride         strideC,
+                                                int                   batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealAStridedBatched(hipblasHandle_t             handle,
+                                                hipblasOperation_t          transa,
+                                                hipblasOperation_t          transb,
+                                                int                         m,
+                                                int                         n,
+                                                int                         k,
+                                                const hipblasDoubleComplex* alpha,
+                                                const double*               A,
+                                                int                         lda,
+                                                hipblasStride               strideA,
+                                                const hipblasDoubleComplex* B,
+                                                int                         ldb,
+                                                hipblasStride               strideB,
+                                                const hipblasDoubleComplex* beta,
+                                                hipblasDoubleComplex*       C,
+                                                int                         ldc,
+                                                hipblasStride               strideC,
+                                                int                         batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealBStridedBatched_v2(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const hipComplex*  alpha,
+                                                   const hipComplex*  A,
+                                                   int                lda,
+                                                   hipblasStride      strideA,
+                                                   const float*       B,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   const hipComplex*  beta,
+                                                   hipComplex*        C,
+                                                   int                ldc,
+                                                   hipblasStride      strideC,
+                                                   int                batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealBStridedBatched_v2(hipblasHandle_t         handle,
+                                                   hipblasOperation_t      transa,
+                                                   hipblasOperation_t      transb,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     k,
+                                                   const hipDoubleComplex* alpha,
+                                                   const hipDoubleComplex* A,
+                                                   int                     lda,
+                                                   hipblasStride           strideA,
+                                                   const double*           B,
+                                                   int                     ldb,
+                                                   hipblasStride           strideB,
+                                                   const hipDoubleComplex* beta,
+                                                   hipDoubleComplex*       C,
+                                                   int                     ldc,
+                                                   hipblasStride           strideC,
+                                                   int                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCgemmRealAStridedBatched_v2(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const hipComplex*  alpha,
+                                                   const float*       A,
+                                                   int                lda,
+                                                   hipblasStride      strideA,
+                                                   const hipComplex*  B,
+                                                   int                ldb,
+                                                   hipblasStride      strideB,
+                                                   const hipComplex*  beta,
+                                                   hipComplex*        C,
+                                                   int                ldc,
+                                                   hipblasStride      strideC,
+                                                   int                batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasZgemmRealAStridedBatched_v2(hipblasHandle_t         handle,
+                                                   hipblasOperation_t      transa,
+                                                   hipblasOperation_t      transb,
+                                                   int                     m,
+                                                   int                     n,
+                                                   int                     k,
+                                                   const hipDoubleComplex* alpha,
+                                                   const double*           A,
+                                                   int                     lda,
+                                                   hipblasStride           strideA,
+                                                   const hipDoubleComplex* B,
+                                                   int                     ldb,
+                                                   hipblasStride           strideB,
+                                                   const hipDoubleComplex* beta,
+                                                   hipDoubleComplex*       C,
+                                                   int                     ldc,
+                                                   hipblasStride           strideC,
+                                                   int                     batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
 // gemm_ex
 hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
                               hipblasOperation_t transa,
@@ -36100,6 +37965,192 @@ catch(...)
     return hipblas_exception_to_status();
 }
 
+hipblasStatus_t hipblasGemmBatchedReduceEx(hipblasHandle_t      handle,
+                                           hipblasOperation_t   transa,
+                                           hipblasOperation_t   transb,
+                                           int                  m,
+                                           int                  n,
+                                           int                  k,
+                                           const void*          alpha,
+                                           const void* const    A[],
+                                           hipDataType          a_type,
+                                           int                  lda,
+                                           const void* const    B[],
+                                           hipDataType          b_type,
+                                           int                  ldb,
+                                           const void*          beta,
+                                           void*                C,
+                                           hipDataType          c_type,
+                                           int                  ldc,
+                                           int                  batch_count,
+                                           hipblasComputeType_t compute_type,
+                                           hipblasGemmAlgo_t    algo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmStridedBatchedReduceEx(hipblasHandle_t      handle,
+                                                  hipblasOperation_t   transa,
+                                                  hipblasOperation_t   transb,
+                                                  int                  m,
+                                                  int                  n,
+                                                  int                  k,
+                                                  const void*          alpha,
+                                                  const void*          A,
+                                                  hipDataType          a_type,
+                                                  int                  lda,
+                                                  hipblasStride        stride_A,
+                                                  const void*          B,
+                                                  hipDataType          b_type,
+                                                  int                  ldb,
+                                                  hipblasStride        stride_B,
+                                                  const void*          beta,
+                                                  void*                C,
+                                                  hipDataType          c_type,
+                                                  int                  ldc,
+                                                  int                  batch_count,
+                                                  hipblasComputeType_t compute_type,
+                                                  hipblasGemmAlgo_t    algo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmIndexedEx(hipblasHandle_t      handle,
+                                     hipblasOperation_t   transa,
+                                     hipblasOperation_t   transb,
+                                     int                  m,
+                                     int                  n,
+                                     int                  k,
+                                     const void*          alpha,
+                                     const void*          A,
+                                     hipDataType          a_type,
+                                     int                  lda,
+                                     const int*           row_index_A,
+                                     const void*          B,
+                                     hipDataType          b_type,
+                                     int                  ldb,
+                                     const void*          beta,
+                                     void*                C,
+                                     hipDataType          c_type,
+                                     int                  ldc,
+                                     const int*           row_index_C,
+                                     hipblasComputeType_t compute_type,
+                                     hipblasGemmAlgo_t    algo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasGemmGroupedIndexedEx(hipblasHandle_t      handle,
+                                            hipblasOperation_t   transa,
+                                            hipblasOperation_t   transb,
+                                            int                  group_count,
+                                            const int*           group_rows,
+                                            int                  n,
+                                            int                  k,
+                                            const void*          alpha,
+                                            const void*          A,
+                                            hipDataType          a_type,
+                                            int                  lda,
+                                            const int*           row_index_A,
+                                            const void*          B,
+                                            hipDataType          b_type,
+                                            int                  ldb,
+                                            hipblasStride        stride_B,
+                                            const void*          beta,
+                                            void*                C,
+                                            hipDataType          c_type,
+                                            int                  ldc,
+                                            const int*           row_index_C,
+                                            hipblasComputeType_t compute_type,
+                                            hipblasGemmAlgo_t    algo)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// copy_ex
+hipblasStatus_t hipblasCopyEx(hipblasHandle_t handle,
+                              int             n,
+                              const void*     x,
+                              hipDataType     xType,
+                              int             incx,
+                              void*           y,
+                              hipDataType     yType,
+                              int             incy)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCopyBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void* const x[],
+                                     hipDataType       xType,
+                                     int               incx,
+                                     void* const       y[],
+                                     hipDataType       yType,
+                                     int               incy,
+                                     int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCopyStridedBatchedEx(hipblasHandle_t handle,
+                                            int             n,
+                                            const void*     x,
+                                            hipDataType     xType,
+                                            int             incx,
+                                            hipblasStride   stridex,
+                                            void*           y,
+                                            hipDataType     yType,
+                                            int             incy,
+                                            hipblasStride   stridey,
+                                            int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCopyMatrixEx(hipblasHandle_t handle,
+                                    int             m,
+                                    int             n,
+                                    const void*     A,
+                                    hipDataType     aType,
+                                    int             lda,
+                                    void*           B,
+                                    hipDataType     bType,
+                                    int             ldb)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCopyMatrixBatchedEx(hipblasHandle_t   handle,
+                                           int               m,
+                                           int               n,
+                                           const void* const A[],
+                                           hipDataType       aType,
+                                           int               lda,
+                                           void* const       B[],
+                                           hipDataType       bType,
+                                           int               ldb,
+                                           int               batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblasCopyMatrixStridedBatchedEx(hipblasHandle_t handle,
+                                                  int             m,
+                                                  int             n,
+                                                  const void*     A,
+                                                  hipDataType     aType,
+                                                  int             lda,
+                                                  hipblasStride   strideA,
+                                                  void*           B,
+                                                  hipDataType     bType,
+                                                  int             ldb,
+                                                  hipblasStride   strideB,
+                                                  int             batchCount)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
 // trsm_ex
 hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
                               hipblasSideMode_t  side,